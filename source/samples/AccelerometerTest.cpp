@@ -1,5 +1,16 @@
 #include "MicroBit.h"
 #include "Tests.h"
+#include "FrameBuffer.h"
+
+static FrameBuffer *frameBuffer = NULL;
+
+static FrameBuffer *getFrameBuffer()
+{
+    if (frameBuffer == NULL)
+        frameBuffer = new FrameBuffer(uBit.display);
+
+    return frameBuffer;
+}
 
 static void
 onCompassData(MicroBitEvent)
@@ -71,8 +82,10 @@ spirit_level2()
         ox = px;
         oy = py;
 
-        uBit.display.image.clear();
-        uBit.display.image.setPixelValue(px,py,255);
+        MicroBitImage &frame = getFrameBuffer()->image();
+        frame.clear();
+        frame.setPixelValue(px,py,255);
+        getFrameBuffer()->swap();
 
         uBit.sleep(100);
     }
@@ -94,8 +107,10 @@ spirit_level()
         int px = g_to_pix(x);
         int py = g_to_pix(y);
 
-        uBit.display.image.clear();
-        uBit.display.image.setPixelValue(px,py,255);
+        MicroBitImage &frame = getFrameBuffer()->image();
+        frame.clear();
+        frame.setPixelValue(px,py,255);
+        getFrameBuffer()->swap();
 
         uBit.sleep(100);
     }
@@ -0,0 +1,327 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AdaptiveRateOutput.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+// The output rates supported, lowest first.
+static const int adaptiveOutputRates[] = {11025, 16000, 22050, 32000, 44100};
+
+/**
+ * Creates an adaptive rate output stage.
+ * @param mixer the mixer to pull from. It should be configured with DATASTREAM_FORMAT_16BIT_UNSIGNED output.
+ */
+AdaptiveRateOutput::AdaptiveRateOutput(Mixer2 &mixer) : mixer(mixer)
+{
+    this->downstream = NULL;
+    this->minimumRate = adaptiveOutputRates[0];
+    this->sampleRate = 0;
+    this->top = 0;
+    this->adaptive = true;
+
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS; i++)
+        channels[i] = NULL;
+
+    cycle_counter_enable();
+    resetStatistics();
+
+    mixer.connect(*this);
+}
+
+/**
+ * Determine the lowest supported output rate that fits all the tracked channels, or the reference rate when not
+ * adaptive.
+ */
+int AdaptiveRateOutput::calculateSampleRate()
+{
+    if (!adaptive)
+        return ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE;
+
+    float required = minimumRate;
+
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS; i++)
+        if (channels[i] && channels[i]->getSampleRate() > required)
+            required = channels[i]->getSampleRate();
+
+    for (unsigned int i = 0; i < sizeof(adaptiveOutputRates) / sizeof(int); i++)
+        if (adaptiveOutputRates[i] >= required)
+            return adaptiveOutputRates[i];
+
+    return ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE;
+}
+
+/**
+ * Adds the time since modeStart to the statistics of the mode in use, and restarts the count.
+ */
+void AdaptiveRateOutput::updateTime()
+{
+    CODAL_TIMESTAMP now = system_timer_current_time_us();
+
+    totalTime[adaptive ? ADAPTIVE_RATE_OUTPUT_ADAPTIVE : ADAPTIVE_RATE_OUTPUT_FIXED] += now - modeStart;
+    modeStart = now;
+}
+
+/**
+ * Adds a channel to the mixer, and takes its sample rate into account when choosing the output rate.
+ * @param stream the source of the channel's audio.
+ * @param sampleRate the sample rate of the stream.
+ * @param sampleRange the range of the samples in the stream.
+ * @return the new MixerChannel, or NULL if the channel could not be added.
+ */
+MixerChannel *AdaptiveRateOutput::addChannel(DataSource &stream, float sampleRate, int sampleRange)
+{
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS; i++)
+    {
+        if (channels[i] == NULL)
+        {
+            channels[i] = mixer.addChannel(stream, sampleRate, sampleRange);
+            return channels[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Removes a channel added with addChannel(). The output rate drops, if it can, from the next buffer.
+ */
+int AdaptiveRateOutput::removeChannel(MixerChannel *channel)
+{
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS; i++)
+    {
+        if (channels[i] == channel)
+        {
+            channels[i] = NULL;
+            return mixer.removeChannel(channel);
+        }
+    }
+
+    return DEVICE_INVALID_PARAMETER;
+}
+
+/**
+ * Defines the lowest rate the output may run at. Channels added directly to the mixer (such as that of a
+ * SoundOutputPin) aren't tracked, so this should be high enough to carry them.
+ */
+int AdaptiveRateOutput::setMinimumSampleRate(int rate)
+{
+    if (rate <= 0 || rate > ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE)
+        return DEVICE_INVALID_PARAMETER;
+
+    minimumRate = rate;
+    return DEVICE_OK;
+}
+
+/**
+ * Chooses whether the output rate follows the channels, or stays at ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE. Either
+ * way the change takes effect from the next buffer.
+ * @param adaptive true to follow the channels (the default), false for a fixed rate.
+ */
+void AdaptiveRateOutput::setAdaptive(bool adaptive)
+{
+    target_disable_irq();
+    updateTime();
+    this->adaptive = adaptive;
+    target_enable_irq();
+}
+
+/**
+ * Provide the next available ManagedBuffer to our downstream caller, in PWM waveform format.
+ */
+ManagedBuffer AdaptiveRateOutput::pull()
+{
+    uint32_t start = cycle_counter_read();
+
+    // Change rate only between buffers, so that every sample in a buffer is mixed and scaled for the period it carries.
+    int rate = calculateSampleRate();
+
+    if (rate != sampleRate)
+    {
+        sampleRate = rate;
+        top = ADAPTIVE_RATE_OUTPUT_PWM_CLOCK / rate;
+
+        mixer.setSampleRate(rate);
+        mixer.setSampleRange(top);
+        rateChanges++;
+    }
+
+    ManagedBuffer in = mixer.pull();
+    int samples = in.length() / 2;
+
+    if (samples == 0)
+        return in;
+
+    ManagedBuffer out(samples * 8);
+    uint16_t *src = (uint16_t *) &in[0];
+    uint16_t *dst = (uint16_t *) &out[0];
+
+    for (int i = 0; i < samples; i++)
+    {
+        uint16_t s = *src++;
+
+        *dst++ = s;
+        *dst++ = s;
+        *dst++ = s;
+        *dst++ = top;
+    }
+
+    int mode = adaptive ? ADAPTIVE_RATE_OUTPUT_ADAPTIVE : ADAPTIVE_RATE_OUTPUT_FIXED;
+
+    totalCycles[mode] += cycle_counter_read() - start;
+    totalSamples[mode] += samples;
+
+    return out;
+}
+
+/**
+ * Callback provided by the mixer when data is ready.
+ */
+int AdaptiveRateOutput::pullRequest()
+{
+    if (downstream)
+        return downstream->pullRequest();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Define a downstream component for data stream.
+ * @sink The component that data will be delivered to, when it is available
+ */
+void AdaptiveRateOutput::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+/**
+ * Determines if this source is connected to a downstream component.
+ */
+bool AdaptiveRateOutput::isConnected()
+{
+    return downstream != NULL;
+}
+
+/**
+ * Disconnect any downstream component.
+ */
+void AdaptiveRateOutput::disconnect()
+{
+    downstream = NULL;
+}
+
+/**
+ * Determine the data format of the buffers streamed out of this component.
+ */
+int AdaptiveRateOutput::getFormat()
+{
+    return DATASTREAM_FORMAT_16BIT_UNSIGNED;
+}
+
+/**
+ * Defines the data format of the buffers streamed out of this component.
+ * Only DATASTREAM_FORMAT_16BIT_UNSIGNED is supported.
+ */
+int AdaptiveRateOutput::setFormat(int format)
+{
+    return format == DATASTREAM_FORMAT_16BIT_UNSIGNED ? DEVICE_OK : DEVICE_NOT_SUPPORTED;
+}
+
+/**
+ * Determine the rate the output is currently running at.
+ */
+float AdaptiveRateOutput::getSampleRate()
+{
+    return sampleRate ? sampleRate : calculateSampleRate();
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void AdaptiveRateOutput::resetStatistics()
+{
+    target_disable_irq();
+    rateChanges = 0;
+
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MODES; i++)
+    {
+        totalCycles[i] = 0;
+        totalSamples[i] = 0;
+        totalTime[i] = 0;
+    }
+
+    modeStart = system_timer_current_time_us();
+    target_enable_irq();
+}
+
+/**
+ * Output the rate, CPU load and estimated power gathered in each mode to the DMESG buffer, and the measured
+ * difference between the two if both have been used since the statistics were reset.
+ */
+void AdaptiveRateOutput::printStatistics()
+{
+    static const char *modeNames[ADAPTIVE_RATE_OUTPUT_MODES] = {"ADAPTIVE", "FIXED 44100 Hz"};
+    uint32_t cyclesPerSecond[ADAPTIVE_RATE_OUTPUT_MODES];
+    uint64_t cycles[ADAPTIVE_RATE_OUTPUT_MODES];
+    uint64_t time[ADAPTIVE_RATE_OUTPUT_MODES];
+    uint32_t samples[ADAPTIVE_RATE_OUTPUT_MODES];
+
+    target_disable_irq();
+    updateTime();
+
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MODES; i++)
+    {
+        cycles[i] = totalCycles[i];
+        time[i] = totalTime[i];
+        samples[i] = totalSamples[i];
+    }
+
+    target_enable_irq();
+
+    DMESG("ADAPTIVE_RATE_OUTPUT:");
+    DMESG("   RATE: %d Hz [CHANGES: %d]", sampleRate, rateChanges);
+
+    for (int i = 0; i < ADAPTIVE_RATE_OUTPUT_MODES; i++)
+    {
+        cyclesPerSecond[i] = time[i] ? (uint32_t)(cycles[i] * 1000000 / time[i]) : 0;
+
+        if (samples[i] == 0)
+            continue;
+
+        // CPU load in tenths of a percent, and the power it costs, both from the cycles spent per second of playback.
+        uint32_t load = (uint64_t)cyclesPerSecond[i] * 1000 / ADAPTIVE_RATE_OUTPUT_CPU_CLOCK;
+        uint32_t power = (uint64_t)cyclesPerSecond[i] * ADAPTIVE_RATE_OUTPUT_CPU_ACTIVE_UW / ADAPTIVE_RATE_OUTPUT_CPU_CLOCK;
+
+        DMESG("   %s: [TIME: %d ms] [SAMPLES: %d] [CYCLES/SAMPLE: %d]", modeNames[i], (int)(time[i] / 1000), samples[i], (int)(cycles[i] / samples[i]));
+        DMESG("      CYCLES/S: %d [CPU: %d.%d%%] [EST. POWER: %d uW]", cyclesPerSecond[i], load / 10, load % 10, power);
+    }
+
+    if (samples[ADAPTIVE_RATE_OUTPUT_ADAPTIVE] && samples[ADAPTIVE_RATE_OUTPUT_FIXED])
+    {
+        int saved = (int)cyclesPerSecond[ADAPTIVE_RATE_OUTPUT_FIXED] - (int)cyclesPerSecond[ADAPTIVE_RATE_OUTPUT_ADAPTIVE];
+        int power = (int)((int64_t)saved * ADAPTIVE_RATE_OUTPUT_CPU_ACTIVE_UW / ADAPTIVE_RATE_OUTPUT_CPU_CLOCK);
+
+        DMESG("   SAVED BY ADAPTING: %d cycles/s [EST. POWER: %d uW]", saved, power);
+    }
+}
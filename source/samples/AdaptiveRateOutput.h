@@ -0,0 +1,178 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MicroBit.h"
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef ADAPTIVE_RATE_OUTPUT_H
+#define ADAPTIVE_RATE_OUTPUT_H
+
+#define ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS       8
+#define ADAPTIVE_RATE_OUTPUT_PWM_CLOCK          16000000
+#define ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE     44100
+#define ADAPTIVE_RATE_OUTPUT_CPU_CLOCK          64000000
+
+// A rough figure for the power the CPU draws while running rather than sleeping, in microwatts: around 6mA from
+// 3.3V, for the nRF52833 running from flash at 64MHz through its LDO regulator. Used to estimate the power the audio
+// pipeline costs from the time the CPU spends in it.
+#define ADAPTIVE_RATE_OUTPUT_CPU_ACTIVE_UW      20000
+
+// Statistics are kept separately for each mode, so that the two can be compared on the same pipeline.
+#define ADAPTIVE_RATE_OUTPUT_ADAPTIVE           0
+#define ADAPTIVE_RATE_OUTPUT_FIXED              1
+#define ADAPTIVE_RATE_OUTPUT_MODES              2
+
+/**
+ * Sits between a Mixer2 and an NRF52PWM, and runs the pair at the lowest output rate that fits the active channels.
+ *
+ * Channels added through this component are tracked, and before each buffer is pulled from the mixer the output rate
+ * is set to the lowest of 11025, 16000, 22050, 32000 and 44100Hz that is at least the rate of every tracked channel.
+ * The mixer's cost is proportional to its output rate, so a mix of 16kHz clips should cost around a third of the CPU
+ * time it would at 44.1kHz. To measure what is actually saved, the output can be held at a fixed 44.1kHz with
+ * setAdaptive(false): the cycles spent in the pipeline (the mixer and everything it pulls from, as well as this
+ * component) and the time spent in each mode are kept apart, and printStatistics() compares the two.
+ *
+ * To switch rate without a glitch, the PWM must be used in waveform decoder mode (PWM_DECODER_LOAD_WaveForm). Each
+ * sample is then passed to the PWM with its own COUNTERTOP, so a rate change takes effect exactly at the first sample
+ * of the first buffer mixed at the new rate, regardless of how many buffers the PWM has queued. The same sample is
+ * written to PWM channels 0..2.
+ */
+class AdaptiveRateOutput : public DataSource, public DataSink
+{
+    Mixer2          &mixer;
+    DataSink        *downstream;
+    MixerChannel    *channels[ADAPTIVE_RATE_OUTPUT_MAX_CHANNELS];
+    int             minimumRate;
+    int             sampleRate;
+    uint16_t        top;
+    bool            adaptive;
+    uint32_t        rateChanges;
+
+    // Statistics for each mode. Time is counted from modeStart for the mode in use.
+    uint64_t        totalCycles[ADAPTIVE_RATE_OUTPUT_MODES];
+    uint32_t        totalSamples[ADAPTIVE_RATE_OUTPUT_MODES];
+    uint64_t        totalTime[ADAPTIVE_RATE_OUTPUT_MODES];
+    CODAL_TIMESTAMP modeStart;
+
+    /**
+     * Determine the lowest supported output rate that fits all the tracked channels, or the reference rate when not
+     * adaptive.
+     */
+    int calculateSampleRate();
+
+    /**
+     * Adds the time since modeStart to the statistics of the mode in use, and restarts the count.
+     */
+    void updateTime();
+
+    public:
+    /**
+     * Creates an adaptive rate output stage.
+     * @param mixer the mixer to pull from. It should be configured with DATASTREAM_FORMAT_16BIT_UNSIGNED output.
+     */
+    AdaptiveRateOutput(Mixer2 &mixer);
+
+    /**
+     * Adds a channel to the mixer, and takes its sample rate into account when choosing the output rate.
+     * @param stream the source of the channel's audio.
+     * @param sampleRate the sample rate of the stream.
+     * @param sampleRange the range of the samples in the stream.
+     * @return the new MixerChannel, or NULL if the channel could not be added.
+     */
+    MixerChannel *addChannel(DataSource &stream, float sampleRate, int sampleRange = 1023);
+
+    /**
+     * Removes a channel added with addChannel(). The output rate drops, if it can, from the next buffer.
+     */
+    int removeChannel(MixerChannel *channel);
+
+    /**
+     * Defines the lowest rate the output may run at. Channels added directly to the mixer (such as that of a
+     * SoundOutputPin) aren't tracked, so this should be high enough to carry them.
+     */
+    int setMinimumSampleRate(int rate);
+
+    /**
+     * Chooses whether the output rate follows the channels, or stays at ADAPTIVE_RATE_OUTPUT_REFERENCE_RATE. Either
+     * way the change takes effect from the next buffer.
+     * @param adaptive true to follow the channels (the default), false for a fixed rate.
+     */
+    void setAdaptive(bool adaptive);
+
+    /**
+     * Provide the next available ManagedBuffer to our downstream caller, in PWM waveform format.
+     */
+    virtual ManagedBuffer pull();
+
+    /**
+     * Callback provided by the mixer when data is ready.
+     */
+    virtual int pullRequest();
+
+    /**
+     * Define a downstream component for data stream.
+     * @sink The component that data will be delivered to, when it is available
+     */
+    virtual void connect(DataSink &sink);
+
+    /**
+     * Determines if this source is connected to a downstream component.
+     */
+    virtual bool isConnected();
+
+    /**
+     * Disconnect any downstream component.
+     */
+    virtual void disconnect();
+
+    /**
+     * Determine the data format of the buffers streamed out of this component.
+     */
+    virtual int getFormat();
+
+    /**
+     * Defines the data format of the buffers streamed out of this component.
+     * Only DATASTREAM_FORMAT_16BIT_UNSIGNED is supported.
+     */
+    virtual int setFormat(int format);
+
+    /**
+     * Determine the rate the output is currently running at.
+     */
+    virtual float getSampleRate();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the rate, CPU load and estimated power gathered in each mode to the DMESG buffer, and the measured
+     * difference between the two if both have been used since the statistics were reset.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,355 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AdpcmSource.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+static const int16_t adpcmStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t adpcmIndexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/**
+ * Creates a component that streams IMA ADPCM clips from flash.
+ * @param sampleRate the sample rate of the clips to be played.
+ * @param blockAlign the size in bytes of each ADPCM block, as given when the clips were encoded.
+ * @param id the ID to use for events raised by this component.
+ */
+AdpcmSource::AdpcmSource(float sampleRate, int blockAlign, uint16_t id)
+{
+    this->downstream = NULL;
+    this->id = id;
+    this->sampleRate = sampleRate;
+    this->blockAlign = blockAlign;
+    this->outputFormat = DATASTREAM_FORMAT_8BIT_UNSIGNED;
+    this->outputBufferSize = ADPCM_SOURCE_DEFAULT_BUFFER_SIZE;
+    this->clip = NULL;
+    this->in = NULL;
+    this->blockEnd = NULL;
+    this->clipEnd = NULL;
+    this->remaining = 0;
+    this->playing = false;
+
+    cycle_counter_enable();
+    resetStatistics();
+}
+
+/**
+ * Decodes up to the given number of samples into the given buffer, in the current output format.
+ * @return the number of samples decoded, which is less than requested only at the end of the clip.
+ */
+int AdpcmSource::decode(uint8_t *out, int samples)
+{
+    int decoded = 0;
+
+    // Never decode past the sample count, into the padding of the last block.
+    if ((uint32_t)samples > remaining)
+        samples = remaining;
+
+    // Hold the decoder state in locals, so the compiler can keep it in registers for the inner loop.
+    const uint8_t *p = in;
+    const uint8_t *end = blockEnd;
+    int s = predictor;
+    int index = stepIndex;
+    bool high = highNibble;
+
+    while (decoded < samples)
+    {
+        int sample;
+
+        if (p >= end)
+        {
+            // Start of a new block. The header holds the first sample verbatim, and resynchronises the step index.
+            if (p + 4 > clipEnd)
+                break;
+
+            s = (int16_t)(p[0] | (p[1] << 8));
+            index = min((int)p[2], 88);
+            end = (clipEnd - p > blockAlign) ? p + blockAlign : clipEnd;
+            p += 4;
+            high = false;
+            sample = s;
+        }
+        else
+        {
+            int nibble = high ? (*p++ >> 4) : (*p & 0x0F);
+            int step = adpcmStepTable[index];
+            int diff = step >> 3;
+
+            high = !high;
+
+            if (nibble & 4) diff += step;
+            if (nibble & 2) diff += step >> 1;
+            if (nibble & 1) diff += step >> 2;
+
+            s = (nibble & 8) ? s - diff : s + diff;
+            s = max(-32768, min(32767, s));
+
+            index = max(0, min(88, index + adpcmIndexTable[nibble & 7]));
+            sample = s;
+        }
+
+        if (outputFormat == DATASTREAM_FORMAT_8BIT_UNSIGNED)
+        {
+            *out++ = (uint8_t)((sample >> 8) + 128);
+        }
+        else
+        {
+            *(int16_t *)out = (int16_t)sample;
+            out += 2;
+        }
+
+        decoded++;
+    }
+
+    in = p;
+    blockEnd = end;
+    predictor = s;
+    stepIndex = index;
+    highNibble = high;
+    remaining -= decoded;
+
+    return decoded;
+}
+
+/**
+ * Provide the next available ManagedBuffer to our downstream caller, decoded from the current clip.
+ */
+ManagedBuffer AdpcmSource::pull()
+{
+    if (!playing)
+        return ManagedBuffer();
+
+    ManagedBuffer buffer(outputBufferSize * DATASTREAM_FORMAT_BYTES_PER_SAMPLE(outputFormat));
+
+    uint32_t start = cycle_counter_read();
+    int samples = decode(&buffer[0], outputBufferSize);
+    uint32_t cycles = cycle_counter_read() - start;
+
+    lastDecodeCycles = cycles;
+    if (cycles > maxDecodeCycles)
+        maxDecodeCycles = cycles;
+    totalDecodeCycles += cycles;
+    buffers++;
+
+    if (samples < outputBufferSize || remaining == 0)
+    {
+        // That was the last of the clip. Trim the final buffer, and let any blocked fibers know we're done.
+        playing = false;
+
+        if (samples < outputBufferSize)
+            buffer.truncate(samples * DATASTREAM_FORMAT_BYTES_PER_SAMPLE(outputFormat));
+
+        Event(id, ADPCM_SOURCE_EVT_PLAYBACK_COMPLETE);
+    }
+    else if (downstream)
+    {
+        // More data is available, so let our downstream component know it can pull again.
+        downstream->pullRequest();
+    }
+
+    return buffer;
+}
+
+/**
+ * Define a downstream component for data stream.
+ * @sink The component that data will be delivered to, when it is available
+ */
+void AdpcmSource::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+/**
+ * Determines if this source is connected to a downstream component.
+ */
+bool AdpcmSource::isConnected()
+{
+    return downstream != NULL;
+}
+
+/**
+ * Disconnect any downstream component.
+ */
+void AdpcmSource::disconnect()
+{
+    downstream = NULL;
+}
+
+/**
+ * Determine the data format of the buffers streamed out of this component.
+ */
+int AdpcmSource::getFormat()
+{
+    return outputFormat;
+}
+
+/**
+ * Defines the data format of the buffers streamed out of this component.
+ * @param format DATASTREAM_FORMAT_8BIT_UNSIGNED (default) or DATASTREAM_FORMAT_16BIT_SIGNED.
+ * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+ */
+int AdpcmSource::setFormat(int format)
+{
+    if (format != DATASTREAM_FORMAT_8BIT_UNSIGNED && format != DATASTREAM_FORMAT_16BIT_SIGNED)
+        return DEVICE_NOT_SUPPORTED;
+
+    outputFormat = format;
+    return DEVICE_OK;
+}
+
+/**
+ * Determine the sample rate of the clips played by this component.
+ */
+float AdpcmSource::getSampleRate()
+{
+    return sampleRate;
+}
+
+/**
+ * Defines the number of samples decoded into each buffer streamed out of this component.
+ * @param size the number of samples per buffer.
+ */
+int AdpcmSource::setBufferSize(int size)
+{
+    if (size <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    outputBufferSize = size;
+    return DEVICE_OK;
+}
+
+/**
+ * Begins playback of the given compressed clip, and returns immediately.
+ * Any clip already being played is stopped.
+ * @param data the compressed clip, starting with its sample count, typically a const array held in flash.
+ * @param length the length of the compressed clip, in bytes, including the sample count.
+ */
+void AdpcmSource::playAsync(const uint8_t *data, int length)
+{
+    // The sample count, then the blocks.
+    uint32_t count = length >= 4 ? data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24) : 0;
+
+    target_disable_irq();
+    clip = data;
+    in = data + 4;
+    blockEnd = in;
+    clipEnd = data + length;
+    remaining = count;
+    predictor = 0;
+    stepIndex = 0;
+    highNibble = false;
+    playing = length >= 8 && count > 0;
+    target_enable_irq();
+
+    if (playing && downstream)
+        downstream->pullRequest();
+}
+
+/**
+ * Plays the given compressed clip, blocking the calling fiber until playback is complete.
+ * @param data the compressed clip, starting with its sample count, typically a const array held in flash.
+ * @param length the length of the compressed clip, in bytes, including the sample count.
+ */
+void AdpcmSource::play(const uint8_t *data, int length)
+{
+    playAsync(data, length);
+
+    if (playing)
+        fiber_wait_for_event(id, ADPCM_SOURCE_EVT_PLAYBACK_COMPLETE);
+}
+
+/**
+ * Stops any clip currently being played.
+ */
+void AdpcmSource::stop()
+{
+    if (playing)
+    {
+        playing = false;
+        Event(id, ADPCM_SOURCE_EVT_PLAYBACK_COMPLETE);
+    }
+}
+
+/**
+ * Determines if a clip is currently being played.
+ */
+bool AdpcmSource::isPlaying()
+{
+    return playing;
+}
+
+/**
+ * Returns the number of CPU cycles taken to decode the last buffer.
+ */
+uint32_t AdpcmSource::getLastDecodeCycles()
+{
+    return lastDecodeCycles;
+}
+
+/**
+ * Returns the largest number of CPU cycles taken to decode a buffer, since the statistics were last reset.
+ */
+uint32_t AdpcmSource::getMaxDecodeCycles()
+{
+    return maxDecodeCycles;
+}
+
+/**
+ * Returns the mean number of CPU cycles taken to decode a buffer, since the statistics were last reset.
+ */
+uint32_t AdpcmSource::getAverageDecodeCycles()
+{
+    return buffers ? totalDecodeCycles / buffers : 0;
+}
+
+/**
+ * Reset the decode statistics gathered.
+ */
+void AdpcmSource::resetStatistics()
+{
+    lastDecodeCycles = 0;
+    maxDecodeCycles = 0;
+    totalDecodeCycles = 0;
+    buffers = 0;
+}
+
+/**
+ * Output the decode statistics gathered to the DMESG buffer.
+ */
+void AdpcmSource::printStatistics()
+{
+    DMESG("ADPCM_SOURCE:");
+    DMESG("   BUFFERS: %d [%d samples]", buffers, outputBufferSize);
+    DMESG("   CYCLES/BUFFER: [LAST: %d] [AVG: %d] [MAX: %d]", lastDecodeCycles, getAverageDecodeCycles(), maxDecodeCycles);
+    DMESG("   CYCLES/SAMPLE: %d", getAverageDecodeCycles() / outputBufferSize);
+}
@@ -0,0 +1,187 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MicroBit.h"
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef ADPCM_SOURCE_H
+#define ADPCM_SOURCE_H
+
+#define ADPCM_SOURCE_ID                         3100
+
+#define ADPCM_SOURCE_EVT_PLAYBACK_COMPLETE      1
+
+#define ADPCM_SOURCE_DEFAULT_BLOCK_ALIGN        256
+#define ADPCM_SOURCE_DEFAULT_BUFFER_SIZE        256
+#define ADPCM_SOURCE_DEFAULT_SAMPLE_RATE        16000
+
+/**
+ * A DataSource that plays IMA ADPCM compressed clips directly from flash.
+ *
+ * Clips are decoded a buffer at a time, as they are pulled by the downstream component (typically a MixerChannel),
+ * so only one output buffer of RAM is ever used, regardless of the length of the clip. Compressed clips are a quarter
+ * of the size of 16 bit PCM (and half the size of the 8 bit PCM used by MemorySource), and can be generated from
+ * WAV files with utils/adpcm_encode.py.
+ *
+ * A clip starts with the number of samples in it, as four bytes little endian. The rest is laid out as a mono WAV IMA
+ * ADPCM data chunk: a sequence of blocks of 'blockAlign' bytes, each holding a four byte header (first sample, step
+ * index) followed by two samples per byte, low nibble first. Decoding stops at the sample count, so the padding
+ * nibble at the end of a clip with an even number of samples in its last block is never played.
+ */
+class AdpcmSource : public DataSource
+{
+    DataSink        *downstream;
+    uint16_t        id;
+    int             outputFormat;
+    int             outputBufferSize;
+    int             blockAlign;
+    float           sampleRate;
+
+    const uint8_t   *clip;                  // The compressed clip being played (in flash)
+    const uint8_t   *in;                    // The next byte of compressed data to decode
+    const uint8_t   *blockEnd;              // The end of the block currently being decoded
+    const uint8_t   *clipEnd;               // The end of the compressed clip
+    uint32_t        remaining;              // The number of samples still to be decoded
+    int             predictor;              // The last decoded sample
+    int             stepIndex;              // The current position in the ADPCM step table
+    bool            highNibble;             // Set when the next sample is held in the high nibble of *in
+    volatile bool   playing;
+
+    uint32_t        lastDecodeCycles;
+    uint32_t        maxDecodeCycles;
+    uint32_t        totalDecodeCycles;
+    uint32_t        buffers;
+
+    /**
+     * Decodes up to the given number of samples into the given buffer, in the current output format.
+     * @return the number of samples decoded, which is less than requested only at the end of the clip.
+     */
+    int decode(uint8_t *out, int samples);
+
+    public:
+    /**
+     * Creates a component that streams IMA ADPCM clips from flash.
+     * @param sampleRate the sample rate of the clips to be played.
+     * @param blockAlign the size in bytes of each ADPCM block, as given when the clips were encoded.
+     * @param id the ID to use for events raised by this component.
+     */
+    AdpcmSource(float sampleRate = ADPCM_SOURCE_DEFAULT_SAMPLE_RATE, int blockAlign = ADPCM_SOURCE_DEFAULT_BLOCK_ALIGN, uint16_t id = ADPCM_SOURCE_ID);
+
+    /**
+     * Provide the next available ManagedBuffer to our downstream caller, decoded from the current clip.
+     */
+    virtual ManagedBuffer pull();
+
+    /**
+     * Define a downstream component for data stream.
+     * @sink The component that data will be delivered to, when it is available
+     */
+    virtual void connect(DataSink &sink);
+
+    /**
+     * Determines if this source is connected to a downstream component.
+     */
+    virtual bool isConnected();
+
+    /**
+     * Disconnect any downstream component.
+     */
+    virtual void disconnect();
+
+    /**
+     * Determine the data format of the buffers streamed out of this component.
+     */
+    virtual int getFormat();
+
+    /**
+     * Defines the data format of the buffers streamed out of this component.
+     * @param format DATASTREAM_FORMAT_8BIT_UNSIGNED (default) or DATASTREAM_FORMAT_16BIT_SIGNED.
+     * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+     */
+    virtual int setFormat(int format);
+
+    /**
+     * Determine the sample rate of the clips played by this component.
+     */
+    virtual float getSampleRate();
+
+    /**
+     * Defines the number of samples decoded into each buffer streamed out of this component.
+     * @param size the number of samples per buffer.
+     */
+    int setBufferSize(int size);
+
+    /**
+     * Begins playback of the given compressed clip, and returns immediately.
+     * Any clip already being played is stopped.
+     * @param data the compressed clip, starting with its sample count, typically a const array held in flash.
+     * @param length the length of the compressed clip, in bytes, including the sample count.
+     */
+    void playAsync(const uint8_t *data, int length);
+
+    /**
+     * Plays the given compressed clip, blocking the calling fiber until playback is complete.
+     * @param data the compressed clip, starting with its sample count, typically a const array held in flash.
+     * @param length the length of the compressed clip, in bytes, including the sample count.
+     */
+    void play(const uint8_t *data, int length);
+
+    /**
+     * Stops any clip currently being played.
+     */
+    void stop();
+
+    /**
+     * Determines if a clip is currently being played.
+     */
+    bool isPlaying();
+
+    /**
+     * Returns the number of CPU cycles taken to decode the last buffer.
+     */
+    uint32_t getLastDecodeCycles();
+
+    /**
+     * Returns the largest number of CPU cycles taken to decode a buffer, since the statistics were last reset.
+     */
+    uint32_t getMaxDecodeCycles();
+
+    /**
+     * Returns the mean number of CPU cycles taken to decode a buffer, since the statistics were last reset.
+     */
+    uint32_t getAverageDecodeCycles();
+
+    /**
+     * Reset the decode statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the decode statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,248 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "AnalogScanSource.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+/**
+ * Callback provided when data is ready.
+ */
+int AnalogScanChannel::pullRequest()
+{
+    // A channel that delivers again before the others have caught up loses its last buffer.
+    if (ready)
+        owner->overruns++;
+    else
+        owner->ready++;
+
+    buffer = upstream->pull();
+    ready = true;
+
+    owner->interleave();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Creates an interleaved source from the given analog pins, and starts sampling them.
+ * @param adc the ADC to use, typically uBit.adc.
+ * @param pins the pins to sample, which must be analog capable.
+ * @param count the number of pins, up to ANALOG_SCAN_SOURCE_MAX_CHANNELS.
+ */
+AnalogScanSource::AnalogScanSource(NRF52ADC &adc, Pin **pins, int count) : adc(adc)
+{
+    this->downstream = NULL;
+    this->count = min(count, ANALOG_SCAN_SOURCE_MAX_CHANNELS);
+    this->ready = 0;
+
+    cycle_counter_enable();
+    resetStatistics();
+
+    for (int i = 0; i < this->count; i++)
+    {
+        this->pins[i] = pins[i];
+
+        channels[i].owner = this;
+        channels[i].ready = false;
+        channels[i].upstream = &adc.getChannel(*pins[i])->output;
+        channels[i].upstream->connect(channels[i]);
+    }
+}
+
+/**
+ * Stops sampling the pins, and releases them.
+ */
+AnalogScanSource::~AnalogScanSource()
+{
+    for (int i = 0; i < count; i++)
+    {
+        channels[i].upstream->disconnect();
+        adc.releaseChannel(*pins[i]);
+    }
+}
+
+/**
+ * Interleaves the buffers held by each channel, once all have one, and lets our downstream component know.
+ */
+void AnalogScanSource::interleave()
+{
+    if (ready < count)
+        return;
+
+    uint32_t start = cycle_counter_read();
+    int bytes = DATASTREAM_FORMAT_BYTES_PER_SAMPLE(getFormat());
+    int samples = channels[0].buffer.length() / bytes;
+
+    // The channels are split from the same DMA buffers, so should always match. Just in case, use the shortest.
+    for (int c = 1; c < count; c++)
+        samples = min(samples, channels[c].buffer.length() / bytes);
+
+    ManagedBuffer out(samples * count * bytes);
+    uint8_t *dst = &out[0];
+
+    for (int c = 0; c < count; c++)
+    {
+        uint8_t *src = &channels[c].buffer[0];
+        uint8_t *d = dst + c * bytes;
+
+        if (bytes == 2)
+        {
+            for (int s = 0; s < samples; s++, d += count * 2)
+                *(uint16_t *)d = ((uint16_t *)src)[s];
+        }
+        else
+        {
+            for (int s = 0; s < samples; s++, d += count * bytes, src += bytes)
+                memcpy(d, src, bytes);
+        }
+
+        channels[c].buffer = ManagedBuffer();
+        channels[c].ready = false;
+    }
+
+    ready = 0;
+
+    // Our downstream component hasn't pulled the last buffer, so it is replaced.
+    if (output.length())
+        overruns++;
+
+    output = out;
+    buffers++;
+    interleaveCycles += cycle_counter_read() - start;
+
+    if (downstream)
+        downstream->pullRequest();
+}
+
+/**
+ * Defines the rate at which every channel is sampled.
+ * @param rate the sample rate of each channel, in Hz.
+ */
+int AnalogScanSource::setSampleRate(int rate)
+{
+    if (rate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    return adc.setSamplePeriod(1000000 / rate);
+}
+
+/**
+ * Determines the number of channels interleaved in each buffer.
+ */
+int AnalogScanSource::getChannels()
+{
+    return count;
+}
+
+/**
+ * Provide the next interleaved buffer to our downstream caller.
+ */
+ManagedBuffer AnalogScanSource::pull()
+{
+    ManagedBuffer b = output;
+    output = ManagedBuffer();
+
+    return b;
+}
+
+/**
+ * Define a downstream component for data stream.
+ * @sink The component that data will be delivered to, when it is available
+ */
+void AnalogScanSource::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+/**
+ * Determines if this source is connected to a downstream component.
+ */
+bool AnalogScanSource::isConnected()
+{
+    return downstream != NULL;
+}
+
+/**
+ * Disconnect any downstream component.
+ */
+void AnalogScanSource::disconnect()
+{
+    downstream = NULL;
+}
+
+/**
+ * Determine the data format of the buffers streamed out of this component, which is that of the ADC channels.
+ */
+int AnalogScanSource::getFormat()
+{
+    return count ? channels[0].upstream->getFormat() : DATASTREAM_FORMAT_UNKNOWN;
+}
+
+/**
+ * Defines the data format of the buffers streamed out of this component, by setting that of every ADC channel.
+ * @param format the format of each sample.
+ */
+int AnalogScanSource::setFormat(int format)
+{
+    for (int c = 0; c < count; c++)
+    {
+        int result = channels[c].upstream->setFormat(format);
+
+        if (result != DEVICE_OK)
+            return result;
+    }
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determine the rate at which each channel is sampled.
+ */
+float AnalogScanSource::getSampleRate()
+{
+    return 1000000.0f / adc.getSamplePeriod();
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void AnalogScanSource::resetStatistics()
+{
+    buffers = 0;
+    overruns = 0;
+    interleaveCycles = 0;
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void AnalogScanSource::printStatistics()
+{
+    DMESG("ANALOG_SCAN_SOURCE: [CHANNELS: %d] [RATE: %d Hz]", count, (int)getSampleRate());
+    DMESG("   BUFFERS: %d", buffers);
+    DMESG("   OVERRUNS: %d", overruns);
+    DMESG("   CYCLES/BUFFER: %d", buffers ? interleaveCycles / buffers : 0);
+}
@@ -0,0 +1,161 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef ANALOG_SCAN_SOURCE_H
+#define ANALOG_SCAN_SOURCE_H
+
+#define ANALOG_SCAN_SOURCE_MAX_CHANNELS         8
+#define ANALOG_SCAN_SOURCE_DEFAULT_RATE         10000
+
+class AnalogScanSource;
+
+/**
+ * Receives the buffers of one ADC channel on behalf of an AnalogScanSource.
+ */
+class AnalogScanChannel : public DataSink
+{
+    public:
+    AnalogScanSource    *owner;
+    DataSource          *upstream;
+    ManagedBuffer       buffer;
+    bool                ready;
+
+    /**
+     * Callback provided when data is ready.
+     */
+    virtual int pullRequest();
+};
+
+/**
+ * A DataSource that samples several analog pins together, and delivers them as one interleaved stream.
+ *
+ * Sampling is done by the system ADC (uBit.adc), which already runs the SAADC in scan mode, converting every active
+ * channel on each tick of a hardware timer straight into a pair of EasyDMA buffers, and splitting each completed DMA
+ * buffer between the channels, in interrupt context. This component collects the buffer from each channel as it is
+ * split out, and once every channel has delivered, interleaves them into a single buffer (channel 0, channel 1, ...
+ * for each sample period) and passes it downstream, so any streaming sink can consume every channel at once.
+ *
+ * The ADC has a single sample rate, which is shared with anything else using it (such as the microphone).
+ */
+class AnalogScanSource : public DataSource
+{
+    NRF52ADC            &adc;
+    DataSink            *downstream;
+    Pin                 *pins[ANALOG_SCAN_SOURCE_MAX_CHANNELS];
+    AnalogScanChannel   channels[ANALOG_SCAN_SOURCE_MAX_CHANNELS];
+    int                 count;
+    int                 ready;              // The number of channels holding a buffer not yet interleaved.
+    ManagedBuffer       output;
+
+    // Statistics.
+    uint32_t            buffers;
+    uint32_t            overruns;
+    uint32_t            interleaveCycles;
+
+    /**
+     * Interleaves the buffers held by each channel, once all have one, and lets our downstream component know.
+     */
+    void interleave();
+
+    friend class AnalogScanChannel;
+
+    public:
+    /**
+     * Creates an interleaved source from the given analog pins, and starts sampling them.
+     * @param adc the ADC to use, typically uBit.adc.
+     * @param pins the pins to sample, which must be analog capable.
+     * @param count the number of pins, up to ANALOG_SCAN_SOURCE_MAX_CHANNELS.
+     */
+    AnalogScanSource(NRF52ADC &adc, Pin **pins, int count);
+
+    /**
+     * Stops sampling the pins, and releases them.
+     */
+    ~AnalogScanSource();
+
+    /**
+     * Defines the rate at which every channel is sampled.
+     * @param rate the sample rate of each channel, in Hz.
+     */
+    int setSampleRate(int rate);
+
+    /**
+     * Determines the number of channels interleaved in each buffer.
+     */
+    int getChannels();
+
+    /**
+     * Provide the next interleaved buffer to our downstream caller.
+     */
+    virtual ManagedBuffer pull();
+
+    /**
+     * Define a downstream component for data stream.
+     * @sink The component that data will be delivered to, when it is available
+     */
+    virtual void connect(DataSink &sink);
+
+    /**
+     * Determines if this source is connected to a downstream component.
+     */
+    virtual bool isConnected();
+
+    /**
+     * Disconnect any downstream component.
+     */
+    virtual void disconnect();
+
+    /**
+     * Determine the data format of the buffers streamed out of this component, which is that of the ADC channels.
+     */
+    virtual int getFormat();
+
+    /**
+     * Defines the data format of the buffers streamed out of this component, by setting that of every ADC channel.
+     * @param format the format of each sample.
+     */
+    virtual int setFormat(int format);
+
+    /**
+     * Determine the rate at which each channel is sampled.
+     */
+    virtual float getSampleRate();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,234 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "AnimationEngine.h"
+#include "Tests.h"
+
+/**
+ * Creates an animation engine.
+ * @param display the display to animate.
+ * @param id the ID to use for events raised by this component.
+ */
+AnimationEngine::AnimationEngine(MicroBitDisplay &display, uint16_t id) : display(display)
+{
+    this->id = id;
+    this->frames = NULL;
+    this->durations = NULL;
+    this->frameMs = 0;
+    this->length = 0;
+    this->position = 0;
+    this->repeat = 1;
+    this->iteration = 0;
+    this->deadline = 0;
+    this->playing = false;
+
+    resetStatistics();
+
+    uBit.messageBus.listen(id, ANIMATION_ENGINE_EVT_FRAME, this, &AnimationEngine::onFrame, MESSAGE_BUS_LISTENER_IMMEDIATE);
+}
+
+/**
+ * Shows the next frame and schedules the one after it, or completes the animation if there are no more frames.
+ * @param now the current system time, in microseconds.
+ */
+void AnimationEngine::showNextFrame(CODAL_TIMESTAMP now)
+{
+    if (position >= length)
+    {
+        iteration++;
+
+        if (repeat != ANIMATION_ENGINE_REPEAT_FOREVER && iteration >= repeat)
+        {
+            playing = false;
+            Event(id, ANIMATION_ENGINE_EVT_COMPLETE);
+            return;
+        }
+
+        position = 0;
+    }
+
+    // The display refresh reads this buffer directly, so the frame appears on the next row scan.
+    memcpy(display.image.getBitmap(), frames[position].data, 25);
+
+    deadline += (CODAL_TIMESTAMP)(durations ? durations[position] : frameMs) * 1000;
+    position++;
+
+    // If we're already past the next deadline, show the next frame as soon as possible rather than skipping it.
+    system_timer_event_after_us(deadline > now ? deadline - now : 1, id, ANIMATION_ENGINE_EVT_FRAME);
+}
+
+/**
+ * Timer event handler, which records how late the frame is against its schedule then shows it.
+ */
+void AnimationEngine::onFrame(MicroBitEvent)
+{
+    if (!playing)
+        return;
+
+    CODAL_TIMESTAMP now = system_timer_current_time_us();
+    int lateness = (int)((int64_t)now - (int64_t)deadline);
+
+    if (framesShown == 0 || lateness < latenessMin)
+        latenessMin = lateness;
+
+    if (framesShown == 0 || lateness > latenessMax)
+        latenessMax = lateness;
+
+    latenessTotal += lateness;
+    framesShown++;
+
+    showNextFrame(now);
+}
+
+/**
+ * Begins playback of an animation in which every frame is shown for the same time, and returns immediately.
+ * Any animation already being played is stopped.
+ * @param frames the frames to show. These must remain valid until playback completes.
+ * @param length the number of frames.
+ * @param frameMs the time each frame is shown for, in milliseconds.
+ * @param repeat the number of times to play the animation, or ANIMATION_ENGINE_REPEAT_FOREVER.
+ */
+int AnimationEngine::playAsync(const ImageLiteral<5, 5> *frames, int length, int frameMs, int repeat)
+{
+    if (frameMs <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->frameMs = frameMs;
+    return playAsync(frames, (const uint16_t *)NULL, length, repeat);
+}
+
+/**
+ * Begins playback of an animation with a duration for each frame, and returns immediately.
+ * Any animation already being played is stopped.
+ * @param frames the frames to show. These must remain valid until playback completes.
+ * @param durations the time each frame is shown for, in milliseconds. These must remain valid until playback completes.
+ * @param length the number of frames.
+ * @param repeat the number of times to play the animation, or ANIMATION_ENGINE_REPEAT_FOREVER.
+ */
+int AnimationEngine::playAsync(const ImageLiteral<5, 5> *frames, const uint16_t *durations, int length, int repeat)
+{
+    if (frames == NULL || length <= 0 || repeat < 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    if (display.image.getWidth() != 5 || display.image.getHeight() != 5)
+        return DEVICE_NOT_SUPPORTED;
+
+    stop();
+
+    // Anything the display is animating itself would overwrite our frames.
+    display.stopAnimation();
+
+    this->frames = frames;
+    this->durations = durations;
+    this->length = length;
+    this->repeat = repeat;
+    this->position = 0;
+    this->iteration = 0;
+    this->playing = true;
+
+    target_disable_irq();
+    deadline = system_timer_current_time_us();
+    showNextFrame(deadline);
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Plays an animation in which every frame is shown for the same time, blocking the calling fiber until it completes.
+ * @param frames the frames to show.
+ * @param length the number of frames.
+ * @param frameMs the time each frame is shown for, in milliseconds.
+ */
+int AnimationEngine::play(const ImageLiteral<5, 5> *frames, int length, int frameMs)
+{
+    int result = playAsync(frames, length, frameMs);
+
+    if (result == DEVICE_OK && playing)
+        fiber_wait_for_event(id, ANIMATION_ENGINE_EVT_COMPLETE);
+
+    return result;
+}
+
+/**
+ * Plays an animation with a duration for each frame, blocking the calling fiber until it completes.
+ * @param frames the frames to show.
+ * @param durations the time each frame is shown for, in milliseconds.
+ * @param length the number of frames.
+ */
+int AnimationEngine::play(const ImageLiteral<5, 5> *frames, const uint16_t *durations, int length)
+{
+    int result = playAsync(frames, durations, length);
+
+    if (result == DEVICE_OK && playing)
+        fiber_wait_for_event(id, ANIMATION_ENGINE_EVT_COMPLETE);
+
+    return result;
+}
+
+/**
+ * Stops any animation currently being played, leaving the current frame on the display.
+ */
+void AnimationEngine::stop()
+{
+    if (!playing)
+        return;
+
+    playing = false;
+    system_timer_cancel_event(id, ANIMATION_ENGINE_EVT_FRAME);
+
+    Event(id, ANIMATION_ENGINE_EVT_COMPLETE);
+}
+
+/**
+ * Determines if an animation is currently being played.
+ */
+bool AnimationEngine::isPlaying()
+{
+    return playing;
+}
+
+/**
+ * Clears the frame timing statistics.
+ */
+void AnimationEngine::resetStatistics()
+{
+    framesShown = 0;
+    latenessMin = 0;
+    latenessMax = 0;
+    latenessTotal = 0;
+}
+
+/**
+ * Output the frame timing statistics gathered to the DMESG buffer.
+ */
+void AnimationEngine::printStatistics()
+{
+    int mean = framesShown ? (int)(latenessTotal / framesShown) : 0;
+
+    DMESG("ANIMATION_ENGINE: [FRAMES: %d]", framesShown);
+    DMESG("   LATENESS: MIN %d us, MEAN %d us, MAX %d us", latenessMin, mean, latenessMax);
+    DMESG("   JITTER: %d us", latenessMax - latenessMin);
+}
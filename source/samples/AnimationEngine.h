@@ -0,0 +1,145 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "ImageLiteral.h"
+
+#ifndef ANIMATION_ENGINE_H
+#define ANIMATION_ENGINE_H
+
+#define ANIMATION_ENGINE_ID                     3102
+
+#define ANIMATION_ENGINE_EVT_FRAME              1
+#define ANIMATION_ENGINE_EVT_COMPLETE           2
+
+#define ANIMATION_ENGINE_REPEAT_FOREVER         0
+
+/**
+ * Plays animations held as arrays of 5x5 image literals on the LED matrix, without involving a fiber.
+ *
+ * Each frame is shown by a system timer event, handled in interrupt context, which copies the frame straight into the
+ * image buffer the display refresh reads from and schedules the next frame. Frames are scheduled against the start of
+ * the animation rather than the previous frame, so latency on one frame never pushes the rest of the animation later.
+ * The lateness of every frame against its schedule is recorded, so that the jitter can be reported.
+ *
+ * An ANIMATION_ENGINE_EVT_COMPLETE event is raised once the last frame has been shown for its full duration.
+ */
+class AnimationEngine
+{
+    MicroBitDisplay             &display;
+    uint16_t                    id;
+    const ImageLiteral<5, 5>    *frames;
+    const uint16_t              *durations;
+    int                         frameMs;
+    int                         length;
+    int                         position;
+    int                         repeat;
+    int                         iteration;
+    CODAL_TIMESTAMP             deadline;
+    volatile bool               playing;
+
+    // Frame timing statistics, in microseconds.
+    int                         framesShown;
+    int                         latenessMin;
+    int                         latenessMax;
+    int64_t                     latenessTotal;
+
+    /**
+     * Shows the next frame and schedules the one after it, or completes the animation if there are no more frames.
+     * @param now the current system time, in microseconds.
+     */
+    void showNextFrame(CODAL_TIMESTAMP now);
+
+    /**
+     * Timer event handler, which records how late the frame is against its schedule then shows it.
+     */
+    void onFrame(MicroBitEvent);
+
+    public:
+    /**
+     * Creates an animation engine.
+     * @param display the display to animate.
+     * @param id the ID to use for events raised by this component.
+     */
+    AnimationEngine(MicroBitDisplay &display, uint16_t id = ANIMATION_ENGINE_ID);
+
+    /**
+     * Begins playback of an animation in which every frame is shown for the same time, and returns immediately.
+     * Any animation already being played is stopped.
+     * @param frames the frames to show. These must remain valid until playback completes.
+     * @param length the number of frames.
+     * @param frameMs the time each frame is shown for, in milliseconds.
+     * @param repeat the number of times to play the animation, or ANIMATION_ENGINE_REPEAT_FOREVER.
+     */
+    int playAsync(const ImageLiteral<5, 5> *frames, int length, int frameMs, int repeat = 1);
+
+    /**
+     * Begins playback of an animation with a duration for each frame, and returns immediately.
+     * Any animation already being played is stopped.
+     * @param frames the frames to show. These must remain valid until playback completes.
+     * @param durations the time each frame is shown for, in milliseconds. These must remain valid until playback completes.
+     * @param length the number of frames.
+     * @param repeat the number of times to play the animation, or ANIMATION_ENGINE_REPEAT_FOREVER.
+     */
+    int playAsync(const ImageLiteral<5, 5> *frames, const uint16_t *durations, int length, int repeat = 1);
+
+    /**
+     * Plays an animation in which every frame is shown for the same time, blocking the calling fiber until it completes.
+     * @param frames the frames to show.
+     * @param length the number of frames.
+     * @param frameMs the time each frame is shown for, in milliseconds.
+     */
+    int play(const ImageLiteral<5, 5> *frames, int length, int frameMs);
+
+    /**
+     * Plays an animation with a duration for each frame, blocking the calling fiber until it completes.
+     * @param frames the frames to show.
+     * @param durations the time each frame is shown for, in milliseconds.
+     * @param length the number of frames.
+     */
+    int play(const ImageLiteral<5, 5> *frames, const uint16_t *durations, int length);
+
+    /**
+     * Stops any animation currently being played, leaving the current frame on the display.
+     */
+    void stop();
+
+    /**
+     * Determines if an animation is currently being played.
+     */
+    bool isPlaying();
+
+    /**
+     * Clears the frame timing statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the frame timing statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,282 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "ImageLiteral.h"
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#define BITBOARD_WIDTH                          5
+#define BITBOARD_HEIGHT                         5
+
+// Every pixel, and the leftmost column: bit (y * 5 + x) holds pixel (x, y).
+#define BITBOARD_ALL                            0x01FFFFFF
+#define BITBOARD_COLUMN_0                       0x00108421
+
+/**
+ * A 5x5 monochrome frame, packed into the low 25 bits of a word.
+ *
+ * Most frames the display shows are only ever on or off, so holding them as a greyscale MicroBitImage spends 25 bytes
+ * and a heap block per frame. A Bitboard is 4 bytes, can live in a register, and every operation on a whole frame
+ * (shift, overlay, invert, collision and comparison) is a handful of instructions regardless of what's lit.
+ *
+ * Bitboards are literal types, so they can be built from image literals at compile time:
+ *     static constexpr Bitboard heart(IMAGE("0,255,0,255,0\n..."));
+ */
+class Bitboard
+{
+    uint32_t    bits;
+
+    /**
+     * Compile time conversion of image literal pixels [i..24] into bits, treating any non zero pixel as lit.
+     */
+    static constexpr uint32_t pack(const ImageLiteral<5, 5> &image, int i)
+    {
+        return i == 25 ? 0 : ((image.data[i] ? 1UL : 0UL) << i) | pack(image, i + 1);
+    }
+
+    /**
+     * The columns left in place when shifting horizontally by n, for 0 <= n <= 5.
+     */
+    static constexpr uint32_t columns(int n)
+    {
+        return ((1UL << (BITBOARD_WIDTH - n)) - 1) * BITBOARD_COLUMN_0;
+    }
+
+    public:
+    /**
+     * Creates a frame from its packed representation. Bits above the 25th are ignored.
+     */
+    constexpr explicit Bitboard(uint32_t bits = 0) : bits(bits & BITBOARD_ALL) {}
+
+    /**
+     * Creates a frame from an image literal, lighting every pixel that isn't 0.
+     */
+    constexpr explicit Bitboard(const ImageLiteral<5, 5> &image) : bits(pack(image, 0)) {}
+
+    /**
+     * Creates a frame with just the given pixel lit.
+     */
+    static constexpr Bitboard pixel(int x, int y)
+    {
+        return Bitboard(1UL << (y * BITBOARD_WIDTH + x));
+    }
+
+    /**
+     * Creates a frame from a MicroBitImage, lighting every pixel that is at least the given brightness.
+     * @param image a 5x5 image.
+     * @param threshold the lowest brightness treated as lit.
+     */
+    static Bitboard fromImage(MicroBitImage &image, int threshold = 1)
+    {
+        uint32_t b = 0;
+        const uint8_t *p = image.getBitmap();
+
+        for (int i = 0; i < 25; i++)
+            if (p[i] >= threshold)
+                b |= 1UL << i;
+
+        return Bitboard(b);
+    }
+
+    /**
+     * The packed representation of this frame.
+     */
+    constexpr uint32_t raw() const
+    {
+        return bits;
+    }
+
+    /**
+     * Determines if the given pixel is lit. Pixels outside the frame are never lit.
+     */
+    constexpr bool get(int x, int y) const
+    {
+        return x >= 0 && x < BITBOARD_WIDTH && y >= 0 && y < BITBOARD_HEIGHT && (bits >> (y * BITBOARD_WIDTH + x)) & 1;
+    }
+
+    /**
+     * Lights or clears the given pixel.
+     */
+    void set(int x, int y, bool lit = true)
+    {
+        if (lit)
+            bits |= 1UL << (y * BITBOARD_WIDTH + x);
+        else
+            bits &= ~(1UL << (y * BITBOARD_WIDTH + x));
+    }
+
+    /**
+     * The number of pixels lit.
+     */
+    int count() const
+    {
+        return __builtin_popcount(bits);
+    }
+
+    /**
+     * The index (y * 5 + x) of the n'th lit pixel, counting from 0 in raster order, or -1 if fewer are lit.
+     */
+    int indexOf(int n) const
+    {
+        uint32_t b = bits;
+
+        while (b && n--)
+            b &= b - 1;
+
+        return b ? __builtin_ctz(b) : -1;
+    }
+
+    constexpr bool isEmpty() const
+    {
+        return bits == 0;
+    }
+
+    /**
+     * Moves the frame by the given offset, discarding pixels moved off the edge.
+     * @param dx the number of columns to move right, or left if negative.
+     * @param dy the number of rows to move down, or up if negative.
+     */
+    constexpr Bitboard shift(int dx, int dy) const
+    {
+        return (dx <= -BITBOARD_WIDTH || dx >= BITBOARD_WIDTH || dy <= -BITBOARD_HEIGHT || dy >= BITBOARD_HEIGHT) ? Bitboard() :
+            Bitboard(dx >= 0 ? (bits & columns(dx)) << dx : (bits >> -dx) & columns(-dx)).shiftRows(dy);
+    }
+
+    /**
+     * Moves the frame vertically, discarding pixels moved off the edge.
+     */
+    constexpr Bitboard shiftRows(int dy) const
+    {
+        return Bitboard(dy >= 0 ? bits << (dy * BITBOARD_WIDTH) : bits >> (-dy * BITBOARD_WIDTH));
+    }
+
+    /**
+     * Moves the frame by one pixel, wrapping pixels moved off one edge around to the other.
+     * @param dx -1, 0 or 1.
+     * @param dy -1, 0 or 1.
+     */
+    constexpr Bitboard wrap(int dx, int dy) const
+    {
+        return dx ? Bitboard(dx > 0 ? ((bits & columns(1)) << 1) | ((bits >> 4) & BITBOARD_COLUMN_0) :
+                                      ((bits >> 1) & columns(1)) | ((bits & BITBOARD_COLUMN_0) << 4)).wrap(0, dy) :
+               dy ? Bitboard(dy > 0 ? (bits << 5) | (bits >> 20) : (bits >> 5) | (bits << 20)) : *this;
+    }
+
+    /**
+     * The pixels lit in either frame.
+     */
+    constexpr Bitboard operator|(Bitboard other) const
+    {
+        return Bitboard(bits | other.bits);
+    }
+
+    /**
+     * The pixels lit in both frames.
+     */
+    constexpr Bitboard operator&(Bitboard other) const
+    {
+        return Bitboard(bits & other.bits);
+    }
+
+    /**
+     * The pixels lit in one frame but not the other.
+     */
+    constexpr Bitboard operator^(Bitboard other) const
+    {
+        return Bitboard(bits ^ other.bits);
+    }
+
+    /**
+     * The inverted frame.
+     */
+    constexpr Bitboard operator~() const
+    {
+        return Bitboard(~bits);
+    }
+
+    Bitboard &operator|=(Bitboard other)
+    {
+        bits |= other.bits;
+        return *this;
+    }
+
+    Bitboard &operator&=(Bitboard other)
+    {
+        bits &= other.bits;
+        return *this;
+    }
+
+    constexpr bool operator==(Bitboard other) const
+    {
+        return bits == other.bits;
+    }
+
+    constexpr bool operator!=(Bitboard other) const
+    {
+        return bits != other.bits;
+    }
+
+    /**
+     * Determines if any pixel is lit in both frames.
+     */
+    constexpr bool collides(Bitboard other) const
+    {
+        return (bits & other.bits) != 0;
+    }
+
+    /**
+     * Writes the frame into a 5x5 image, such as the display buffer.
+     * @param image the image to write to.
+     * @param brightness the value written to lit pixels. Unlit pixels are written as 0.
+     */
+    void render(MicroBitImage &image, uint8_t brightness = 255) const
+    {
+        uint8_t *p = image.getBitmap();
+        uint32_t b = bits;
+
+        for (int i = 0; i < 25; i++)
+        {
+            p[i] = (b & 1) ? brightness : 0;
+            b >>= 1;
+        }
+    }
+
+    /**
+     * Lights the pixels of this frame in a 5x5 image, leaving every other pixel as it was.
+     * @param image the image to write to.
+     * @param brightness the value written to lit pixels.
+     */
+    void overlay(MicroBitImage &image, uint8_t brightness = 255) const
+    {
+        uint8_t *p = image.getBitmap();
+
+        for (uint32_t b = bits; b; b &= b - 1)
+            p[__builtin_ctz(b)] = brightness;
+    }
+};
+
+#endif
@@ -1,55 +1,57 @@
 #include "MicroBit.h"
 #include "Tests.h"
+#include "GreyscaleMatrix.h"
+#include "PinGroup.h"
+#include "CycleCounter.h"
 
 int clicks;
 int clickmode;
 
-void red_power_test()
+// All ten matrix pins: the rows in bits 0..4, then the columns in bits 5..9.
+#define MATRIX_ROW(n)                           (1 << (n))
+#define MATRIX_COL(n)                           (1 << (5 + (n)))
+#define MATRIX_ROWS                             0x01F
+#define MATRIX_COLS                             0x3E0
+
+static PinGroup *matrixPins = NULL;
+
+static PinGroup *getMatrixPins()
 {
-    uBit.io.row1.setDigitalValue(1);
-    uBit.io.row2.getDigitalValue();
-    uBit.io.row3.getDigitalValue();
-    uBit.io.row4.getDigitalValue();
-    uBit.io.row5.getDigitalValue();
+    if (matrixPins == NULL)
+    {
+        NRF52Pin *pins[10];
 
-    uBit.io.col1.setDigitalValue(0);
-    uBit.io.col2.getDigitalValue();
-    uBit.io.col3.getDigitalValue();
-    uBit.io.col4.getDigitalValue();
-    uBit.io.col5.getDigitalValue();
+        for (int i = 0; i < 5; i++)
+        {
+            pins[i] = uBit.ledRowPins[i];
+            pins[5 + i] = uBit.ledColPins[i];
+        }
 
+        matrixPins = new PinGroup(pins, 10);
+    }
+
+    return matrixPins;
+}
+
+void red_power_test()
+{
+    PinGroup *pins = getMatrixPins();
+
+    pins->write(MATRIX_ROW(0));
+    pins->setDirection(MATRIX_ROW(0) | MATRIX_COL(0));
 }
 
 void green_power_test()
 {
-    uBit.io.row1.setDigitalValue(0);
-    uBit.io.row2.getDigitalValue();
-    uBit.io.row3.getDigitalValue();
-    uBit.io.row4.getDigitalValue();
-    uBit.io.row5.getDigitalValue();
-
-    uBit.io.col1.setDigitalValue(1);
-    uBit.io.col2.getDigitalValue();
-    uBit.io.col3.getDigitalValue();
-    uBit.io.col4.getDigitalValue();
-    uBit.io.col5.getDigitalValue();
+    PinGroup *pins = getMatrixPins();
 
+    pins->write(MATRIX_COL(0));
+    pins->setDirection(MATRIX_ROW(0) | MATRIX_COL(0));
 }
 
 void off_power_test()
 {
-    uBit.io.row1.getDigitalValue();
-    uBit.io.row2.getDigitalValue();
-    uBit.io.row3.getDigitalValue();
-    uBit.io.row4.getDigitalValue();
-    uBit.io.row5.getDigitalValue();
-
-    uBit.io.col1.getDigitalValue();
-    uBit.io.col2.getDigitalValue();
-    uBit.io.col3.getDigitalValue();
-    uBit.io.col4.getDigitalValue();
-    uBit.io.col5.getDigitalValue();
-
+    getMatrixPins()->input();
 }
 
 
@@ -57,38 +59,12 @@ static void setDisplay(int mode)
 {
     DMESG(mode ? "RED\n" : "GREEN\n");
 
-    uBit.io.row1.setDigitalValue(mode);
-    uBit.io.row2.setDigitalValue(mode);
-    uBit.io.row3.setDigitalValue(mode);
-    uBit.io.row4.setDigitalValue(mode);
-    uBit.io.row5.setDigitalValue(mode);
-
-    uBit.io.col1.setDigitalValue(!mode);
-    uBit.io.col2.setDigitalValue(!mode);
-    uBit.io.col3.setDigitalValue(!mode);
-    uBit.io.col4.setDigitalValue(!mode);
-    uBit.io.col5.setDigitalValue(!mode);
-}
-
-static void setCol(int col, int mode)
-{
-    int c = 0;
-
-    for (NRF52Pin *p : uBit.ledRowPins)
-        p->setDigitalValue(mode == 2 ? 0 : mode);
+    PinGroup *pins = getMatrixPins();
 
-    for (NRF52Pin *p : uBit.ledColPins)
-    {
-        if (c == col)
-            p->setDigitalValue(mode == 2 ? 0 : !mode);
-        else
-            p->setDigitalValue(mode == 2 ? 0 : mode);
-
-        c++;
-    }
+    pins->write(mode ? MATRIX_ROWS : MATRIX_COLS);
+    pins->output();
 }
 
-
 static void onButtonA(MicroBitEvent)
 {
     if (clickmode != 1)
@@ -142,35 +118,47 @@ void button_blinky_test2()
 
 void fade_test()
 {
+    static GreyscaleMatrix *matrix = NULL;
+
     uBit.display.disable();
 
-    int period = 40;
+    if (matrix == NULL)
+        matrix = new GreyscaleMatrix();
+
+    matrix->enable();
+
     int brightness[5] = {0,20,40,60,80};
     int dx[5] = {1,1,1,1,1};
     int compression = 25;
+    int ticks = 0;
 
+    // Crossfade each column between red (forward) and green (reverse biased, on a bicolour matrix). The middle column
+    // has no green phase. The columns are modulated by the hardware, so all we do is move the levels on and sleep.
     while(1)
     {
         for (int c=0; c<5; c++)
         {
             //green
-            setCol(c==2?5:c,0);
-            target_wait_us(period * brightness[c]) ;
+            matrix->setReverseColumn(c, c==2 ? 0 : brightness[c] * 255 / 100);
 
             //red
-            setCol(c,1);
-            target_wait_us(period * (((100-brightness[c])*compression)/100));
-        }
+            matrix->setColumn(c, ((100-brightness[c]) * compression * 255) / 10000);
 
-        for (int c=0; c<5; c++)
-        {
             brightness[c] += dx[c];
 
             if (brightness[c] == 100 || brightness[c] == 0)
                 dx[c] = -dx[c];
         }
-    }
 
+        // The green phase costs an interrupt every period, so report what that comes to every few seconds.
+        if (++ticks % 500 == 0)
+        {
+            matrix->printStatistics();
+            matrix->resetStatistics();
+        }
+
+        uBit.sleep(10);
+    }
 }
 
 void blinky() 
@@ -195,4 +183,51 @@ void blinky()
     }
 }
 
+#define PIN_GROUP_BENCHMARK_TRANSITIONS         10000
+
+// Toggles all ten matrix pins between the two states setDisplay() uses, first one pin at a time through NRF52Pin,
+// then with a PinGroup, and reports how many whole-matrix transitions per second each manages.
+void pin_group_benchmark()
+{
+    uBit.display.disable();
+
+    uint32_t pinCycles, groupCycles, compiledCycles;
 
+    cycle_counter_enable();
+
+    uint32_t start = cycle_counter_read();
+    for (int i = 0; i < PIN_GROUP_BENCHMARK_TRANSITIONS; i++)
+    {
+        int mode = i & 1;
+
+        for (NRF52Pin *p : uBit.ledRowPins)
+            p->setDigitalValue(mode);
+
+        for (NRF52Pin *p : uBit.ledColPins)
+            p->setDigitalValue(!mode);
+    }
+    pinCycles = cycle_counter_read() - start;
+
+    // Only now hand the pins to the group, which takes them over from NRF52Pin.
+    PinGroup *pins = getMatrixPins();
+    PinGroupState states[2] = { pins->compile(MATRIX_COLS), pins->compile(MATRIX_ROWS) };
+
+    pins->output();
+
+    start = cycle_counter_read();
+    for (int i = 0; i < PIN_GROUP_BENCHMARK_TRANSITIONS; i++)
+        pins->write(i & 1 ? MATRIX_ROWS : MATRIX_COLS);
+    groupCycles = cycle_counter_read() - start;
+
+    start = cycle_counter_read();
+    for (int i = 0; i < PIN_GROUP_BENCHMARK_TRANSITIONS; i++)
+        pins->write(states[i & 1]);
+    compiledCycles = cycle_counter_read() - start;
+
+    pins->input();
+
+    DMESG("PIN_GROUP_BENCHMARK: [TRANSITIONS: %d]", PIN_GROUP_BENCHMARK_TRANSITIONS);
+    DMESG("   PER PIN:  %d cycles, %d transitions/s", pinCycles / PIN_GROUP_BENCHMARK_TRANSITIONS, (int)(64000000ULL * PIN_GROUP_BENCHMARK_TRANSITIONS / pinCycles));
+    DMESG("   GROUP:    %d cycles, %d transitions/s", groupCycles / PIN_GROUP_BENCHMARK_TRANSITIONS, (int)(64000000ULL * PIN_GROUP_BENCHMARK_TRANSITIONS / groupCycles));
+    DMESG("   COMPILED: %d cycles, %d transitions/s", compiledCycles / PIN_GROUP_BENCHMARK_TRANSITIONS, (int)(64000000ULL * PIN_GROUP_BENCHMARK_TRANSITIONS / compiledCycles));
+}
@@ -24,81 +24,14 @@ DEALINGS IN THE SOFTWARE.
 */
 
 #include "Tests.h"
+#include "TouchSampler.h"
+#include "TouchClassifier.h"
 
 int last_t0, last_t1, last_t2;
 static int c0 = 0;
 static int c1 = 0;
 static int c2 = 0;
 
-#define TOUCH_SENSE_CLUSTER_LOW                     0
-#define TOUCH_SENSE_CLUSTER_HIGH                    1
-#define TOUCH_SENSE_INITIALISATION_COUNT            10
-#define TOUCH_SENSE_CONVERGENCE_RATE                0.98f
-#define TOUCH_SENSE_SMOOTHING_RATE                  0.5f
-#define TOUCH_SENSE_CLUSTER_CEILING                 10000
-
-int loops = 0;
-
-float threshold;
-int currentCluster = TOUCH_SENSE_CLUSTER_LOW;
-int initializing;
-
-float lo_mean;
-float hi_mean;
-float touch_level;
-
-void
-calibrateInit()
-{
-    threshold = 500.0f;
-    currentCluster = TOUCH_SENSE_CLUSTER_LOW;
-    initializing = TOUCH_SENSE_INITIALISATION_COUNT;
-    lo_mean = 0.0f;
-    hi_mean = 0.0f;
-    touch_level = 0.0f;
-}
-
-void 
-calibrateTest(float sample)
-{
-    if (initializing)
-    {
-        lo_mean += sample;
-        initializing--;
-
-        if (initializing == 0)
-        {
-            lo_mean = lo_mean / TOUCH_SENSE_INITIALISATION_COUNT;
-            hi_mean = lo_mean + threshold * 2;
-            touch_level = lo_mean;
-        }
-        return;
-    }
-
-    touch_level = touch_level * TOUCH_SENSE_SMOOTHING_RATE + sample * (1-TOUCH_SENSE_SMOOTHING_RATE);
-
-    if (currentCluster == TOUCH_SENSE_CLUSTER_LOW && touch_level < TOUCH_SENSE_CLUSTER_CEILING && touch_level < hi_mean - threshold)
-        lo_mean = lo_mean * TOUCH_SENSE_CONVERGENCE_RATE + touch_level * (1-TOUCH_SENSE_CONVERGENCE_RATE);
-
-    if (currentCluster == TOUCH_SENSE_CLUSTER_HIGH && touch_level < TOUCH_SENSE_CLUSTER_CEILING && touch_level > lo_mean + threshold)
-        hi_mean = hi_mean * TOUCH_SENSE_CONVERGENCE_RATE + touch_level * (1-TOUCH_SENSE_CONVERGENCE_RATE);
-
-    if (touch_level < lo_mean + threshold)
-        currentCluster = TOUCH_SENSE_CLUSTER_LOW;
-
-    if (touch_level > hi_mean - threshold)
-        currentCluster = TOUCH_SENSE_CLUSTER_HIGH;
-    
-    loops++;
-
-    if (loops == 10){
-        DMESG("%d: [SAMPLE: %d][LEVEL: %d][LO_MEAN: %d] [HI_MEAN: %d]", currentCluster, (int)sample, (int)touch_level, (int)lo_mean, (int)hi_mean);
-        loops = 0;
-    }
-
-    //DMESG("[SAMPLE: %d]", (int)sample);
-}
-
 static void
 onCalibrate(MicroBitEvent)
 {
@@ -173,51 +106,25 @@ cap_touch_test_raw()
     // Simply release this fiber, which will mean we enter the scheduler. Worse case, we then
     // sit in the idle task forever, in a power efficient sleep.
 
-    int t, t0, t1, t2;
+    // Each pin is discharged between scans, then released, and the time it takes to rise to a CMOS logic HI is
+    // captured by the hardware, in 16MHz ticks. A pin that doesn't rise reads as the timeout.
+    NRF52Pin *pins[] = {&uBit.io.P0, &uBit.io.P1, &uBit.io.P2};
+    TouchSampler sampler(pins, 3);
+    uint32_t values[3];
+    int t0, t1, t2;
     //int THRESHOLD = 100;
-    int T_MAX = 2000;
+
+    sampler.setScanRate(50);
+    sampler.start();
 
     while(1)
     {
-        // Discharge each pin
-        uBit.io.P0.setDigitalValue(0);
-        uBit.io.P1.setDigitalValue(0);
-        uBit.io.P2.setDigitalValue(0);
-
-        uBit.sleep(20);
-
-        // Convert each pin to an input, and time how long it takes to rise to a CMOS logic HI.
-        t=1; 
-        t0=0;
-        t1=0;
-        t2=0;
-
-        uBit.io.P0.getDigitalValue(PullMode::None);
-        uBit.io.P1.getDigitalValue(PullMode::None);
-        uBit.io.P2.getDigitalValue(PullMode::None);
-
-        while (t < T_MAX)
-        {
-            if (t0 == 0 && uBit.io.P0.getDigitalValue())
-                t0=t;
+        sampler.waitForScan();
+        sampler.read(values);
 
-            if (t1 == 0 && uBit.io.P1.getDigitalValue())
-                t1=t;
-
-            if (t2 == 0 && uBit.io.P2.getDigitalValue())
-                t2=t;
-
-            t++;
-        }
-
-        if(t0 == 0)
-            t0 = T_MAX;
-
-        if(t1 == 0)
-            t1 = T_MAX;
-
-        if(t2 == 0)
-            t2 = T_MAX;
+        t0 = values[0];
+        t1 = values[1];
+        t2 = values[2];
 
         last_t0 = t0;
         last_t1 = t1;
@@ -251,3 +158,114 @@ cap_touch_test_raw()
     release_fiber();
 }
 
+void
+touch_sampler_test()
+{
+    NRF52Pin *pins[] = {&uBit.io.P0, &uBit.io.P1, &uBit.io.P2};
+    TouchSampler sampler(pins, 3);
+    uint32_t values[3];
+    uint32_t baseline[3] = {0, 0, 0};
+
+    sampler.setTimeout(4000);
+    sampler.setScanRate(100);
+    sampler.start();
+
+    // Take the untouched rise times from the first scans, as the calibration of cap_touch_test_raw does.
+    for (int n = 0; n < 10; n++)
+    {
+        sampler.waitForScan();
+        sampler.read(values);
+
+        for (int i = 0; i < 3; i++)
+            baseline[i] += values[i];
+    }
+
+    for (int i = 0; i < 3; i++)
+        baseline[i] /= 10;
+
+    sampler.resetStatistics();
+
+    // The measurement is all in hardware, so this fiber only wakes once per scan.
+    while(1)
+    {
+        sampler.waitForScan();
+        uint32_t scan = sampler.read(values);
+
+        for (int i = 0; i < 3; i++)
+            uBit.display.image.setPixelValue(i * 2, 0, values[i] > baseline[i] * 2 ? 255 : 0);
+
+        if (scan % 100 == 0)
+        {
+            uBit.serial.printf("[P0: %d] [P1: %d] [P2: %d] ticks\n", (int)values[0], (int)values[1], (int)values[2]);
+            sampler.printStatistics();
+        }
+    }
+}
+
+static void
+onClassifiedTouch(MicroBitEvent e)
+{
+    if (e.value < TOUCH_SAMPLER_EVT_TOUCH)
+        return;
+
+    int pin = e.value & 0x0F;
+    bool touched = (e.value & 0xF0) == TOUCH_SAMPLER_EVT_TOUCH;
+
+    uBit.display.image.setPixelValue(pin * 2, 2, touched ? 255 : 0);
+    DMESG("TOUCH_CLASSIFIER: P%d %s", pin, touched ? "TOUCH" : "RELEASE");
+}
+
+void
+touch_classifier_test()
+{
+    NRF52Pin *pins[] = {&uBit.io.P0, &uBit.io.P1, &uBit.io.P2};
+    TouchSampler sampler(pins, 3);
+    TouchClassifier classifier(3);
+
+    // 1kHz scans, classified in the scan interrupt, with the classifier's default filter which is tuned for that rate.
+    sampler.setTimeout(800);
+    sampler.setScanRate(1000);
+    sampler.setClassifier(&classifier);
+
+    uBit.messageBus.listen(TOUCH_SAMPLER_ID, DEVICE_EVT_ANY, onClassifiedTouch);
+
+    sampler.start();
+
+    while(1)
+    {
+        uBit.sleep(1000);
+
+        for (int i = 0; i < 3; i++)
+            DMESG("   P%d: [LEVEL: %d] [BASELINE: %d] [TOUCHED: %d]", i, classifier.getLevel(i), classifier.getBaseline(i), classifier.getTouchLevel(i));
+
+        sampler.printStatistics();
+    }
+}
+
+void
+touch_trace_test()
+{
+    NRF52Pin *pins[] = {&uBit.io.P0, &uBit.io.P1, &uBit.io.P2};
+    TouchSampler sampler(pins, 3);
+    uint32_t values[3];
+    uint32_t last = 0;
+
+    // Every scan as a line of comma separated rise times, to be recorded from the serial port and replayed on the host
+    // by utils/host/touch_replay (with -r 500). 500 scans a second is about as many as 115200 baud will carry. Note
+    // when each pad is touched, so the recording can be given the touches it should produce (see touch_replay.cpp).
+    sampler.setTimeout(800);
+    sampler.setScanRate(500);
+    sampler.start();
+
+    while(1)
+    {
+        sampler.waitForScan();
+        uint32_t scan = sampler.read(values);
+
+        if (scan != last + 1 && last != 0)
+            uBit.serial.printf("# %d scans missed\n", (int)(scan - last - 1));
+
+        uBit.serial.printf("%d,%d,%d\n", (int)values[0], (int)values[1], (int)values[2]);
+        last = scan;
+    }
+}
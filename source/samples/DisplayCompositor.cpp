@@ -0,0 +1,172 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "DisplayCompositor.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+/**
+ * Creates a compositor, which takes over the given display's image.
+ * @param display the display to composite onto.
+ * @param id the ID of this component.
+ */
+DisplayCompositor::DisplayCompositor(MicroBitDisplay &display, uint16_t id) : display(display)
+{
+    this->id = id;
+
+    memset(pixels, 0, sizeof(pixels));
+    dirty = 1 << DISPLAY_COMPOSITOR_LAYER_BACKGROUND;
+
+    resetStatistics();
+    cycle_counter_enable();
+
+    status |= DEVICE_COMPONENT_STATUS_SYSTEM_TICK;
+}
+
+/**
+ * Rebuilds the display image from the layers.
+ */
+void DisplayCompositor::composite()
+{
+    uint32_t start = cycle_counter_read();
+    uint8_t *out = display.image.getBitmap();
+
+    memcpy(out, pixels[DISPLAY_COMPOSITOR_LAYER_BACKGROUND], 25);
+
+    for (int l = DISPLAY_COMPOSITOR_LAYER_BACKGROUND + 1; l < DISPLAY_COMPOSITOR_LAYERS; l++)
+        for (uint32_t b = opaque[l].raw(); b; b &= b - 1)
+            out[__builtin_ctz(b)] = pixels[l][__builtin_ctz(b)];
+
+    compositeCycles += cycle_counter_read() - start;
+    composites++;
+}
+
+/**
+ * Composites the layers if any have changed. Called by the scheduler on every system tick.
+ */
+void DisplayCompositor::periodicCallback()
+{
+    if (!dirty)
+        return;
+
+    dirty = 0;
+    composite();
+}
+
+/**
+ * Replaces the content of a layer with an image. In every layer but the background, pixels that are 0 are
+ * transparent.
+ * @param layer the layer to write.
+ * @param image a 5x5 image.
+ */
+int DisplayCompositor::setImage(int layer, MicroBitImage &image)
+{
+    if (layer < 0 || layer >= DISPLAY_COMPOSITOR_LAYERS || image.getWidth() != 5 || image.getHeight() != 5)
+        return DEVICE_INVALID_PARAMETER;
+
+    // Work out the new layer before taking the lock, so the compositor is only held off for the copy.
+    Bitboard mask = Bitboard::fromImage(image);
+
+    target_disable_irq();
+    memcpy(pixels[layer], image.getBitmap(), 25);
+    opaque[layer] = mask;
+    dirty |= 1 << layer;
+    writes++;
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Replaces the content of a layer with a monochrome frame.
+ * @param layer the layer to write.
+ * @param frame the pixels to light.
+ * @param brightness the brightness of lit pixels.
+ */
+int DisplayCompositor::setFrame(int layer, Bitboard frame, uint8_t brightness)
+{
+    if (layer < 0 || layer >= DISPLAY_COMPOSITOR_LAYERS)
+        return DEVICE_INVALID_PARAMETER;
+
+    target_disable_irq();
+    for (int i = 0; i < 25; i++)
+        pixels[layer][i] = (frame.raw() >> i) & 1 ? brightness : 0;
+    opaque[layer] = brightness ? frame : Bitboard();
+    dirty |= 1 << layer;
+    writes++;
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Sets a single pixel of a layer.
+ * @param layer the layer to write.
+ * @param x the column, in the range 0..4.
+ * @param y the row, in the range 0..4.
+ * @param value the brightness. In every layer but the background, 0 is transparent.
+ */
+int DisplayCompositor::setPixel(int layer, int x, int y, uint8_t value)
+{
+    if (layer < 0 || layer >= DISPLAY_COMPOSITOR_LAYERS || x < 0 || x > 4 || y < 0 || y > 4)
+        return DEVICE_INVALID_PARAMETER;
+
+    target_disable_irq();
+    pixels[layer][y * 5 + x] = value;
+    opaque[layer].set(x, y, value != 0);
+    dirty |= 1 << layer;
+    writes++;
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Clears a layer, making it entirely transparent (or, for the background, dark).
+ * @param layer the layer to clear.
+ */
+int DisplayCompositor::clearLayer(int layer)
+{
+    return setFrame(layer, Bitboard(), 0);
+}
+
+/**
+ * Clears the statistics.
+ */
+void DisplayCompositor::resetStatistics()
+{
+    writes = 0;
+    composites = 0;
+    compositeCycles = 0;
+}
+
+/**
+ * Output the write and composite statistics gathered to the DMESG buffer.
+ */
+void DisplayCompositor::printStatistics()
+{
+    DMESG("DISPLAY_COMPOSITOR: [WRITES: %d, COMPOSITES: %d]", writes, composites);
+    DMESG("   COMPOSITE: %d cycles", composites ? (int)(compositeCycles / composites) : 0);
+}
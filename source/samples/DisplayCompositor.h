@@ -0,0 +1,121 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "Bitboard.h"
+
+#ifndef DISPLAY_COMPOSITOR_H
+#define DISPLAY_COMPOSITOR_H
+
+#define DISPLAY_COMPOSITOR_ID                   3103
+
+// Layers, lowest priority first. Lit pixels in a higher layer hide whatever is beneath them.
+#define DISPLAY_COMPOSITOR_LAYER_BACKGROUND     0
+#define DISPLAY_COMPOSITOR_LAYER_STATUS         1
+#define DISPLAY_COMPOSITOR_LAYER_ALERT          2
+#define DISPLAY_COMPOSITOR_LAYERS               3
+
+/**
+ * Composites prioritised layers onto the display, so that several fibers can each own part of what's shown.
+ *
+ * Each fiber writes only to its own layer, which just copies the pixels and marks the layer dirty. Once per system
+ * tick, in interrupt context, the compositor checks the dirty bits and, only if any are set, rebuilds the display
+ * image from the layers: the background is copied, then each lit pixel of the status and alert layers is laid over
+ * it. However many writes happen between ticks, the display is composited at most once, and always in the same order,
+ * so concurrent writers can never overwrite each other.
+ */
+class DisplayCompositor : public CodalComponent
+{
+    MicroBitDisplay     &display;
+    uint8_t             pixels[DISPLAY_COMPOSITOR_LAYERS][25];
+    Bitboard            opaque[DISPLAY_COMPOSITOR_LAYERS];
+    volatile uint8_t    dirty;
+
+    // Statistics.
+    int                 writes;
+    int                 composites;
+    uint32_t            compositeCycles;
+
+    /**
+     * Rebuilds the display image from the layers.
+     */
+    void composite();
+
+    public:
+    /**
+     * Creates a compositor, which takes over the given display's image.
+     * @param display the display to composite onto.
+     * @param id the ID of this component.
+     */
+    DisplayCompositor(MicroBitDisplay &display, uint16_t id = DISPLAY_COMPOSITOR_ID);
+
+    /**
+     * Replaces the content of a layer with an image. In every layer but the background, pixels that are 0 are
+     * transparent.
+     * @param layer the layer to write.
+     * @param image a 5x5 image.
+     */
+    int setImage(int layer, MicroBitImage &image);
+
+    /**
+     * Replaces the content of a layer with a monochrome frame.
+     * @param layer the layer to write.
+     * @param frame the pixels to light.
+     * @param brightness the brightness of lit pixels.
+     */
+    int setFrame(int layer, Bitboard frame, uint8_t brightness = 255);
+
+    /**
+     * Sets a single pixel of a layer.
+     * @param layer the layer to write.
+     * @param x the column, in the range 0..4.
+     * @param y the row, in the range 0..4.
+     * @param value the brightness. In every layer but the background, 0 is transparent.
+     */
+    int setPixel(int layer, int x, int y, uint8_t value);
+
+    /**
+     * Clears a layer, making it entirely transparent (or, for the background, dark).
+     * @param layer the layer to clear.
+     */
+    int clearLayer(int layer);
+
+    /**
+     * Composites the layers if any have changed. Called by the scheduler on every system tick.
+     */
+    virtual void periodicCallback();
+
+    /**
+     * Clears the statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the write and composite statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -1,61 +1,87 @@
 #include "MicroBit.h"
 #include "Tests.h"
-
-const char * const arrow_left_emoji ="\
+#include "ImageLiteral.h"
+#include "AnimationEngine.h"
+#include "Bitboard.h"
+#include "CycleCounter.h"
+#include "ScrollCache.h"
+#include "DisplayCompositor.h"
+#include "SensingDisplay.h"
+
+static constexpr auto arrow_left_emoji = IMAGE("\
     000,000,255,000,000\n\
     000,255,000,000,000\n\
     255,255,255,255,255\n\
     000,255,000,000,000\n\
-    000,000,255,000,000\n";
+    000,000,255,000,000\n");
 
-const char * const arrow_right_emoji ="\
+static constexpr auto arrow_right_emoji = IMAGE("\
     000,000,255,000,000\n\
     000,000,000,255,000\n\
     255,255,255,255,255\n\
     000,000,000,255,000\n\
-    000,000,255,000,000\n";
+    000,000,255,000,000\n");
 
-const char * const tick_emoji ="\
+static constexpr auto tick_emoji = IMAGE("\
     000,000,000,000,000\n\
     000,000,000,000,255\n\
     000,000,000,255,000\n\
     255,000,255,000,000\n\
-    000,255,000,000,000\n";
+    000,255,000,000,000\n");
 
-const char * const radio_emoji ="\
+static constexpr auto radio_emoji = IMAGE("\
     255,255,255,000,000\n\
     000,000,000,255,000\n\
     255,255,000,000,255\n\
     000,000,255,000,255\n\
-    255,000,255,000,255\n";
+    255,000,255,000,255\n");
 
-const char * const happy_emoji ="\
+static constexpr auto happy_emoji = IMAGE("\
     000,255,000,255,000\n\
     000,000,000,000,000\n\
     255,000,000,000,255\n\
     000,255,255,255,000\n\
-    000,000,000,000,000\n";
+    000,000,000,000,000\n");
 
-const char * const wink_emoji ="\
+static constexpr auto wink_emoji = IMAGE("\
     000,255,000,000,000\n\
     000,000,000,000,000\n\
     255,000,000,000,255\n\
     000,255,255,255,000\n\
-    000,000,000,000,000\n";
+    000,000,000,000,000\n");
 
-const char * const sad_emoji ="\
+static constexpr auto sad_emoji = IMAGE("\
     000,255,000,255,000\n\
     000,000,000,000,000\n\
     000,000,000,000,000\n\
     000,255,255,255,000\n\
-    255,000,000,000,255\n";
+    255,000,000,000,255\n");
+
+static ScrollCache *scroller = NULL;
+
+static ScrollCache *getScroller()
+{
+    if (scroller == NULL)
+        scroller = new ScrollCache(uBit.display);
+
+    return scroller;
+}
 
+static DisplayCompositor *compositor = NULL;
+
+// Each fiber owns a layer of the compositor, so neither can overwrite the other: the background alternates between
+// two faces, the status layer blinks a corner pixel, and the alert layer shows a tick while button A is held.
 static void
 concurrent_display_test_t1()
 {
+    MicroBitImage happy = happy_emoji.image();
+    MicroBitImage sad = sad_emoji.image();
+
     while(1)
     {
-        uBit.display.print("JJ");
+        compositor->setImage(DISPLAY_COMPOSITOR_LAYER_BACKGROUND, happy);
+        uBit.sleep(1000);
+        compositor->setImage(DISPLAY_COMPOSITOR_LAYER_BACKGROUND, sad);
         uBit.sleep(1000);
     }
 }
@@ -66,8 +92,10 @@ concurrent_display_test_t2()
     uBit.sleep(500);
     while(1)
     {
-        uBit.display.print("FF");
-        uBit.sleep(1000);
+        compositor->setPixel(DISPLAY_COMPOSITOR_LAYER_STATUS, 4, 0, 255);
+        uBit.sleep(250);
+        compositor->setPixel(DISPLAY_COMPOSITOR_LAYER_STATUS, 4, 0, 0);
+        uBit.sleep(250);
     }
 }
 
@@ -76,10 +104,35 @@ concurrent_display_test()
 {
     DMESG("CONCURRENT_DISPLAY_TEST1:");
 
+    if (compositor == NULL)
+        compositor = new DisplayCompositor(uBit.display);
+
     create_fiber(concurrent_display_test_t1);
     create_fiber(concurrent_display_test_t2);
 
-    release_fiber();
+    MicroBitImage tick = tick_emoji.image();
+    bool alert = false;
+
+    while(1)
+    {
+        if (uBit.buttonA.isPressed() != alert)
+        {
+            alert = !alert;
+
+            if (alert)
+                compositor->setImage(DISPLAY_COMPOSITOR_LAYER_ALERT, tick);
+            else
+                compositor->clearLayer(DISPLAY_COMPOSITOR_LAYER_ALERT);
+        }
+
+        if (uBit.buttonB.isPressed())
+        {
+            compositor->printStatistics();
+            compositor->resetStatistics();
+        }
+
+        uBit.sleep(50);
+    }
 }
 
 void
@@ -101,8 +154,8 @@ display_test2()
     DMESG("DISPLAY_TEST2:");
     while(1)
     {
-        uBit.display.scroll("HELLO");
-        uBit.display.scroll("WORLD");
+        getScroller()->scroll("HELLO");
+        getScroller()->scroll("WORLD");
         uBit.sleep(2000);
     }
 }
@@ -112,8 +165,8 @@ display_wink()
 {
     DMESG("DISPLAY_WINK:");
 
-    MicroBitImage smile(happy_emoji);
-    MicroBitImage wink(wink_emoji);
+    MicroBitImage smile = happy_emoji.image();
+    MicroBitImage wink = wink_emoji.image();
 
     uBit.display.print(smile);
     uBit.sleep(1000);
@@ -128,7 +181,7 @@ display_wink()
 void
 display_brightness_test()
 {
-    MicroBitImage smile(happy_emoji);
+    MicroBitImage smile = happy_emoji.image();
     uBit.display.print(smile);
     uBit.display.setBrightness(50);
 
@@ -154,7 +207,7 @@ display_tick()
 {
     DMESG("DISPLAY_TICK:");
 
-    MicroBitImage tick(tick_emoji);
+    MicroBitImage tick = tick_emoji.image();
     uBit.display.print(tick);
 }
 
@@ -163,8 +216,8 @@ display_arrows()
 {
     DMESG("DISPLAY_ARROWS:");
 
-    MicroBitImage arrowL(arrow_left_emoji);
-    MicroBitImage arrowR(arrow_right_emoji);
+    MicroBitImage arrowL = arrow_left_emoji.image();
+    MicroBitImage arrowR = arrow_right_emoji.image();
 
     uBit.display.print(arrowL);
     uBit.sleep(200);
@@ -192,7 +245,7 @@ display_radio()
 {
     DMESG("DISPLAY_RADIO:");
 
-    MicroBitImage radio(radio_emoji);
+    MicroBitImage radio = radio_emoji.image();
     uBit.display.print(radio);
 }
 
@@ -245,53 +298,53 @@ raw_blinky_test()
 static void
 onButtonAPressed(MicroBitEvent)
 {
-    const char * const a_emoji ="\
+    static constexpr auto a_emoji = IMAGE("\
         255,000,000,000,255\n\
         000,000,000,000,000\n\
         255,255,255,255,255\n\
         000,000,000,255,255\n\
-        000,000,000,255,255\n";
+        000,000,000,255,255\n");
 
-    MicroBitImage img_a(a_emoji);
+    MicroBitImage img_a = a_emoji.image();
     uBit.display.print(img_a);
 }
 
 static void
 onButtonBPressed(MicroBitEvent)
 {
-    const char * const b_emoji ="\
+    static constexpr auto b_emoji = IMAGE("\
         000,255,000,000,255\n\
         000,000,255,255,000\n\
         000,000,255,255,000\n\
         000,000,255,255,000\n\
-        000,255,000,000,255\n";
-    MicroBitImage img_b(b_emoji);
+        000,255,000,000,255\n");
+    MicroBitImage img_b = b_emoji.image();
     uBit.display.print(img_b);    
 }
 
 static void
 onButtonABPressed(MicroBitEvent)
 {
-    const char * const c_emoji ="\
+    static constexpr auto c_emoji = IMAGE("\
         000,000,000,255,255\n\
         000,000,000,255,255\n\
         255,255,255,255,255\n\
         255,255,255,255,255\n\
-        000,255,000,255,000\n";
-    MicroBitImage img_c(c_emoji);
+        000,255,000,255,000\n");
+    MicroBitImage img_c = c_emoji.image();
     uBit.display.print(img_c);    
 }
 
 static void
 onShakePressed(MicroBitEvent)
 {
-    const char * const d_emoji ="\
+    static constexpr auto d_emoji = IMAGE("\
         255,000,000,000,255\n\
         000,255,000,255,000\n\
         000,000,000,000,000\n\
         255,255,255,255,255\n\
-        255,000,255,000,255\n";
-    MicroBitImage img_d(d_emoji);
+        255,000,255,000,255\n");
+    MicroBitImage img_d = d_emoji.image();
     uBit.display.print(img_d);    
 }
 
@@ -304,14 +357,14 @@ do_something_forever()
 void 
 display_button_icon_test()
 {
-    const char * const heart_emoji ="\
+    static constexpr auto heart_emoji = IMAGE("\
     000,255,000,255,000\n\
     255,255,255,255,255\n\
     255,255,255,255,255\n\
     000,255,255,255,000\n\
-    000,000,255,000,000\n";
+    000,000,255,000,000\n");
 
-    MicroBitImage img_heart(heart_emoji);
+    MicroBitImage img_heart = heart_emoji.image();
     uBit.display.print(img_heart);
 
     uBit.messageBus.listen(MICROBIT_ID_BUTTON_A, MICROBIT_BUTTON_EVT_CLICK, onButtonAPressed);
@@ -354,13 +407,27 @@ display_brightness_AB_test()
 void 
 display_lightlevel_test()
 {
+    static SensingDisplay *sensingDisplay = NULL;
+
+    if (sensingDisplay == NULL)
+        sensingDisplay = new SensingDisplay(uBit.display);
+
     for (int i=0; i<25; i++)
         uBit.display.image.setPixelValue(i / 5, i % 5, 255);
 
+    sensingDisplay->enable();
+
+    // Auto brightness. The light level is measured as part of every few refreshes, so can be read as often as we like.
     while(1)
     {
-        uBit.display.setBrightness(uBit.display.readLightLevel());
+        sensingDisplay->setBrightness(max(sensingDisplay->readLightLevel(), 8));
         uBit.sleep(100);
+
+        if (uBit.buttonB.isPressed())
+        {
+            sensingDisplay->printStatistics();
+            sensingDisplay->resetStatistics();
+        }
     }
 }
 
@@ -389,4 +456,161 @@ display_lightlevel_test2()
 
         i++;
     }
-}
\ No newline at end of file
+}
+
+#define ANIMATION_TEST_ROUNDS                   10
+
+static constexpr ImageLiteral<5, 5> spinner[] = {
+    IMAGE("0,0,255,0,0\n0,0,255,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,255,255\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n255,255,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n")
+};
+
+static const uint16_t spinnerDurations[] = { 60, 60, 60, 120 };
+
+static AnimationEngine *animationEngine = NULL;
+
+// Plays the same animation with display.print() in a fiber loop, then with the AnimationEngine while this fiber
+// samples the accelerometer, and reports how far each frame landed from where it was meant to.
+void
+animation_engine_test()
+{
+    if (animationEngine == NULL)
+        animationEngine = new AnimationEngine(uBit.display);
+
+    // Fiber loop. Any time spent outside the print accumulates, so frames drift later and later.
+    CODAL_TIMESTAMP due = system_timer_current_time_us();
+    int latenessMax = 0;
+    int lateness = 0;
+
+    for (int round = 0; round < ANIMATION_TEST_ROUNDS; round++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            lateness = (int)(system_timer_current_time_us() - due);
+            latenessMax = max(latenessMax, lateness);
+
+            uBit.display.print(spinner[i].image(), 0, 0, 0, spinnerDurations[i]);
+            due += spinnerDurations[i] * 1000;
+        }
+    }
+
+    DMESG("FIBER LOOP: [FRAMES: %d]", ANIMATION_TEST_ROUNDS * 4);
+    DMESG("   LATENESS: MAX %d us, LAST %d us", latenessMax, lateness);
+
+    // Animation engine. This fiber is free to do other work until the animation completes.
+    int samples = 0;
+
+    animationEngine->resetStatistics();
+    animationEngine->playAsync(spinner, spinnerDurations, 4, ANIMATION_TEST_ROUNDS);
+
+    while (animationEngine->isPlaying())
+    {
+        uBit.accelerometer.getX();
+        samples++;
+        uBit.sleep(10);
+    }
+
+    animationEngine->printStatistics();
+    DMESG("   ACCELEROMETER SAMPLES WHILE ANIMATING: %d", samples);
+
+    uBit.display.clear();
+}
+
+#define BITBOARD_TEST_ITERATIONS                1000
+
+// Runs the same frame logic (shift, overlay, collision test and compare) on greyscale images and on bitboards, and
+// reports the cycles and memory each takes.
+void
+bitboard_test()
+{
+    MicroBitImage imageA(happy_emoji.image());
+    MicroBitImage imageB(sad_emoji.image());
+    MicroBitImage imageFrame(5, 5);
+    Bitboard boardA(happy_emoji);
+    Bitboard boardB(sad_emoji);
+    Bitboard boardFrame;
+    uint32_t imageCycles, boardCycles;
+    int imageHits = 0, boardHits = 0;
+
+    cycle_counter_enable();
+
+    uint32_t start = cycle_counter_read();
+    for (int i = 0; i < BITBOARD_TEST_ITERATIONS; i++)
+    {
+        imageFrame.paste(imageA);
+        imageFrame.shiftLeft(i % 3 - 1);
+        imageFrame.paste(imageB, 0, 0, 1);
+
+        for (int p = 0; p < 25; p++)
+            if (imageFrame.getPixelValue(p % 5, p / 5) && imageA.getPixelValue(p % 5, p / 5))
+            {
+                imageHits++;
+                break;
+            }
+
+        if (imageFrame == imageB)
+            imageHits++;
+    }
+    imageCycles = cycle_counter_read() - start;
+
+    start = cycle_counter_read();
+    for (int i = 0; i < BITBOARD_TEST_ITERATIONS; i++)
+    {
+        boardFrame = boardA.shift(1 - i % 3, 0) | boardB;
+
+        if (boardFrame.collides(boardA))
+            boardHits++;
+
+        if (boardFrame == boardB)
+            boardHits++;
+    }
+    boardCycles = cycle_counter_read() - start;
+
+    boardFrame.render(uBit.display.image);
+
+    DMESG("BITBOARD_TEST: [ITERATIONS: %d]", BITBOARD_TEST_ITERATIONS);
+    DMESG("   IMAGE:    %d cycles/frame, %d bytes/frame [HITS: %d]", imageCycles / BITBOARD_TEST_ITERATIONS, (int)(sizeof(MicroBitImage) + 6 + 25), imageHits);
+    DMESG("   BITBOARD: %d cycles/frame, %d bytes/frame [HITS: %d]", boardCycles / BITBOARD_TEST_ITERATIONS, (int)sizeof(Bitboard), boardHits);
+}
+
+#define SCROLL_CACHE_TEST_TEXT                  "HELLO WORLD"
+
+// Measures the CPU cost of each scroll step when the visible glyphs are drawn again for every column shifted, then
+// scrolls the same text twice through the ScrollCache (once to render it, once from the cache) for comparison.
+void
+scroll_cache_test()
+{
+    ManagedString text(SCROLL_CACHE_TEST_TEXT);
+    MicroBitImage scratch(5, 5);
+    int steps = text.length() * (SCROLL_CACHE_GLYPH_WIDTH + SCROLL_CACHE_SPACING) + SCROLL_CACHE_GLYPH_WIDTH;
+    uint32_t cycles = 0;
+
+    cycle_counter_enable();
+
+    for (int o = 0; o < steps; o++)
+    {
+        uint32_t start = cycle_counter_read();
+
+        scratch.clear();
+
+        for (int i = 0; i < text.length(); i++)
+        {
+            int x = i * (SCROLL_CACHE_GLYPH_WIDTH + SCROLL_CACHE_SPACING) + 4 - o;
+
+            if (x > -SCROLL_CACHE_GLYPH_WIDTH && x < 5)
+                scratch.print(text.charAt(i), x, 0);
+        }
+
+        uBit.display.image.paste(scratch);
+        cycles += cycle_counter_read() - start;
+    }
+
+    DMESG("RE-RENDER: %d cycles/step [STEPS: %d]", (int)(cycles / steps), steps);
+
+    getScroller()->resetStatistics();
+    getScroller()->scroll(text);
+    getScroller()->scroll(text);
+    getScroller()->printStatistics();
+}
@@ -0,0 +1,321 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "EdgeCapture.h"
+#include "Tests.h"
+
+EdgeCapture *EdgeCapture::instance = NULL;
+
+/**
+ * Creates an edge capture component.
+ * @param pins the pins to watch. These are made digital inputs, keeping any pull already set.
+ * @param count the number of pins, up to EDGE_CAPTURE_MAX_PINS.
+ * @param clock the timer used to timestamp edges. This must have six compare registers (TIMER3 or TIMER4), and
+ * must not be shared.
+ * @param counter the timer used to count edges, which must not be shared.
+ * @param irqn the interrupt of the counter timer.
+ * @param gpioteChannel the first of 'count' consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of 'count' consecutive PPI channels to use.
+ * @param queueSize the number of edges that can be held waiting to be read, as a power of two.
+ * @param id the ID to use for events raised by this component.
+ */
+EdgeCapture::EdgeCapture(NRF52Pin *const *pins, int count, NRF_TIMER_Type *clock, NRF_TIMER_Type *counter, IRQn_Type irqn, int gpioteChannel, int ppiChannel, int queueSize, uint16_t id) : counter(counter, irqn)
+{
+    this->count = min(count, EDGE_CAPTURE_MAX_PINS);
+    this->clock = clock;
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->id = id;
+    this->running = false;
+
+    for (int i = 0; i < this->count; i++)
+        this->pins[i] = pins[i];
+
+    // Round down to a power of two, so the queue indices can be masked.
+    while (queueSize & (queueSize - 1))
+        queueSize &= queueSize - 1;
+
+    this->queueSize = max(queueSize, 2);
+    this->queue = new EdgeCaptureEvent[this->queueSize];
+    this->head = 0;
+    this->tail = 0;
+    this->waiting = false;
+    this->handled = 0;
+
+    resetStatistics();
+}
+
+/**
+ * Counter interrupt handler.
+ */
+void EdgeCapture::onCounter(uint16_t channels)
+{
+    if ((channels & 1) && instance)
+        instance->onEdge();
+}
+
+/**
+ * Moves every edge seen by the hardware into the queue.
+ */
+void EdgeCapture::onEdge()
+{
+    NRF_TIMER_Type *c = counter.timer;
+    uint32_t counted;
+
+    clock->TASKS_CAPTURE[EDGE_CAPTURE_ISR_CC] = 1;
+    uint32_t entered = clock->CC[EDGE_CAPTURE_ISR_CC];
+
+    do
+    {
+        bool pending;
+
+        do
+        {
+            for (int i = 0; i < count; i++)
+            {
+                int g = gpioteChannel + i;
+
+                if (NRF_GPIOTE->EVENTS_IN[g])
+                {
+                    // Read the timestamp before clearing the event, so an edge in between is counted as lost rather
+                    // than taking this edge's place.
+                    uint32_t timestamp = clock->CC[i];
+                    NRF_GPIOTE->EVENTS_IN[g] = 0;
+
+                    levels[i] = !levels[i];
+                    handled++;
+                    edges++;
+
+                    uint32_t latency = entered - timestamp;
+                    isrLatencyTotal += latency;
+                    if (latency > isrLatencyMax)
+                        isrLatencyMax = latency;
+
+                    int next = (head + 1) & (queueSize - 1);
+
+                    if (next == tail)
+                    {
+                        dropped++;
+                    }
+                    else
+                    {
+                        queue[head].timestamp = timestamp;
+                        queue[head].pin = i;
+                        queue[head].level = levels[i];
+                        head = next;
+                    }
+                }
+            }
+
+            c->TASKS_CAPTURE[1] = 1;
+            counted = c->CC[1];
+
+            // An edge can arrive after its pin was looked at but before the count was taken. Look again before
+            // treating the difference as lost.
+            pending = false;
+            for (int i = 0; i < count; i++)
+                if (NRF_GPIOTE->EVENTS_IN[gpioteChannel + i])
+                    pending = true;
+        } while (counted != handled && pending);
+
+        // Any difference between the edges counted by the hardware and those we've seen is edges that came too close
+        // together on the same pin to be told apart. Count them, and take the levels from the pins again. The count can
+        // trail the events by a cycle, so only ever count forwards.
+        if ((int32_t)(counted - handled) > 0)
+        {
+            lost += counted - handled;
+            handled = counted;
+
+            for (int i = 0; i < count; i++)
+                levels[i] = (pins[i]->name < 32 ? NRF_P0->IN >> pins[i]->name : NRF_P1->IN >> (pins[i]->name - 32)) & 1;
+        }
+
+        // Interrupt on the next edge. If one has arrived since we looked, its compare has been missed, so go round again.
+        c->CC[0] = handled + 1;
+        c->TASKS_CAPTURE[1] = 1;
+    } while (c->CC[1] != counted);
+
+    if (waiting && head != tail)
+    {
+        waiting = false;
+        Event(id, EDGE_CAPTURE_EVT_EDGE);
+    }
+}
+
+/**
+ * Starts capturing edges, from a timestamp of 0.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int EdgeCapture::start()
+{
+    if (running)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + count > 8 || ppiChannel < 0 || ppiChannel + count > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    clock->TASKS_STOP = 1;
+    clock->TASKS_CLEAR = 1;
+    clock->MODE = TIMER_MODE_MODE_Timer;
+    clock->BITMODE = TIMER_BITMODE_BITMODE_32Bit;
+    clock->PRESCALER = 4;
+    clock->SHORTS = 0;
+    clock->INTENCLR = 0xFFFFFFFF;
+
+    handled = 0;
+    instance = this;
+
+    counter.setMode(TimerModeCounter);
+    counter.setBitMode(BitMode32);
+    counter.setIRQ(onCounter);
+    counter.reset();
+    counter.setCompare(0, 1);
+    counter.enable();
+
+    for (int i = 0; i < count; i++)
+    {
+        int g = gpioteChannel + i;
+        int p = ppiChannel + i;
+
+        levels[i] = pins[i]->getDigitalValue();
+
+        NRF_GPIOTE->EVENTS_IN[g] = 0;
+        NRF_GPIOTE->CONFIG[g] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                (pins[i]->name << GPIOTE_CONFIG_PSEL_Pos) |
+                                (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos);
+
+        NRF_PPI->CH[p].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[g];
+        NRF_PPI->CH[p].TEP = (uint32_t) &clock->TASKS_CAPTURE[i];
+        NRF_PPI->FORK[p].TEP = (uint32_t) &counter.timer->TASKS_COUNT;
+        NRF_PPI->CHENSET = 1 << p;
+    }
+
+    running = true;
+    clock->TASKS_START = 1;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops capturing edges. Edges already captured can still be read.
+ */
+void EdgeCapture::stop()
+{
+    if (!running)
+        return;
+
+    for (int i = 0; i < count; i++)
+    {
+        NRF_PPI->CHENCLR = 1 << (ppiChannel + i);
+        NRF_PPI->FORK[ppiChannel + i].TEP = 0;
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = 0;
+    }
+
+    counter.disable();
+    clock->TASKS_STOP = 1;
+    running = false;
+}
+
+/**
+ * Takes the oldest edge from the queue.
+ * @param edge the edge read.
+ * @return DEVICE_OK, or DEVICE_NO_DATA if the queue is empty.
+ */
+int EdgeCapture::read(EdgeCaptureEvent &edge)
+{
+    if (tail == head)
+        return DEVICE_NO_DATA;
+
+    edge = queue[tail];
+    tail = (tail + 1) & (queueSize - 1);
+
+    uint32_t latency = now() - edge.timestamp;
+    readLatencyTotal += latency;
+    if (latency > readLatencyMax)
+        readLatencyMax = latency;
+    reads++;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Blocks the calling fiber until there is an edge to read.
+ */
+void EdgeCapture::waitForEdge()
+{
+    waiting = true;
+
+    if (tail == head)
+        fiber_wait_for_event(id, EDGE_CAPTURE_EVT_EDGE);
+
+    waiting = false;
+}
+
+/**
+ * Determines the time on the capture clock, in microseconds from when the capture started.
+ */
+uint32_t EdgeCapture::now()
+{
+    clock->TASKS_CAPTURE[EDGE_CAPTURE_FIBER_CC] = 1;
+    return clock->CC[EDGE_CAPTURE_FIBER_CC];
+}
+
+/**
+ * Determines the number of edges lost or dropped since the statistics were last reset.
+ */
+uint32_t EdgeCapture::getLostEdges()
+{
+    return lost + dropped;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void EdgeCapture::resetStatistics()
+{
+    target_disable_irq();
+    edges = 0;
+    lost = 0;
+    dropped = 0;
+    isrLatencyMax = 0;
+    isrLatencyTotal = 0;
+    readLatencyMax = 0;
+    readLatencyTotal = 0;
+    reads = 0;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void EdgeCapture::printStatistics()
+{
+    DMESG("EDGE_CAPTURE: [PINS: %d]", count);
+    DMESG("   EDGES: %d", edges);
+    DMESG("   LOST: %d", lost);
+    DMESG("   DROPPED: %d", dropped);
+    DMESG("   EDGE TO HANDLER: [AVG: %d us] [MAX: %d us]", edges ? isrLatencyTotal / edges : 0, isrLatencyMax);
+    DMESG("   EDGE TO FIBER: [AVG: %d us] [MAX: %d us]", reads ? readLatencyTotal / reads : 0, readLatencyMax);
+}
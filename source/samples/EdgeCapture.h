@@ -0,0 +1,172 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+
+#ifndef EDGE_CAPTURE_H
+#define EDGE_CAPTURE_H
+
+#define EDGE_CAPTURE_ID                         3106
+
+#define EDGE_CAPTURE_EVT_EDGE                   1
+
+// The timestamp timer has a capture register for each pin, and two more to read the time from the interrupt and from
+// fibers.
+#define EDGE_CAPTURE_MAX_PINS                   4
+#define EDGE_CAPTURE_ISR_CC                     4
+#define EDGE_CAPTURE_FIBER_CC                   5
+
+#define EDGE_CAPTURE_DEFAULT_QUEUE_SIZE         256
+
+// Default peripheral resources. One GPIOTE channel and one PPI channel per pin.
+#define EDGE_CAPTURE_DEFAULT_GPIOTE             4
+#define EDGE_CAPTURE_DEFAULT_PPI                15
+
+/**
+ * An edge on a captured pin.
+ */
+struct EdgeCaptureEvent
+{
+    uint32_t    timestamp;              // The time of the edge, in microseconds from when the capture started.
+    uint8_t     pin;                    // The index of the pin, in the array given to EdgeCapture.
+    uint8_t     level;                  // The level of the pin after the edge: 1 for a rising edge, 0 for falling.
+};
+
+/**
+ * Records every edge on a few pins, with the time it happened to the microsecond, without polling.
+ *
+ * Each pin is watched by a GPIOTE channel in toggle mode, and its PPI channel does two things the moment an edge is
+ * seen: it captures a free running 1MHz TIMER into that pin's capture register, timestamping the edge in hardware,
+ * and (through the PPI fork) counts the edge on a second TIMER in counter mode, whose compare interrupt runs the
+ * handler. GPIOTE's own interrupt belongs to CODAL, which is why the interrupt comes from the counter.
+ *
+ * The handler moves each edge into a lock-free queue, to be drained by a fiber with read(). It raises a message bus
+ * event when a fiber is waiting in waitForEdge(). Two edges on the same pin close enough together that the handler
+ * sees only one are still counted by the hardware, so the number lost is always known, as is the number dropped
+ * because the queue was full. The latency from each edge to the handler, and from each edge to the fiber that reads
+ * it, are measured.
+ */
+class EdgeCapture
+{
+    NRF52Pin                *pins[EDGE_CAPTURE_MAX_PINS];
+    uint8_t                 levels[EDGE_CAPTURE_MAX_PINS];
+    int                     count;
+    NRF_TIMER_Type          *clock;
+    NRFLowLevelTimer        counter;
+    int                     gpioteChannel;
+    int                     ppiChannel;
+    uint16_t                id;
+    bool                    running;
+
+    EdgeCaptureEvent        *queue;
+    int                     queueSize;
+    volatile int            head;               // The next event to be written, by the interrupt handler.
+    volatile int            tail;               // The next event to be read.
+    volatile bool           waiting;
+    uint32_t                handled;            // Edges counted by the handler, to compare with the hardware count.
+
+    // Statistics.
+    uint32_t                edges;
+    uint32_t                lost;
+    uint32_t                dropped;
+    uint32_t                isrLatencyMax;
+    uint32_t                isrLatencyTotal;
+    uint32_t                readLatencyMax;
+    uint32_t                readLatencyTotal;
+    uint32_t                reads;
+
+    static EdgeCapture      *instance;
+
+    /**
+     * Counter interrupt handler.
+     */
+    static void onCounter(uint16_t channels);
+
+    /**
+     * Moves every edge seen by the hardware into the queue.
+     */
+    void onEdge();
+
+    public:
+    /**
+     * Creates an edge capture component.
+     * @param pins the pins to watch. These are made digital inputs, keeping any pull already set.
+     * @param count the number of pins, up to EDGE_CAPTURE_MAX_PINS.
+     * @param clock the timer used to timestamp edges. This must have six compare registers (TIMER3 or TIMER4), and
+     * must not be shared.
+     * @param counter the timer used to count edges, which must not be shared.
+     * @param irqn the interrupt of the counter timer.
+     * @param gpioteChannel the first of 'count' consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of 'count' consecutive PPI channels to use.
+     * @param queueSize the number of edges that can be held waiting to be read, as a power of two.
+     * @param id the ID to use for events raised by this component.
+     */
+    EdgeCapture(NRF52Pin *const *pins, int count, NRF_TIMER_Type *clock = NRF_TIMER3, NRF_TIMER_Type *counter = NRF_TIMER0, IRQn_Type irqn = TIMER0_IRQn, int gpioteChannel = EDGE_CAPTURE_DEFAULT_GPIOTE, int ppiChannel = EDGE_CAPTURE_DEFAULT_PPI, int queueSize = EDGE_CAPTURE_DEFAULT_QUEUE_SIZE, uint16_t id = EDGE_CAPTURE_ID);
+
+    /**
+     * Starts capturing edges, from a timestamp of 0.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int start();
+
+    /**
+     * Stops capturing edges. Edges already captured can still be read.
+     */
+    void stop();
+
+    /**
+     * Takes the oldest edge from the queue.
+     * @param edge the edge read.
+     * @return DEVICE_OK, or DEVICE_NO_DATA if the queue is empty.
+     */
+    int read(EdgeCaptureEvent &edge);
+
+    /**
+     * Blocks the calling fiber until there is an edge to read.
+     */
+    void waitForEdge();
+
+    /**
+     * Determines the time on the capture clock, in microseconds from when the capture started.
+     */
+    uint32_t now();
+
+    /**
+     * Determines the number of edges lost or dropped since the statistics were last reset.
+     */
+    uint32_t getLostEdges();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
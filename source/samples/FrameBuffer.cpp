@@ -0,0 +1,132 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "FrameBuffer.h"
+#include "Tests.h"
+
+/**
+ * Creates a frame buffer for the given display. The display's image is the front buffer.
+ * @param display the display to double buffer.
+ * @param id the ID to use for events raised by this component.
+ */
+FrameBuffer::FrameBuffer(MicroBitDisplay &display, uint16_t id) : display(display), back(display.image.getWidth(), display.image.getHeight())
+{
+    this->id = id;
+    this->pending = false;
+    this->waiters = 0;
+
+    resetStatistics();
+
+    status |= DEVICE_COMPONENT_STATUS_SYSTEM_TICK;
+}
+
+/**
+ * The image to draw the next frame into. Its content is whatever was presented two frames ago.
+ * Don't draw into it between present() and the following vsync.
+ */
+MicroBitImage &FrameBuffer::image()
+{
+    return back;
+}
+
+/**
+ * Requests that the back buffer is shown from the next system tick, and returns immediately.
+ * Presenting again before the swap has happened just replaces the pending frame.
+ */
+void FrameBuffer::present()
+{
+    if (pending)
+        dropped++;
+
+    pending = true;
+}
+
+/**
+ * Blocks the calling fiber until the next vsync.
+ */
+void FrameBuffer::waitForVsync()
+{
+    // The event is raised on every tick while anyone is waiting, so a tick between here and the wait can't be missed.
+    waiters++;
+    fiber_wait_for_event(id, FRAME_BUFFER_EVT_VSYNC);
+    waiters--;
+}
+
+/**
+ * Presents the back buffer, and blocks the calling fiber until it's being shown and the back buffer can be drawn.
+ */
+void FrameBuffer::swap()
+{
+    present();
+    waitForVsync();
+}
+
+/**
+ * Performs any pending swap and raises the vsync event. Called by the scheduler on every system tick.
+ */
+void FrameBuffer::periodicCallback()
+{
+    if (pending)
+    {
+        // Exchange the pixels rather than the images, as assigning a MicroBitImage changes reference counts (and can
+        // free memory), which has no place in an interrupt.
+        uint8_t *shown = display.image.getBitmap();
+        uint8_t *drawn = back.getBitmap();
+        int size = back.getWidth() * back.getHeight();
+
+        for (int i = 0; i < size; i++)
+        {
+            uint8_t pixel = shown[i];
+            shown[i] = drawn[i];
+            drawn[i] = pixel;
+        }
+
+        pending = false;
+        swaps++;
+    }
+    else if (waiters == 0)
+    {
+        return;
+    }
+
+    Event(id, FRAME_BUFFER_EVT_VSYNC);
+}
+
+/**
+ * Clears the statistics.
+ */
+void FrameBuffer::resetStatistics()
+{
+    swaps = 0;
+    dropped = 0;
+}
+
+/**
+ * Output the swap statistics gathered to the DMESG buffer.
+ */
+void FrameBuffer::printStatistics()
+{
+    DMESG("FRAME_BUFFER: [SWAPS: %d, DROPPED: %d]", swaps, dropped);
+}
@@ -0,0 +1,106 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+
+#ifndef FRAME_BUFFER_H
+#define FRAME_BUFFER_H
+
+#define FRAME_BUFFER_ID                         3104
+
+#define FRAME_BUFFER_EVT_VSYNC                  1
+
+/**
+ * Double buffering for the display.
+ *
+ * Frames are drawn into a back buffer that the display never reads, then presented. The swap happens on the next
+ * system tick, in interrupt context, by exchanging the pixels of the back buffer with those of the display's image, a
+ * byte at a time. Nothing is allocated or reference counted in the interrupt, and the display keeps the same image.
+ *
+ * CODAL gives no hook for the end of a display scan, so the swap isn't synchronised with the refresh: a scan that is
+ * in progress at the tick (or interrupts the exchange) can show some rows of the old frame and some of the new one.
+ * That lasts for the one scan only, and no partly drawn frame is ever shown.
+ *
+ * A FRAME_BUFFER_EVT_VSYNC event is raised after each swap (and on the next tick for anyone waiting), so a fiber can
+ * draw, swap() and redraw in lock step with the display without ever touching a frame that's being shown.
+ */
+class FrameBuffer : public CodalComponent
+{
+    MicroBitDisplay     &display;
+    MicroBitImage       back;
+    volatile bool       pending;
+    volatile int        waiters;
+
+    // Statistics.
+    int                 swaps;
+    int                 dropped;
+
+    public:
+    /**
+     * Creates a frame buffer for the given display. The display's image is the front buffer.
+     * @param display the display to double buffer.
+     * @param id the ID to use for events raised by this component.
+     */
+    FrameBuffer(MicroBitDisplay &display, uint16_t id = FRAME_BUFFER_ID);
+
+    /**
+     * The image to draw the next frame into. Its content is whatever was presented two frames ago.
+     * Don't draw into it between present() and the following vsync.
+     */
+    MicroBitImage &image();
+
+    /**
+     * Requests that the back buffer is shown from the next system tick, and returns immediately.
+     * Presenting again before the swap has happened just replaces the pending frame.
+     */
+    void present();
+
+    /**
+     * Blocks the calling fiber until the next vsync.
+     */
+    void waitForVsync();
+
+    /**
+     * Presents the back buffer, and blocks the calling fiber until it's being shown and the back buffer can be drawn.
+     */
+    void swap();
+
+    /**
+     * Performs any pending swap and raises the vsync event. Called by the scheduler on every system tick.
+     */
+    virtual void periodicCallback();
+
+    /**
+     * Clears the statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the swap statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -2,6 +2,13 @@
 #include "Tests.h"
 #include "NRF52PWM.h"
 #include "MemorySource.h"
+#include "LogicAnalyzer.h"
+#include "EdgeCapture.h"
+#include "SoftSerial.h"
+#include "PulseMeter.h"
+#include "WaveformGenerator.h"
+#include "AnalogScanSource.h"
+#include "SerialStreamer.h"
 
 Pin *edgeConnector[] = {
     &uBit.io.P0, 
@@ -25,8 +32,16 @@ Pin *edgeConnector[] = {
     &uBit.io.P20
 };
 
+// The edge connector number of each pin in edgeConnector, to name them in logic analyzer captures.
+static const uint8_t edgeConnectorLabels[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 19, 20};
+
+#define EDGE_CONNECTOR_PINS                     (sizeof(edgeConnector) / sizeof(Pin *))
+
+static LogicAnalyzer *logicAnalyzer = NULL;
+
 //Pin *analogPins[] = {&uBit.io.P1, &uBit.io.P2};
 static Pin *analogPins[] = {&uBit.io.P1};
+static Pin *analogScanPins[] = {&uBit.io.P0, &uBit.io.P1, &uBit.io.P2};
 static NRF52PWM *pwm = NULL;
 static MemorySource *pwmSource = NULL;
 
@@ -89,20 +104,39 @@ analog_test()
         uBit.sleep(100);
     }
 }
+static EdgeCapture *edgeCapture = NULL;
+
+static EdgeCapture *getEdgeCapture()
+{
+    if (edgeCapture == NULL)
+    {
+        NRF52Pin *pins[] = {&uBit.io.P2};
+        edgeCapture = new EdgeCapture(pins, 1);
+    }
+
+    return edgeCapture;
+}
+
+// Toggles P1 every 100ms and follows P2 on the top left LED, so linking the two shows the loop working. P2 is watched
+// by EdgeCapture rather than polled, so every edge on it is seen with its time, however short the pulse.
 void
 gpio_test()
 {
+    EdgeCapture *capture = getEdgeCapture();
+    EdgeCaptureEvent edge;
     int value = 0;
 
     uBit.io.P2.getDigitalValue();
     uBit.io.P2.setPull(PullMode::Up);
+    capture->start();
 
     while(1)
     {
-        if (uBit.io.P2.getDigitalValue())
-            uBit.display.image.setPixelValue(0,0,255);
-        else
-            uBit.display.image.setPixelValue(0,0,0);
+        while (capture->read(edge) == DEVICE_OK)
+        {
+            uBit.display.image.setPixelValue(0,0,edge.level ? 255 : 0);
+            DMESG("P2: %s @ %d us", edge.level ? "RISE" : "FALL", edge.timestamp);
+        }
 
         uBit.io.P1.setDigitalValue(value);
         value = !value;
@@ -195,3 +229,427 @@ pwm_test()
     // Should never get here...
     DMESG("SPEAKER TEST: EXITING...");
 }
+
+static LogicAnalyzer *getLogicAnalyzer()
+{
+    if (logicAnalyzer == NULL)
+    {
+        NRF52Pin *pins[EDGE_CONNECTOR_PINS];
+
+        for (unsigned int i = 0; i < EDGE_CONNECTOR_PINS; i++)
+            pins[i] = (NRF52Pin *)edgeConnector[i];
+
+        logicAnalyzer = new LogicAnalyzer(pins, edgeConnectorLabels, EDGE_CONNECTOR_PINS);
+    }
+
+    return logicAnalyzer;
+}
+
+#define LOGIC_ANALYZER_TEST_RATE                250000
+#define LOGIC_ANALYZER_TEST_BAUD                1000000
+
+// Samples every pin on the edge connector and streams the transitions over serial, as a cheap bus sniffer. Capture the
+// serial output to a file, and convert it with utils/host/logic_vcd to view it in any VCD viewer (such as GTKWave).
+void
+logic_analyzer_test()
+{
+    // The display and buttons share pins with the edge connector.
+    uBit.display.disable();
+    uBit.buttonA.disable();
+    uBit.buttonB.disable();
+
+    LogicAnalyzer *analyzer = getLogicAnalyzer();
+
+    uBit.serial.setBaud(LOGIC_ANALYZER_TEST_BAUD);
+    analyzer->start(LOGIC_ANALYZER_TEST_RATE);
+
+    while(1)
+    {
+        analyzer->stream();
+        uBit.sleep(10);
+    }
+}
+
+#define LOGIC_ANALYZER_BENCHMARK_MS             500
+
+static const int logicAnalyzerBenchmarkRates[] = {100000, 200000, 250000, 320000, 400000, 500000, 640000, 800000, 1000000};
+
+// Runs the logic analyzer over the edge connector at increasing sample rates, streaming at the test baud rate as
+// logic_analyzer_test does, and reports the highest rate that it sustains without missing or dropping a sample.
+void
+logic_analyzer_benchmark()
+{
+    uBit.display.disable();
+    uBit.buttonA.disable();
+    uBit.buttonB.disable();
+
+    LogicAnalyzer *analyzer = getLogicAnalyzer();
+    int sustained = 0;
+
+    uBit.serial.setBaud(LOGIC_ANALYZER_TEST_BAUD);
+
+    for (int rate : logicAnalyzerBenchmarkRates)
+    {
+        analyzer->start(rate);
+
+        CODAL_TIMESTAMP end = system_timer_current_time() + LOGIC_ANALYZER_BENCHMARK_MS;
+
+        while (system_timer_current_time() < end)
+        {
+            analyzer->stream();
+            uBit.sleep(10);
+        }
+
+        analyzer->stop();
+        analyzer->stream();
+
+        analyzer->printStatistics();
+
+        if (analyzer->getMissedSamples() == 0 && analyzer->getDroppedSamples() == 0)
+            sustained = analyzer->getSampleRate();
+    }
+
+    DMESG("LOGIC_ANALYZER_BENCHMARK: [MAX SUSTAINED RATE: %d Hz]", sustained);
+}
+
+#define ANALOG_SCAN_TEST_RATE                   1000
+
+// Samples P0, P1 and P2 together, and streams them interleaved over serial.
+void
+analog_scan_test()
+{
+    static AnalogScanSource *source = NULL;
+    static SerialStreamer *streamer = NULL;
+
+    if (source == NULL)
+    {
+        source = new AnalogScanSource(uBit.adc, analogScanPins, 3);
+        source->setSampleRate(ANALOG_SCAN_TEST_RATE);
+    }
+
+    if (streamer == NULL)
+        streamer = new SerialStreamer(*source, SERIAL_STREAM_MODE_DECIMAL);
+
+    while(1)
+    {
+        uBit.sleep(5000);
+        source->printStatistics();
+    }
+}
+
+/**
+ * A sink that just counts the bytes streamed to it.
+ */
+class AnalogScanCounter : public DataSink
+{
+    DataSource          &upstream;
+
+    public:
+    volatile uint32_t   bytes;
+
+    AnalogScanCounter(DataSource &source) : upstream(source)
+    {
+        bytes = 0;
+        upstream.connect(*this);
+    }
+
+    virtual int pullRequest()
+    {
+        bytes += upstream.pull().length();
+        return DEVICE_OK;
+    }
+};
+
+// Spins for the given time, counting iterations. Everything done in interrupt context in the meantime is time not
+// spent counting, so comparing counts gives the CPU load.
+static uint32_t idle_iterations(int ms)
+{
+    uint32_t iterations = 0;
+    CODAL_TIMESTAMP end = system_timer_current_time_us() + ms * 1000;
+
+    while (system_timer_current_time_us() < end)
+        iterations++;
+
+    return iterations;
+}
+
+#define ANALOG_SCAN_BENCHMARK_MS                500
+
+static const int analogScanBenchmarkRates[] = {1000, 5000, 10000, 20000};
+
+// Measures the CPU load of sampling and interleaving 1, 2 and 3 channels at a range of sample rates.
+void
+analog_scan_benchmark()
+{
+    uint32_t idle = idle_iterations(ANALOG_SCAN_BENCHMARK_MS);
+
+    DMESG("ANALOG_SCAN_BENCHMARK: [IDLE: %d iterations]", idle);
+
+    for (int channels = 1; channels <= 3; channels++)
+    {
+        for (int rate : analogScanBenchmarkRates)
+        {
+            AnalogScanSource *source = new AnalogScanSource(uBit.adc, analogScanPins, channels);
+            AnalogScanCounter *counter = new AnalogScanCounter(*source);
+
+            source->setSampleRate(rate);
+            uBit.sleep(100);
+
+            source->resetStatistics();
+            counter->bytes = 0;
+
+            uint32_t busy = idle_iterations(ANALOG_SCAN_BENCHMARK_MS);
+            int samples = counter->bytes / DATASTREAM_FORMAT_BYTES_PER_SAMPLE(source->getFormat()) * 1000 / ANALOG_SCAN_BENCHMARK_MS;
+
+            DMESG("   %d x %d Hz: [SAMPLES/S: %d] [CPU: %d%%]", channels, rate, samples, 100 - (int)(busy * 100ULL / idle));
+            source->printStatistics();
+
+            source->disconnect();
+            delete counter;
+            delete source;
+        }
+    }
+}
+
+#define EDGE_CAPTURE_BENCHMARK_MS               200
+
+static const int edgeCaptureBenchmarkPeriods[] = {1000, 200, 100, 50, 20, 10, 5};
+
+// With P1 linked to P2 (as for gpio_test), drives P1 with a square wave of decreasing period and drains the edges seen
+// on P2 from a fiber, reporting the latency from edge to handler and to fiber, and the highest edge rate captured
+// without losing an edge.
+void
+edge_capture_benchmark()
+{
+    EdgeCapture *capture = getEdgeCapture();
+    EdgeCaptureEvent edge;
+    int sustained = 0;
+
+    uBit.io.P2.getDigitalValue();
+    uBit.io.P2.setPull(PullMode::Up);
+
+    for (int period : edgeCaptureBenchmarkPeriods)
+    {
+        uBit.io.P1.setAnalogValue(512);
+        uBit.io.P1.setAnalogPeriodUs(period);
+
+        capture->start();
+        capture->resetStatistics();
+
+        int edges = 0;
+        CODAL_TIMESTAMP end = system_timer_current_time_us() + EDGE_CAPTURE_BENCHMARK_MS * 1000;
+
+        while (system_timer_current_time_us() < end)
+            while (capture->read(edge) == DEVICE_OK)
+                edges++;
+
+        capture->stop();
+        while (capture->read(edge) == DEVICE_OK)
+            edges++;
+
+        int rate = edges * 1000 / EDGE_CAPTURE_BENCHMARK_MS;
+
+        DMESG("EDGE_CAPTURE_BENCHMARK: [PERIOD: %d us] [EDGES/S: %d]", period, rate);
+        capture->printStatistics();
+
+        if (edges && capture->getLostEdges() == 0)
+            sustained = max(sustained, rate);
+    }
+
+    uBit.io.P1.setDigitalValue(0);
+
+    DMESG("EDGE_CAPTURE_BENCHMARK: [MAX EDGE RATE: %d edges/s]", sustained);
+}
+
+#define SOFT_SERIAL_LOOPBACK_BYTES              4096
+#define SOFT_SERIAL_LOOPBACK_TIMEOUT_MS         10000
+
+static const int softSerialLoopbackBauds[] = {9600, 57600, 115200, 230400, 460800, 921600};
+
+// The byte sent at each position of the loopback test, so that the receiver can check it without any shared state.
+static uint8_t soft_serial_pattern(uint32_t i)
+{
+    return (i * 2654435761UL) >> 24;
+}
+
+// Keeps the speaker busy for the whole loopback test.
+static void soft_serial_audio()
+{
+    while(1)
+        uBit.audio.soundExpressions.play("giggle");
+}
+
+// With P1 linked to P2 (as for gpio_test), sends a stream of bytes from a SoftSerial on P1 to itself on P2 at
+// increasing baud rates, while the display scrolls and the speaker plays, and reports the bytes received, those
+// received wrong, and the throughput at each rate. The SoftSerial keeps off the display's TIMER4, so the scrolling
+// text is a fair load.
+void
+soft_serial_loopback_test()
+{
+    static SoftSerial *serial = NULL;
+
+    if (serial == NULL)
+        serial = new SoftSerial(uBit.io.P1, uBit.io.P2);
+
+    uBit.io.P2.getDigitalValue();
+    uBit.io.P2.setPull(PullMode::Up);
+
+    uBit.display.scrollAsync(ManagedString("SOFT SERIAL LOOPBACK"), 60);
+    create_fiber(soft_serial_audio);
+
+    for (int baud : softSerialLoopbackBauds)
+    {
+        uint8_t buffer[32];
+        int sent = 0;
+        int received = 0;
+        int errors = 0;
+
+        serial->setBaud(baud);
+        serial->start();
+        serial->resetStatistics();
+
+        CODAL_TIMESTAMP start = system_timer_current_time_us();
+        CODAL_TIMESTAMP timeout = start + SOFT_SERIAL_LOOPBACK_TIMEOUT_MS * 1000;
+
+        while (received < SOFT_SERIAL_LOOPBACK_BYTES && system_timer_current_time_us() < timeout)
+        {
+            int n = min((int)sizeof(buffer), SOFT_SERIAL_LOOPBACK_BYTES - sent);
+
+            for (int i = 0; i < n; i++)
+                buffer[i] = soft_serial_pattern(sent + i);
+
+            sent += serial->write(buffer, n);
+
+            while ((n = serial->read(buffer, sizeof(buffer))) > 0)
+            {
+                for (int i = 0; i < n; i++)
+                    if (buffer[i] != soft_serial_pattern(received++))
+                        errors++;
+            }
+
+            uBit.sleep(1);
+        }
+
+        int elapsed = (int)(system_timer_current_time_us() - start);
+
+        serial->stop();
+
+        DMESG("SOFT_SERIAL_LOOPBACK: [BAUD: %d] [SENT: %d] [RECEIVED: %d] [ERRORS: %d] [BYTES/S: %d]", baud, sent, received, errors, (int)(received * 1000000ULL / elapsed));
+        serial->printStatistics();
+    }
+}
+
+static PulseMeter *pulseMeter = NULL;
+
+static PulseMeter *getPulseMeter()
+{
+    if (pulseMeter == NULL)
+        pulseMeter = new PulseMeter(uBit.io.P2);
+
+    return pulseMeter;
+}
+
+// Each PWM setting of the pulse meter test: the period in microseconds, and the duty cycle out of 1024.
+static const int pulseMeterTestSettings[][2] = {{20000, 102}, {1000, 256}, {1000, 512}, {1000, 768}, {100, 512}, {20, 512}};
+
+// With P1 linked to P2 (as for gpio_test), drives P1 with PWM at a range of periods and duty cycles, and reports what
+// the pulse meter on P2 makes of each.
+void
+pulse_meter_test()
+{
+    PulseMeter *meter = getPulseMeter();
+
+    meter->start();
+
+    for (auto &setting : pulseMeterTestSettings)
+    {
+        uBit.io.P1.setAnalogValue(setting[1]);
+        uBit.io.P1.setAnalogPeriodUs(setting[0]);
+
+        // Let the meter see a whole gate of the new signal before reading it.
+        uBit.sleep(3 * PULSE_METER_DEFAULT_GATE_MS);
+
+        DMESG("PULSE_METER_TEST: [SET: %d us, %d/1024] [MEASURED: %d mHz, %d ns, %d/10000]", setting[0], setting[1],
+              (int)(meter->getFrequency() * 1000), (int)(meter->getPeriod() * 1000), (int)(meter->getDutyCycle() * 100));
+    }
+
+    uBit.io.P1.setDigitalValue(0);
+    uBit.sleep(PULSE_METER_DEFAULT_TIMEOUT_MS + PULSE_METER_DEFAULT_GATE_MS);
+
+    meter->printStatistics();
+    meter->stop();
+}
+
+// Measures a sensor's output on P2 continuously, streaming the frequency (mHz), period (ns) and duty cycle (hundredths
+// of a percent) over serial.
+void
+pulse_meter_stream_test()
+{
+    static SerialStreamer *streamer = NULL;
+
+    PulseMeter *meter = getPulseMeter();
+
+    if (streamer == NULL)
+        streamer = new SerialStreamer(*meter, SERIAL_STREAM_MODE_DECIMAL);
+
+    meter->start();
+
+    while(1)
+    {
+        uBit.sleep(5000);
+        meter->printStatistics();
+    }
+}
+
+#define WAVEFORM_GENERATOR_TEST_MS              500
+
+// One cycle of a lopsided wave, to show a custom table.
+static const int16_t waveformTestCycle[] = {0, 32767, 16384, 32767, 0, -32767, -16384, -32767};
+
+static const int waveformTestFrequencies[] = {220, 440, 880, 1760, 3520};
+
+// Plays a sine wave on the speaker, the same sine 120 degrees behind on P0, and a custom wave on P1, all in sync.
+// Reports the CPU time left over at each of a few frequencies, then sweeps the frequency in small steps to show that
+// retuning doesn't glitch.
+void
+waveform_generator_test()
+{
+    static WaveformGenerator *generator = NULL;
+
+    if (generator == NULL)
+    {
+        generator = new WaveformGenerator();
+        generator->connectPin(uBit.io.speaker, 0);
+        generator->connectPin(uBit.io.P0, 1);
+        generator->connectPin(uBit.io.P1, 2);
+    }
+
+    uBit.io.speaker.setHighDrive(true);
+
+    generator->setWaveform(0, WAVEFORM_SINE);
+    generator->setWaveform(1, WAVEFORM_SINE, WAVEFORM_GENERATOR_MAX_AMPLITUDE, 120);
+    generator->setCustomWaveform(2, waveformTestCycle, sizeof(waveformTestCycle) / sizeof(int16_t));
+
+    uint32_t idle = idle_iterations(WAVEFORM_GENERATOR_TEST_MS);
+
+    DMESG("WAVEFORM_GENERATOR_TEST: [IDLE: %d iterations]", idle);
+
+    generator->start();
+
+    for (int frequency : waveformTestFrequencies)
+    {
+        generator->setFrequency(frequency);
+
+        uint32_t busy = idle_iterations(WAVEFORM_GENERATOR_TEST_MS);
+        DMESG("   %d Hz: [PLAYING: %d mHz] [CPU: %d%%]", frequency, (int)(generator->getFrequency() * 1000), 100 - (int)(busy * 100ULL / idle));
+    }
+
+    for (int frequency = 200; frequency <= 2000; frequency += 5)
+    {
+        generator->setFrequency(frequency);
+        uBit.sleep(10);
+    }
+
+    generator->printStatistics();
+    generator->stop();
+}
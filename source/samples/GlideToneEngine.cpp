@@ -0,0 +1,243 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GlideToneEngine.h"
+#include "Tests.h"
+
+/**
+ * Creates a glide tone engine.
+ * @param module the PWM module to use. This must not be shared with any other component.
+ */
+GlideToneEngine::GlideToneEngine(NRF_PWM_Type *module)
+{
+    this->PWM = module;
+    this->buffer = 0;
+    this->slide = 1;
+    this->stepMs = GLIDE_TONE_DEFAULT_STEP_MS;
+    this->fromFrequency = 0;
+    this->targetFrequency = 0;
+    this->startTime = 0;
+    this->playing = false;
+
+    for (int i = 0; i < GLIDE_TONE_CHANNELS; i++)
+        PWM->PSEL.OUT[i] = (PWM_PSEL_OUT_CONNECT_Disconnected << PWM_PSEL_OUT_CONNECT_Pos);
+
+    // Run the counter at 1MHz, so sequence entries are in microseconds. In waveform mode, the fourth value of each
+    // entry is the COUNTERTOP of that period. Sequence 0 (the glide) is always followed by sequence 1 (the sustain).
+    // Started from sequence 1, a loop is just sequence 1, so restarting it whenever the loop is done holds the sustain
+    // until the PWM is stopped.
+    PWM->ENABLE = (PWM_ENABLE_ENABLE_Enabled << PWM_ENABLE_ENABLE_Pos);
+    PWM->MODE = (PWM_MODE_UPDOWN_Up << PWM_MODE_UPDOWN_Pos);
+    PWM->PRESCALER = (PWM_PRESCALER_PRESCALER_DIV_16 << PWM_PRESCALER_PRESCALER_Pos);
+    PWM->DECODER = (PWM_DECODER_LOAD_WaveForm << PWM_DECODER_LOAD_Pos) | (PWM_DECODER_MODE_RefreshCount << PWM_DECODER_MODE_Pos);
+    PWM->LOOP = (1 << PWM_LOOP_CNT_Pos);
+    PWM->SEQ[0].ENDDELAY = 0;
+    PWM->SEQ[1].ENDDELAY = 0;
+    PWM->SHORTS = PWM_SHORTS_LOOPSDONE_SEQSTART1_Msk;
+    PWM->INTEN = 0;
+}
+
+/**
+ * Fills the given PWM sequence entry with a 50% duty cycle square wave of the given period.
+ */
+void GlideToneEngine::setEntry(uint16_t *entry, uint32_t top)
+{
+    entry[0] = top / 2;
+    entry[1] = top / 2;
+    entry[2] = top / 2;
+    entry[3] = top;
+}
+
+/**
+ * Precomputes a glide into the given sequence buffer. Each step of the glide is held for as many whole PWM periods
+ * as fit in stepMs, so the slide takes the same time as if it were stepped by a timer.
+ * @param sequence the buffer to fill, or NULL to just count the entries needed.
+ * @param refresh the number of additional periods each entry is repeated for.
+ * @return the number of entries written, or -1 if the glide doesn't fit at the given refresh count.
+ */
+int GlideToneEngine::buildGlide(uint16_t (*sequence)[4], int refresh)
+{
+    uint32_t stepUs = stepMs * 1000;
+    uint32_t elapsed = 0;
+    uint32_t stepEnd = 0;
+    int frequency = fromFrequency;
+    int entries = 0;
+
+    while (true)
+    {
+        int delta = (targetFrequency - frequency) / slide;
+
+        // Once within a step of the target, settle on it.
+        if (delta == 0)
+            break;
+
+        frequency += delta;
+        stepEnd += stepUs;
+
+        uint32_t top = 1000000 / (frequency < GLIDE_TONE_MIN_FREQUENCY ? GLIDE_TONE_MIN_FREQUENCY : frequency);
+
+        while (elapsed < stepEnd)
+        {
+            if (sequence)
+            {
+                if (entries == GLIDE_TONE_MAX_ENTRIES)
+                    return -1;
+
+                setEntry(sequence[entries], top);
+            }
+
+            entries++;
+            elapsed += top * (refresh + 1);
+        }
+    }
+
+    return entries;
+}
+
+/**
+ * Routes the tone to the given pin.
+ * @param pin the pin to drive.
+ * @param channel the PWM channel to use, in the range 0..2.
+ */
+int GlideToneEngine::connectPin(Pin &pin, int channel)
+{
+    if (channel < 0 || channel >= GLIDE_TONE_CHANNELS)
+        return DEVICE_INVALID_PARAMETER;
+
+    // Release the pin from any other peripheral, and leave it low while no tone is playing.
+    pin.setDigitalValue(0);
+    pin.setHighDrive(true);
+
+    PWM->PSEL.OUT[channel] = (pin.name << PWM_PSEL_OUT_PIN_Pos) | (PWM_PSEL_OUT_CONNECT_Connected << PWM_PSEL_OUT_CONNECT_Pos);
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the glide between notes.
+ * @param slide each step moves 1/slide of the way to the new frequency. 1 disables glides.
+ * @param stepMs the duration of each step, in milliseconds.
+ */
+int GlideToneEngine::setSlide(int slide, int stepMs)
+{
+    if (slide < 1 || stepMs < 1)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->slide = slide;
+    this->stepMs = stepMs;
+    return DEVICE_OK;
+}
+
+/**
+ * Glides to the given frequency, and holds it until the next call to play() or stop().
+ * This precomputes the glide and returns immediately. The target frequency is then held by the hardware, which
+ * restarts the sustain sequence whenever it ends, without the CPU.
+ * @param frequency the frequency to play, in Hz. Zero stops the tone.
+ * @param from the frequency to start the glide from, or -1 to continue from the frequency currently sounding.
+ */
+int GlideToneEngine::play(int frequency, int from)
+{
+    if (frequency < 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    if (frequency == 0)
+    {
+        stop();
+        return DEVICE_OK;
+    }
+
+    fromFrequency = from < 0 ? getFrequency() : from;
+    targetFrequency = frequency;
+
+    // Build into the buffers not in use, as the PWM may still be reading the current ones until the end of its period.
+    int b = buffer ^ 1;
+
+    // Find the smallest refresh count that lets the whole glide fit into the buffer at one entry per period or more.
+    int refresh = buildGlide(NULL, 0) / GLIDE_TONE_MAX_ENTRIES;
+    int entries;
+
+    while ((entries = buildGlide(glide[b], refresh)) < 0)
+        refresh++;
+
+    setEntry(sustain[b], 1000000 / (frequency < GLIDE_TONE_MIN_FREQUENCY ? GLIDE_TONE_MIN_FREQUENCY : frequency));
+
+    // With no glide to play, sequence 0 holds just a single period of the target frequency.
+    if (entries == 0)
+    {
+        setEntry(glide[b][0], sustain[b][3]);
+        entries = 1;
+    }
+
+    PWM->SEQ[0].PTR = ((uint32_t)(glide[b]) << PWM_SEQ_PTR_PTR_Pos);
+    PWM->SEQ[0].CNT = ((entries * 4) << PWM_SEQ_CNT_CNT_Pos);
+    PWM->SEQ[0].REFRESH = refresh;
+    PWM->SEQ[1].PTR = ((uint32_t)(sustain[b]) << PWM_SEQ_PTR_PTR_Pos);
+    PWM->SEQ[1].CNT = (4 << PWM_SEQ_CNT_CNT_Pos);
+    PWM->SEQ[1].REFRESH = 0xFFFFFF;
+
+    PWM->EVENTS_STOPPED = 0;
+    PWM->TASKS_SEQSTART[0] = 1;
+
+    buffer = b;
+    startTime = system_timer_current_time_us();
+    playing = true;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops any tone being played.
+ */
+void GlideToneEngine::stop()
+{
+    if (!playing)
+        return;
+
+    PWM->TASKS_STOP = 1;
+    playing = false;
+}
+
+/**
+ * Determine the frequency currently sounding, in Hz, or zero if no tone is being played.
+ * This replays the glide curve up to the current time, rather than asking the hardware.
+ */
+int GlideToneEngine::getFrequency()
+{
+    if (!playing)
+        return 0;
+
+    uint64_t steps = (system_timer_current_time_us() - startTime) / (stepMs * 1000);
+    int frequency = fromFrequency;
+
+    while (steps--)
+    {
+        int delta = (targetFrequency - frequency) / slide;
+
+        if (delta == 0)
+            break;
+
+        frequency += delta;
+    }
+
+    return frequency;
+}
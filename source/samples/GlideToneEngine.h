@@ -0,0 +1,113 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MicroBit.h"
+#include "nrf.h"
+
+#ifndef GLIDE_TONE_ENGINE_H
+#define GLIDE_TONE_ENGINE_H
+
+#define GLIDE_TONE_MAX_ENTRIES                  128
+#define GLIDE_TONE_CHANNELS                     3
+#define GLIDE_TONE_MIN_FREQUENCY                31      // The lowest frequency a 15 bit COUNTERTOP allows at 1MHz
+#define GLIDE_TONE_DEFAULT_STEP_MS              5
+
+/**
+ * Plays square wave tones with glides (portamento) between them, sequenced entirely by an NRF52 PWM module.
+ *
+ * When a new frequency is requested, the whole glide from the current frequency is precomputed as a table with one
+ * entry per PWM period, using the PWM 'waveform' decoder mode so that every period can have its own length. The glide
+ * is played as sequence 0, and the target frequency is then held by sequence 1 until the next request. The CPU is
+ * only involved when a note changes, so there are no periodic wakeups, and pitch slides are free of scheduling jitter.
+ *
+ * The glide curve matches the one used by the out of box experience: every step, the frequency moves 1/slide of the
+ * way to the target frequency.
+ */
+class GlideToneEngine
+{
+    NRF_PWM_Type    *PWM;
+    uint16_t        glide[2][GLIDE_TONE_MAX_ENTRIES][4];    // Double buffered, as DMA may still be reading the old glide
+    uint16_t        sustain[2][4];
+    int             buffer;                                 // The buffer set used by the sequence currently playing
+    int             slide;
+    int             stepMs;
+    int             fromFrequency;
+    int             targetFrequency;
+    uint64_t        startTime;
+    bool            playing;
+
+    /**
+     * Fills the given PWM sequence entry with a 50% duty cycle square wave of the given period.
+     */
+    void setEntry(uint16_t *entry, uint32_t top);
+
+    /**
+     * Precomputes a glide into the given sequence buffer.
+     * @param sequence the buffer to fill, or NULL to just count the entries needed.
+     * @param refresh the number of additional periods each entry is repeated for.
+     * @return the number of entries written, or -1 if the glide doesn't fit at the given refresh count.
+     */
+    int buildGlide(uint16_t (*sequence)[4], int refresh);
+
+    public:
+    /**
+     * Creates a glide tone engine.
+     * @param module the PWM module to use. This must not be shared with any other component.
+     */
+    GlideToneEngine(NRF_PWM_Type *module = NRF_PWM2);
+
+    /**
+     * Routes the tone to the given pin.
+     * @param pin the pin to drive.
+     * @param channel the PWM channel to use, in the range 0..2.
+     */
+    int connectPin(Pin &pin, int channel);
+
+    /**
+     * Defines the glide between notes.
+     * @param slide each step moves 1/slide of the way to the new frequency. 1 disables glides.
+     * @param stepMs the duration of each step, in milliseconds.
+     */
+    int setSlide(int slide, int stepMs = GLIDE_TONE_DEFAULT_STEP_MS);
+
+    /**
+     * Glides to the given frequency, and holds it until the next call to play() or stop().
+     * This precomputes the glide and returns immediately.
+     * @param frequency the frequency to play, in Hz. Zero stops the tone.
+     * @param from the frequency to start the glide from, or -1 to continue from the frequency currently sounding.
+     */
+    int play(int frequency, int from = -1);
+
+    /**
+     * Stops any tone being played.
+     */
+    void stop();
+
+    /**
+     * Determine the frequency currently sounding, in Hz, or zero if no tone is being played.
+     */
+    int getFrequency();
+};
+
+#endif
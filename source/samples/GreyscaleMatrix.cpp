@@ -0,0 +1,354 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "GreyscaleMatrix.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+GreyscaleMatrix *GreyscaleMatrix::instance = NULL;
+
+/**
+ * Creates a greyscale matrix driver.
+ * @param timer the timer to use. This must have six compare registers (TIMER3 or TIMER4), and must not be shared.
+ * The default, TIMER4, is the display's refresh timer, whose interrupt is taken over from the moment this is
+ * created, so the display must be disabled first and not enabled again.
+ * @param irqn the interrupt of the given timer.
+ * @param gpioteChannel the first of five consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of ten consecutive PPI channels to use.
+ */
+GreyscaleMatrix::GreyscaleMatrix(NRF_TIMER_Type *timer, IRQn_Type irqn, int gpioteChannel, int ppiChannel) : timer(timer, irqn)
+{
+    this->rowPins = NULL;
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->rows = (1 << GREYSCALE_MATRIX_ROWS) - 1;
+    this->phase = GREYSCALE_MATRIX_FORWARD;
+    this->next = GREYSCALE_MATRIX_FORWARD;
+    this->enabled = false;
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+    {
+        levels[GREYSCALE_MATRIX_FORWARD][c] = 0;
+        levels[GREYSCALE_MATRIX_REVERSE][c] = 0;
+    }
+
+    resetStatistics();
+    cycle_counter_enable();
+}
+
+/**
+ * Timer interrupt handler, at the start of each period.
+ */
+void GreyscaleMatrix::onTimer(uint16_t channels)
+{
+    if ((channels & (1 << 5)) && instance)
+        instance->onPeriod();
+}
+
+/**
+ * Loads the levels and polarity of the period that has just started, and sets up the start of the next one.
+ */
+void GreyscaleMatrix::onPeriod()
+{
+    uint32_t start = cycle_counter_read();
+    bool reverse = false;
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+        if (levels[GREYSCALE_MATRIX_REVERSE][c])
+            reverse = true;
+
+    phase = next;
+    next = (phase == GREYSCALE_MATRIX_FORWARD && reverse) ? GREYSCALE_MATRIX_REVERSE : GREYSCALE_MATRIX_FORWARD;
+
+    apply();
+
+    // Nothing more to load until the levels change.
+    if (phase == GREYSCALE_MATRIX_FORWARD && next == GREYSCALE_MATRIX_FORWARD)
+        timer.timer->INTENCLR = TIMER_INTENCLR_COMPARE5_Msk;
+
+    interrupts++;
+    interruptCycles += cycle_counter_read() - start;
+}
+
+/**
+ * Sets up the compare registers, PPI channels and rows for the current period, and the start of the next.
+ */
+void GreyscaleMatrix::apply()
+{
+    NRF_TIMER_Type *t = timer.timer;
+    uint32_t compare[GREYSCALE_MATRIX_COLUMNS];
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+    {
+        int g = gpioteChannel + c;
+        int start = ppiChannel + c;
+        int end = ppiChannel + GREYSCALE_MATRIX_COLUMNS + c;
+        int level = levels[phase][c];
+
+        // The end of this period's on time. A full brightness column is turned off past the end of the period, so it
+        // never is. A dark column is still turned off, in case it was left on by the last period.
+        if (phase == GREYSCALE_MATRIX_REVERSE)
+            NRF_PPI->CH[end].TEP = (uint32_t) &NRF_GPIOTE->TASKS_CLR[g];
+        else
+            NRF_PPI->CH[end].TEP = (uint32_t) &NRF_GPIOTE->TASKS_SET[g];
+
+        compare[c] = level == 255 ? GREYSCALE_MATRIX_PERIOD_US + 1 : max(level * GREYSCALE_MATRIX_US_PER_LEVEL, 1);
+        t->CC[c] = compare[c];
+
+        // The start of the next period's.
+        if (next == GREYSCALE_MATRIX_REVERSE)
+            NRF_PPI->CH[start].TEP = (uint32_t) &NRF_GPIOTE->TASKS_SET[g];
+        else
+            NRF_PPI->CH[start].TEP = (uint32_t) &NRF_GPIOTE->TASKS_CLR[g];
+
+        if (levels[next][c])
+            NRF_PPI->CHENSET = 1 << start;
+        else
+            NRF_PPI->CHENCLR = 1 << start;
+    }
+
+    // Borrow a compare register for a moment to take the time, and turn off by hand any column whose on time has
+    // already passed. The extra tick covers the time to put the register back.
+    t->TASKS_CAPTURE[0] = 1;
+    uint32_t now = t->CC[0] + 1;
+    t->CC[0] = compare[0];
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+    {
+        int g = gpioteChannel + c;
+
+        if (compare[c] <= now)
+        {
+            if (phase == GREYSCALE_MATRIX_REVERSE)
+                NRF_GPIOTE->TASKS_CLR[g] = 1;
+            else
+                NRF_GPIOTE->TASKS_SET[g] = 1;
+        }
+    }
+
+    // Only now switch the rows, so that no column is left on in the wrong direction.
+    rowPins->write(rowStates[phase]);
+}
+
+/**
+ * Requests an interrupt at the start of the next period, to load new levels.
+ */
+void GreyscaleMatrix::update()
+{
+    if (enabled)
+        timer.timer->INTENSET = TIMER_INTENSET_COMPARE5_Msk;
+}
+
+/**
+ * Takes control of the matrix pins and starts the hardware. The display must be disabled first.
+ */
+int GreyscaleMatrix::enable()
+{
+    if (enabled)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + GREYSCALE_MATRIX_COLUMNS > 8 || ppiChannel < 0 || ppiChannel + 2 * GREYSCALE_MATRIX_COLUMNS > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    if (rowPins == NULL)
+        rowPins = new PinGroup(uBit.ledRowPins, GREYSCALE_MATRIX_ROWS);
+
+    instance = this;
+
+    timer.setClockSpeed(1000);
+    timer.setBitMode(BitMode16);
+    timer.setIRQ(onTimer);
+    timer.reset();
+    timer.timer->INTENCLR = 0xFFFFFFFF;
+    timer.timer->SHORTS = TIMER_SHORTS_COMPARE5_CLEAR_Msk;
+    timer.timer->CC[5] = GREYSCALE_MATRIX_PERIOD_US;
+
+    rowStates[GREYSCALE_MATRIX_FORWARD] = rowPins->compile((1 << GREYSCALE_MATRIX_ROWS) - 1);
+    rowStates[GREYSCALE_MATRIX_REVERSE] = rowPins->compile(0);
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+    {
+        int g = gpioteChannel + c;
+        int end = ppiChannel + GREYSCALE_MATRIX_COLUMNS + c;
+
+        // Columns are active low. Leave the pin latched high, so it stays off when GPIOTE lets go of it.
+        uBit.ledColPins[c]->setDigitalValue(1);
+
+        NRF_GPIOTE->CONFIG[g] = (GPIOTE_CONFIG_MODE_Task << GPIOTE_CONFIG_MODE_Pos) |
+                                (uBit.ledColPins[c]->name << GPIOTE_CONFIG_PSEL_Pos) |
+                                (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos) |
+                                (GPIOTE_CONFIG_OUTINIT_High << GPIOTE_CONFIG_OUTINIT_Pos);
+
+        NRF_PPI->CH[ppiChannel + c].EEP = (uint32_t) &timer.timer->EVENTS_COMPARE[5];
+        NRF_PPI->CH[end].EEP = (uint32_t) &timer.timer->EVENTS_COMPARE[c];
+        NRF_PPI->CHENSET = 1 << end;
+    }
+
+    // The first period is a forward one. The interrupt at its end loads anything else.
+    phase = GREYSCALE_MATRIX_FORWARD;
+    next = GREYSCALE_MATRIX_FORWARD;
+    apply();
+    rowPins->setDirection(rows);
+
+    enabled = true;
+    update();
+    timer.enable();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops the hardware and releases the matrix pins, leaving every LED off.
+ */
+void GreyscaleMatrix::disable()
+{
+    if (!enabled)
+        return;
+
+    timer.disable();
+    timer.timer->INTENCLR = 0xFFFFFFFF;
+    timer.timer->SHORTS = 0;
+
+    for (int c = 0; c < GREYSCALE_MATRIX_COLUMNS; c++)
+    {
+        NRF_PPI->CHENCLR = (1 << (ppiChannel + c)) | (1 << (ppiChannel + GREYSCALE_MATRIX_COLUMNS + c));
+        NRF_GPIOTE->CONFIG[gpioteChannel + c] = 0;
+        uBit.ledColPins[c]->setDigitalValue(1);
+    }
+
+    rowPins->write(0);
+    rowPins->output();
+    enabled = false;
+}
+
+/**
+ * Defines the brightness of a column. Takes effect from the start of the next period.
+ * @param column the column, in the range 0..4.
+ * @param level the brightness, in the range 0 (off) to 255 (fully on).
+ */
+int GreyscaleMatrix::setColumn(int column, int level)
+{
+    if (column < 0 || column >= GREYSCALE_MATRIX_COLUMNS || level < 0 || level > 255)
+        return DEVICE_INVALID_PARAMETER;
+
+    levels[GREYSCALE_MATRIX_FORWARD][column] = level;
+    update();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the brightness of a column.
+ * @param column the column, in the range 0..4.
+ * @return the brightness, or DEVICE_INVALID_PARAMETER.
+ */
+int GreyscaleMatrix::getColumn(int column)
+{
+    if (column < 0 || column >= GREYSCALE_MATRIX_COLUMNS)
+        return DEVICE_INVALID_PARAMETER;
+
+    return levels[GREYSCALE_MATRIX_FORWARD][column];
+}
+
+/**
+ * Defines the brightness of the reverse biased LEDs of a column, on a bicolour matrix. Takes effect from the
+ * start of the next period. While any column has a reverse level, the forward and reverse levels each get every
+ * other period.
+ * @param column the column, in the range 0..4.
+ * @param level the brightness, in the range 0 (off) to 255 (fully on).
+ */
+int GreyscaleMatrix::setReverseColumn(int column, int level)
+{
+    if (column < 0 || column >= GREYSCALE_MATRIX_COLUMNS || level < 0 || level > 255)
+        return DEVICE_INVALID_PARAMETER;
+
+    levels[GREYSCALE_MATRIX_REVERSE][column] = level;
+    update();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the brightness of the reverse biased LEDs of a column.
+ * @param column the column, in the range 0..4.
+ * @return the brightness, or DEVICE_INVALID_PARAMETER.
+ */
+int GreyscaleMatrix::getReverseColumn(int column)
+{
+    if (column < 0 || column >= GREYSCALE_MATRIX_COLUMNS)
+        return DEVICE_INVALID_PARAMETER;
+
+    return levels[GREYSCALE_MATRIX_REVERSE][column];
+}
+
+/**
+ * Defines which rows are lit.
+ * @param mask a bit for each row, with bit 0 being the top row.
+ */
+int GreyscaleMatrix::setRows(uint8_t mask)
+{
+    if (mask >> GREYSCALE_MATRIX_ROWS)
+        return DEVICE_INVALID_PARAMETER;
+
+    rows = mask;
+
+    // Unlit rows are released rather than driven, so that the LEDs on them can't light either way round.
+    if (enabled)
+        rowPins->setDirection(rows);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void GreyscaleMatrix::resetStatistics()
+{
+    target_disable_irq();
+    interrupts = 0;
+    interruptCycles = 0;
+    statisticsStart = system_timer_current_time_us();
+    target_enable_irq();
+}
+
+/**
+ * Output the number of period interrupts taken, and the CPU time they cost, to the DMESG buffer.
+ */
+void GreyscaleMatrix::printStatistics()
+{
+    target_disable_irq();
+    uint32_t count = interrupts;
+    uint64_t cycles = interruptCycles;
+    uint64_t time = system_timer_current_time_us() - statisticsStart;
+    target_enable_irq();
+
+    // CPU load in hundredths of a percent, from the cycles spent in the interrupt per second.
+    uint32_t perSecond = time ? (uint32_t)((uint64_t)count * 1000000 / time) : 0;
+    uint32_t load = time ? (uint32_t)(cycles * 1000000 / time * 10000 / GREYSCALE_MATRIX_CPU_CLOCK) : 0;
+
+    DMESG("GREYSCALE_MATRIX: [TIME: %d ms]", (int)(time / 1000));
+    DMESG("   INTERRUPTS: %d [%d/s]", count, perSecond);
+    DMESG("   CYCLES: %d/interrupt [CPU: %d.%d%d%%]", count ? (int)(cycles / count) : 0, load / 100, (load / 10) % 10, load % 10);
+}
@@ -0,0 +1,187 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "PinGroup.h"
+
+#ifndef GREYSCALE_MATRIX_H
+#define GREYSCALE_MATRIX_H
+
+#define GREYSCALE_MATRIX_COLUMNS                5
+#define GREYSCALE_MATRIX_ROWS                   5
+
+// The timer runs at 1MHz. Each brightness level is 4us, so a full period is 1020us (~980Hz).
+#define GREYSCALE_MATRIX_US_PER_LEVEL           4
+#define GREYSCALE_MATRIX_PERIOD_US              (255 * GREYSCALE_MATRIX_US_PER_LEVEL)
+
+// The two kinds of period: forward, lighting the LEDs from the rows to the columns, and reverse, lighting any LEDs the
+// other way round (the green half of a bicolour matrix).
+#define GREYSCALE_MATRIX_FORWARD                0
+#define GREYSCALE_MATRIX_REVERSE                1
+
+// Default peripheral resources. One GPIOTE channel per column, and two PPI channels per column.
+#define GREYSCALE_MATRIX_DEFAULT_GPIOTE         0
+#define GREYSCALE_MATRIX_DEFAULT_PPI            0
+
+// The CPU clock, for turning the cycles spent in the interrupt into a load.
+#define GREYSCALE_MATRIX_CPU_CLOCK              64000000
+
+/**
+ * Hardware timed greyscale for the LED matrix, for programs that drive the matrix directly with the display disabled.
+ *
+ * Every lit row is held high, and each column is pulse width modulated by the hardware: a TIMER with six compare
+ * registers marks the start of each period (CC[5]) and the end of each column's on time (CC[0..4]), and PPI routes
+ * those events to GPIOTE tasks that pull the column low and release it again.
+ *
+ * New levels are only loaded into the compare registers by the interrupt at the start of a period, so a period never
+ * sees half of one level and half of another. If the interrupt comes after a column's new on time has already passed,
+ * the column is turned off by hand. The interrupt is only enabled while there is something to load, so a matrix with
+ * fixed forward levels, and no reverse levels, runs without the CPU at all.
+ *
+ * A bicolour matrix has a second LED the other way round at each position. Given any reverse levels, the driver
+ * interleaves reverse periods with the forward ones: the lit rows are held low, and each column is driven high for its
+ * reverse on time. The rows are switched by the interrupt, after the columns, so neither colour lights in between.
+ * Unlit rows are released, so nothing on them lights either way round.
+ *
+ * That switch is not hardware timed: while any reverse level is set, the interrupt runs at the start of every period
+ * (~980 times a second), even if no level changes, to swap the compare values, the GPIOTE task of every PPI channel
+ * and the row levels. PPI can't do it alone: holding the rows through GPIOTE would take five more channels than the
+ * three left over, and each phase needs its own set of compare values. printStatistics() reports the interrupts taken
+ * and the cycles they cost. The handler is a few hundred cycles, so the load should be well under 1% of the CPU, but
+ * it does keep the CPU waking ~980 times a second for as long as a reverse level is set.
+ *
+ * A column at level 0 has its PPI channel disabled so it never lights, and one at level 255 never reaches its compare,
+ * so it never turns off.
+ */
+class GreyscaleMatrix
+{
+    NRFLowLevelTimer    timer;
+    PinGroup            *rowPins;
+    PinGroupState       rowStates[2];       // The lit rows for forward and reverse periods.
+    int                 gpioteChannel;
+    int                 ppiChannel;
+    volatile uint8_t    levels[2][GREYSCALE_MATRIX_COLUMNS];
+    uint8_t             rows;
+    uint8_t             phase;              // The kind of the current period.
+    uint8_t             next;               // The kind of the next period, which its start channels are set up for.
+    bool                enabled;
+
+    // Statistics.
+    uint32_t            interrupts;
+    uint64_t            interruptCycles;
+    CODAL_TIMESTAMP     statisticsStart;
+
+    static GreyscaleMatrix *instance;
+
+    /**
+     * Timer interrupt handler, at the start of each period.
+     */
+    static void onTimer(uint16_t channels);
+
+    /**
+     * Loads the levels and polarity of the period that has just started, and sets up the start of the next one.
+     */
+    void onPeriod();
+
+    /**
+     * Sets up the compare registers, PPI channels and rows for the current period, and the start of the next.
+     */
+    void apply();
+
+    /**
+     * Requests an interrupt at the start of the next period, to load new levels.
+     */
+    void update();
+
+    public:
+    /**
+     * Creates a greyscale matrix driver.
+     * @param timer the timer to use. This must have six compare registers (TIMER3 or TIMER4), and must not be shared.
+     * The default, TIMER4, is the display's refresh timer, whose interrupt is taken over from the moment this is
+     * created, so the display must be disabled first and not enabled again.
+     * @param irqn the interrupt of the given timer.
+     * @param gpioteChannel the first of five consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of ten consecutive PPI channels to use.
+     */
+    GreyscaleMatrix(NRF_TIMER_Type *timer = NRF_TIMER4, IRQn_Type irqn = TIMER4_IRQn, int gpioteChannel = GREYSCALE_MATRIX_DEFAULT_GPIOTE, int ppiChannel = GREYSCALE_MATRIX_DEFAULT_PPI);
+
+    /**
+     * Takes control of the matrix pins and starts the hardware. The display must be disabled first.
+     */
+    int enable();
+
+    /**
+     * Stops the hardware and releases the matrix pins, leaving every LED off.
+     */
+    void disable();
+
+    /**
+     * Defines the brightness of a column. Takes effect from the start of the next period.
+     * @param column the column, in the range 0..4.
+     * @param level the brightness, in the range 0 (off) to 255 (fully on).
+     */
+    int setColumn(int column, int level);
+
+    /**
+     * Determines the brightness of a column.
+     * @param column the column, in the range 0..4.
+     * @return the brightness, or DEVICE_INVALID_PARAMETER.
+     */
+    int getColumn(int column);
+
+    /**
+     * Defines the brightness of the reverse biased LEDs of a column, on a bicolour matrix. Takes effect from the
+     * start of the next period. While any column has a reverse level, the forward and reverse levels each get every
+     * other period.
+     * @param column the column, in the range 0..4.
+     * @param level the brightness, in the range 0 (off) to 255 (fully on).
+     */
+    int setReverseColumn(int column, int level);
+
+    /**
+     * Determines the brightness of the reverse biased LEDs of a column.
+     * @param column the column, in the range 0..4.
+     * @return the brightness, or DEVICE_INVALID_PARAMETER.
+     */
+    int getReverseColumn(int column);
+
+    /**
+     * Defines which rows are lit.
+     * @param mask a bit for each row, with bit 0 being the top row.
+     */
+    int setRows(uint8_t mask);
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the number of period interrupts taken, and the CPU time they cost, to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,603 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#ifndef HELLO_CLIP_H
+#define HELLO_CLIP_H
+
+// "Hello", as 8 bit unsigned PCM at 16000 Hz. Shared by SpeakerTest.cpp and the host renderer in utils/host.
+static const uint8_t hello[] = {
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
+    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
+    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 
+    0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x81, 0x81, 0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7F, 
+    0x7F, 0x80, 0x81, 0x81, 0x81, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x80, 0x81, 0x80, 0x80, 0x7F, 
+    0x7E, 0x7E, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7F, 0x7E, 0x7C, 0x7B, 0x7D, 0x80, 0x82, 0x82, 
+    0x81, 0x7F, 0x7D, 0x7D, 0x7E, 0x7F, 0x82, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7D, 0x7F, 
+    0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x81, 0x83, 0x83, 0x81, 0x7E, 0x7C, 0x7E, 
+    0x81, 0x82, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7F, 
+    0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x81, 0x81, 0x80, 0x7F, 0x80, 0x80, 0x7E, 0x7D, 0x7F, 0x82, 0x83, 0x80, 0x7E, 0x7E, 0x7F, 
+    0x7F, 0x7E, 0x7E, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x80, 0x83, 0x84, 
+    0x83, 0x7E, 0x7A, 0x79, 0x7C, 0x7E, 0x81, 0x85, 0x87, 0x83, 0x7D, 0x7B, 0x7D, 0x7E, 0x7E, 0x80, 
+    0x84, 0x85, 0x82, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 0x7F, 0x83, 0x86, 0x82, 0x7B, 0x7B, 0x82, 0x82, 
+    0x7C, 0x7D, 0x82, 0x82, 0x81, 0x81, 0x7F, 0x7D, 0x80, 0x82, 0x7E, 0x7C, 0x7D, 0x7D, 0x80, 0x84, 
+    0x82, 0x7C, 0x7D, 0x84, 0x84, 0x7E, 0x7C, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x7C, 0x7C, 
+    0x80, 0x82, 0x7F, 0x7F, 0x82, 0x81, 0x7E, 0x7D, 0x7E, 0x81, 0x84, 0x82, 0x80, 0x81, 0x81, 0x7D, 
+    0x7B, 0x7E, 0x7F, 0x7F, 0x81, 0x82, 0x81, 0x7D, 0x79, 0x79, 0x81, 0x86, 0x87, 0x85, 0x82, 0x80, 
+    0x7D, 0x7A, 0x79, 0x7F, 0x84, 0x82, 0x7F, 0x82, 0x82, 0x7B, 0x79, 0x7D, 0x7E, 0x7D, 0x81, 0x88, 
+    0x8B, 0x88, 0x81, 0x7B, 0x7A, 0x7C, 0x7B, 0x7A, 0x7F, 0x87, 0x86, 0x7C, 0x79, 0x7D, 0x7B, 0x77, 
+    0x7C, 0x85, 0x88, 0x88, 0x89, 0x84, 0x7A, 0x78, 0x7C, 0x7E, 0x7F, 0x82, 0x81, 0x7F, 0x83, 0x80, 
+    0x74, 0x74, 0x7D, 0x82, 0x83, 0x85, 0x85, 0x82, 0x82, 0x83, 0x80, 0x79, 0x7A, 0x81, 0x85, 0x81, 
+    0x7C, 0x7D, 0x81, 0x85, 0x82, 0x76, 0x71, 0x7B, 0x85, 0x87, 0x89, 0x89, 0x83, 0x7D, 0x79, 0x77, 
+    0x79, 0x80, 0x86, 0x88, 0x85, 0x7F, 0x77, 0x72, 0x75, 0x7E, 0x82, 0x85, 0x8B, 0x8B, 0x83, 0x7D, 
+    0x7B, 0x77, 0x77, 0x80, 0x89, 0x8D, 0x8D, 0x85, 0x75, 0x6D, 0x72, 0x76, 0x7A, 0x87, 0x91, 0x8E, 
+    0x87, 0x80, 0x73, 0x6C, 0x72, 0x7D, 0x88, 0x94, 0x97, 0x8C, 0x7B, 0x6E, 0x68, 0x6C, 0x79, 0x87, 
+    0x92, 0x92, 0x8B, 0x85, 0x7B, 0x6D, 0x6D, 0x7A, 0x86, 0x8E, 0x8F, 0x88, 0x81, 0x7C, 0x77, 0x71, 
+    0x71, 0x7A, 0x85, 0x89, 0x88, 0x84, 0x7C, 0x77, 0x79, 0x7D, 0x7F, 0x83, 0x86, 0x86, 0x84, 0x82, 
+    0x7D, 0x77, 0x78, 0x7E, 0x86, 0x8A, 0x85, 0x7E, 0x7D, 0x7C, 0x77, 0x7A, 0x83, 0x86, 0x84, 0x82, 
+    0x7E, 0x7B, 0x7E, 0x81, 0x7D, 0x7E, 0x86, 0x84, 0x7F, 0x82, 0x7E, 0x78, 0x7F, 0x84, 0x7C, 0x78, 
+    0x7E, 0x83, 0x83, 0x7F, 0x7A, 0x7C, 0x84, 0x87, 0x83, 0x7B, 0x78, 0x7D, 0x84, 0x86, 0x84, 0x82, 
+    0x80, 0x7C, 0x7A, 0x7B, 0x7A, 0x7D, 0x83, 0x83, 0x81, 0x85, 0x87, 0x82, 0x81, 0x84, 0x82, 0x7B, 
+    0x76, 0x75, 0x7B, 0x84, 0x88, 0x84, 0x81, 0x7E, 0x78, 0x72, 0x74, 0x7C, 0x87, 0x91, 0x93, 0x8B, 
+    0x7F, 0x76, 0x73, 0x78, 0x7C, 0x80, 0x85, 0x87, 0x85, 0x7D, 0x73, 0x73, 0x7B, 0x7E, 0x7B, 0x7F, 
+    0x87, 0x8C, 0x8B, 0x84, 0x7C, 0x79, 0x7B, 0x7D, 0x7C, 0x7E, 0x81, 0x85, 0x87, 0x81, 0x7C, 0x7D, 
+    0x7E, 0x7C, 0x7C, 0x80, 0x82, 0x85, 0x82, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x84, 0x87, 0x88, 0x86, 
+    0x7E, 0x7A, 0x7E, 0x84, 0x87, 0x85, 0x7F, 0x7C, 0x80, 0x86, 0x80, 0x78, 0x7D, 0x84, 0x83, 0x82, 
+    0x85, 0x83, 0x80, 0x84, 0x85, 0x80, 0x83, 0x87, 0x83, 0x80, 0x81, 0x79, 0x77, 0x83, 0x85, 0x7D, 
+    0x78, 0x78, 0x78, 0x7A, 0x7C, 0x7C, 0x7C, 0x7C, 0x81, 0x84, 0x7E, 0x7A, 0x7B, 0x76, 0x73, 0x7A, 
+    0x7F, 0x7D, 0x7D, 0x7F, 0x7B, 0x74, 0x6F, 0x6E, 0x72, 0x78, 0x78, 0x72, 0x6C, 0x6E, 0x6F, 0x68, 
+    0x62, 0x6B, 0x82, 0xA8, 0xCA, 0xC0, 0x98, 0x88, 0x8D, 0x86, 0x86, 0x9E, 0xAA, 0xA2, 0x9D, 0x8C, 
+    0x69, 0x51, 0x50, 0x50, 0x55, 0x6A, 0x77, 0x79, 0x83, 0x8C, 0x7C, 0x68, 0x70, 0x85, 0x90, 0x9B, 
+    0xA8, 0xA8, 0x9C, 0x8D, 0x83, 0x7C, 0x79, 0x78, 0x80, 0x8D, 0x97, 0x9B, 0x96, 0x8C, 0x7F, 0x75, 
+    0x73, 0x7C, 0x8B, 0x93, 0x8F, 0x88, 0x81, 0x75, 0x6A, 0x65, 0x68, 0x72, 0x80, 0x8A, 0x8B, 0x87, 
+    0x83, 0x7D, 0x77, 0x79, 0x85, 0x8F, 0x92, 0x93, 0x8F, 0x82, 0x71, 0x64, 0x61, 0x63, 0x69, 0x73, 
+    0x7D, 0x80, 0x79, 0x74, 0x71, 0x68, 0x61, 0x68, 0x73, 0x79, 0x79, 0x76, 0x6E, 0x63, 0x4E, 0x38, 
+    0x2B, 0x35, 0x46, 0x51, 0x81, 0xD7, 0xFE, 0xBC, 0x72, 0x77, 0x93, 0x86, 0x7E, 0xA4, 0xCE, 0xD4, 
+    0xB6, 0x84, 0x5D, 0x4F, 0x4A, 0x43, 0x4D, 0x69, 0x7F, 0x8F, 0x9F, 0x98, 0x70, 0x51, 0x60, 0x80, 
+    0x8E, 0x97, 0xAA, 0xB3, 0xA4, 0x8C, 0x7B, 0x6E, 0x5F, 0x53, 0x56, 0x6F, 0x92, 0xA2, 0x94, 0x7A, 
+    0x6B, 0x63, 0x5F, 0x67, 0x79, 0x8C, 0x98, 0x99, 0x90, 0x85, 0x7F, 0x75, 0x65, 0x63, 0x75, 0x84, 
+    0x87, 0x8A, 0x8D, 0x83, 0x72, 0x6C, 0x73, 0x78, 0x7A, 0x83, 0x90, 0x93, 0x8B, 0x83, 0x85, 0x84, 
+    0x7D, 0x7B, 0x83, 0x8B, 0x8E, 0x8F, 0x8D, 0x88, 0x83, 0x7A, 0x74, 0x7A, 0x88, 0x8F, 0x8E, 0x8C, 
+    0x8B, 0x89, 0x88, 0x86, 0x84, 0x84, 0x88, 0x8B, 0x8A, 0x84, 0x7B, 0x72, 0x6F, 0x71, 0x73, 0x76, 
+    0x7C, 0x82, 0x83, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 0x7E, 0x81, 0x83, 0x80, 0x7B, 0x78, 0x72, 0x6B, 
+    0x64, 0x62, 0x61, 0x5B, 0x55, 0x56, 0x59, 0x55, 0x50, 0x4D, 0x73, 0xCE, 0xFD, 0xB2, 0x57, 0x67, 
+    0x9E, 0x98, 0x7C, 0x8A, 0xB6, 0xD2, 0xB9, 0x77, 0x4D, 0x59, 0x64, 0x4F, 0x44, 0x5B, 0x77, 0x8E, 
+    0xA2, 0x9C, 0x73, 0x5A, 0x6B, 0x83, 0x89, 0x90, 0xA3, 0xAE, 0xA5, 0x97, 0x8F, 0x85, 0x70, 0x57, 
+    0x52, 0x6D, 0x92, 0xA1, 0x93, 0x7C, 0x6F, 0x69, 0x64, 0x64, 0x70, 0x81, 0x8F, 0x96, 0x95, 0x93, 
+    0x93, 0x89, 0x72, 0x63, 0x6E, 0x82, 0x89, 0x8A, 0x8D, 0x8A, 0x7C, 0x70, 0x6F, 0x6E, 0x6B, 0x6F, 
+    0x7F, 0x8B, 0x89, 0x84, 0x85, 0x83, 0x7C, 0x7A, 0x81, 0x87, 0x87, 0x8A, 0x90, 0x91, 0x86, 0x78, 
+    0x74, 0x78, 0x7D, 0x7C, 0x7A, 0x7E, 0x86, 0x8A, 0x8A, 0x89, 0x87, 0x83, 0x82, 0x83, 0x86, 0x88, 
+    0x87, 0x82, 0x7D, 0x7A, 0x79, 0x79, 0x77, 0x76, 0x77, 0x7A, 0x7C, 0x7F, 0x81, 0x80, 0x7F, 0x81, 
+    0x82, 0x81, 0x7F, 0x7E, 0x7A, 0x74, 0x6E, 0x69, 0x65, 0x63, 0x5D, 0x52, 0x48, 0x45, 0x6C, 0xCE, 
+    0xFE, 0xA8, 0x45, 0x5E, 0xA9, 0xA5, 0x75, 0x78, 0xB3, 0xE7, 0xD3, 0x83, 0x54, 0x6A, 0x77, 0x4F, 
+    0x30, 0x47, 0x73, 0x91, 0x9F, 0x94, 0x77, 0x69, 0x6E, 0x6B, 0x66, 0x78, 0x9A, 0xA9, 0xA5, 0xA4, 
+    0xAA, 0xA0, 0x7A, 0x51, 0x49, 0x64, 0x85, 0x96, 0x94, 0x8A, 0x83, 0x7B, 0x6B, 0x5C, 0x5B, 0x67, 
+    0x79, 0x86, 0x8C, 0x97, 0xAA, 0xA6, 0x81, 0x64, 0x6A, 0x79, 0x7A, 0x7C, 0x8C, 0x98, 0x94, 0x8A, 
+    0x82, 0x75, 0x64, 0x5E, 0x69, 0x76, 0x7D, 0x85, 0x90, 0x91, 0x87, 0x7D, 0x7C, 0x80, 0x84, 0x83, 
+    0x85, 0x90, 0x96, 0x8C, 0x82, 0x82, 0x7E, 0x75, 0x74, 0x78, 0x7A, 0x80, 0x89, 0x89, 0x83, 0x85, 
+    0x87, 0x81, 0x7B, 0x7C, 0x7F, 0x81, 0x86, 0x87, 0x81, 0x7C, 0x7C, 0x7A, 0x76, 0x73, 0x75, 0x78, 
+    0x7C, 0x7F, 0x81, 0x85, 0x85, 0x80, 0x7B, 0x79, 0x79, 0x73, 0x6C, 0x67, 0x60, 0x57, 0x4F, 0x49, 
+    0x55, 0x9C, 0xF4, 0xDA, 0x5E, 0x37, 0x8E, 0xC7, 0x97, 0x61, 0x7B, 0xCF, 0xF8, 0xB6, 0x5D, 0x5F, 
+    0x92, 0x80, 0x37, 0x1E, 0x4C, 0x85, 0x9D, 0x8F, 0x73, 0x75, 0x8C, 0x85, 0x60, 0x56, 0x77, 0x95, 
+    0x9A, 0x9A, 0xA9, 0xB8, 0xA8, 0x78, 0x4F, 0x52, 0x71, 0x82, 0x80, 0x7D, 0x84, 0x91, 0x93, 0x7D, 
+    0x63, 0x5D, 0x68, 0x6F, 0x6F, 0x78, 0x94, 0xAD, 0xA6, 0x88, 0x79, 0x80, 0x7C, 0x67, 0x62, 0x79, 
+    0x93, 0x99, 0x93, 0x8D, 0x86, 0x7C, 0x71, 0x69, 0x64, 0x67, 0x76, 0x88, 0x90, 0x8F, 0x94, 0x9A, 
+    0x90, 0x79, 0x6F, 0x7B, 0x84, 0x81, 0x7F, 0x8A, 0x93, 0x92, 0x87, 0x7A, 0x74, 0x76, 0x78, 0x77, 
+    0x7B, 0x85, 0x8E, 0x95, 0x97, 0x8F, 0x7F, 0x73, 0x6F, 0x71, 0x78, 0x7E, 0x7E, 0x7A, 0x7A, 0x7E, 
+    0x7C, 0x74, 0x6B, 0x68, 0x6E, 0x78, 0x81, 0x85, 0x83, 0x7C, 0x75, 0x6C, 0x60, 0x56, 0x4D, 0x4B, 
+    0x7E, 0xDA, 0xE8, 0x86, 0x4B, 0x88, 0xC3, 0x9B, 0x56, 0x59, 0xA6, 0xED, 0xD2, 0x7A, 0x62, 0x95, 
+    0x9E, 0x58, 0x22, 0x34, 0x6D, 0x91, 0x87, 0x6C, 0x75, 0x98, 0x96, 0x6F, 0x63, 0x7F, 0x90, 0x83, 
+    0x7D, 0x95, 0xB7, 0xB9, 0x90, 0x66, 0x68, 0x82, 0x86, 0x70, 0x5C, 0x60, 0x78, 0x8D, 0x8A, 0x7C, 
+    0x79, 0x7C, 0x75, 0x68, 0x66, 0x75, 0x89, 0x8B, 0x7F, 0x83, 0x9F, 0xA9, 0x8D, 0x6F, 0x71, 0x7F, 
+    0x7D, 0x76, 0x7B, 0x87, 0x8D, 0x8D, 0x87, 0x7B, 0x70, 0x6B, 0x6A, 0x68, 0x6D, 0x80, 0x91, 0x91, 
+    0x8D, 0x97, 0xA2, 0x98, 0x7E, 0x6C, 0x71, 0x80, 0x8C, 0x8F, 0x8B, 0x89, 0x8D, 0x8E, 0x85, 0x78, 
+    0x6F, 0x6D, 0x73, 0x7D, 0x86, 0x8F, 0x96, 0x8E, 0x7F, 0x78, 0x76, 0x6E, 0x68, 0x6E, 0x78, 0x80, 
+    0x83, 0x84, 0x80, 0x78, 0x70, 0x69, 0x62, 0x5E, 0x5F, 0x65, 0x66, 0x61, 0x5D, 0x71, 0xB2, 0xE1, 
+    0xAB, 0x55, 0x65, 0xBA, 0xC7, 0x7F, 0x52, 0x7D, 0xD0, 0xE3, 0x96, 0x55, 0x76, 0xAA, 0x85, 0x3A, 
+    0x2F, 0x5D, 0x7D, 0x72, 0x5C, 0x67, 0x94, 0xA4, 0x7D, 0x5F, 0x78, 0x98, 0x8D, 0x70, 0x72, 0x97, 
+    0xB6, 0xAA, 0x87, 0x7F, 0x96, 0x9E, 0x87, 0x6B, 0x61, 0x69, 0x78, 0x7D, 0x77, 0x79, 0x82, 0x81, 
+    0x76, 0x6B, 0x68, 0x71, 0x77, 0x6D, 0x67, 0x7C, 0x97, 0x97, 0x88, 0x88, 0x93, 0x96, 0x8C, 0x81, 
+    0x81, 0x8B, 0x8E, 0x87, 0x85, 0x88, 0x86, 0x7E, 0x76, 0x6E, 0x6A, 0x6F, 0x73, 0x6C, 0x6D, 0x7D, 
+    0x87, 0x83, 0x81, 0x86, 0x8A, 0x8B, 0x8B, 0x85, 0x82, 0x89, 0x92, 0x93, 0x91, 0x8D, 0x8D, 0x8E, 
+    0x86, 0x78, 0x75, 0x7B, 0x78, 0x72, 0x76, 0x7D, 0x78, 0x72, 0x75, 0x7B, 0x79, 0x6F, 0x68, 0x6B, 
+    0x74, 0x7A, 0x78, 0x72, 0x6A, 0x65, 0x65, 0x66, 0x60, 0x6F, 0xA0, 0xB3, 0x86, 0x6B, 0x9A, 0xC9, 
+    0xAD, 0x75, 0x6A, 0x9A, 0xCB, 0xBA, 0x7B, 0x69, 0x97, 0xAF, 0x83, 0x4F, 0x4A, 0x68, 0x7D, 0x6D, 
+    0x52, 0x5D, 0x81, 0x83, 0x66, 0x65, 0x84, 0x91, 0x7B, 0x6A, 0x7A, 0x9C, 0xA5, 0x8A, 0x77, 0x8D, 
+    0xAB, 0xA8, 0x8F, 0x80, 0x83, 0x88, 0x84, 0x77, 0x6D, 0x70, 0x77, 0x78, 0x75, 0x75, 0x77, 0x78, 
+    0x75, 0x6B, 0x67, 0x72, 0x7B, 0x74, 0x70, 0x82, 0x96, 0x97, 0x8D, 0x88, 0x8C, 0x91, 0x8D, 0x83, 
+    0x81, 0x85, 0x88, 0x8D, 0x90, 0x8E, 0x89, 0x86, 0x7E, 0x76, 0x77, 0x7B, 0x74, 0x69, 0x6E, 0x7B, 
+    0x82, 0x7E, 0x79, 0x7C, 0x84, 0x8A, 0x87, 0x7E, 0x7C, 0x83, 0x8F, 0x94, 0x90, 0x89, 0x89, 0x8B, 
+    0x86, 0x7D, 0x78, 0x75, 0x75, 0x78, 0x7D, 0x80, 0x7B, 0x73, 0x71, 0x70, 0x6A, 0x5F, 0x57, 0x54, 
+    0x58, 0x60, 0x64, 0x75, 0x94, 0x9B, 0x7E, 0x72, 0x95, 0xB6, 0xA3, 0x7D, 0x7D, 0xAB, 0xD0, 0xB8, 
+    0x85, 0x85, 0xB0, 0xB7, 0x87, 0x5E, 0x62, 0x77, 0x76, 0x5E, 0x51, 0x62, 0x71, 0x63, 0x54, 0x60, 
+    0x76, 0x77, 0x6B, 0x68, 0x78, 0x8C, 0x8D, 0x7E, 0x7D, 0x95, 0xAB, 0xA9, 0x9D, 0x9A, 0xA0, 0xA5, 
+    0x9C, 0x89, 0x7F, 0x82, 0x82, 0x7B, 0x77, 0x73, 0x6A, 0x66, 0x68, 0x64, 0x61, 0x66, 0x67, 0x60, 
+    0x60, 0x6F, 0x7E, 0x82, 0x80, 0x84, 0x95, 0xA5, 0xA4, 0x9A, 0x96, 0x96, 0x95, 0x95, 0x93, 0x89, 
+    0x82, 0x88, 0x8D, 0x87, 0x83, 0x80, 0x74, 0x67, 0x68, 0x6D, 0x69, 0x62, 0x65, 0x70, 0x7F, 0x89, 
+    0x88, 0x86, 0x8A, 0x8D, 0x8B, 0x88, 0x89, 0x8B, 0x8F, 0x8F, 0x8A, 0x87, 0x87, 0x85, 0x7E, 0x78, 
+    0x74, 0x6B, 0x64, 0x65, 0x6A, 0x6B, 0x65, 0x5C, 0x5D, 0x65, 0x6A, 0x77, 0x8F, 0x8F, 0x78, 0x7A, 
+    0x9F, 0xAD, 0x90, 0x76, 0x84, 0xA9, 0xB9, 0x98, 0x74, 0x83, 0xAF, 0xB2, 0x89, 0x6E, 0x7A, 0x8E, 
+    0x87, 0x67, 0x58, 0x6A, 0x79, 0x67, 0x58, 0x6D, 0x86, 0x7A, 0x5E, 0x5A, 0x70, 0x82, 0x77, 0x62, 
+    0x67, 0x85, 0x99, 0x97, 0x93, 0x99, 0x9E, 0x9C, 0x97, 0x90, 0x8B, 0x89, 0x85, 0x85, 0x8C, 0x91, 
+    0x8B, 0x83, 0x7E, 0x7A, 0x75, 0x6F, 0x66, 0x5C, 0x5B, 0x66, 0x72, 0x76, 0x72, 0x72, 0x7A, 0x83, 
+    0x83, 0x80, 0x84, 0x8A, 0x8B, 0x8E, 0x95, 0x99, 0x99, 0x9C, 0x9D, 0x98, 0x94, 0x91, 0x8B, 0x83, 
+    0x7E, 0x7A, 0x74, 0x72, 0x72, 0x6F, 0x6D, 0x6D, 0x6C, 0x6D, 0x73, 0x79, 0x77, 0x77, 0x7B, 0x80, 
+    0x82, 0x84, 0x86, 0x86, 0x8B, 0x8F, 0x8A, 0x83, 0x85, 0x86, 0x7E, 0x72, 0x69, 0x66, 0x68, 0x64, 
+    0x60, 0x75, 0x8F, 0x82, 0x61, 0x6C, 0x99, 0xA3, 0x7F, 0x66, 0x7D, 0xAA, 0xB7, 0x91, 0x75, 0x96, 
+    0xC2, 0xB4, 0x86, 0x79, 0x8C, 0x93, 0x7D, 0x62, 0x62, 0x75, 0x74, 0x5C, 0x59, 0x77, 0x83, 0x6C, 
+    0x5A, 0x66, 0x7C, 0x7E, 0x6A, 0x5B, 0x6F, 0x8F, 0x94, 0x85, 0x86, 0x98, 0x9E, 0x95, 0x8A, 0x89, 
+    0x8D, 0x8D, 0x85, 0x83, 0x8C, 0x8F, 0x85, 0x7F, 0x85, 0x87, 0x80, 0x78, 0x6F, 0x6B, 0x71, 0x79, 
+    0x75, 0x6E, 0x6E, 0x78, 0x82, 0x83, 0x79, 0x77, 0x7F, 0x85, 0x83, 0x85, 0x89, 0x88, 0x89, 0x90, 
+    0x94, 0x90, 0x8E, 0x8C, 0x89, 0x88, 0x8C, 0x8B, 0x85, 0x7F, 0x7F, 0x81, 0x80, 0x7C, 0x75, 0x74, 
+    0x78, 0x7C, 0x7B, 0x77, 0x71, 0x6D, 0x72, 0x78, 0x74, 0x6C, 0x6E, 0x77, 0x7D, 0x80, 0x81, 0x7C, 
+    0x77, 0x78, 0x77, 0x6F, 0x68, 0x6D, 0x81, 0x94, 0x8B, 0x78, 0x86, 0xAA, 0xAC, 0x89, 0x77, 0x8A, 
+    0xA3, 0x9C, 0x7B, 0x6F, 0x8E, 0xA8, 0x93, 0x72, 0x79, 0x93, 0x8F, 0x6F, 0x5F, 0x71, 0x84, 0x76, 
+    0x5D, 0x66, 0x86, 0x87, 0x68, 0x5F, 0x7A, 0x8C, 0x7C, 0x61, 0x62, 0x7D, 0x8E, 0x82, 0x72, 0x7B, 
+    0x90, 0x95, 0x8D, 0x89, 0x8E, 0x91, 0x8E, 0x88, 0x89, 0x8C, 0x87, 0x7B, 0x79, 0x83, 0x87, 0x7F, 
+    0x77, 0x74, 0x76, 0x7B, 0x7B, 0x73, 0x6C, 0x6F, 0x78, 0x7F, 0x7E, 0x7B, 0x80, 0x8B, 0x8F, 0x8D, 
+    0x8E, 0x8F, 0x88, 0x83, 0x89, 0x8C, 0x87, 0x84, 0x84, 0x86, 0x8A, 0x8D, 0x84, 0x79, 0x78, 0x7D, 
+    0x7C, 0x75, 0x71, 0x75, 0x80, 0x88, 0x86, 0x80, 0x7F, 0x80, 0x7D, 0x7C, 0x7B, 0x74, 0x6F, 0x71, 
+    0x75, 0x73, 0x6F, 0x6B, 0x67, 0x66, 0x69, 0x68, 0x63, 0x70, 0x89, 0x8A, 0x76, 0x7C, 0xA0, 0xB0, 
+    0x9A, 0x85, 0x93, 0xB3, 0xB6, 0x94, 0x7E, 0x95, 0xB0, 0xA1, 0x80, 0x7C, 0x8B, 0x8B, 0x75, 0x63, 
+    0x68, 0x74, 0x68, 0x51, 0x55, 0x72, 0x7B, 0x66, 0x5B, 0x6C, 0x82, 0x81, 0x70, 0x68, 0x77, 0x88, 
+    0x87, 0x81, 0x87, 0x92, 0x94, 0x95, 0x99, 0x99, 0x93, 0x8F, 0x8E, 0x90, 0x8E, 0x83, 0x75, 0x74, 
+    0x7C, 0x7C, 0x74, 0x71, 0x71, 0x71, 0x72, 0x73, 0x72, 0x6E, 0x6D, 0x6F, 0x78, 0x80, 0x82, 0x82, 
+    0x88, 0x8E, 0x93, 0x98, 0x97, 0x8F, 0x8E, 0x96, 0x95, 0x8D, 0x89, 0x89, 0x89, 0x8D, 0x8F, 0x85, 
+    0x7C, 0x7C, 0x79, 0x71, 0x6B, 0x67, 0x65, 0x69, 0x73, 0x79, 0x7B, 0x7E, 0x80, 0x82, 0x84, 0x84, 
+    0x7F, 0x7A, 0x79, 0x79, 0x79, 0x76, 0x6E, 0x65, 0x63, 0x65, 0x64, 0x71, 0x86, 0x7D, 0x63, 0x71, 
+    0x9F, 0xAA, 0x88, 0x75, 0x8E, 0xB2, 0xB4, 0x92, 0x81, 0xA1, 0xBF, 0xAA, 0x86, 0x84, 0x93, 0x8F, 
+    0x7C, 0x6F, 0x73, 0x79, 0x6C, 0x59, 0x5F, 0x76, 0x72, 0x58, 0x52, 0x68, 0x79, 0x71, 0x62, 0x63, 
+    0x75, 0x81, 0x7F, 0x7E, 0x8A, 0x95, 0x94, 0x95, 0x9D, 0xA0, 0x9A, 0x92, 0x8E, 0x91, 0x93, 0x88, 
+    0x7B, 0x7C, 0x83, 0x81, 0x77, 0x70, 0x6C, 0x6B, 0x6F, 0x71, 0x69, 0x65, 0x6A, 0x73, 0x79, 0x79, 
+    0x78, 0x7C, 0x85, 0x8C, 0x93, 0x98, 0x95, 0x91, 0x96, 0x9E, 0x9F, 0x99, 0x91, 0x8C, 0x8C, 0x8E, 
+    0x8A, 0x81, 0x77, 0x72, 0x76, 0x79, 0x73, 0x6A, 0x6A, 0x70, 0x74, 0x73, 0x72, 0x74, 0x79, 0x7E, 
+    0x80, 0x7A, 0x73, 0x73, 0x78, 0x77, 0x6D, 0x60, 0x5C, 0x61, 0x6C, 0x81, 0x90, 0x7F, 0x6C, 0x88, 
+    0xB6, 0xAD, 0x7C, 0x75, 0x9E, 0xBA, 0xA8, 0x83, 0x7F, 0xA1, 0xB1, 0x95, 0x7E, 0x8B, 0x93, 0x81, 
+    0x70, 0x71, 0x77, 0x6E, 0x58, 0x50, 0x67, 0x7C, 0x6C, 0x55, 0x61, 0x83, 0x8D, 0x78, 0x67, 0x6E, 
+    0x83, 0x88, 0x7E, 0x7B, 0x8A, 0x95, 0x96, 0x9B, 0xA2, 0x9E, 0x92, 0x8C, 0x8C, 0x8C, 0x82, 0x70, 
+    0x69, 0x77, 0x82, 0x7A, 0x71, 0x74, 0x77, 0x76, 0x79, 0x78, 0x6E, 0x66, 0x6B, 0x76, 0x7F, 0x80, 
+    0x7E, 0x86, 0x94, 0x9D, 0x9F, 0x9D, 0x93, 0x87, 0x8B, 0x94, 0x8D, 0x81, 0x82, 0x88, 0x88, 0x8B, 
+    0x8F, 0x84, 0x75, 0x72, 0x75, 0x71, 0x6C, 0x68, 0x6B, 0x74, 0x7D, 0x7F, 0x7F, 0x7E, 0x7A, 0x76, 
+    0x78, 0x75, 0x67, 0x5D, 0x5D, 0x5C, 0x58, 0x5D, 0x6F, 0x92, 0x9E, 0x7B, 0x7A, 0xBC, 0xD6, 0x92, 
+    0x62, 0x8A, 0xB4, 0xAA, 0x89, 0x78, 0x93, 0xBE, 0xB6, 0x85, 0x79, 0x88, 0x7A, 0x5E, 0x56, 0x5B, 
+    0x58, 0x51, 0x51, 0x6B, 0x90, 0x90, 0x6E, 0x6C, 0x8E, 0x9B, 0x85, 0x6F, 0x69, 0x72, 0x8C, 0x9F, 
+    0x96, 0x86, 0x8C, 0x9D, 0xA3, 0x95, 0x79, 0x65, 0x66, 0x6A, 0x6B, 0x70, 0x6F, 0x69, 0x74, 0x8D, 
+    0x92, 0x85, 0x7C, 0x76, 0x72, 0x7D, 0x8B, 0x83, 0x77, 0x84, 0xA2, 0xB4, 0xA7, 0x91, 0x91, 0x9A, 
+    0x8D, 0x79, 0x73, 0x69, 0x60, 0x72, 0x87, 0x81, 0x7A, 0x81, 0x82, 0x81, 0x88, 0x80, 0x69, 0x66, 
+    0x77, 0x85, 0x8C, 0x89, 0x81, 0x86, 0x95, 0x92, 0x81, 0x72, 0x6B, 0x69, 0x6C, 0x69, 0x5C, 0x50, 
+    0x49, 0x47, 0x4B, 0x5D, 0x95, 0xC4, 0x96, 0x59, 0x9A, 0xFB, 0xC5, 0x4F, 0x5C, 0xC0, 0xE2, 0xB2, 
+    0x79, 0x7A, 0xB3, 0xC7, 0x83, 0x46, 0x4F, 0x5C, 0x47, 0x44, 0x5E, 0x69, 0x5F, 0x60, 0x7D, 0xA3, 
+    0xA8, 0x82, 0x64, 0x7C, 0xA6, 0xA8, 0x8E, 0x7D, 0x80, 0x97, 0xB1, 0xA9, 0x83, 0x6B, 0x71, 0x78, 
+    0x70, 0x5E, 0x4B, 0x4B, 0x5E, 0x72, 0x7B, 0x78, 0x74, 0x7B, 0x8D, 0x91, 0x84, 0x80, 0x86, 0x86, 
+    0x8C, 0xA2, 0xAC, 0x96, 0x83, 0x91, 0xA7, 0x9C, 0x7C, 0x6C, 0x74, 0x82, 0x85, 0x80, 0x79, 0x72, 
+    0x78, 0x8B, 0x93, 0x7E, 0x68, 0x6D, 0x7D, 0x83, 0x7E, 0x76, 0x74, 0x7C, 0x8A, 0x92, 0x89, 0x7C, 
+    0x7A, 0x85, 0x8C, 0x85, 0x7D, 0x7A, 0x78, 0x7A, 0x7E, 0x75, 0x5D, 0x4D, 0x4D, 0x4B, 0x41, 0x46, 
+    0x70, 0xB1, 0xBA, 0x7B, 0x6F, 0xC8, 0xED, 0x8F, 0x49, 0x82, 0xD2, 0xD3, 0x9C, 0x77, 0x90, 0xC1, 
+    0xAD, 0x5C, 0x38, 0x50, 0x58, 0x43, 0x48, 0x67, 0x78, 0x77, 0x7D, 0x92, 0xA5, 0x9D, 0x77, 0x5E, 
+    0x76, 0x99, 0x96, 0x7F, 0x7C, 0x90, 0xAA, 0xB0, 0x91, 0x6C, 0x67, 0x71, 0x66, 0x58, 0x5D, 0x68, 
+    0x72, 0x80, 0x8D, 0x93, 0x8E, 0x81, 0x7A, 0x7C, 0x7C, 0x76, 0x73, 0x75, 0x7C, 0x8D, 0x9E, 0x99, 
+    0x87, 0x82, 0x8B, 0x8F, 0x83, 0x77, 0x7E, 0x89, 0x84, 0x85, 0x9E, 0xA4, 0x88, 0x7D, 0x8C, 0x8D, 
+    0x7D, 0x6E, 0x65, 0x6B, 0x81, 0x85, 0x76, 0x73, 0x81, 0x88, 0x83, 0x7C, 0x77, 0x76, 0x79, 0x80, 
+    0x82, 0x7D, 0x75, 0x71, 0x70, 0x6B, 0x5A, 0x46, 0x42, 0x5A, 0x74, 0x7B, 0x7C, 0x93, 0xB8, 0xBD, 
+    0x9B, 0x8B, 0xA6, 0xB3, 0x97, 0x84, 0x94, 0xAC, 0xAE, 0x92, 0x73, 0x70, 0x7B, 0x69, 0x47, 0x42, 
+    0x58, 0x68, 0x6E, 0x7B, 0x89, 0x8D, 0x90, 0x92, 0x8D, 0x86, 0x82, 0x7E, 0x79, 0x7C, 0x88, 0x90, 
+    0x92, 0x8B, 0x80, 0x7B, 0x7C, 0x72, 0x5F, 0x57, 0x62, 0x70, 0x7B, 0x83, 0x88, 0x8D, 0x93, 0x95, 
+    0x8B, 0x7D, 0x79, 0x7A, 0x75, 0x73, 0x7E, 0x8C, 0x8F, 0x8C, 0x8E, 0x90, 0x8B, 0x83, 0x7E, 0x81, 
+    0x82, 0x7F, 0x7E, 0x87, 0x8F, 0x8D, 0x8C, 0x8C, 0x84, 0x7C, 0x7C, 0x79, 0x6E, 0x6C, 0x76, 0x7D, 
+    0x7F, 0x81, 0x84, 0x8A, 0x90, 0x8B, 0x82, 0x7F, 0x80, 0x7D, 0x79, 0x75, 0x6E, 0x64, 0x5D, 0x53, 
+    0x47, 0x4C, 0x5F, 0x68, 0x66, 0x7D, 0xAA, 0xB6, 0x91, 0x80, 0xA2, 0xBC, 0xA4, 0x87, 0x94, 0xB5, 
+    0xBB, 0x9A, 0x79, 0x7B, 0x88, 0x76, 0x50, 0x45, 0x59, 0x6B, 0x6F, 0x72, 0x7C, 0x8B, 0x99, 0x97, 
+    0x88, 0x80, 0x87, 0x87, 0x7C, 0x77, 0x7D, 0x83, 0x86, 0x83, 0x7A, 0x76, 0x7E, 0x7B, 0x6B, 0x63, 
+    0x6A, 0x73, 0x77, 0x7B, 0x83, 0x8E, 0x95, 0x91, 0x89, 0x84, 0x80, 0x7B, 0x74, 0x6D, 0x6F, 0x7C, 
+    0x88, 0x85, 0x7F, 0x87, 0x97, 0x96, 0x8B, 0x89, 0x8D, 0x8D, 0x90, 0x94, 0x92, 0x8E, 0x8C, 0x86, 
+    0x82, 0x7F, 0x74, 0x66, 0x64, 0x6D, 0x70, 0x6D, 0x6E, 0x73, 0x79, 0x84, 0x8A, 0x85, 0x81, 0x88, 
+    0x8E, 0x89, 0x80, 0x79, 0x70, 0x64, 0x5A, 0x59, 0x5D, 0x62, 0x6C, 0x81, 0x9A, 0xA9, 0x9B, 0x7C, 
+    0x7B, 0x98, 0x9B, 0x7E, 0x79, 0x9A, 0xB5, 0xAF, 0x94, 0x7F, 0x80, 0x82, 0x68, 0x43, 0x3F, 0x5C, 
+    0x73, 0x76, 0x7F, 0x94, 0xA5, 0xAA, 0xA3, 0x93, 0x88, 0x89, 0x85, 0x77, 0x73, 0x7E, 0x85, 0x80, 
+    0x78, 0x73, 0x72, 0x71, 0x69, 0x60, 0x61, 0x6B, 0x73, 0x7A, 0x86, 0x93, 0x98, 0x96, 0x93, 0x91, 
+    0x8C, 0x86, 0x7F, 0x72, 0x6A, 0x6D, 0x76, 0x78, 0x71, 0x6D, 0x77, 0x85, 0x89, 0x84, 0x84, 0x8B, 
+    0x96, 0x9F, 0x9F, 0x9B, 0x9B, 0x98, 0x90, 0x8D, 0x8A, 0x7E, 0x75, 0x77, 0x78, 0x72, 0x70, 0x70, 
+    0x69, 0x66, 0x6B, 0x70, 0x6D, 0x6D, 0x76, 0x80, 0x83, 0x7E, 0x79, 0x72, 0x6A, 0x63, 0x60, 0x62, 
+    0x70, 0x8D, 0xAE, 0xB2, 0x91, 0x81, 0x9E, 0xB1, 0x92, 0x72, 0x7F, 0x9E, 0xA4, 0x8D, 0x74, 0x74, 
+    0x82, 0x7D, 0x5E, 0x49, 0x54, 0x6C, 0x77, 0x79, 0x7C, 0x86, 0x98, 0xA4, 0x9B, 0x8A, 0x8A, 0x93, 
+    0x8E, 0x81, 0x7F, 0x88, 0x8A, 0x7F, 0x70, 0x67, 0x6B, 0x74, 0x6C, 0x5C, 0x60, 0x73, 0x80, 0x84, 
+    0x87, 0x8D, 0x95, 0x9C, 0x98, 0x8A, 0x88, 0x92, 0x8E, 0x76, 0x6A, 0x75, 0x7E, 0x78, 0x6F, 0x6E, 
+    0x73, 0x77, 0x73, 0x6F, 0x76, 0x83, 0x86, 0x88, 0x93, 0x9F, 0xA1, 0x9E, 0x9A, 0x92, 0x8B, 0x89, 
+    0x84, 0x78, 0x71, 0x78, 0x7F, 0x7A, 0x70, 0x6F, 0x75, 0x73, 0x68, 0x63, 0x69, 0x6D, 0x68, 0x64, 
+    0x69, 0x70, 0x73, 0x78, 0x84, 0x9F, 0xC2, 0xC6, 0x97, 0x6F, 0x83, 0xA0, 0x90, 0x6E, 0x71, 0x93, 
+    0xAB, 0x9F, 0x7A, 0x68, 0x74, 0x77, 0x54, 0x35, 0x3F, 0x61, 0x7A, 0x88, 0x8E, 0x8F, 0x9D, 0xB5, 
+    0xB1, 0x8E, 0x7D, 0x88, 0x8D, 0x81, 0x7D, 0x8B, 0x97, 0x93, 0x81, 0x70, 0x6F, 0x73, 0x68, 0x53, 
+    0x4E, 0x59, 0x68, 0x76, 0x80, 0x86, 0x8C, 0x96, 0x99, 0x8F, 0x89, 0x92, 0x99, 0x8E, 0x81, 0x81, 
+    0x89, 0x8D, 0x8A, 0x82, 0x7C, 0x7A, 0x78, 0x73, 0x70, 0x74, 0x77, 0x75, 0x74, 0x7B, 0x86, 0x8D, 
+    0x8C, 0x89, 0x87, 0x88, 0x8A, 0x8B, 0x83, 0x7A, 0x79, 0x79, 0x74, 0x73, 0x76, 0x76, 0x6E, 0x6A, 
+    0x6D, 0x6E, 0x67, 0x5D, 0x58, 0x5D, 0x6A, 0x7E, 0xA5, 0xCD, 0xC4, 0x98, 0x92, 0xB3, 0xB2, 0x89, 
+    0x75, 0x87, 0x9C, 0x9D, 0x87, 0x70, 0x75, 0x89, 0x79, 0x45, 0x2C, 0x41, 0x5B, 0x63, 0x69, 0x71, 
+    0x7F, 0x9A, 0xAE, 0xA9, 0x97, 0x92, 0x94, 0x8D, 0x80, 0x7C, 0x85, 0x95, 0x97, 0x85, 0x79, 0x82, 
+    0x88, 0x76, 0x5F, 0x59, 0x5C, 0x5F, 0x6A, 0x78, 0x80, 0x89, 0x94, 0x90, 0x80, 0x81, 0x90, 0x90, 
+    0x7A, 0x6C, 0x77, 0x8D, 0x9B, 0x99, 0x91, 0x8F, 0x90, 0x88, 0x7A, 0x77, 0x7A, 0x76, 0x6F, 0x70, 
+    0x79, 0x84, 0x8E, 0x8B, 0x7D, 0x79, 0x83, 0x86, 0x77, 0x6C, 0x75, 0x7F, 0x79, 0x71, 0x7A, 0x87, 
+    0x83, 0x75, 0x6F, 0x6E, 0x65, 0x59, 0x5B, 0x64, 0x67, 0x73, 0xA1, 0xCA, 0xB7, 0x88, 0x85, 0xA1, 
+    0x9C, 0x7A, 0x72, 0x8B, 0xA1, 0x9D, 0x88, 0x80, 0x94, 0xA4, 0x88, 0x56, 0x45, 0x58, 0x69, 0x6B, 
+    0x69, 0x6C, 0x78, 0x8F, 0x9E, 0x95, 0x88, 0x8D, 0x93, 0x86, 0x78, 0x79, 0x83, 0x8A, 0x88, 0x7C, 
+    0x78, 0x83, 0x8A, 0x7F, 0x70, 0x69, 0x66, 0x65, 0x6A, 0x71, 0x78, 0x85, 0x90, 0x8A, 0x80, 0x8B, 
+    0x9E, 0x96, 0x7B, 0x70, 0x79, 0x81, 0x82, 0x82, 0x83, 0x85, 0x89, 0x89, 0x83, 0x82, 0x84, 0x83, 
+    0x80, 0x7E, 0x7E, 0x82, 0x88, 0x89, 0x85, 0x82, 0x82, 0x7C, 0x73, 0x73, 0x78, 0x74, 0x68, 0x66, 
+    0x72, 0x7E, 0x7F, 0x79, 0x71, 0x6A, 0x67, 0x68, 0x6B, 0x6E, 0x76, 0x90, 0xB3, 0xBC, 0xA2, 0x91, 
+    0x9D, 0xA3, 0x8F, 0x79, 0x79, 0x87, 0x8D, 0x82, 0x73, 0x75, 0x87, 0x8B, 0x72, 0x57, 0x54, 0x64, 
+    0x6F, 0x70, 0x6F, 0x75, 0x86, 0x9B, 0xA1, 0x97, 0x92, 0x99, 0x98, 0x86, 0x77, 0x79, 0x82, 0x82, 
+    0x78, 0x72, 0x79, 0x85, 0x89, 0x7D, 0x6F, 0x6C, 0x6F, 0x6E, 0x6C, 0x6D, 0x76, 0x82, 0x88, 0x83, 
+    0x84, 0x93, 0x9D, 0x95, 0x86, 0x80, 0x82, 0x85, 0x85, 0x7F, 0x7B, 0x81, 0x88, 0x84, 0x7C, 0x7B, 
+    0x7D, 0x7B, 0x75, 0x6E, 0x72, 0x7F, 0x89, 0x89, 0x87, 0x8C, 0x92, 0x8C, 0x80, 0x7D, 0x7E, 0x75, 
+    0x67, 0x62, 0x6B, 0x76, 0x79, 0x73, 0x6C, 0x6A, 0x6B, 0x68, 0x66, 0x6C, 0x7D, 0x98, 0xAE, 0xAB, 
+    0x9A, 0x9A, 0xAB, 0xAB, 0x91, 0x80, 0x8B, 0x99, 0x92, 0x7D, 0x70, 0x79, 0x8A, 0x83, 0x66, 0x55, 
+    0x5E, 0x69, 0x67, 0x63, 0x68, 0x73, 0x7D, 0x85, 0x87, 0x88, 0x8E, 0x96, 0x92, 0x87, 0x84, 0x8C, 
+    0x92, 0x8D, 0x85, 0x84, 0x88, 0x8A, 0x85, 0x7A, 0x72, 0x6F, 0x6D, 0x69, 0x67, 0x6A, 0x70, 0x75, 
+    0x75, 0x74, 0x7B, 0x8B, 0x93, 0x8F, 0x8B, 0x91, 0x94, 0x8E, 0x8A, 0x8D, 0x90, 0x8C, 0x86, 0x84, 
+    0x87, 0x87, 0x80, 0x79, 0x74, 0x6F, 0x6A, 0x6E, 0x77, 0x7C, 0x7D, 0x7F, 0x86, 0x89, 0x87, 0x86, 
+    0x85, 0x7D, 0x6F, 0x6A, 0x70, 0x77, 0x78, 0x74, 0x72, 0x71, 0x71, 0x6F, 0x69, 0x63, 0x65, 0x73, 
+    0x88, 0x9B, 0x9E, 0x99, 0x9F, 0xAC, 0xAA, 0x9A, 0x93, 0x9B, 0x9C, 0x8D, 0x7B, 0x76, 0x7F, 0x88, 
+    0x81, 0x6E, 0x64, 0x69, 0x6C, 0x67, 0x65, 0x69, 0x6E, 0x73, 0x79, 0x7D, 0x81, 0x8E, 0x9B, 0x93, 
+    0x83, 0x80, 0x88, 0x8A, 0x82, 0x7D, 0x80, 0x87, 0x8A, 0x87, 0x85, 0x87, 0x85, 0x7B, 0x70, 0x6C, 
+    0x6B, 0x69, 0x68, 0x6A, 0x6B, 0x6F, 0x7A, 0x84, 0x86, 0x89, 0x91, 0x92, 0x8A, 0x87, 0x90, 0x97, 
+    0x92, 0x8B, 0x8A, 0x8E, 0x90, 0x8D, 0x85, 0x7E, 0x7B, 0x77, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 
+    0x7F, 0x85, 0x88, 0x85, 0x80, 0x7C, 0x7B, 0x7B, 0x78, 0x73, 0x6F, 0x71, 0x73, 0x72, 0x6D, 0x6A, 
+    0x6A, 0x69, 0x67, 0x67, 0x6F, 0x82, 0x9A, 0x9F, 0x94, 0x93, 0xA3, 0xAA, 0x9D, 0x94, 0x99, 0x9F, 
+    0x97, 0x88, 0x7E, 0x84, 0x8D, 0x87, 0x71, 0x62, 0x67, 0x6E, 0x6C, 0x6A, 0x6C, 0x6C, 0x6D, 0x74, 
+    0x7B, 0x7C, 0x81, 0x89, 0x86, 0x7D, 0x7F, 0x8C, 0x91, 0x8C, 0x83, 0x7F, 0x83, 0x8C, 0x8F, 0x8E, 
+    0x8C, 0x89, 0x82, 0x78, 0x74, 0x77, 0x77, 0x6E, 0x62, 0x5F, 0x68, 0x77, 0x7D, 0x78, 0x75, 0x7C, 
+    0x82, 0x81, 0x82, 0x87, 0x89, 0x88, 0x8C, 0x91, 0x93, 0x97, 0x9B, 0x97, 0x8F, 0x8A, 0x88, 0x83, 
+    0x7F, 0x7D, 0x7D, 0x7C, 0x7A, 0x79, 0x7B, 0x81, 0x87, 0x84, 0x7B, 0x77, 0x79, 0x7A, 0x77, 0x71, 
+    0x6F, 0x71, 0x74, 0x75, 0x73, 0x72, 0x73, 0x71, 0x6B, 0x65, 0x65, 0x6B, 0x76, 0x86, 0x96, 0x97, 
+    0x8D, 0x8E, 0x9C, 0xA1, 0x93, 0x8A, 0x90, 0x99, 0x94, 0x89, 0x85, 0x8D, 0x96, 0x92, 0x81, 0x75, 
+    0x79, 0x7F, 0x76, 0x69, 0x67, 0x6C, 0x6C, 0x69, 0x67, 0x69, 0x70, 0x78, 0x77, 0x71, 0x75, 0x83, 
+    0x8B, 0x8B, 0x89, 0x8C, 0x94, 0x9B, 0x9C, 0x99, 0x99, 0x99, 0x90, 0x83, 0x7C, 0x7D, 0x7B, 0x72, 
+    0x67, 0x5E, 0x5F, 0x66, 0x6A, 0x64, 0x5F, 0x65, 0x6F, 0x70, 0x6F, 0x7B, 0x8D, 0x93, 0x8E, 0x91, 
+    0xA0, 0xAD, 0xAD, 0xA7, 0xA4, 0xA2, 0x9B, 0x92, 0x8A, 0x86, 0x83, 0x7C, 0x72, 0x6E, 0x72, 0x75, 
+    0x72, 0x6C, 0x68, 0x6A, 0x6E, 0x71, 0x71, 0x71, 0x76, 0x7C, 0x7E, 0x82, 0x86, 0x88, 0x87, 0x84, 
+    0x7F, 0x7A, 0x76, 0x6F, 0x66, 0x63, 0x66, 0x70, 0x81, 0x8B, 0x83, 0x7C, 0x87, 0x94, 0x8D, 0x82, 
+    0x8B, 0x9B, 0x9E, 0x95, 0x90, 0x95, 0xA0, 0xA4, 0x96, 0x84, 0x81, 0x87, 0x7E, 0x6D, 0x66, 0x68, 
+    0x66, 0x61, 0x5F, 0x61, 0x67, 0x71, 0x75, 0x6E, 0x6F, 0x80, 0x8E, 0x89, 0x80, 0x86, 0x92, 0x97, 
+    0x95, 0x98, 0x9F, 0xA1, 0x99, 0x8E, 0x89, 0x89, 0x82, 0x73, 0x65, 0x5E, 0x5A, 0x5A, 0x5F, 0x62, 
+    0x60, 0x65, 0x70, 0x73, 0x70, 0x76, 0x84, 0x89, 0x86, 0x88, 0x96, 0xA4, 0xAB, 0xAC, 0xAC, 0xAC, 
+    0xA8, 0x9F, 0x93, 0x8B, 0x83, 0x7A, 0x71, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x71, 0x6F, 0x71, 0x75, 
+    0x74, 0x72, 0x76, 0x7A, 0x78, 0x79, 0x83, 0x8C, 0x8B, 0x86, 0x87, 0x88, 0x80, 0x76, 0x72, 0x70, 
+    0x6C, 0x66, 0x64, 0x65, 0x66, 0x6C, 0x7F, 0x90, 0x87, 0x78, 0x7F, 0x95, 0x94, 0x80, 0x7E, 0x92, 
+    0xA0, 0x9A, 0x90, 0x94, 0xA5, 0xAD, 0x9F, 0x8A, 0x86, 0x8F, 0x8E, 0x7C, 0x6E, 0x6D, 0x6E, 0x67, 
+    0x60, 0x5C, 0x5E, 0x65, 0x69, 0x61, 0x5C, 0x6C, 0x82, 0x83, 0x76, 0x77, 0x87, 0x92, 0x91, 0x91, 
+    0x99, 0xA0, 0x9E, 0x98, 0x94, 0x96, 0x9A, 0x96, 0x86, 0x75, 0x6D, 0x6F, 0x70, 0x68, 0x5C, 0x5A, 
+    0x65, 0x6A, 0x64, 0x64, 0x75, 0x80, 0x78, 0x70, 0x7C, 0x8E, 0x95, 0x94, 0x97, 0x9F, 0xA4, 0xA5, 
+    0xA7, 0xAA, 0xA8, 0x9F, 0x91, 0x86, 0x82, 0x7E, 0x78, 0x71, 0x6D, 0x69, 0x69, 0x6D, 0x6E, 0x6B, 
+    0x6A, 0x6C, 0x6B, 0x6C, 0x73, 0x7F, 0x83, 0x81, 0x85, 0x90, 0x95, 0x91, 0x8C, 0x8A, 0x85, 0x78, 
+    0x6E, 0x6B, 0x6B, 0x67, 0x62, 0x5C, 0x59, 0x61, 0x79, 0x89, 0x7D, 0x6F, 0x80, 0x9A, 0x9A, 0x8D, 
+    0x95, 0xAD, 0xB4, 0xA5, 0x99, 0x9F, 0xAD, 0xAE, 0x98, 0x81, 0x80, 0x89, 0x83, 0x6E, 0x61, 0x5F, 
+    0x5C, 0x54, 0x4E, 0x4D, 0x54, 0x61, 0x67, 0x63, 0x66, 0x7D, 0x93, 0x92, 0x84, 0x83, 0x91, 0x99, 
+    0x95, 0x94, 0x9D, 0xA5, 0xA1, 0x94, 0x8D, 0x91, 0x94, 0x88, 0x72, 0x65, 0x68, 0x70, 0x72, 0x6C, 
+    0x68, 0x6B, 0x73, 0x76, 0x73, 0x75, 0x7D, 0x7E, 0x74, 0x6F, 0x7D, 0x8F, 0x92, 0x8D, 0x8F, 0x94, 
+    0x94, 0x91, 0x92, 0x90, 0x8A, 0x87, 0x88, 0x88, 0x88, 0x8B, 0x8B, 0x86, 0x80, 0x7D, 0x7E, 0x7F, 
+    0x7C, 0x76, 0x73, 0x77, 0x79, 0x77, 0x79, 0x81, 0x81, 0x76, 0x71, 0x7A, 0x80, 0x7A, 0x73, 0x74, 
+    0x76, 0x77, 0x79, 0x7D, 0x7F, 0x7E, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x77, 0x6E, 0x6F, 0x84, 
+    0x93, 0x86, 0x76, 0x83, 0x94, 0x8A, 0x78, 0x81, 0x95, 0x96, 0x88, 0x80, 0x8A, 0x9C, 0xA2, 0x94, 
+    0x82, 0x83, 0x91, 0x91, 0x82, 0x79, 0x7C, 0x7C, 0x74, 0x6D, 0x67, 0x66, 0x69, 0x66, 0x58, 0x51, 
+    0x61, 0x73, 0x72, 0x68, 0x70, 0x85, 0x8E, 0x89, 0x8A, 0x96, 0x9E, 0x99, 0x92, 0x93, 0x9E, 0xA7, 
+    0xA4, 0x97, 0x8D, 0x8C, 0x8D, 0x87, 0x78, 0x6B, 0x68, 0x6C, 0x69, 0x60, 0x62, 0x71, 0x76, 0x69, 
+    0x63, 0x72, 0x81, 0x7E, 0x74, 0x77, 0x83, 0x8A, 0x8B, 0x90, 0x94, 0x96, 0x9A, 0x9B, 0x94, 0x8C, 
+    0x8E, 0x93, 0x8C, 0x7D, 0x7A, 0x83, 0x86, 0x7B, 0x6F, 0x73, 0x7A, 0x77, 0x6F, 0x72, 0x7E, 0x82, 
+    0x7D, 0x7B, 0x82, 0x89, 0x87, 0x80, 0x7C, 0x7D, 0x80, 0x7F, 0x7B, 0x7A, 0x7E, 0x81, 0x81, 0x7E, 
+    0x7A, 0x7B, 0x7B, 0x76, 0x6E, 0x6D, 0x72, 0x74, 0x71, 0x70, 0x72, 0x7B, 0x8B, 0x91, 0x83, 0x77, 
+    0x83, 0x90, 0x84, 0x71, 0x7C, 0x96, 0x9A, 0x8A, 0x83, 0x91, 0xA0, 0x9B, 0x87, 0x79, 0x7E, 0x89, 
+    0x86, 0x7B, 0x78, 0x81, 0x85, 0x80, 0x77, 0x74, 0x74, 0x72, 0x6A, 0x60, 0x63, 0x73, 0x7E, 0x77, 
+    0x6C, 0x74, 0x85, 0x87, 0x7D, 0x7B, 0x86, 0x8C, 0x89, 0x89, 0x92, 0x9D, 0xA2, 0x9D, 0x94, 0x8E, 
+    0x8F, 0x91, 0x88, 0x79, 0x72, 0x76, 0x79, 0x74, 0x6F, 0x72, 0x77, 0x72, 0x6A, 0x69, 0x70, 0x76, 
+    0x72, 0x6E, 0x71, 0x7B, 0x83, 0x84, 0x82, 0x83, 0x86, 0x88, 0x87, 0x85, 0x87, 0x8C, 0x8D, 0x88, 
+    0x83, 0x86, 0x8E, 0x8F, 0x87, 0x82, 0x87, 0x8D, 0x89, 0x83, 0x86, 0x8C, 0x89, 0x80, 0x7C, 0x7D, 
+    0x7F, 0x7D, 0x78, 0x73, 0x73, 0x78, 0x7A, 0x77, 0x76, 0x7B, 0x7F, 0x7D, 0x7A, 0x7D, 0x82, 0x82, 
+    0x7D, 0x79, 0x7C, 0x81, 0x7F, 0x79, 0x76, 0x77, 0x77, 0x73, 0x70, 0x70, 0x6F, 0x6B, 0x6D, 0x79, 
+    0x82, 0x7B, 0x74, 0x7F, 0x8E, 0x8B, 0x7E, 0x81, 0x94, 0x9B, 0x90, 0x87, 0x90, 0x9E, 0xA0, 0x96, 
+    0x8B, 0x8A, 0x91, 0x93, 0x8B, 0x83, 0x83, 0x84, 0x80, 0x7A, 0x75, 0x74, 0x72, 0x6D, 0x66, 0x61, 
+    0x65, 0x6D, 0x6E, 0x64, 0x62, 0x70, 0x7F, 0x7E, 0x79, 0x7F, 0x88, 0x89, 0x86, 0x8A, 0x90, 0x93, 
+    0x94, 0x94, 0x90, 0x8E, 0x94, 0x9B, 0x93, 0x82, 0x7D, 0x85, 0x85, 0x7B, 0x76, 0x7A, 0x7C, 0x75, 
+    0x6E, 0x72, 0x78, 0x77, 0x70, 0x6B, 0x6B, 0x6E, 0x74, 0x79, 0x79, 0x76, 0x78, 0x83, 0x88, 0x85, 
+    0x83, 0x8A, 0x8D, 0x86, 0x82, 0x88, 0x8F, 0x8C, 0x85, 0x85, 0x89, 0x89, 0x84, 0x83, 0x83, 0x82, 
+    0x7F, 0x80, 0x82, 0x80, 0x7F, 0x82, 0x84, 0x81, 0x7F, 0x83, 0x87, 0x83, 0x7F, 0x82, 0x86, 0x84, 
+    0x81, 0x81, 0x81, 0x7E, 0x79, 0x77, 0x77, 0x76, 0x74, 0x71, 0x71, 0x71, 0x74, 0x76, 0x76, 0x77, 
+    0x78, 0x7A, 0x7C, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7A, 0x7B, 0x80, 0x87, 0x86, 0x7D, 0x7A, 0x85, 
+    0x8F, 0x88, 0x7C, 0x7F, 0x8A, 0x8B, 0x82, 0x7D, 0x84, 0x8C, 0x8A, 0x80, 0x7C, 0x85, 0x92, 0x92, 
+    0x89, 0x85, 0x8C, 0x90, 0x8E, 0x8B, 0x87, 0x81, 0x7D, 0x7A, 0x75, 0x70, 0x72, 0x77, 0x73, 0x67, 
+    0x66, 0x72, 0x7A, 0x73, 0x6A, 0x6E, 0x75, 0x75, 0x76, 0x7D, 0x85, 0x88, 0x8B, 0x8E, 0x90, 0x94, 
+    0x9B, 0x9E, 0x95, 0x89, 0x89, 0x8F, 0x8D, 0x85, 0x80, 0x80, 0x7D, 0x78, 0x77, 0x79, 0x79, 0x75, 
+    0x6E, 0x6B, 0x6A, 0x6D, 0x72, 0x75, 0x73, 0x71, 0x75, 0x7C, 0x7F, 0x7D, 0x7E, 0x80, 0x80, 0x7E, 
+    0x7F, 0x86, 0x8C, 0x8B, 0x87, 0x87, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x88, 0x85, 0x89, 0x8C, 0x8B, 
+    0x87, 0x86, 0x86, 0x83, 0x80, 0x7F, 0x7E, 0x7C, 0x79, 0x77, 0x78, 0x79, 0x7B, 0x7D, 0x7C, 0x7A, 
+    0x7A, 0x7D, 0x7F, 0x7F, 0x7C, 0x7A, 0x7D, 0x80, 0x80, 0x7E, 0x7E, 0x7F, 0x80, 0x7D, 0x7C, 0x7D, 
+    0x7F, 0x7E, 0x7A, 0x78, 0x7A, 0x7B, 0x78, 0x73, 0x71, 0x72, 0x74, 0x73, 0x73, 0x78, 0x7D, 0x7D, 
+    0x7A, 0x7E, 0x88, 0x8B, 0x86, 0x84, 0x8B, 0x92, 0x91, 0x8B, 0x8A, 0x8F, 0x93, 0x91, 0x8E, 0x8E, 
+    0x90, 0x92, 0x8D, 0x86, 0x81, 0x81, 0x80, 0x7A, 0x74, 0x73, 0x76, 0x77, 0x75, 0x72, 0x71, 0x74, 
+    0x76, 0x72, 0x6D, 0x70, 0x76, 0x79, 0x77, 0x77, 0x7D, 0x83, 0x85, 0x83, 0x83, 0x84, 0x87, 0x87, 
+    0x86, 0x85, 0x87, 0x8A, 0x89, 0x84, 0x82, 0x86, 0x89, 0x84, 0x7F, 0x80, 0x85, 0x87, 0x84, 0x82, 
+    0x84, 0x85, 0x82, 0x7D, 0x7C, 0x7D, 0x7C, 0x78, 0x77, 0x79, 0x7B, 0x7A, 0x78, 0x77, 0x75, 0x75, 
+    0x76, 0x76, 0x75, 0x75, 0x79, 0x7D, 0x7D, 0x7C, 0x80, 0x84, 0x83, 0x80, 0x81, 0x85, 0x87, 0x87, 
+    0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8B, 0x8B, 0x8A, 0x88, 0x87, 0x86, 0x85, 0x83, 0x81, 0x7F, 0x7C, 
+    0x7D, 0x80, 0x80, 0x7D, 0x7C, 0x7E, 0x7F, 0x7D, 0x7C, 0x7E, 0x7F, 0x7D, 0x7C, 0x7F, 0x81, 0x82, 
+    0x82, 0x80, 0x7F, 0x7E, 0x7E, 0x7D, 0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x78, 0x78, 0x7B, 0x7C, 0x76, 
+    0x72, 0x74, 0x77, 0x75, 0x72, 0x71, 0x71, 0x73, 0x76, 0x76, 0x74, 0x76, 0x7E, 0x83, 0x83, 0x84, 
+    0x8D, 0x95, 0x94, 0x8F, 0x90, 0x95, 0x97, 0x93, 0x8D, 0x8D, 0x91, 0x92, 0x8D, 0x88, 0x87, 0x87, 
+    0x82, 0x7A, 0x76, 0x76, 0x74, 0x72, 0x72, 0x73, 0x73, 0x75, 0x79, 0x7B, 0x77, 0x77, 0x7C, 0x80, 
+    0x7E, 0x7B, 0x7F, 0x84, 0x84, 0x82, 0x83, 0x87, 0x87, 0x84, 0x82, 0x82, 0x83, 0x83, 0x82, 0x7F, 
+    0x7D, 0x7D, 0x7F, 0x7F, 0x7D, 0x7B, 0x7B, 0x7C, 0x7C, 0x7B, 0x7D, 0x80, 0x81, 0x80, 0x7F, 0x81, 
+    0x85, 0x85, 0x81, 0x80, 0x81, 0x81, 0x7F, 0x7D, 0x7D, 0x7D, 0x7B, 0x79, 0x77, 0x77, 0x77, 0x78, 
+    0x78, 0x78, 0x78, 0x7A, 0x7E, 0x80, 0x7F, 0x7E, 0x80, 0x82, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 
+    0x85, 0x88, 0x8A, 0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x85, 0x86, 0x88, 0x89, 0x87, 
+    0x87, 0x88, 0x87, 0x81, 0x7F, 0x81, 0x81, 0x7D, 0x7A, 0x7C, 0x7C, 0x7A, 0x7A, 0x7D, 0x7E, 0x7A, 
+    0x77, 0x78, 0x79, 0x77, 0x75, 0x74, 0x75, 0x75, 0x75, 0x77, 0x7A, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 
+    0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x7B, 0x7D, 0x7D, 0x7C, 0x7D, 0x7F, 0x7D, 0x7C, 0x7E, 0x83, 
+    0x83, 0x80, 0x81, 0x87, 0x89, 0x89, 0x8A, 0x8D, 0x8E, 0x8C, 0x8C, 0x8E, 0x8E, 0x8B, 0x88, 0x88, 
+    0x89, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x84, 0x83, 0x80, 0x7F, 0x7E, 0x7D, 0x7A, 0x79, 0x7A, 
+    0x79, 0x77, 0x76, 0x76, 0x75, 0x74, 0x73, 0x74, 0x74, 0x72, 0x71, 0x75, 0x78, 0x79, 0x7A, 0x7C, 
+    0x7E, 0x7E, 0x80, 0x83, 0x84, 0x80, 0x7F, 0x82, 0x85, 0x84, 0x83, 0x85, 0x87, 0x85, 0x83, 0x84, 
+    0x85, 0x84, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x83, 
+    0x83, 0x81, 0x7E, 0x7F, 0x80, 0x7F, 0x7B, 0x79, 0x7A, 0x7B, 0x7A, 0x7A, 0x7D, 0x80, 0x7F, 0x7E, 
+    0x80, 0x84, 0x85, 0x84, 0x83, 0x84, 0x85, 0x87, 0x8A, 0x8B, 0x8A, 0x8A, 0x8C, 0x8C, 0x8B, 0x89, 
+    0x89, 0x89, 0x85, 0x81, 0x80, 0x81, 0x81, 0x7F, 0x7D, 0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x78, 0x76, 
+    0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75, 0x74, 0x75, 0x77, 0x78, 0x76, 0x76, 0x78, 0x7A, 0x7B, 
+    0x7C, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x82, 0x82, 0x83, 0x85, 0x86, 0x86, 0x87, 0x8A, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8B, 
+    0x89, 0x88, 0x89, 0x89, 0x86, 0x85, 0x85, 0x85, 0x82, 0x7E, 0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 
+    0x79, 0x78, 0x79, 0x7A, 0x79, 0x79, 0x7A, 0x7A, 0x78, 0x78, 0x7A, 0x7C, 0x7C, 0x7A, 0x7A, 0x7B, 
+    0x7B, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x82, 0x85, 0x87, 
+    0x86, 0x86, 0x86, 0x87, 0x87, 0x86, 0x85, 0x84, 0x84, 0x82, 0x80, 0x7F, 0x7F, 0x7E, 0x7C, 0x7C, 
+    0x7C, 0x7B, 0x7B, 0x7C, 0x7E, 0x7C, 0x7B, 0x7D, 0x7E, 0x7E, 0x7E, 0x80, 0x83, 0x83, 0x82, 0x83, 
+    0x85, 0x84, 0x83, 0x82, 0x82, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x81, 0x81, 0x80, 0x81, 0x83, 
+    0x83, 0x81, 0x80, 0x82, 0x84, 0x84, 0x83, 0x83, 0x85, 0x86, 0x84, 0x83, 0x82, 0x81, 0x7F, 0x7D, 
+    0x7C, 0x7C, 0x7B, 0x7A, 0x7A, 0x79, 0x7A, 0x7B, 0x7C, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7A, 0x7A, 
+    0x7B, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x81, 0x82, 0x82, 0x81, 0x82, 
+    0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 
+    0x81, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
+    0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x82, 0x84, 0x83, 0x82, 0x83, 0x85, 0x84, 0x81, 0x81, 0x83, 
+    0x84, 0x83, 0x82, 0x81, 0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x7D, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x82, 
+    0x82, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7E, 
+    0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7A, 0x7B, 0x7D, 0x80, 0x81, 0x80, 0x81, 0x83, 0x84, 0x84, 0x84, 
+    0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 
+    0x7A, 0x7A, 0x7B, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 
+    0x82, 0x82, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 
+    0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7C, 0x7C, 0x7D, 0x7E, 
+    0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x81, 0x81, 0x81, 0x82, 0x84, 0x85, 0x84, 
+    0x83, 0x83, 0x83, 0x81, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
+    0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x81, 0x7F, 0x7F, 0x7F, 0x7E, 
+    0x7D, 0x7C, 0x7D, 0x7D, 0x7D, 0x7C, 0x7D, 0x7D, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 
+    0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 
+    0x82, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7E, 0x7E, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 
+    0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 
+    0x7D, 0x7B, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 
+    0x82, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7D, 0x7C, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 
+    0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 
+    0x83, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7E, 
+    0x7C, 0x7B, 0x7C, 0x7B, 0x7A, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x82, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 
+    0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x7E, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 
+    0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 
+    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x82, 0x85, 0x88, 0x88, 0x87, 0x85, 0x81, 
+    0x7E, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7C, 0x79, 0x78, 0x78, 0x79, 0x7A, 0x7C, 0x7D, 
+    0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 
+    0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x81, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7D, 
+    0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x81, 
+    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 
+    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 
+    0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 
+    0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x81, 0x81, 0x81, 0x80, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 
+    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
+    0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7F, 
+    0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 
+    0x7E, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 
+    0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 
+    0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
+    0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
+    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7E, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 
+    0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
+    0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 
+    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
+    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
+    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 
+    0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
+    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
+    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F
+};
+
+#endif
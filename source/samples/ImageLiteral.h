@@ -0,0 +1,202 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MicroBit.h"
+
+#ifndef IMAGE_LITERAL_H
+#define IMAGE_LITERAL_H
+
+/**
+ * A compile time compiler for the CSV image strings accepted by MicroBitImage.
+ *
+ *     static constexpr auto HEART = IMAGE("0,255,0,255,0\n255,255,255,255,255\n...");
+ *
+ *     uBit.display.print(HEART.image());
+ *
+ * The IMAGE macro parses and validates the string as the program is compiled (a malformed image, a value over 255 or
+ * rows of differing length fail the build with an error referencing image_syntax_error), and produces an ImageLiteral
+ * laid out exactly as a CODAL ImageData with a read-only reference count. The literal lives in flash, and image()
+ * wraps it in a MicroBitImage without parsing, copying or allocating anything.
+ *
+ * Whitespace is ignored, so the images can be laid out as a grid in the source. Images of the same size have the same
+ * type, so animations can be held in arrays: static constexpr ImageLiteral<5, 5> frames[] = {IMAGE(...), ...};
+ */
+
+template <int W, int H>
+struct ImageLiteral
+{
+    static_assert(W > 0 && H > 0, "An image must contain at least one pixel");
+
+    uint16_t    refCount;               // 0xFFFF marks a read-only image in flash, that is never counted or freed.
+    uint16_t    width;
+    uint16_t    height;
+    uint8_t     data[W * H];
+
+    /**
+     * Wraps the literal in a MicroBitImage. This costs a few cycles, and no memory.
+     */
+    MicroBitImage image() const
+    {
+        return MicroBitImage((ImageData *)this);
+    }
+};
+
+/**
+ * Deliberately not constexpr, so that reaching this during compilation of an image fails the build.
+ */
+void image_syntax_error();
+
+constexpr bool image_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool image_is_space(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+constexpr const char *image_skip_spaces(const char *s)
+{
+    return image_is_space(*s) ? image_skip_spaces(s + 1) : s;
+}
+
+constexpr const char *image_skip_digits(const char *s)
+{
+    return image_is_digit(*s) ? image_skip_digits(s + 1) : s;
+}
+
+constexpr int image_number(const char *s, int value)
+{
+    return image_is_digit(*s) ? image_number(s + 1, value * 10 + (*s - '0')) : value;
+}
+
+/**
+ * Find the value following the one at p (or the end of the row), failing the build if the value isn't followed by a
+ * separator.
+ */
+constexpr const char *image_separator(const char *p)
+{
+    return *p == ',' ? p + 1 : (*p == '\n' || *p == '\0') ? p : (image_syntax_error(), p);
+}
+
+constexpr const char *image_next_value(const char *s)
+{
+    return image_separator(image_skip_spaces(image_skip_digits(image_skip_spaces(s))));
+}
+
+/**
+ * Find the start of the row following the one at s.
+ */
+constexpr const char *image_next_row(const char *s)
+{
+    return *s == '\0' ? s : *s == '\n' ? s + 1 : image_next_row(s + 1);
+}
+
+/**
+ * Find the start of the first row at or after s that holds any values, skipping blank lines.
+ */
+constexpr const char *image_skip_blank_rows(const char *s)
+{
+    return *image_skip_spaces(s) == '\n' ? image_skip_blank_rows(image_skip_spaces(s) + 1) : s;
+}
+
+/**
+ * Determine the number of values in the row at s.
+ */
+constexpr int image_row_width(const char *s)
+{
+    return (*image_skip_spaces(s) == '\n' || *image_skip_spaces(s) == '\0') ? 0 : 1 + image_row_width(image_next_value(s));
+}
+
+/**
+ * Determine the number of rows in an image string.
+ */
+constexpr int image_height(const char *s)
+{
+    return *image_skip_spaces(image_skip_blank_rows(s)) == '\0' ? 0 : 1 + image_height(image_next_row(image_skip_blank_rows(s)));
+}
+
+/**
+ * Determine the number of columns in an image string, from its first row.
+ */
+constexpr int image_width(const char *s)
+{
+    return image_row_width(image_skip_blank_rows(s));
+}
+
+/**
+ * Find the start of the r'th row in an image string.
+ */
+constexpr const char *image_row(const char *s, int r)
+{
+    return r == 0 ? image_skip_blank_rows(s) : image_row(image_next_row(image_skip_blank_rows(s)), r - 1);
+}
+
+/**
+ * Find the c'th value in a row.
+ */
+constexpr const char *image_column(const char *row, int c)
+{
+    return c == 0 ? image_skip_spaces(row) : image_column(image_next_value(row), c - 1);
+}
+
+/**
+ * Checks that a row holds the same number of values as the first, failing the build if not.
+ */
+constexpr const char *image_check_row(const char *row, int width)
+{
+    return image_row_width(row) == width ? row : (image_syntax_error(), row);
+}
+
+/**
+ * Parses a single pixel value, failing the build if it isn't a number in the range 0..255.
+ */
+constexpr uint8_t image_value(const char *p)
+{
+    return (image_is_digit(*p) && image_number(p, 0) <= 255) ? (uint8_t)image_number(p, 0) : (image_syntax_error(), 0);
+}
+
+constexpr uint8_t image_pixel(const char *s, int width, int i)
+{
+    return image_value(image_column(image_check_row(image_row(s, i / width), width), i % width));
+}
+
+template <int... I> struct ImageIndices {};
+template <int N, int... I> struct ImageIndexBuilder : ImageIndexBuilder<N - 1, N - 1, I...> {};
+template <int... I> struct ImageIndexBuilder<0, I...> { typedef ImageIndices<I...> type; };
+
+template <int W, int H, int... I>
+constexpr ImageLiteral<W, H> image_compile(const char *s, ImageIndices<I...>)
+{
+    return ImageLiteral<W, H>{ 0xFFFF, W, H, { image_pixel(s, W, I)... } };
+}
+
+/**
+ * Compiles a CSV image string literal into an ImageLiteral. Assign the result to a constexpr variable, so that it is
+ * guaranteed to be evaluated at compile time.
+ */
+#define IMAGE(csv) image_compile<image_width(csv), image_height(csv)>(csv, ImageIndexBuilder<image_width(csv) * image_height(csv)>::type())
+
+#endif
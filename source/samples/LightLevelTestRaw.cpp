@@ -1,31 +1,23 @@
+#include "MicroBit.h"
 #include "Tests.h"
+#include "MatrixLightSensor.h"
 
-void 
+void
 light_level_test_raw()
 {
-    int t;
+    static MatrixLightSensor *sensor = NULL;
 
-    uBit.io.row1.getDigitalValue();
-    uBit.io.row2.getDigitalValue();
-    uBit.io.row3.getDigitalValue();
-    uBit.io.row4.getDigitalValue();
-    uBit.io.row5.getDigitalValue();
+    if (sensor == NULL)
+        sensor = new MatrixLightSensor();
 
-    uBit.io.col1.setDigitalValue(1);
-    uBit.io.col2.setDigitalValue(1);
-    uBit.io.col3.setDigitalValue(1);
-    uBit.io.col4.setDigitalValue(1);
-    uBit.io.col5.setDigitalValue(1);
+    uBit.display.disable();
+    sensor->setPeriod(500);
+    sensor->start();
 
     while(1)
     {
-        t = 0;
-        uBit.io.row1.setDigitalValue(0);
-        while(t < 1000000 && uBit.io.row1.getDigitalValue(PullMode::None) == 0)
-            t++;
-        
-        DMESG("DECAY: %d\n", t);
+        fiber_wait_for_event(MATRIX_LIGHT_SENSOR_ID, MATRIX_LIGHT_SENSOR_EVT_DATA_READY);
 
-        uBit.sleep(500);
+        DMESG("DECAY: %d %d %d %d %d\n", sensor->read(0), sensor->read(1), sensor->read(2), sensor->read(3), sensor->read(4));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,316 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "LogicAnalyzer.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+LogicAnalyzer *LogicAnalyzer::instance = NULL;
+
+/**
+ * Creates a logic analyzer.
+ * @param pins the pins to watch. These are made digital inputs, pulled down so that unconnected pins stay quiet.
+ * @param labels a number for each pin to be named by in the stream (such as its edge connector number), or NULL
+ * to use the pin's position in the array.
+ * @param count the number of pins, up to 32.
+ * @param timer the timer to use as the sample clock, which must not be shared.
+ * @param irqn the interrupt of the given timer.
+ * @param bufferSize the number of transitions that can be held waiting to be streamed, as a power of two.
+ */
+LogicAnalyzer::LogicAnalyzer(NRF52Pin *const *pins, const uint8_t *labels, int count, NRF_TIMER_Type *timer, IRQn_Type irqn, int bufferSize) : pins(pins, count, PullMode::Down), timer(timer, irqn)
+{
+    this->labels = labels;
+
+    // Round down to a power of two, so the ring buffer indices can be masked.
+    while (bufferSize & (bufferSize - 1))
+        bufferSize &= bufferSize - 1;
+
+    this->bufferSize = max(bufferSize, 2);
+    this->buffer = new LogicAnalyzerRecord[this->bufferSize];
+    this->head = 0;
+    this->tail = 0;
+    this->period = LOGIC_ANALYZER_CLOCK_HZ / 1000;
+    this->deadline = 0;
+    this->tick = 0;
+    this->running = false;
+    this->headerSent = false;
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        mask[p] = this->pins.getMask(p);
+
+    resetStatistics();
+}
+
+/**
+ * Timer interrupt handler, which takes a sample.
+ */
+void LogicAnalyzer::onTimer(uint16_t channels)
+{
+    if ((channels & 1) && instance)
+        instance->sample();
+}
+
+/**
+ * Takes a sample, and records it if it differs from the last.
+ */
+void LogicAnalyzer::sample()
+{
+    uint32_t start = cycle_counter_read();
+    uint32_t in0 = NRF_P0->IN & mask[0];
+    uint32_t in1 = NRF_P1->IN & mask[1];
+
+    if (in0 != last[0] || in1 != last[1])
+    {
+        int free = (tail - head - 1) & (bufferSize - 1);
+
+        if (free >= (gap ? 2 : 1))
+        {
+            // Mark where the buffer overflowed first, so the gap shows in the right place in the stream.
+            if (gap)
+            {
+                buffer[head].tick = LOGIC_ANALYZER_OVERFLOW;
+                buffer[head].in[0] = gap;
+                buffer[head].in[1] = 0;
+                head = (head + 1) & (bufferSize - 1);
+                gap = 0;
+            }
+
+            buffer[head].tick = tick;
+            buffer[head].in[0] = in0;
+            buffer[head].in[1] = in1;
+            head = (head + 1) & (bufferSize - 1);
+
+            last[0] = in0;
+            last[1] = in1;
+            transitions++;
+        }
+        else
+        {
+            // Full. Leave the last sample as it was, so this transition is recorded as soon as there is room.
+            gap++;
+            dropped++;
+        }
+    }
+
+    tick++;
+    deadline += period;
+
+    NRF_TIMER_Type *t = timer.timer;
+    t->CC[0] = deadline;
+
+    // If we were so late that the next sample is already due, its compare has been missed. Skip to the next one we
+    // can make, and count those we couldn't.
+    t->TASKS_CAPTURE[1] = 1;
+    uint32_t late = t->CC[1] - deadline;
+
+    if ((int32_t)late >= 0)
+    {
+        uint32_t skip = late / period + 1;
+
+        missed += skip;
+        tick += skip;
+        deadline += skip * period;
+
+        t->EVENTS_COMPARE[0] = 0;
+        t->CC[0] = deadline;
+    }
+
+    sampleCycles += cycle_counter_read() - start;
+}
+
+/**
+ * Starts sampling. The first sample is always recorded, to give the starting state of every pin.
+ * @param sampleRate the sample rate, in Hz.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the rate is out of range.
+ */
+int LogicAnalyzer::start(int sampleRate)
+{
+    if (sampleRate <= 0 || sampleRate > LOGIC_ANALYZER_CLOCK_HZ / LOGIC_ANALYZER_MIN_PERIOD)
+        return DEVICE_INVALID_PARAMETER;
+
+    stop();
+
+    period = LOGIC_ANALYZER_CLOCK_HZ / sampleRate;
+    tick = 0;
+    headerSent = false;
+    gap = 0;
+
+    // Values no sample can have, so the first is always recorded.
+    last[0] = ~mask[0];
+    last[1] = ~mask[1];
+
+    cycle_counter_enable();
+    resetStatistics();
+
+    instance = this;
+    running = true;
+
+    timer.setClockSpeed(LOGIC_ANALYZER_CLOCK_HZ / 1000);
+    timer.setBitMode(BitMode32);
+    timer.setIRQ(onTimer);
+    timer.enable();
+
+    deadline = timer.captureCounter() + period;
+    timer.setCompare(0, deadline);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops sampling. Transitions recorded and not yet streamed are kept.
+ */
+void LogicAnalyzer::stop()
+{
+    if (!running)
+        return;
+
+    timer.disable();
+    running = false;
+}
+
+/**
+ * Determines if the analyzer is sampling.
+ */
+bool LogicAnalyzer::isRunning()
+{
+    return running;
+}
+
+/**
+ * Determines the sample rate actually in use, which is the clock divided by a whole number.
+ */
+int LogicAnalyzer::getSampleRate()
+{
+    return LOGIC_ANALYZER_CLOCK_HZ / period;
+}
+
+/**
+ * Writes a 32 bit value to the given buffer, little endian.
+ */
+static uint8_t *logic_analyzer_put(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+
+    return p + 4;
+}
+
+/**
+ * Sends the transitions recorded so far to the serial port, preceded by the header if this is the first call
+ * since start(). Blocks the calling fiber while the data is sent.
+ * @return the number of transitions sent.
+ */
+int LogicAnalyzer::stream()
+{
+    uint8_t out[LOGIC_ANALYZER_STREAM_BATCH * 8];
+    int sent = 0;
+
+    if (!headerSent)
+    {
+        uint8_t *p = logic_analyzer_put(out, LOGIC_ANALYZER_MAGIC);
+
+        *p++ = LOGIC_ANALYZER_VERSION;
+        *p++ = pins.size();
+        *p++ = 0;
+        *p++ = 0;
+        p = logic_analyzer_put(p, getSampleRate());
+
+        for (int i = 0; i < pins.size(); i++)
+            *p++ = labels ? labels[i] : i;
+
+        uBit.serial.send(out, p - out);
+        headerSent = true;
+    }
+
+    while (tail != head)
+    {
+        uint8_t *p = out;
+
+        // Decode from port bits to pin order here, rather than in the sample interrupt.
+        while (tail != head && p < out + sizeof(out))
+        {
+            LogicAnalyzerRecord &r = buffer[tail];
+
+            p = logic_analyzer_put(p, r.tick);
+            p = logic_analyzer_put(p, r.tick == LOGIC_ANALYZER_OVERFLOW ? r.in[0] : pins.decode(r.in));
+
+            tail = (tail + 1) & (bufferSize - 1);
+            sent++;
+        }
+
+        uBit.serial.send(out, p - out);
+    }
+
+    return sent;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void LogicAnalyzer::resetStatistics()
+{
+    target_disable_irq();
+    transitions = 0;
+    missed = 0;
+    dropped = 0;
+    sampleCycles = 0;
+    startTick = tick;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void LogicAnalyzer::printStatistics()
+{
+    uint32_t samples = tick - startTick;
+
+    DMESG("LOGIC_ANALYZER: [RATE: %d Hz] [PINS: %d]", getSampleRate(), pins.size());
+    DMESG("   SAMPLES: %d", samples);
+    DMESG("   TRANSITIONS: %d", transitions);
+    DMESG("   MISSED: %d samples", missed);
+    DMESG("   DROPPED: %d samples", dropped);
+    DMESG("   CYCLES/SAMPLE: %d", samples > missed ? sampleCycles / (samples - missed) : 0);
+}
+
+/**
+ * Determines the number of samples missed because the sample interrupt was late, since the statistics were last
+ * reset. Any at all means the sample rate can't be sustained.
+ */
+uint32_t LogicAnalyzer::getMissedSamples()
+{
+    return missed;
+}
+
+/**
+ * Determines the number of samples that could not be recorded because the buffer was full, since the statistics
+ * were last reset. Any at all means the transitions came faster than they could be streamed.
+ */
+uint32_t LogicAnalyzer::getDroppedSamples()
+{
+    return dropped;
+}
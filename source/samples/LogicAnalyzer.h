@@ -0,0 +1,173 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "PinGroup.h"
+
+#ifndef LOGIC_ANALYZER_H
+#define LOGIC_ANALYZER_H
+
+// The sample clock runs at 16MHz, so sample rates are 16MHz divided by a whole number.
+#define LOGIC_ANALYZER_CLOCK_HZ                 16000000
+#define LOGIC_ANALYZER_MIN_PERIOD               16
+#define LOGIC_ANALYZER_DEFAULT_BUFFER_SIZE      512
+
+// The stream starts with a header: the magic, a version, the number of pins, the sample rate (Hz), then a label for
+// each pin. Then comes a record for each transition: the sample number, and a bit for each pin. A record with a sample
+// number of LOGIC_ANALYZER_OVERFLOW marks a gap, and holds the number of samples that could not be recorded.
+// Everything is little endian. utils/host/logic_vcd converts a captured stream to a VCD file.
+#define LOGIC_ANALYZER_MAGIC                    0x41474F4C
+#define LOGIC_ANALYZER_VERSION                  1
+#define LOGIC_ANALYZER_OVERFLOW                 0xFFFFFFFF
+#define LOGIC_ANALYZER_STREAM_BATCH             32
+
+/**
+ * A transition, as recorded in interrupt context: the sample number and the raw input of each port.
+ */
+struct LogicAnalyzerRecord
+{
+    uint32_t    tick;
+    uint32_t    in[PIN_GROUP_PORTS];
+};
+
+/**
+ * A logic analyzer, that samples a group of pins at a fixed rate and streams their transitions over serial.
+ *
+ * The sample clock is the compare interrupt of a dedicated TIMER. Each sample is a single read of the IN register of
+ * each port in use, masked to the pins being watched and compared with the last sample. Only samples that differ are
+ * recorded, with their sample number, into a ring buffer shared with the fiber that streams them out: the gap between
+ * two records is the length of the run between transitions, so a quiet bus costs nothing but the read and compare.
+ * Decoding from port bits to pin order is left to the streaming fiber.
+ *
+ * Interrupts are scheduled against the sample clock rather than from one another, so the rate doesn't drift. If an
+ * interrupt is late enough to miss a sample, the missed samples are counted, and the sample rate can't be sustained.
+ * If the ring buffer fills, because the transitions come faster than the serial port can carry them, the samples that
+ * could not be recorded are counted and a gap is marked in the stream.
+ */
+class LogicAnalyzer
+{
+    PinGroup                pins;
+    NRFLowLevelTimer        timer;
+    const uint8_t           *labels;
+
+    LogicAnalyzerRecord     *buffer;
+    int                     bufferSize;
+    volatile int            head;               // The next record to be written, by the sample interrupt.
+    volatile int            tail;               // The next record to be streamed.
+
+    uint32_t                mask[PIN_GROUP_PORTS];
+    uint32_t                last[PIN_GROUP_PORTS];
+    uint32_t                period;             // The sample period, in clock ticks.
+    uint32_t                deadline;           // The clock tick of the next sample.
+    uint32_t                tick;               // The sample number.
+    bool                    running;
+    bool                    headerSent;
+
+    // Statistics.
+    volatile uint32_t       transitions;
+    volatile uint32_t       missed;
+    volatile uint32_t       dropped;
+    uint32_t                gap;                // Samples not yet recorded since the buffer filled.
+    uint32_t                sampleCycles;
+    uint32_t                startTick;
+
+    static LogicAnalyzer    *instance;
+
+    /**
+     * Timer interrupt handler, which takes a sample.
+     */
+    static void onTimer(uint16_t channels);
+
+    /**
+     * Takes a sample, and records it if it differs from the last.
+     */
+    void sample();
+
+    public:
+    /**
+     * Creates a logic analyzer.
+     * @param pins the pins to watch. These are made digital inputs, pulled down so that unconnected pins stay quiet.
+     * @param labels a number for each pin to be named by in the stream (such as its edge connector number), or NULL
+     * to use the pin's position in the array.
+     * @param count the number of pins, up to 32.
+     * @param timer the timer to use as the sample clock, which must not be shared.
+     * @param irqn the interrupt of the given timer.
+     * @param bufferSize the number of transitions that can be held waiting to be streamed, as a power of two.
+     */
+    LogicAnalyzer(NRF52Pin *const *pins, const uint8_t *labels, int count, NRF_TIMER_Type *timer = NRF_TIMER3, IRQn_Type irqn = TIMER3_IRQn, int bufferSize = LOGIC_ANALYZER_DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Starts sampling. The first sample is always recorded, to give the starting state of every pin.
+     * @param sampleRate the sample rate, in Hz.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the rate is out of range.
+     */
+    int start(int sampleRate);
+
+    /**
+     * Stops sampling. Transitions recorded and not yet streamed are kept.
+     */
+    void stop();
+
+    /**
+     * Determines if the analyzer is sampling.
+     */
+    bool isRunning();
+
+    /**
+     * Determines the sample rate actually in use, which is the clock divided by a whole number.
+     */
+    int getSampleRate();
+
+    /**
+     * Sends the transitions recorded so far to the serial port, preceded by the header if this is the first call
+     * since start(). Blocks the calling fiber while the data is sent.
+     * @return the number of transitions sent.
+     */
+    int stream();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+
+    /**
+     * Determines the number of samples missed because the sample interrupt was late, since the statistics were last
+     * reset. Any at all means the sample rate can't be sustained.
+     */
+    uint32_t getMissedSamples();
+
+    /**
+     * Determines the number of samples that could not be recorded because the buffer was full, since the statistics
+     * were last reset. Any at all means the transitions came faster than they could be streamed.
+     */
+    uint32_t getDroppedSamples();
+};
+
+#endif
@@ -0,0 +1,297 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MatrixLightSensor.h"
+#include "Tests.h"
+
+/**
+ * Creates a light sensor for the LED matrix.
+ * @param timer the timer to use. This must have six compare registers (TIMER3 or TIMER4), and must not be shared.
+ * @param gpioteChannel the first of five consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of five consecutive PPI channels to use.
+ * @param id the ID to use for events raised by this component.
+ */
+MatrixLightSensor::MatrixLightSensor(NRF_TIMER_Type *timer, int gpioteChannel, int ppiChannel, uint16_t id)
+{
+    this->downstream = NULL;
+    this->timer = timer;
+    this->id = id;
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->periodMs = MATRIX_LIGHT_SENSOR_DEFAULT_PERIOD_MS;
+    this->timeoutUs = MATRIX_LIGHT_SENSOR_DEFAULT_TIMEOUT_US;
+    this->running = false;
+    this->measuring = false;
+
+    for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+        decay[r] = timeoutUs;
+
+    resetStatistics();
+
+    uBit.messageBus.listen(id, MATRIX_LIGHT_SENSOR_EVT_SAMPLE, this, &MatrixLightSensor::onSample, MESSAGE_BUS_LISTENER_IMMEDIATE);
+}
+
+/**
+ * Timer event handler, which collects the sample being taken and starts the next one.
+ */
+void MatrixLightSensor::onSample(MicroBitEvent)
+{
+    if (!running)
+        return;
+
+    if (measuring)
+    {
+        timer->TASKS_STOP = 1;
+
+        // Hand the rows back to GPIO, which holds them low until the next sample is started.
+        for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+        {
+            NRF_GPIOTE->CONFIG[gpioteChannel + r] = 0;
+
+            decay[r] = min((int)timer->CC[r], timeoutUs);
+            if (decay[r] == timeoutUs)
+                timeouts++;
+        }
+
+        samples++;
+
+        if (downstream)
+            downstream->pullRequest();
+
+        Event(id, MATRIX_LIGHT_SENSOR_EVT_DATA_READY);
+    }
+
+    // A row that never rises keeps its capture register at the timeout.
+    timer->TASKS_CLEAR = 1;
+    timer->CC[5] = timeoutUs;
+    for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+        timer->CC[r] = timeoutUs;
+
+    timer->TASKS_START = 1;
+
+    // Handing a row to GPIOTE as an input releases it, so this is when the time starts for each row.
+    for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+        NRF_GPIOTE->CONFIG[gpioteChannel + r] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                                (uBit.ledRowPins[r]->name << GPIOTE_CONFIG_PSEL_Pos) |
+                                                (GPIOTE_CONFIG_POLARITY_LoToHi << GPIOTE_CONFIG_POLARITY_Pos);
+
+    measuring = true;
+}
+
+/**
+ * Takes control of the matrix pins and begins sampling. The display must be disabled first.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int MatrixLightSensor::start()
+{
+    if (running)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + MATRIX_LIGHT_SENSOR_ROWS > 8 || ppiChannel < 0 || ppiChannel + MATRIX_LIGHT_SENSOR_ROWS > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    timer->TASKS_STOP = 1;
+    timer->TASKS_CLEAR = 1;
+    timer->MODE = TIMER_MODE_MODE_Timer;
+    timer->BITMODE = TIMER_BITMODE_BITMODE_16Bit;
+    timer->PRESCALER = 4;
+    timer->SHORTS = TIMER_SHORTS_COMPARE5_STOP_Msk;
+    timer->INTENCLR = 0xFFFFFFFF;
+
+    // Reverse bias every LED: columns high, rows low.
+    for (int c = 0; c < MATRIX_LIGHT_SENSOR_ROWS; c++)
+        uBit.ledColPins[c]->setDigitalValue(1);
+
+    for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+    {
+        int p = ppiChannel + r;
+
+        uBit.ledRowPins[r]->setDigitalValue(0);
+
+        NRF_PPI->CH[p].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[gpioteChannel + r];
+        NRF_PPI->CH[p].TEP = (uint32_t) &timer->TASKS_CAPTURE[r];
+        NRF_PPI->CHENSET = 1 << p;
+    }
+
+    running = true;
+    measuring = false;
+
+    // Start the first sample straight away, to be collected by the first timer event.
+    onSample(MicroBitEvent(id, MATRIX_LIGHT_SENSOR_EVT_SAMPLE, CREATE_ONLY));
+    system_timer_event_every_us(periodMs * 1000, id, MATRIX_LIGHT_SENSOR_EVT_SAMPLE);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops sampling and releases the matrix pins.
+ */
+void MatrixLightSensor::stop()
+{
+    if (!running)
+        return;
+
+    system_timer_cancel_event(id, MATRIX_LIGHT_SENSOR_EVT_SAMPLE);
+
+    running = false;
+    measuring = false;
+    timer->TASKS_STOP = 1;
+
+    for (int r = 0; r < MATRIX_LIGHT_SENSOR_ROWS; r++)
+    {
+        NRF_PPI->CHENCLR = 1 << (ppiChannel + r);
+        NRF_GPIOTE->CONFIG[gpioteChannel + r] = 0;
+    }
+}
+
+/**
+ * Determines if the sensor is sampling.
+ */
+bool MatrixLightSensor::isRunning()
+{
+    return running;
+}
+
+/**
+ * Defines how often the rows are sampled, and how long each row is given to rise.
+ * The timeout must be shorter than the period.
+ * @param periodMs the time between samples, in milliseconds.
+ * @param timeoutUs the longest time measured, in microseconds (at most 65535).
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int MatrixLightSensor::setPeriod(int periodMs, int timeoutUs)
+{
+    if (timeoutUs <= 0 || timeoutUs > 0xFFFF || timeoutUs >= periodMs * 1000)
+        return DEVICE_INVALID_PARAMETER;
+
+    bool wasRunning = running;
+
+    stop();
+    this->periodMs = periodMs;
+    this->timeoutUs = timeoutUs;
+
+    if (wasRunning)
+        start();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the time the given row took to rise in the last sample.
+ * @param row the row, in the range 0..4.
+ * @return the time in microseconds (equal to the timeout if the row did not rise), or DEVICE_INVALID_PARAMETER.
+ */
+int MatrixLightSensor::read(int row)
+{
+    if (row < 0 || row >= MATRIX_LIGHT_SENSOR_ROWS)
+        return DEVICE_INVALID_PARAMETER;
+
+    return decay[row];
+}
+
+/**
+ * Provide the last sample taken to our downstream caller.
+ */
+ManagedBuffer MatrixLightSensor::pull()
+{
+    ManagedBuffer buffer(MATRIX_LIGHT_SENSOR_ROWS * sizeof(uint16_t));
+
+    target_disable_irq();
+    memcpy(&buffer[0], decay, sizeof(decay));
+    target_enable_irq();
+
+    return buffer;
+}
+
+/**
+ * Define a downstream component for data stream.
+ * @sink The component that data will be delivered to, when it is available
+ */
+void MatrixLightSensor::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+/**
+ * Determines if this source is connected to a downstream component.
+ */
+bool MatrixLightSensor::isConnected()
+{
+    return downstream != NULL;
+}
+
+/**
+ * Disconnect any downstream component.
+ */
+void MatrixLightSensor::disconnect()
+{
+    downstream = NULL;
+}
+
+/**
+ * Determine the data format of the buffers streamed out of this component.
+ */
+int MatrixLightSensor::getFormat()
+{
+    return DATASTREAM_FORMAT_16BIT_UNSIGNED;
+}
+
+/**
+ * Defines the data format of the buffers streamed out of this component.
+ * @param format DATASTREAM_FORMAT_16BIT_UNSIGNED.
+ * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+ */
+int MatrixLightSensor::setFormat(int format)
+{
+    return format == DATASTREAM_FORMAT_16BIT_UNSIGNED ? DEVICE_OK : DEVICE_NOT_SUPPORTED;
+}
+
+/**
+ * Determine the rate at which samples are streamed out of this component.
+ */
+float MatrixLightSensor::getSampleRate()
+{
+    return 1000.0f / periodMs;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void MatrixLightSensor::resetStatistics()
+{
+    samples = 0;
+    timeouts = 0;
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void MatrixLightSensor::printStatistics()
+{
+    DMESG("MATRIX_LIGHT_SENSOR: [PERIOD: %d ms] [TIMEOUT: %d us]", periodMs, timeoutUs);
+    DMESG("   SAMPLES: %d", samples);
+    DMESG("   TIMEOUTS: %d rows", timeouts);
+    DMESG("   DECAY: %d %d %d %d %d us", decay[0], decay[1], decay[2], decay[3], decay[4]);
+}
@@ -0,0 +1,176 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef MATRIX_LIGHT_SENSOR_H
+#define MATRIX_LIGHT_SENSOR_H
+
+#define MATRIX_LIGHT_SENSOR_ID                  3105
+
+#define MATRIX_LIGHT_SENSOR_EVT_SAMPLE          1
+#define MATRIX_LIGHT_SENSOR_EVT_DATA_READY      2
+
+#define MATRIX_LIGHT_SENSOR_ROWS                5
+
+// Sample every 50ms, giving each row up to 40ms to recover before it is recorded as being in the dark.
+#define MATRIX_LIGHT_SENSOR_DEFAULT_PERIOD_MS   50
+#define MATRIX_LIGHT_SENSOR_DEFAULT_TIMEOUT_US  40000
+
+// Default peripheral resources. One GPIOTE channel and one PPI channel per row. The PPI channels follow those used by
+// GreyscaleMatrix, though the two can't be used at the same time as both drive the matrix pins.
+#define MATRIX_LIGHT_SENSOR_DEFAULT_GPIOTE      0
+#define MATRIX_LIGHT_SENSOR_DEFAULT_PPI         10
+
+/**
+ * A DataSource that measures the ambient light falling on each row of the LED matrix, using the LEDs as photodiodes.
+ *
+ * The columns are held high and the rows low, reverse biasing every LED. To take a sample the rows are released and
+ * left floating, and the light falling on the LEDs brings each row up to a logic 1: the brighter the light, the sooner
+ * that happens. Rather than polling a pin, each row is watched by a GPIOTE channel, and PPI routes its rising edge to
+ * a capture task on a free running 1MHz TIMER, so all five rows are timed at once, to the microsecond, without the CPU.
+ * A compare on the last timer channel stops the timer at the timeout, leaving any row that hasn't risen at the timeout.
+ *
+ * Sampling is driven by the system timer. Each period the captured times are collected and the rows pulled low again,
+ * ready for the next sample, which starts straight away. The buffers streamed out hold one 16 bit unsigned sample per
+ * row, being the time taken for that row to rise in microseconds (so larger values mean less light).
+ *
+ * The display must be disabled while sampling, as the sensor takes control of the matrix pins.
+ */
+class MatrixLightSensor : public DataSource
+{
+    DataSink        *downstream;
+    NRF_TIMER_Type  *timer;
+    uint16_t        id;
+    int             gpioteChannel;
+    int             ppiChannel;
+    int             periodMs;
+    int             timeoutUs;
+    uint16_t        decay[MATRIX_LIGHT_SENSOR_ROWS];
+    bool            running;
+    bool            measuring;
+
+    uint32_t        samples;
+    uint32_t        timeouts;
+
+    /**
+     * Timer event handler, which collects the sample being taken and starts the next one.
+     */
+    void onSample(MicroBitEvent);
+
+    public:
+    /**
+     * Creates a light sensor for the LED matrix.
+     * @param timer the timer to use. This must have six compare registers (TIMER3 or TIMER4), and must not be shared.
+     * @param gpioteChannel the first of five consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of five consecutive PPI channels to use.
+     * @param id the ID to use for events raised by this component.
+     */
+    MatrixLightSensor(NRF_TIMER_Type *timer = NRF_TIMER3, int gpioteChannel = MATRIX_LIGHT_SENSOR_DEFAULT_GPIOTE, int ppiChannel = MATRIX_LIGHT_SENSOR_DEFAULT_PPI, uint16_t id = MATRIX_LIGHT_SENSOR_ID);
+
+    /**
+     * Takes control of the matrix pins and begins sampling. The display must be disabled first.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int start();
+
+    /**
+     * Stops sampling and releases the matrix pins.
+     */
+    void stop();
+
+    /**
+     * Determines if the sensor is sampling.
+     */
+    bool isRunning();
+
+    /**
+     * Defines how often the rows are sampled, and how long each row is given to rise.
+     * The timeout must be shorter than the period.
+     * @param periodMs the time between samples, in milliseconds.
+     * @param timeoutUs the longest time measured, in microseconds (at most 65535).
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setPeriod(int periodMs, int timeoutUs = MATRIX_LIGHT_SENSOR_DEFAULT_TIMEOUT_US);
+
+    /**
+     * Determines the time the given row took to rise in the last sample.
+     * @param row the row, in the range 0..4.
+     * @return the time in microseconds (equal to the timeout if the row did not rise), or DEVICE_INVALID_PARAMETER.
+     */
+    int read(int row);
+
+    /**
+     * Provide the last sample taken to our downstream caller.
+     */
+    virtual ManagedBuffer pull();
+
+    /**
+     * Define a downstream component for data stream.
+     * @sink The component that data will be delivered to, when it is available
+     */
+    virtual void connect(DataSink &sink);
+
+    /**
+     * Determines if this source is connected to a downstream component.
+     */
+    virtual bool isConnected();
+
+    /**
+     * Disconnect any downstream component.
+     */
+    virtual void disconnect();
+
+    /**
+     * Determine the data format of the buffers streamed out of this component.
+     */
+    virtual int getFormat();
+
+    /**
+     * Defines the data format of the buffers streamed out of this component.
+     * @param format DATASTREAM_FORMAT_16BIT_UNSIGNED.
+     * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+     */
+    virtual int setFormat(int format);
+
+    /**
+     * Determine the rate at which samples are streamed out of this component.
+     */
+    virtual float getSampleRate();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
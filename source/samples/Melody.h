@@ -0,0 +1,232 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stdint.h>
+
+#ifndef MELODY_H
+#define MELODY_H
+
+/**
+ * A compile time compiler for MakeCode style melody strings.
+ *
+ * Melodies are written as a string of space separated notes in the format NOTE[#|b][octave][:duration], for example
+ * "G4:1 C5 E G:2 E:1 G:3". The octave and duration are optional, and carry over from the previous note when omitted.
+ * 'R' is a rest. Durations are in ticks of a quarter of a beat, as in MakeCode.
+ *
+ *     static constexpr auto POWER_UP = MELODY("G4:1 C5 E G:2 E:1 G:3");
+ *
+ * The MELODY macro parses and validates the string as the program is compiled (a malformed melody fails the build with
+ * an error referencing melody_syntax_error), producing a Melody: a table of note periods and durations that lives in
+ * flash. Periods come from an integer table scaled by octave, so no parsing or floating point is left at runtime.
+ *
+ * The constexpr evaluation is recursive, so each melody is limited to around 150 notes by the compiler's default
+ * constexpr depth.
+ */
+
+#define MELODY_DEFAULT_OCTAVE           4
+#define MELODY_DEFAULT_DURATION         4
+
+struct MelodyNote
+{
+    uint16_t    periodUs;               // The period of the note in microseconds, or zero for a rest.
+    uint16_t    ticks;                  // The duration of the note, in quarter beats.
+};
+
+template <int N>
+struct Melody
+{
+    static_assert(N > 0, "A melody must contain at least one note");
+
+    MelodyNote  notes[N];
+
+    constexpr int length() const { return N; }
+};
+
+// Period of each note in octave 0 (C0 to B0), in sixteenths of a microsecond.
+static constexpr uint32_t MELODY_PERIODS_OCTAVE_0[12] = {
+    978498, 923579, 871742, 822815, 776634, 733045, 691902, 653069, 616415, 581818, 549163, 518341
+};
+
+// Frequency of each note in octave 8 (C8 to B8), in quarters of a Hz.
+static constexpr uint32_t MELODY_FREQUENCIES_OCTAVE_8[12] = {
+    16744, 17740, 18795, 19912, 21096, 22351, 23680, 25088, 26580, 28160, 29834, 31609
+};
+
+/**
+ * Deliberately not constexpr, so that reaching this during compilation of a melody fails the build.
+ */
+void melody_syntax_error();
+
+/**
+ * Determine the period of a note, in microseconds.
+ * @param semitone the number of semitones the note lies above C0 (e.g. A4 is 57).
+ */
+constexpr uint16_t melody_period_us(int semitone)
+{
+    return semitone < 0 ? 0 : (uint16_t)((MELODY_PERIODS_OCTAVE_0[semitone % 12] + (1u << (semitone / 12 + 3))) >> (semitone / 12 + 4));
+}
+
+/**
+ * Determine the frequency of a note, rounded to the nearest Hz.
+ * @param semitone the number of semitones the note lies above C0 (e.g. A4 is 57).
+ */
+constexpr uint32_t melody_frequency(int semitone)
+{
+    return semitone < 0 ? 0 :
+        semitone / 12 > 8 ? (MELODY_FREQUENCIES_OCTAVE_8[semitone % 12] << (semitone / 12 - 8)) >> 2 :
+        (MELODY_FREQUENCIES_OCTAVE_8[semitone % 12] + (1u << (9 - semitone / 12))) >> (10 - semitone / 12);
+}
+
+constexpr bool melody_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool melody_is_end(char c)
+{
+    return c == ' ' || c == '\0';
+}
+
+constexpr const char *melody_skip_spaces(const char *s)
+{
+    return *s == ' ' ? melody_skip_spaces(s + 1) : s;
+}
+
+constexpr const char *melody_skip_token(const char *s)
+{
+    return melody_is_end(*s) ? s : melody_skip_token(s + 1);
+}
+
+constexpr const char *melody_skip_digits(const char *s)
+{
+    return melody_is_digit(*s) ? melody_skip_digits(s + 1) : s;
+}
+
+constexpr const char *melody_skip_accidentals(const char *s)
+{
+    return (*s == '#' || *s == 'b') ? melody_skip_accidentals(s + 1) : s;
+}
+
+constexpr int melody_number(const char *s, int value)
+{
+    return melody_is_digit(*s) ? melody_number(s + 1, value * 10 + (*s - '0')) : value;
+}
+
+/**
+ * Determine the number of notes in a melody string.
+ */
+constexpr int melody_count(const char *s)
+{
+    return *melody_skip_spaces(s) == '\0' ? 0 : 1 + melody_count(melody_skip_token(melody_skip_spaces(s)));
+}
+
+/**
+ * Find the start of the i'th note in a melody string.
+ */
+constexpr const char *melody_token(const char *s, int i)
+{
+    return i == 0 ? melody_skip_spaces(s) : melody_token(melody_skip_token(melody_skip_spaces(s)), i - 1);
+}
+
+/**
+ * Determine the position of a note letter within its octave, in semitones above C. Rests are -1.
+ */
+constexpr int melody_letter(char c)
+{
+    return c == 'C' ? 0 : c == 'D' ? 2 : c == 'E' ? 4 : c == 'F' ? 5 : c == 'G' ? 7 : c == 'A' ? 9 : c == 'B' ? 11 :
+        c == 'R' ? -1 : (melody_syntax_error(), 0);
+}
+
+constexpr int melody_accidentals(const char *s)
+{
+    return *s == '#' ? 1 + melody_accidentals(s + 1) : *s == 'b' ? -1 + melody_accidentals(s + 1) : 0;
+}
+
+// The fields of a note token, which start at its octave and its ':' duration marker respectively.
+constexpr const char *melody_octave_field(const char *t)
+{
+    return melody_skip_accidentals(t + 1);
+}
+
+constexpr const char *melody_duration_field(const char *t)
+{
+    return melody_skip_digits(melody_octave_field(t));
+}
+
+constexpr bool melody_duration_valid(const char *d)
+{
+    return melody_is_end(*d) || (*d == ':' && melody_is_digit(d[1]) && melody_is_end(*melody_skip_digits(d + 1)));
+}
+
+/**
+ * Checks that a note token is well formed, failing the build if not.
+ */
+constexpr const char *melody_check(const char *t)
+{
+    return (melody_letter(*t) >= -1 && melody_duration_valid(melody_duration_field(t))) ? t : (melody_syntax_error(), t);
+}
+
+/**
+ * Determine the octave of the i'th note, carried over from previous notes if it isn't given.
+ */
+constexpr int melody_octave(const char *s, int i)
+{
+    return melody_is_digit(*melody_octave_field(melody_token(s, i))) ? melody_number(melody_octave_field(melody_token(s, i)), 0) :
+        i == 0 ? MELODY_DEFAULT_OCTAVE : melody_octave(s, i - 1);
+}
+
+/**
+ * Determine the duration of the i'th note, carried over from previous notes if it isn't given.
+ */
+constexpr int melody_duration(const char *s, int i)
+{
+    return *melody_duration_field(melody_token(s, i)) == ':' ? melody_number(melody_duration_field(melody_token(s, i)) + 1, 0) :
+        i == 0 ? MELODY_DEFAULT_DURATION : melody_duration(s, i - 1);
+}
+
+constexpr MelodyNote melody_note(const char *s, int i, const char *t)
+{
+    return MelodyNote{
+        melody_letter(*t) < 0 ? (uint16_t)0 : melody_period_us(melody_octave(s, i) * 12 + melody_letter(*t) + melody_accidentals(t + 1)),
+        (uint16_t)melody_duration(s, i)
+    };
+}
+
+template <int... I> struct MelodyIndices {};
+template <int N, int... I> struct MelodyIndexBuilder : MelodyIndexBuilder<N - 1, N - 1, I...> {};
+template <int... I> struct MelodyIndexBuilder<0, I...> { typedef MelodyIndices<I...> type; };
+
+template <int... I>
+constexpr Melody<sizeof...(I)> melody_compile(const char *s, MelodyIndices<I...>)
+{
+    return Melody<sizeof...(I)>{{ melody_note(s, I, melody_check(melody_token(s, I)))... }};
+}
+
+/**
+ * Compiles a melody string literal into a Melody. Assign the result to a constexpr variable, so that it is
+ * guaranteed to be evaluated at compile time.
+ */
+#define MELODY(notes) melody_compile(notes, MelodyIndexBuilder<melody_count(notes)>::type())
+
+#endif
@@ -0,0 +1,180 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MelodyPlayer.h"
+#include "Tests.h"
+
+/**
+ * Creates a melody player.
+ * @param pin the pin to play melodies on.
+ * @param id the ID to use for events raised by this component.
+ */
+MelodyPlayer::MelodyPlayer(Pin &pin, uint16_t id) : pin(pin)
+{
+    this->id = id;
+    this->notes = NULL;
+    this->length = 0;
+    this->position = 0;
+    this->gapMs = MELODY_PLAYER_DEFAULT_GAP_MS;
+    this->volume = MELODY_PLAYER_DEFAULT_VOLUME;
+    this->noteOn = false;
+    this->playing = false;
+
+    setTempo(MELODY_PLAYER_DEFAULT_TEMPO_BPM);
+
+    uBit.messageBus.listen(id, MELODY_PLAYER_EVT_STEP, this, &MelodyPlayer::onStep, MESSAGE_BUS_LISTENER_IMMEDIATE);
+}
+
+/**
+ * Timer event handler, which moves the melody on by one step.
+ */
+void MelodyPlayer::onStep(MicroBitEvent)
+{
+    if (!playing)
+        return;
+
+    // End of a note. Silence the pin for the gap between notes, unless there isn't one.
+    if (noteOn)
+    {
+        noteOn = false;
+        pin.setAnalogValue(0);
+
+        if (gapMs)
+        {
+            system_timer_event_after(gapMs, id, MELODY_PLAYER_EVT_STEP);
+            return;
+        }
+    }
+
+    if (position >= length)
+    {
+        playing = false;
+        Event(id, MELODY_PLAYER_EVT_COMPLETE);
+        return;
+    }
+
+    const MelodyNote &note = notes[position++];
+
+    if (note.periodUs)
+    {
+        pin.setAnalogPeriodUs(note.periodUs);
+        pin.setAnalogValue(volume);
+    }
+
+    noteOn = true;
+    system_timer_event_after(note.ticks * msPerTick, id, MELODY_PLAYER_EVT_STEP);
+}
+
+/**
+ * Begins playback of the given melody table, and returns immediately. Any melody already being played is stopped.
+ * @param notes the notes to play. These must remain valid until playback completes.
+ * @param length the number of notes to play.
+ */
+void MelodyPlayer::playAsync(const MelodyNote *notes, int length)
+{
+    stop();
+
+    this->notes = notes;
+    this->length = length;
+    this->position = 0;
+    this->noteOn = false;
+    this->playing = true;
+
+    onStep(MicroBitEvent(id, MELODY_PLAYER_EVT_STEP, CREATE_ONLY));
+}
+
+/**
+ * Plays the given melody table, blocking the calling fiber until playback is complete.
+ * @param notes the notes to play.
+ * @param length the number of notes to play.
+ */
+void MelodyPlayer::play(const MelodyNote *notes, int length)
+{
+    playAsync(notes, length);
+
+    if (playing)
+        fiber_wait_for_event(id, MELODY_PLAYER_EVT_COMPLETE);
+}
+
+/**
+ * Stops any melody currently being played.
+ */
+void MelodyPlayer::stop()
+{
+    if (!playing)
+        return;
+
+    playing = false;
+    system_timer_cancel_event(id, MELODY_PLAYER_EVT_STEP);
+    pin.setAnalogValue(0);
+
+    Event(id, MELODY_PLAYER_EVT_COMPLETE);
+}
+
+/**
+ * Determines if a melody is currently being played.
+ */
+bool MelodyPlayer::isPlaying()
+{
+    return playing;
+}
+
+/**
+ * Defines the tempo at which melodies are played.
+ * @param bpm the tempo, in beats per minute. Note durations are given in quarter beats.
+ */
+int MelodyPlayer::setTempo(int bpm)
+{
+    if (bpm <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    msPerTick = (60000 / bpm) / 4;
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the silence left between consecutive notes.
+ * @param ms the length of the gap in milliseconds.
+ */
+int MelodyPlayer::setGap(int ms)
+{
+    if (ms < 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    gapMs = ms;
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the analog value written to the pin while a note is sounding.
+ * @param volume the analog value, in the range 0..1023.
+ */
+int MelodyPlayer::setVolume(int volume)
+{
+    if (volume < 0 || volume > 1023)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->volume = volume;
+    return DEVICE_OK;
+}
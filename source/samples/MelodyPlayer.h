@@ -0,0 +1,133 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MicroBit.h"
+#include "Melody.h"
+
+#ifndef MELODY_PLAYER_H
+#define MELODY_PLAYER_H
+
+#define MELODY_PLAYER_ID                        3101
+
+#define MELODY_PLAYER_EVT_STEP                  1
+#define MELODY_PLAYER_EVT_COMPLETE              2
+
+#define MELODY_PLAYER_DEFAULT_TEMPO_BPM         120
+#define MELODY_PLAYER_DEFAULT_GAP_MS            10
+#define MELODY_PLAYER_DEFAULT_VOLUME            127
+
+/**
+ * Plays melodies compiled with the MELODY macro on a Pin (typically uBit.audio.virtualOutputPin).
+ *
+ * Playback is driven entirely by system timer events, handled in interrupt context: each step simply loads the next
+ * precomputed period into the pin and schedules the following step, so no fiber is blocked while a melody plays.
+ */
+class MelodyPlayer
+{
+    Pin                 &pin;
+    uint16_t            id;
+    const MelodyNote    *notes;
+    int                 length;
+    int                 position;
+    int                 msPerTick;
+    int                 gapMs;
+    int                 volume;
+    bool                noteOn;
+    volatile bool       playing;
+
+    /**
+     * Timer event handler, which moves the melody on by one step.
+     */
+    void onStep(MicroBitEvent);
+
+    public:
+    /**
+     * Creates a melody player.
+     * @param pin the pin to play melodies on.
+     * @param id the ID to use for events raised by this component.
+     */
+    MelodyPlayer(Pin &pin, uint16_t id = MELODY_PLAYER_ID);
+
+    /**
+     * Begins playback of the given melody table, and returns immediately. Any melody already being played is stopped.
+     * @param notes the notes to play. These must remain valid until playback completes.
+     * @param length the number of notes to play.
+     */
+    void playAsync(const MelodyNote *notes, int length);
+
+    /**
+     * Plays the given melody table, blocking the calling fiber until playback is complete.
+     * @param notes the notes to play.
+     * @param length the number of notes to play.
+     */
+    void play(const MelodyNote *notes, int length);
+
+    /**
+     * Begins playback of a compiled melody, and returns immediately.
+     */
+    template <int N>
+    void playAsync(const Melody<N> &melody)
+    {
+        playAsync(melody.notes, N);
+    }
+
+    /**
+     * Plays a compiled melody, blocking the calling fiber until playback is complete.
+     */
+    template <int N>
+    void play(const Melody<N> &melody)
+    {
+        play(melody.notes, N);
+    }
+
+    /**
+     * Stops any melody currently being played.
+     */
+    void stop();
+
+    /**
+     * Determines if a melody is currently being played.
+     */
+    bool isPlaying();
+
+    /**
+     * Defines the tempo at which melodies are played.
+     * @param bpm the tempo, in beats per minute. Note durations are given in quarter beats.
+     */
+    int setTempo(int bpm);
+
+    /**
+     * Defines the silence left between consecutive notes.
+     * @param ms the length of the gap in milliseconds.
+     */
+    int setGap(int ms);
+
+    /**
+     * Defines the analog value written to the pin while a note is sounding.
+     * @param volume the analog value, in the range 0..1023.
+     */
+    int setVolume(int volume);
+};
+
+#endif
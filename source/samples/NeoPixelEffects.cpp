@@ -0,0 +1,353 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "NeoPixelEffects.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+// The hues of the rainbow, in three sectors of 256.
+#define NEOPIXEL_EFFECTS_HUES                   768
+
+/**
+ * Creates an effects player.
+ * @param strip the strip to play effects on. Nothing else should send to it while an effect plays.
+ * @param id the ID to use for events raised by this component.
+ */
+NeoPixelEffects::NeoPixelEffects(NeoPixelStrip &strip, uint16_t id) : strip(strip)
+{
+    this->id = id;
+    this->size = strip.getLength() * strip.getBytesPerPixel();
+    this->frame[0] = new uint8_t[size];
+    this->frame[1] = new uint8_t[size];
+    this->active = 0;
+    this->playing = false;
+
+    this->effect = NEOPIXEL_EFFECT_CHASE;
+    this->red = 0;
+    this->green = 0;
+    this->blue = 0;
+    this->periodUs = 0;
+    this->phase = 0;
+    this->phaseStep = 0;
+    this->deadline = 0;
+    this->first = true;
+    this->last = -1;
+    this->random = 0x2545F491;
+
+    memset(frame[0], 0, size);
+    memset(frame[1], 0, size);
+
+    cycle_counter_enable();
+    resetStatistics();
+
+    uBit.messageBus.listen(id, NEOPIXEL_EFFECTS_EVT_FRAME, this, &NeoPixelEffects::onFrame, MESSAGE_BUS_LISTENER_IMMEDIATE);
+}
+
+/**
+ * Determines the pixel a phase corresponds to.
+ */
+int NeoPixelEffects::position(uint32_t phase)
+{
+    return ((uint64_t)phase * strip.getLength()) >> 32;
+}
+
+/**
+ * Renders the next frame into the back buffer, from the one on the strip.
+ * @param previous the phase of the last frame.
+ */
+void NeoPixelEffects::render(uint32_t previous)
+{
+    int length = strip.getLength();
+    int bpp = strip.getBytesPerPixel();
+    uint8_t *back = frame[!active];
+
+    if (first)
+        memset(back, 0, size);
+    else
+        memcpy(back, frame[active], size);
+
+    switch (effect)
+    {
+        case NEOPIXEL_EFFECT_CHASE:
+        {
+            int head = position(phase);
+
+            if (head == last)
+                break;
+
+            // Clear the tail where it was, then draw it where it is now.
+            if (last >= 0)
+                for (int k = 0; k < NEOPIXEL_EFFECTS_CHASE_TAIL; k++)
+                    memset(back + ((last - k + length) % length) * bpp, 0, bpp);
+
+            for (int k = NEOPIXEL_EFFECTS_CHASE_TAIL - 1; k >= 0; k--)
+            {
+                int level = 256 - k * 256 / NEOPIXEL_EFFECTS_CHASE_TAIL;
+                strip.writePixel(back + ((head - k + length) % length) * bpp, (red * level) >> 8, (green * level) >> 8, (blue * level) >> 8);
+            }
+
+            last = head;
+            break;
+        }
+
+        case NEOPIXEL_EFFECT_FADE:
+        {
+            // A triangle, up over the first half of the period and down over the second.
+            int level = phase >> 23;
+
+            if (level > 255)
+                level = 511 - level;
+
+            if (level == last)
+                break;
+
+            strip.writePixel(back, (red * level) >> 8, (green * level) >> 8, (blue * level) >> 8);
+
+            for (int i = 1; i < length; i++)
+                memcpy(back + i * bpp, back, bpp);
+
+            last = level;
+            break;
+        }
+
+        case NEOPIXEL_EFFECT_RAINBOW:
+        {
+            int offset = ((uint64_t)phase * NEOPIXEL_EFFECTS_HUES) >> 32;
+
+            if (offset == last)
+                break;
+
+            // One turn of the wheel along the strip, stepping the hue without a division per pixel.
+            int hue = offset;
+            int step = NEOPIXEL_EFFECTS_HUES / length;
+            int remainder = NEOPIXEL_EFFECTS_HUES % length;
+            int error = 0;
+            uint8_t *p = back;
+
+            for (int i = 0; i < length; i++)
+            {
+                int x = hue & 255;
+
+                switch (hue >> 8)
+                {
+                    case 0: strip.writePixel(p, 255 - x, x, 0); break;
+                    case 1: strip.writePixel(p, 0, 255 - x, x); break;
+                    default: strip.writePixel(p, x, 0, 255 - x); break;
+                }
+
+                p += bpp;
+                hue += step;
+                error += remainder;
+
+                if (error >= length)
+                {
+                    error -= length;
+                    hue++;
+                }
+
+                if (hue >= NEOPIXEL_EFFECTS_HUES)
+                    hue -= NEOPIXEL_EFFECTS_HUES;
+            }
+
+            last = offset;
+            break;
+        }
+
+        case NEOPIXEL_EFFECT_SPARKLE:
+        {
+            // Everything lit decays by an eighth a frame, reaching zero in about 40 frames.
+            for (int i = 0; i < size; i++)
+                if (back[i])
+                    back[i] -= (back[i] >> 3) + 1;
+
+            // A new sparkle for every pixel the phase has moved on by.
+            int sparkles = (position(phase) - position(previous) + length) % length;
+
+            while (sparkles--)
+            {
+                random ^= random << 13;
+                random ^= random >> 17;
+                random ^= random << 5;
+
+                strip.writePixel(back + (random % length) * bpp, red, green, blue);
+            }
+
+            break;
+        }
+    }
+
+    first = false;
+}
+
+/**
+ * Timer event handler, which renders the frame that is due and sends it if it has changed.
+ */
+void NeoPixelEffects::onFrame(MicroBitEvent)
+{
+    if (!playing)
+        return;
+
+    CODAL_TIMESTAMP now = system_timer_current_time_us();
+    uint32_t lateness = now > deadline ? now - deadline : 0;
+    uint32_t previous = phase;
+    int periods = 0;
+
+    if (lateness > latenessMax)
+        latenessMax = lateness;
+
+    // Every frame period that has passed moves the effect on, but only one frame is rendered for them all.
+    do
+    {
+        deadline += periodUs;
+        phase += phaseStep;
+        periods++;
+    } while (deadline <= now);
+
+    frames += periods;
+    dropped += periods - 1;
+
+    if (strip.isBusy())
+    {
+        dropped++;
+    }
+    else
+    {
+        uint32_t start = cycle_counter_read();
+
+        render(previous);
+
+        uint32_t cycles = cycle_counter_read() - start;
+        renderCycles += cycles;
+        if (cycles > renderCyclesMax)
+            renderCyclesMax = cycles;
+        renders++;
+
+        if (memcmp(frame[!active], frame[active], size) == 0)
+        {
+            unchanged++;
+        }
+        else if (strip.showAsync(frame[!active]) == DEVICE_OK)
+        {
+            active = !active;
+            sent++;
+        }
+        else
+        {
+            dropped++;
+        }
+    }
+
+    system_timer_event_after_us(deadline - now, id, NEOPIXEL_EFFECTS_EVT_FRAME);
+}
+
+/**
+ * Begins playing an effect until stopped, and returns immediately. Any effect already playing is replaced.
+ * @param effect one of the NEOPIXEL_EFFECT_ effects.
+ * @param red the colour of the effect. The rainbow ignores it.
+ * @param periodMs the time for one cycle of the effect: for the chase to go round the strip, the fade to go up
+ * and down, or the rainbow to turn once. A sparkle lights each pixel once a period on average.
+ * @param frameRate the number of frames a second, up to NEOPIXEL_EFFECTS_MAX_RATE.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int NeoPixelEffects::playAsync(int effect, uint8_t red, uint8_t green, uint8_t blue, int periodMs, int frameRate)
+{
+    if (effect < NEOPIXEL_EFFECT_CHASE || effect > NEOPIXEL_EFFECT_SPARKLE || strip.getLength() == 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    // A cycle must last at least two frames, so the phase step fits in 32 bits.
+    if (frameRate <= 0 || frameRate > NEOPIXEL_EFFECTS_MAX_RATE || periodMs <= 0 || (uint64_t)periodMs * frameRate < 2000)
+        return DEVICE_INVALID_PARAMETER;
+
+    stop();
+
+    this->effect = effect;
+    this->red = red;
+    this->green = green;
+    this->blue = blue;
+    this->periodUs = 1000000 / frameRate;
+    this->phaseStep = (uint32_t)(((uint64_t)1 << 32) * 1000 / ((uint64_t)periodMs * frameRate));
+    this->phase = 0;
+    this->first = true;
+    this->last = -1;
+    this->playing = true;
+
+    target_disable_irq();
+    deadline = system_timer_current_time_us();
+    system_timer_event_after_us(1, id, NEOPIXEL_EFFECTS_EVT_FRAME);
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops the effect playing, leaving the last frame on the strip.
+ */
+void NeoPixelEffects::stop()
+{
+    if (!playing)
+        return;
+
+    playing = false;
+    system_timer_cancel_event(id, NEOPIXEL_EFFECTS_EVT_FRAME);
+}
+
+/**
+ * Determines if an effect is playing.
+ */
+bool NeoPixelEffects::isPlaying()
+{
+    return playing;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void NeoPixelEffects::resetStatistics()
+{
+    target_disable_irq();
+    frames = 0;
+    sent = 0;
+    unchanged = 0;
+    dropped = 0;
+    renders = 0;
+    renderCycles = 0;
+    renderCyclesMax = 0;
+    latenessMax = 0;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void NeoPixelEffects::printStatistics()
+{
+    DMESG("NEOPIXEL_EFFECTS: [EFFECT: %d] [FRAMES: %d]", effect, frames);
+    DMESG("   SENT: %d", sent);
+    DMESG("   UNCHANGED: %d", unchanged);
+    DMESG("   DROPPED: %d", dropped);
+    DMESG("   RENDER: [AVG: %d us] [MAX: %d us]", renders ? renderCycles / renders / 64 : 0, renderCyclesMax / 64);
+    DMESG("   LATENESS: [MAX: %d us]", latenessMax);
+}
@@ -0,0 +1,146 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "MicroBit.h"
+#include "NeoPixelStrip.h"
+
+#ifndef NEOPIXEL_EFFECTS_H
+#define NEOPIXEL_EFFECTS_H
+
+#define NEOPIXEL_EFFECTS_ID                     3109
+
+#define NEOPIXEL_EFFECTS_EVT_FRAME              1
+
+#define NEOPIXEL_EFFECTS_DEFAULT_PERIOD         2000
+#define NEOPIXEL_EFFECTS_DEFAULT_RATE           50
+#define NEOPIXEL_EFFECTS_MAX_RATE               200
+
+// The number of pixels lit by the chase, fading from the head.
+#define NEOPIXEL_EFFECTS_CHASE_TAIL             8
+
+#define NEOPIXEL_EFFECT_CHASE                   0
+#define NEOPIXEL_EFFECT_FADE                    1
+#define NEOPIXEL_EFFECT_RAINBOW                 2
+#define NEOPIXEL_EFFECT_SPARKLE                 3
+
+/**
+ * Plays animated effects on a NeoPixelStrip at a steady frame rate, without involving a fiber.
+ *
+ * Each frame is rendered by a system timer event, handled in interrupt context, and scheduled against the start of
+ * the effect rather than the previous frame, as the AnimationEngine does for the display. Effects are worked out in
+ * integer maths from a 32 bit phase that advances by a fixed step each frame period, so their speed doesn't depend on
+ * how many frames are actually shown, and each frame is built from the last one by changing only what moved.
+ *
+ * Frames are double buffered: one is sent to the strip while the next is rendered into the other, then the two are
+ * exchanged. A frame identical to the one on the strip isn't sent at all. If the strip is still busy with the last
+ * frame when the next is due, or the timer event is late by a whole period, that frame is dropped and counted.
+ */
+class NeoPixelEffects
+{
+    NeoPixelStrip               &strip;
+    uint16_t                    id;
+    uint8_t                     *frame[2];
+    int                         active;             // The frame on the strip, or being sent to it.
+    int                         size;
+    volatile bool               playing;
+
+    int                         effect;
+    uint8_t                     red, green, blue;
+    uint32_t                    periodUs;
+    uint32_t                    phase;
+    uint32_t                    phaseStep;
+    CODAL_TIMESTAMP             deadline;
+    bool                        first;
+    int                         last;               // What the last frame showed: the chase head, fade level or hue.
+    uint32_t                    random;
+
+    // Statistics.
+    uint32_t                    frames;
+    uint32_t                    sent;
+    uint32_t                    unchanged;
+    uint32_t                    dropped;
+    uint32_t                    renders;
+    uint32_t                    renderCycles;
+    uint32_t                    renderCyclesMax;
+    uint32_t                    latenessMax;
+
+    /**
+     * Determines the pixel a phase corresponds to.
+     */
+    int position(uint32_t phase);
+
+    /**
+     * Renders the next frame into the back buffer, from the one on the strip.
+     * @param previous the phase of the last frame.
+     */
+    void render(uint32_t previous);
+
+    /**
+     * Timer event handler, which renders the frame that is due and sends it if it has changed.
+     */
+    void onFrame(MicroBitEvent);
+
+    public:
+    /**
+     * Creates an effects player.
+     * @param strip the strip to play effects on. Nothing else should send to it while an effect plays.
+     * @param id the ID to use for events raised by this component.
+     */
+    NeoPixelEffects(NeoPixelStrip &strip, uint16_t id = NEOPIXEL_EFFECTS_ID);
+
+    /**
+     * Begins playing an effect until stopped, and returns immediately. Any effect already playing is replaced.
+     * @param effect one of the NEOPIXEL_EFFECT_ effects.
+     * @param red the colour of the effect. The rainbow ignores it.
+     * @param periodMs the time for one cycle of the effect: for the chase to go round the strip, the fade to go up
+     * and down, or the rainbow to turn once. A sparkle lights each pixel once a period on average.
+     * @param frameRate the number of frames a second, up to NEOPIXEL_EFFECTS_MAX_RATE.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int playAsync(int effect, uint8_t red, uint8_t green, uint8_t blue, int periodMs = NEOPIXEL_EFFECTS_DEFAULT_PERIOD, int frameRate = NEOPIXEL_EFFECTS_DEFAULT_RATE);
+
+    /**
+     * Stops the effect playing, leaving the last frame on the strip.
+     */
+    void stop();
+
+    /**
+     * Determines if an effect is playing.
+     */
+    bool isPlaying();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,521 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "NeoPixelStrip.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+#include <math.h>
+
+// Two bits as PWM compare values, the first sent in the lower half word. Falling edge polarity, so the output is high
+// for the first T0H or T1H ticks of the period.
+#define NEOPIXEL_STRIP_0                        (0x8000UL | NEOPIXEL_STRIP_T0H)
+#define NEOPIXEL_STRIP_1                        (0x8000UL | NEOPIXEL_STRIP_T1H)
+#define NEOPIXEL_STRIP_LOW                      0x80008000UL
+
+static const uint32_t neopixel_strip_bits[4] = {
+    NEOPIXEL_STRIP_0 | (NEOPIXEL_STRIP_0 << 16),
+    NEOPIXEL_STRIP_0 | (NEOPIXEL_STRIP_1 << 16),
+    NEOPIXEL_STRIP_1 | (NEOPIXEL_STRIP_0 << 16),
+    NEOPIXEL_STRIP_1 | (NEOPIXEL_STRIP_1 << 16)
+};
+
+// The offset of the red, green, blue and white bytes of a pixel, for each colour order.
+static const uint8_t neopixel_strip_offsets[4][4] = {
+    {1, 0, 2, 3},
+    {0, 1, 2, 3},
+    {1, 0, 2, 3},
+    {0, 1, 2, 3}
+};
+
+NeoPixelStrip *NeoPixelStrip::instance = NULL;
+
+/**
+ * Creates a NeoPixel strip, with every pixel off.
+ * @param pin the pin the strip's data input is connected to.
+ * @param length the number of pixels.
+ * @param order the colour order of the pixels, one of the NEOPIXEL_ orders.
+ * @param pwm the PWM instance to use, which must not be shared.
+ * @param counter the timer used to count the PWM's sequences, which must not be shared.
+ * @param irqn the interrupt of the counter timer.
+ * @param ppiChannel the first of two consecutive PPI channels to use.
+ * @param id the ID to use for events raised by this component.
+ */
+NeoPixelStrip::NeoPixelStrip(NRF52Pin &pin, int length, int order, NRF_PWM_Type *pwm, NRF_TIMER_Type *counter, IRQn_Type irqn, int ppiChannel, uint16_t id) : pin(pin), counter(counter, irqn)
+{
+    this->pwm = pwm;
+    this->ppiChannel = ppiChannel;
+    this->id = id;
+    this->enabled = false;
+
+    this->length = max(length, 0);
+    this->order = (order >= NEOPIXEL_GRB && order <= NEOPIXEL_RGBW) ? order : NEOPIXEL_GRB;
+    this->bytesPerPixel = this->order >= NEOPIXEL_GRBW ? 4 : 3;
+    this->pixels = new uint8_t[this->length * bytesPerPixel];
+    this->frame = pixels;
+
+    // Each buffer holds a chunk of pixels, or the reset time, at one compare value per bit.
+    int bits = max(NEOPIXEL_STRIP_CHUNK_PIXELS * bytesPerPixel * 8, NEOPIXEL_STRIP_RESET_BITS);
+    chunk[0] = new uint32_t[bits / 2];
+    chunk[1] = new uint32_t[bits / 2];
+
+    sequences = 0;
+    ended = 0;
+    busy = false;
+    waiting = false;
+    frameStart = 0;
+
+    brightness = 255;
+    gamma = NEOPIXEL_STRIP_DEFAULT_GAMMA;
+    updateLookupTable();
+    clear();
+
+    cycle_counter_enable();
+    resetStatistics();
+}
+
+/**
+ * Destructor. Waits for the frame being sent, if any, and releases the peripherals.
+ */
+NeoPixelStrip::~NeoPixelStrip()
+{
+    waitForFrame();
+
+    if (enabled)
+    {
+        NRF_PPI->CHENCLR = 3 << ppiChannel;
+        counter.disable();
+
+        pwm->ENABLE = (PWM_ENABLE_ENABLE_Disabled << PWM_ENABLE_ENABLE_Pos);
+        pwm->PSEL.OUT[0] = (PWM_PSEL_OUT_CONNECT_Disconnected << PWM_PSEL_OUT_CONNECT_Pos);
+    }
+
+    if (instance == this)
+        instance = NULL;
+
+    delete[] pixels;
+    delete[] chunk[0];
+    delete[] chunk[1];
+}
+
+/**
+ * Counter interrupt handler.
+ */
+void NeoPixelStrip::onCounter(uint16_t channels)
+{
+    if ((channels & 1) && instance)
+        instance->onSequenceEnd();
+}
+
+/**
+ * Encodes the next chunk of the frame into the buffer of each sequence that has ended.
+ */
+void NeoPixelStrip::onSequenceEnd()
+{
+    NRF_TIMER_Type *c = counter.timer;
+    uint32_t counted;
+
+    do
+    {
+        c->TASKS_CAPTURE[1] = 1;
+        counted = c->CC[1];
+
+        while (ended < (int)counted && ended < sequences)
+        {
+            pwm->EVENTS_SEQEND[ended & 1] = 0;
+            ended++;
+
+            // The sequence after the one that just ended is playing, so refill this one with the sequence after that.
+            // If the one playing has ended by the time that's done, the PWM has already started on a part built buffer.
+            if (ended + 1 < sequences)
+            {
+                encode(ended + 1);
+
+                if (pwm->EVENTS_SEQEND[ended & 1])
+                    underruns++;
+            }
+        }
+
+        // Interrupt on the next sequence end. If one has arrived since we looked, its compare has been missed, so go
+        // round again.
+        c->CC[0] = ended + 1;
+        c->TASKS_CAPTURE[1] = 1;
+    } while (c->CC[1] != counted);
+
+    if (busy && ended >= sequences)
+    {
+        uint32_t frameTime = system_timer_current_time_us() - frameStart;
+        frameTimeTotal += frameTime;
+        if (frameTime > frameTimeMax)
+            frameTimeMax = frameTime;
+        frames++;
+
+        busy = false;
+
+        if (waiting)
+        {
+            waiting = false;
+            Event(id, NEOPIXEL_STRIP_EVT_SHOWN);
+        }
+    }
+}
+
+/**
+ * Encodes one chunk of the frame into the buffer of the sequence that will play it.
+ * @param n the index of the sequence in the frame.
+ */
+void NeoPixelStrip::encode(int n)
+{
+    uint32_t start = cycle_counter_read();
+    uint32_t *out = chunk[n & 1];
+    uint32_t *o = out;
+    int first = n * NEOPIXEL_STRIP_CHUNK_PIXELS;
+
+    if (first < length)
+    {
+        const uint8_t *p = frame + first * bytesPerPixel;
+        const uint8_t *end = frame + min(first + NEOPIXEL_STRIP_CHUNK_PIXELS, length) * bytesPerPixel;
+
+        // Gamma and brightness, then each bit most significant first, two at a time.
+        while (p < end)
+        {
+            uint32_t v = lut[*p++];
+
+            o[0] = neopixel_strip_bits[v >> 6];
+            o[1] = neopixel_strip_bits[(v >> 4) & 3];
+            o[2] = neopixel_strip_bits[(v >> 2) & 3];
+            o[3] = neopixel_strip_bits[v & 3];
+            o += 4;
+        }
+    }
+    else
+    {
+        while (o < out + NEOPIXEL_STRIP_RESET_BITS / 2)
+            *o++ = NEOPIXEL_STRIP_LOW;
+    }
+
+    pwm->SEQ[n & 1].CNT = (o - out) * 2;
+
+    uint32_t cycles = cycle_counter_read() - start;
+    encodeCycles += cycles;
+    if (cycles > encodeCyclesMax)
+        encodeCyclesMax = cycles;
+    chunks++;
+}
+
+/**
+ * Rebuilds the lookup table from the gamma and brightness.
+ */
+void NeoPixelStrip::updateLookupTable()
+{
+    for (int v = 0; v < 256; v++)
+    {
+        float x = v / 255.0f;
+
+        if (gamma != 1.0f)
+            x = powf(x, gamma);
+
+        lut[v] = (uint8_t)(x * brightness + 0.5f);
+    }
+}
+
+/**
+ * Blocks the calling fiber until the frame being sent, if any, has been latched.
+ */
+void NeoPixelStrip::waitForFrame()
+{
+    // Check and wait with interrupts off, so the frame can't end between the two.
+    target_disable_irq();
+
+    if (busy)
+    {
+        waiting = true;
+        fiber_wake_on_event(id, NEOPIXEL_STRIP_EVT_SHOWN);
+        target_enable_irq();
+        schedule();
+    }
+    else
+    {
+        target_enable_irq();
+    }
+}
+
+/**
+ * Sets the colour of one pixel. Takes effect at the next show().
+ * @param index the pixel, from 0.
+ * @param white the white level, which is ignored unless the strip is RGBW.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int NeoPixelStrip::setPixel(int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+{
+    if (index < 0 || index >= length)
+        return DEVICE_INVALID_PARAMETER;
+
+    writePixel(pixels + index * bytesPerPixel, red, green, blue, white);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Writes a colour into one pixel of a frame held outside the strip, in the strip's colour order.
+ * @param pixel the getBytesPerPixel() bytes of the pixel.
+ * @param white the white level, which is ignored unless the strip is RGBW.
+ */
+void NeoPixelStrip::writePixel(uint8_t *pixel, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+{
+    const uint8_t *offset = neopixel_strip_offsets[order];
+
+    pixel[offset[0]] = red;
+    pixel[offset[1]] = green;
+    pixel[offset[2]] = blue;
+
+    if (bytesPerPixel == 4)
+        pixel[offset[3]] = white;
+}
+
+/**
+ * Sets every pixel to the same colour. Takes effect at the next show().
+ * @param white the white level, which is ignored unless the strip is RGBW.
+ */
+void NeoPixelStrip::fill(uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+{
+    for (int i = 0; i < length; i++)
+        setPixel(i, red, green, blue, white);
+}
+
+/**
+ * Turns every pixel off. Takes effect at the next show().
+ */
+void NeoPixelStrip::clear()
+{
+    memset(pixels, 0, length * bytesPerPixel);
+}
+
+/**
+ * Provides the pixels, with getBytesPerPixel() bytes for each in the order they are sent.
+ */
+uint8_t *NeoPixelStrip::getBuffer()
+{
+    return pixels;
+}
+
+/**
+ * Determines the number of pixels.
+ */
+int NeoPixelStrip::getLength()
+{
+    return length;
+}
+
+/**
+ * Determines the number of bytes for each pixel: 3, or 4 for RGBW.
+ */
+int NeoPixelStrip::getBytesPerPixel()
+{
+    return bytesPerPixel;
+}
+
+/**
+ * Defines the global brightness. Takes effect at the next show().
+ * @param brightness the brightness, from 0 to 255.
+ */
+void NeoPixelStrip::setBrightness(int brightness)
+{
+    this->brightness = min(max(brightness, 0), 255);
+    updateLookupTable();
+}
+
+/**
+ * Determines the global brightness, from 0 to 255.
+ */
+int NeoPixelStrip::getBrightness()
+{
+    return brightness;
+}
+
+/**
+ * Defines the gamma correction. Takes effect at the next show().
+ * @param gamma the exponent applied to each colour value, or 1 for none.
+ */
+void NeoPixelStrip::setGamma(float gamma)
+{
+    this->gamma = gamma > 0.0f ? gamma : 1.0f;
+    updateLookupTable();
+}
+
+/**
+ * Sends the pixels to the strip, and blocks the calling fiber until they have been latched. The pixels are read
+ * as they are sent, so must not be changed by another fiber until this returns.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the PPI channels given are out of range.
+ */
+int NeoPixelStrip::show()
+{
+    int result;
+
+    waitForFrame();
+    result = showAsync();
+
+    if (result == DEVICE_OK)
+        waitForFrame();
+
+    return result;
+}
+
+/**
+ * Starts sending a frame to the strip, and returns immediately. Can be called from interrupt context.
+ * @param frame the pixels to send, laid out as getBuffer(), or NULL to send the strip's own. These are read as
+ * they are sent, so must not change until isBusy() is false.
+ * @return DEVICE_OK on success, DEVICE_BUSY if a frame is already being sent, or DEVICE_INVALID_PARAMETER if the
+ * PPI channels given are out of range.
+ */
+int NeoPixelStrip::showAsync(const uint8_t *frame)
+{
+    if (ppiChannel < 0 || ppiChannel + 2 > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    target_disable_irq();
+
+    if (busy)
+    {
+        target_enable_irq();
+        return DEVICE_BUSY;
+    }
+
+    busy = true;
+    target_enable_irq();
+
+    if (!enabled)
+    {
+        // Idle low, for the time the PWM isn't driving the pin.
+        pin.setDigitalValue(0);
+
+        pwm->PSEL.OUT[0] = (pin.name << PWM_PSEL_OUT_PIN_Pos) | (PWM_PSEL_OUT_CONNECT_Connected << PWM_PSEL_OUT_CONNECT_Pos);
+        for (int n = 1; n < 4; n++)
+            pwm->PSEL.OUT[n] = (PWM_PSEL_OUT_CONNECT_Disconnected << PWM_PSEL_OUT_CONNECT_Pos);
+
+        pwm->ENABLE = (PWM_ENABLE_ENABLE_Enabled << PWM_ENABLE_ENABLE_Pos);
+        pwm->MODE = (PWM_MODE_UPDOWN_Up << PWM_MODE_UPDOWN_Pos);
+        pwm->PRESCALER = (PWM_PRESCALER_PRESCALER_DIV_1 << PWM_PRESCALER_PRESCALER_Pos);
+        pwm->COUNTERTOP = NEOPIXEL_STRIP_BIT_TICKS;
+        pwm->DECODER = (PWM_DECODER_LOAD_Common << PWM_DECODER_LOAD_Pos) | (PWM_DECODER_MODE_RefreshCount << PWM_DECODER_MODE_Pos);
+
+        for (int n = 0; n < 2; n++)
+        {
+            pwm->SEQ[n].PTR = (uint32_t) chunk[n];
+            pwm->SEQ[n].REFRESH = 0;
+            pwm->SEQ[n].ENDDELAY = 0;
+        }
+
+        // Stop at the end of the frame, without an interrupt.
+        pwm->SHORTS = PWM_SHORTS_LOOPSDONE_STOP_Msk;
+        pwm->INTEN = 0;
+
+        instance = this;
+
+        counter.setMode(TimerModeCounter);
+        counter.setBitMode(BitMode32);
+        counter.setIRQ(onCounter);
+        counter.reset();
+        counter.enable();
+
+        for (int n = 0; n < 2; n++)
+        {
+            NRF_PPI->CH[ppiChannel + n].EEP = (uint32_t) &pwm->EVENTS_SEQEND[n];
+            NRF_PPI->CH[ppiChannel + n].TEP = (uint32_t) &counter.timer->TASKS_COUNT;
+            NRF_PPI->CHENSET = 1 << (ppiChannel + n);
+        }
+
+        enabled = true;
+    }
+
+    // The frame's chunks, and at least one sequence of reset time, played as whole pairs of sequences.
+    int dataChunks = (length + NEOPIXEL_STRIP_CHUNK_PIXELS - 1) / NEOPIXEL_STRIP_CHUNK_PIXELS;
+    sequences = (dataChunks + 2) & ~1;
+    ended = 0;
+    this->frame = frame ? frame : pixels;
+
+    encode(0);
+    encode(1);
+
+    pwm->LOOP = sequences / 2;
+    pwm->EVENTS_SEQEND[0] = 0;
+    pwm->EVENTS_SEQEND[1] = 0;
+    pwm->EVENTS_STOPPED = 0;
+
+    counter.reset();
+    counter.setCompare(0, 1);
+
+    frameStart = system_timer_current_time_us();
+    pwm->TASKS_SEQSTART[0] = 1;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines if a frame is being sent.
+ */
+bool NeoPixelStrip::isBusy()
+{
+    return busy;
+}
+
+/**
+ * Determines the time taken to send a frame, in microseconds, including the reset time.
+ */
+uint32_t NeoPixelStrip::getFrameTime()
+{
+    int dataChunks = (length + NEOPIXEL_STRIP_CHUNK_PIXELS - 1) / NEOPIXEL_STRIP_CHUNK_PIXELS;
+    int resets = ((dataChunks + 2) & ~1) - dataChunks;
+    uint32_t bits = length * bytesPerPixel * 8 + resets * NEOPIXEL_STRIP_RESET_BITS;
+
+    return bits * NEOPIXEL_STRIP_BIT_TICKS / 16;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void NeoPixelStrip::resetStatistics()
+{
+    target_disable_irq();
+    frames = 0;
+    frameTimeTotal = 0;
+    frameTimeMax = 0;
+    chunks = 0;
+    encodeCycles = 0;
+    encodeCyclesMax = 0;
+    underruns = 0;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void NeoPixelStrip::printStatistics()
+{
+    DMESG("NEOPIXEL_STRIP: [PIXELS: %d] [BYTES PER PIXEL: %d]", length, bytesPerPixel);
+    DMESG("   FRAMES: %d [AVG: %d us] [MAX: %d us] [WIRE TIME: %d us]", frames, frames ? frameTimeTotal / frames : 0, frameTimeMax, getFrameTime());
+    DMESG("   CHUNKS: %d [AVG: %d cycles] [MAX: %d cycles]", chunks, chunks ? encodeCycles / chunks : 0, encodeCyclesMax);
+    DMESG("   UNDERRUNS: %d", underruns);
+}
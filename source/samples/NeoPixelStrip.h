@@ -0,0 +1,249 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "MicroBit.h"
+
+#ifndef NEOPIXEL_STRIP_H
+#define NEOPIXEL_STRIP_H
+
+#define NEOPIXEL_STRIP_ID                       3108
+
+#define NEOPIXEL_STRIP_EVT_SHOWN                1
+
+// Each bit on the wire is one 1.25us PWM period at 16MHz. The PWM is high for the first T0H or T1H ticks of it.
+#define NEOPIXEL_STRIP_BIT_TICKS                20
+#define NEOPIXEL_STRIP_T0H                      6
+#define NEOPIXEL_STRIP_T1H                      13
+
+// The low time that latches a frame. 300us is long enough for the newer WS2812B parts, which need 280us.
+#define NEOPIXEL_STRIP_RESET_BITS               240
+
+// The pixels encoded into each of the two DMA buffers at a time.
+#define NEOPIXEL_STRIP_CHUNK_PIXELS             8
+
+// Default peripheral resources. The PPI channels are the same as the light sensor's, and the two aren't used together.
+#define NEOPIXEL_STRIP_DEFAULT_PPI              10
+
+// Colour orders. Bytes are sent in the order named.
+#define NEOPIXEL_GRB                            0
+#define NEOPIXEL_RGB                            1
+#define NEOPIXEL_GRBW                           2
+#define NEOPIXEL_RGBW                           3
+
+#define NEOPIXEL_STRIP_DEFAULT_GAMMA            2.8f
+
+/**
+ * Drives a strip of WS2812B (NeoPixel) LEDs of any length from one PWM instance, using a fixed amount of memory for
+ * the bit patterns, however long the strip.
+ *
+ * Every bit sent is a PWM period with its own compare value, read by EasyDMA. Rather than encode the whole frame
+ * (48 bytes per RGB pixel) before sending it, the PWM's two sequences take turns playing from two small buffers of
+ * a few pixels each. As each sequence ends, the other is already playing, and the next chunk of pixels is encoded into
+ * the buffer just finished. Both sequence end events are counted by a TIMER in counter mode through PPI, whose compare
+ * interrupt does the encoding, as the PWM's own interrupt belongs to CODAL. The whole frame, with the reset time that
+ * latches it, is a fixed number of sequence pairs, so the PWM stops itself at the end through the LOOPSDONE shortcut.
+ *
+ * Pixels are held as 8 bit colour values in the order they are sent. Gamma correction and the global brightness are
+ * one 256 entry lookup table, applied as each chunk is encoded, so the pixels themselves are never changed by them.
+ */
+class NeoPixelStrip
+{
+    NRF52Pin                &pin;
+    NRF_PWM_Type            *pwm;
+    NRFLowLevelTimer        counter;
+    int                     ppiChannel;
+    uint16_t                id;
+    bool                    enabled;
+
+    int                     length;
+    int                     order;
+    int                     bytesPerPixel;
+    uint8_t                 *pixels;
+    const uint8_t           *frame;             // The pixels being sent.
+    uint32_t                *chunk[2];          // Two bits of 16 bit compare values in each word.
+
+    uint8_t                 lut[256];
+    int                     brightness;
+    float                   gamma;
+
+    int                     sequences;          // The number of PWM sequences in the frame, including the reset.
+    volatile int            ended;              // The number of sequences played so far.
+    volatile bool           busy;
+    volatile bool           waiting;
+    uint64_t                frameStart;
+
+    // Statistics.
+    uint32_t                frames;
+    uint32_t                frameTimeTotal;
+    uint32_t                frameTimeMax;
+    uint32_t                chunks;
+    uint32_t                encodeCycles;
+    uint32_t                encodeCyclesMax;
+    uint32_t                underruns;
+
+    static NeoPixelStrip    *instance;
+
+    /**
+     * Counter interrupt handler.
+     */
+    static void onCounter(uint16_t channels);
+
+    /**
+     * Encodes the next chunk of the frame into the buffer of each sequence that has ended.
+     */
+    void onSequenceEnd();
+
+    /**
+     * Encodes one chunk of the frame into the buffer of the sequence that will play it.
+     * @param n the index of the sequence in the frame.
+     */
+    void encode(int n);
+
+    /**
+     * Rebuilds the lookup table from the gamma and brightness.
+     */
+    void updateLookupTable();
+
+    /**
+     * Blocks the calling fiber until the frame being sent, if any, has been latched.
+     */
+    void waitForFrame();
+
+    public:
+    /**
+     * Creates a NeoPixel strip, with every pixel off.
+     * @param pin the pin the strip's data input is connected to.
+     * @param length the number of pixels.
+     * @param order the colour order of the pixels, one of the NEOPIXEL_ orders.
+     * @param pwm the PWM instance to use, which must not be shared.
+     * @param counter the timer used to count the PWM's sequences, which must not be shared.
+     * @param irqn the interrupt of the counter timer.
+     * @param ppiChannel the first of two consecutive PPI channels to use.
+     * @param id the ID to use for events raised by this component.
+     */
+    NeoPixelStrip(NRF52Pin &pin, int length, int order = NEOPIXEL_GRB, NRF_PWM_Type *pwm = NRF_PWM3, NRF_TIMER_Type *counter = NRF_TIMER3, IRQn_Type irqn = TIMER3_IRQn, int ppiChannel = NEOPIXEL_STRIP_DEFAULT_PPI, uint16_t id = NEOPIXEL_STRIP_ID);
+
+    /**
+     * Destructor. Waits for the frame being sent, if any, and releases the peripherals.
+     */
+    ~NeoPixelStrip();
+
+    /**
+     * Sets the colour of one pixel. Takes effect at the next show().
+     * @param index the pixel, from 0.
+     * @param white the white level, which is ignored unless the strip is RGBW.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setPixel(int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t white = 0);
+
+    /**
+     * Writes a colour into one pixel of a frame held outside the strip, in the strip's colour order.
+     * @param pixel the getBytesPerPixel() bytes of the pixel.
+     * @param white the white level, which is ignored unless the strip is RGBW.
+     */
+    void writePixel(uint8_t *pixel, uint8_t red, uint8_t green, uint8_t blue, uint8_t white = 0);
+
+    /**
+     * Sets every pixel to the same colour. Takes effect at the next show().
+     * @param white the white level, which is ignored unless the strip is RGBW.
+     */
+    void fill(uint8_t red, uint8_t green, uint8_t blue, uint8_t white = 0);
+
+    /**
+     * Turns every pixel off. Takes effect at the next show().
+     */
+    void clear();
+
+    /**
+     * Provides the pixels, with getBytesPerPixel() bytes for each in the order they are sent.
+     */
+    uint8_t *getBuffer();
+
+    /**
+     * Determines the number of pixels.
+     */
+    int getLength();
+
+    /**
+     * Determines the number of bytes for each pixel: 3, or 4 for RGBW.
+     */
+    int getBytesPerPixel();
+
+    /**
+     * Defines the global brightness. Takes effect at the next show().
+     * @param brightness the brightness, from 0 to 255.
+     */
+    void setBrightness(int brightness);
+
+    /**
+     * Determines the global brightness, from 0 to 255.
+     */
+    int getBrightness();
+
+    /**
+     * Defines the gamma correction. Takes effect at the next show().
+     * @param gamma the exponent applied to each colour value, or 1 for none.
+     */
+    void setGamma(float gamma);
+
+    /**
+     * Sends the pixels to the strip, and blocks the calling fiber until they have been latched. The pixels are read
+     * as they are sent, so must not be changed by another fiber until this returns.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the PPI channels given are out of range.
+     */
+    int show();
+
+    /**
+     * Starts sending a frame to the strip, and returns immediately. Can be called from interrupt context.
+     * @param frame the pixels to send, laid out as getBuffer(), or NULL to send the strip's own. These are read as
+     * they are sent, so must not change until isBusy() is false.
+     * @return DEVICE_OK on success, DEVICE_BUSY if a frame is already being sent, or DEVICE_INVALID_PARAMETER if the
+     * PPI channels given are out of range.
+     */
+    int showAsync(const uint8_t *frame = NULL);
+
+    /**
+     * Determines if a frame is being sent.
+     */
+    bool isBusy();
+
+    /**
+     * Determines the time taken to send a frame, in microseconds, including the reset time.
+     */
+    uint32_t getFrameTime();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
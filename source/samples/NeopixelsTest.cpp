@@ -25,6 +25,8 @@ DEALINGS IN THE SOFTWARE.
 #include "MicroBit.h"
 #include "Tests.h"
 #include "neopixel.h"
+#include "NeoPixelStrip.h"
+#include "NeoPixelEffects.h"
 
 extern MicroBit uBit;
 
@@ -64,3 +66,136 @@ neopixel_test()
         uBit.sleep(1000);
     }
 }
+
+// The number of pixels in the benchmark strip, and how long each part of it runs for.
+#define NEOPIXEL_BENCHMARK_LENGTH       300
+#define NEOPIXEL_BENCHMARK_TIME         3000
+
+/**
+ * Converts a hue, from 0 to 767, to a fully saturated colour.
+ */
+static void
+neopixel_wheel(int hue, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+    int x = hue & 255;
+
+    switch (hue >> 8)
+    {
+        case 0: r = 255 - x; g = x; b = 0; break;
+        case 1: r = 0; g = 255 - x; b = x; break;
+        default: r = x; g = 0; b = 255 - x; break;
+    }
+}
+
+/**
+ * Sends a moving rainbow to a strip as fast as it will go, and reports the frame rate.
+ */
+static void
+neopixel_benchmark_strip(NeoPixelStrip &strip, const char *name)
+{
+    int length = strip.getLength();
+    int frames = 0;
+    uint8_t r, g, b;
+
+    strip.setBrightness(32);
+    strip.resetStatistics();
+
+    uint64_t start = system_timer_current_time();
+
+    while (system_timer_current_time() - start < NEOPIXEL_BENCHMARK_TIME)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            neopixel_wheel(((i + frames) * 768 / length) % 768, r, g, b);
+            strip.setPixel(i, r, g, b, (i + frames) & 63);
+        }
+
+        strip.show();
+        frames++;
+    }
+
+    uint32_t elapsed = system_timer_current_time() - start;
+
+    DMESG("NEOPIXEL_BENCHMARK: %s [PIXELS: %d] [FRAMES: %d] [FPS: %d] [WIRE LIMIT FPS: %d]", name, length, frames, frames * 1000 / elapsed, 1000000 / strip.getFrameTime());
+    strip.printStatistics();
+}
+
+void
+neopixel_benchmark()
+{
+    int length = NEOPIXEL_BENCHMARK_LENGTH;
+
+    // The existing driver, which needs the whole frame in memory and encodes it all before sending any of it.
+    ManagedBuffer buffer(length * 3);
+    int frames = 0;
+    uint8_t r, g, b;
+
+    uint64_t start = system_timer_current_time();
+
+    while (system_timer_current_time() - start < NEOPIXEL_BENCHMARK_TIME)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            neopixel_wheel(((i + frames) * 768 / length) % 768, r, g, b);
+            buffer[i * 3] = g >> 3;
+            buffer[i * 3 + 1] = r >> 3;
+            buffer[i * 3 + 2] = b >> 3;
+        }
+
+        neopixel_send_buffer(uBit.io.P0, buffer);
+        frames++;
+    }
+
+    uint32_t elapsed = system_timer_current_time() - start;
+    DMESG("NEOPIXEL_BENCHMARK: neopixel_send_buffer [PIXELS: %d] [FRAMES: %d] [FPS: %d]", length, frames, frames * 1000 / elapsed);
+
+    {
+        NeoPixelStrip strip(uBit.io.P0, length, NEOPIXEL_GRB);
+        neopixel_benchmark_strip(strip, "GRB");
+    }
+
+    {
+        NeoPixelStrip strip(uBit.io.P0, length, NEOPIXEL_GRBW);
+        neopixel_benchmark_strip(strip, "GRBW");
+    }
+}
+
+void
+neopixel_effects_test()
+{
+    static const char *names[] = {"CHASE", "FADE", "RAINBOW", "SPARKLE"};
+
+    NeoPixelStrip strip(uBit.io.P0, NEOPIXEL_BENCHMARK_LENGTH, NEOPIXEL_GRB);
+    NeoPixelEffects effects(strip);
+
+    strip.setBrightness(32);
+
+    while(1)
+    {
+        for (int effect = NEOPIXEL_EFFECT_CHASE; effect <= NEOPIXEL_EFFECT_SPARKLE; effect++)
+        {
+            int reads = 0;
+            int x = 0;
+
+            strip.resetStatistics();
+            effects.resetStatistics();
+            effects.playAsync(effect, 255, 96, 0, 2000, 60);
+
+            // The effect runs from the timer, leaving this fiber free to keep reading the sensors at its own pace.
+            uint64_t start = system_timer_current_time();
+
+            while (system_timer_current_time() - start < NEOPIXEL_BENCHMARK_TIME)
+            {
+                x += uBit.accelerometer.getX();
+                reads++;
+                uBit.sleep(10);
+            }
+
+            effects.stop();
+
+            DMESG("NEOPIXEL_EFFECTS_TEST: %s [SENSOR READS: %d] [AVG X: %d]", names[effect], reads, x / reads);
+            effects.printStatistics();
+            strip.printStatistics();
+        }
+    }
+}
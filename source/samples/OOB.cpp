@@ -6,6 +6,13 @@
 #include "Tests.h"
 #include <cmath>
 #include "Synthesizer.h"
+#include "Melody.h"
+#include "GlideToneEngine.h"
+#include "ImageLiteral.h"
+#include "CycleCounter.h"
+#include "AnimationEngine.h"
+#include "Bitboard.h"
+#include "ScrollCache.h"
 
 #define OOB_SHAKE_OVERSAMPLING                  5
 #define OOB_SHAKE_OVERSAMPLING_THRESHOLD        4
@@ -46,135 +53,123 @@ int basenote = 52;
  
 // Images and animations -----------------
  
-const MicroBitImage dot("0,255,0,255,0\n255,255,255,255,255\n255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n");
+static constexpr auto dot = IMAGE("0,255,0,255,0\n255,255,255,255,255\n255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n");
  
-const char *shake[] = {
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n0,255,0,255,0\n0,0,255,0,0\n0,255,0,255,0\n0,0,0,0,0\n",
-    "0,0,255,0,0\n0,255,0,255,0\n255,0,255,0,255\n0,255,0,255,0\n0,0,255,0,0\n",
-    "255,0,255,0,255\n0,255,0,255,0\n255,0,255,0,255\n0,255,0,255,0\n255,0,255,0,255\n",
-    "255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n"    
+static constexpr ImageLiteral<5, 5> shake[] = {
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,255,0,255,0\n0,0,255,0,0\n0,255,0,255,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,255,0,0\n0,255,0,255,0\n255,0,255,0,255\n0,255,0,255,0\n0,0,255,0,0\n"),
+    IMAGE("255,0,255,0,255\n0,255,0,255,0\n255,0,255,0,255\n0,255,0,255,0\n255,0,255,0,255\n"),
+    IMAGE("255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n")    
 };
  
-const char *wakeAnim[] = {
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n0,255,255,255,0\n0,255,255,255,0\n0,255,255,255,0\n0,0,0,0,0\n",
-    "255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n"
+static constexpr ImageLiteral<5, 5> wakeAnim[] = {
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,255,255,255,0\n0,255,255,255,0\n0,255,255,255,0\n0,0,0,0,0\n"),
+    IMAGE("255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n")
 };
  
-const char *explosionTime[] = {
-    "255,255,255,255,255\n255,0,0,0,255\n255,0,0,0,255\n255,0,0,0,255\n255,255,255,255,255\n",
-    "255,255,255,255,255\n255,255,255,255,255\n255,255,0,255,255\n255,255,255,255,255\n255,255,255,255,255\n",
-    "255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n",
-    "0,0,0,0,0\n0,255,255,255,0\n0,255,255,255,0\n0,255,255,255,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n0,255,0,255,0\n0,0,0,0,0\n0,255,0,255,0\n0,0,0,0,0\n",
-    "255,0,0,0,255\n0,0,255,0,0\n0,255,255,255,0\n0,0,255,0,0\n255,0,0,0,255\n",
-    "0,0,255,0,0\n0,255,0,255,0\n255,0,0,0,255\n0,255,0,255,0\n0,0,255,0,0\n",
-    "255,0,0,0,255\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n255,0,0,0,255\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n"    
+static constexpr ImageLiteral<5, 5> explosionTime[] = {
+    IMAGE("255,255,255,255,255\n255,0,0,0,255\n255,0,0,0,255\n255,0,0,0,255\n255,255,255,255,255\n"),
+    IMAGE("255,255,255,255,255\n255,255,255,255,255\n255,255,0,255,255\n255,255,255,255,255\n255,255,255,255,255\n"),
+    IMAGE("255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n255,255,255,255,255\n"),
+    IMAGE("0,0,0,0,0\n0,255,255,255,0\n0,255,255,255,0\n0,255,255,255,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,255,0,255,0\n0,0,0,0,0\n0,255,0,255,0\n0,0,0,0,0\n"),
+    IMAGE("255,0,0,0,255\n0,0,255,0,0\n0,255,255,255,0\n0,0,255,0,0\n255,0,0,0,255\n"),
+    IMAGE("0,0,255,0,0\n0,255,0,255,0\n255,0,0,0,255\n0,255,0,255,0\n0,0,255,0,0\n"),
+    IMAGE("255,0,0,0,255\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n255,0,0,0,255\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n")    
 };
  
-const char *twistyTime[] = {
-    "0,0,0,0,0\n0,0,0,0,0\n255,0,0,0,255\n0,0,0,0,0\n0,0,0,0,0\n",
-    "0,0,0,0,0\n255,0,0,0,255\n255,255,0,255,255\n255,0,0,0,255\n0,0,0,0,0\n",
-    "255,0,0,0,255\n255,255,0,255,255\n255,255,255,255,255\n255,255,0,255,255\n255,0,0,0,255\n",
-    "0,0,0,255,255\n255,0,0,255,255\n255,255,255,255,255\n255,255,0,0,255\n255,255,0,0,0\n",
-    "0,255,255,255,255\n0,0,255,255,255\n255,0,255,0,255\n255,255,255,0,0\n255,255,255,255,0\n",
-    "255,255,255,255,255\n0,0,255,255,255\n0,0,255,0,0\n255,255,255,0,0\n255,255,255,255,255\n",
-    "255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n0,255,255,255,0\n255,255,255,255,255\n",
-    "0,255,255,255,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,255,255,255,0\n",
-    "0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n"
+static constexpr ImageLiteral<5, 5> twistyTime[] = {
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n255,0,0,0,255\n0,0,0,0,0\n0,0,0,0,0\n"),
+    IMAGE("0,0,0,0,0\n255,0,0,0,255\n255,255,0,255,255\n255,0,0,0,255\n0,0,0,0,0\n"),
+    IMAGE("255,0,0,0,255\n255,255,0,255,255\n255,255,255,255,255\n255,255,0,255,255\n255,0,0,0,255\n"),
+    IMAGE("0,0,0,255,255\n255,0,0,255,255\n255,255,255,255,255\n255,255,0,0,255\n255,255,0,0,0\n"),
+    IMAGE("0,255,255,255,255\n0,0,255,255,255\n255,0,255,0,255\n255,255,255,0,0\n255,255,255,255,0\n"),
+    IMAGE("255,255,255,255,255\n0,0,255,255,255\n0,0,255,0,0\n255,255,255,0,0\n255,255,255,255,255\n"),
+    IMAGE("255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n0,255,255,255,0\n255,255,255,255,255\n"),
+    IMAGE("0,255,255,255,0\n0,0,255,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,255,255,255,0\n"),
+    IMAGE("0,0,255,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n")
 };
  
-const char *heart[] = { 
-     "0,255,0,255,0\n255,255,255,255,255\n255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n"
+static constexpr ImageLiteral<5, 5> heart[] = { 
+     IMAGE("0,255,0,255,0\n255,255,255,255,255\n255,255,255,255,255\n0,255,255,255,0\n0,0,255,0,0\n")
 };
  
+// Button prompt: the letter, then the arrow pointing at the button.
+static constexpr ImageLiteral<5, 5> buttonAPrompt[] = {
+    IMAGE("0,255,255,0,0\n255,0,0,255,0\n255,255,255,255,0\n255,0,0,255,0\n255,0,0,255,0\n"),
+    IMAGE("0,0,255,0,0\n0,255,0,0,0\n255,255,255,255,255\n0,255,0,0,0\n0,0,255,0,0\n")
+};
+
+static const uint16_t buttonAPromptDurations[] = { 500, 400 };
+
 // Arrow images and animations.
-const MicroBitImage arrowUpTime("0,0,255,0,0\n0,255,255,255,0\n255,0,255,0,255\n0,0,255,0,0\n0,0,255,0,0\n");
- 
-const char *arrowDisintegrationTime[] = {
-    "0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n0,255,255,255,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n",
-    "0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n"
+static constexpr auto arrowUpTime = IMAGE("0,0,255,0,0\n0,255,255,255,0\n255,0,255,0,255\n0,0,255,0,0\n0,0,255,0,0\n");
+ 
+static constexpr ImageLiteral<5, 5> arrowDisintegrationTime[] = {
+    IMAGE("0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n0,255,255,255,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n0,0,0,0,0\n")
 };
  
 // Bottom arrow from left to right
-const char *bottomArrow[] = {
-    "0,0,255,0,0\n0,255,0,0,0\n255,255,255,255,255\n0,255,0,0,0\n0,0,255,0,0\n",
-    "0,0,0,0,255\n255,0,0,255,0\n255,0,255,0,0\n255,255,0,0,0\n255,255,255,255,0\n",
-    "0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n0,255,255,255,0\n0,0,255,0,0\n",
-    "255,0,0,0,0\n0,255,0,0,255\n0,0,255,0,255\n0,0,0,255,255\n0,255,255,255,255\n",
-    "0,0,255,0,0\n0,0,0,255,0\n255,255,255,255,255\n0,0,0,255,0\n0,0,255,0,0\n"
+static constexpr ImageLiteral<5, 5> bottomArrow[] = {
+    IMAGE("0,0,255,0,0\n0,255,0,0,0\n255,255,255,255,255\n0,255,0,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,0,0,0,255\n255,0,0,255,0\n255,0,255,0,0\n255,255,0,0,0\n255,255,255,255,0\n"),
+    IMAGE("0,0,255,0,0\n0,0,255,0,0\n255,0,255,0,255\n0,255,255,255,0\n0,0,255,0,0\n"),
+    IMAGE("255,0,0,0,0\n0,255,0,0,255\n0,0,255,0,255\n0,0,0,255,255\n0,255,255,255,255\n"),
+    IMAGE("0,0,255,0,0\n0,0,0,255,0\n255,255,255,255,255\n0,0,0,255,0\n0,0,255,0,0\n")
 };
  
-const char *topArrow[] = {
-    "0,0,255,0,0\n0,255,0,0,0\n255,255,255,255,255\n0,255,0,0,0\n0,0,255,0,0\n",
-    "255,255,255,255,0\n255,255,0,0,0\n255,0,255,0,0\n255,0,0,255,0\n0,0,0,0,255\n",
-    "0,0,255,0,0\n0,255,255,255,0\n255,0,255,0,255\n0,0,255,0,0\n0,0,255,0,0\n",
-    "0,255,255,255,255\n0,0,0,255,255\n0,0,255,0,255\n0,255,0,0,255\n255,0,0,0,0\n",
-    "0,0,255,0,0\n0,0,0,255,0\n255,255,255,255,255\n0,0,0,255,0\n0,0,255,0,0\n"
+static constexpr ImageLiteral<5, 5> topArrow[] = {
+    IMAGE("0,0,255,0,0\n0,255,0,0,0\n255,255,255,255,255\n0,255,0,0,0\n0,0,255,0,0\n"),
+    IMAGE("255,255,255,255,0\n255,255,0,0,0\n255,0,255,0,0\n255,0,0,255,0\n0,0,0,0,255\n"),
+    IMAGE("0,0,255,0,0\n0,255,255,255,0\n255,0,255,0,255\n0,0,255,0,0\n0,0,255,0,0\n"),
+    IMAGE("0,255,255,255,255\n0,0,0,255,255\n0,0,255,0,255\n0,255,0,0,255\n255,0,0,0,0\n"),
+    IMAGE("0,0,255,0,0\n0,0,0,255,0\n255,255,255,255,255\n0,0,0,255,0\n0,0,255,0,0\n")
 };
 
-int target_freq;
-int current_freq;
 int playback_sleep = 5;
 int slide = 1;
 int chatter = false;
 int chatter_toggle = false;
 
+static GlideToneEngine *toneEngine = NULL;
+static AnimationEngine *animationEngine = NULL;
+static ScrollCache *scroller = NULL;
+
 // ---------------------------
-void playfreq(int freq)
+// Glide to the given frequency on the speaker and P0, from the frequency currently sounding unless told otherwise.
+// The glide is sequenced entirely by the PWM hardware, so nothing needs to run until the next note.
+void playfreq(int freq, int from = -1)
 {
   if (mute || freq == 0) { 
-    uBit.io.speaker.setAnalogValue(0);
-    uBit.io.P0.setAnalogValue(0);
+    toneEngine->stop();
     return;
   }
-  uBit.io.speaker.setHighDrive(true);
-  uBit.io.speaker.setAnalogValue(512);
-  uBit.io.P0.setHighDrive(true);
-  uBit.io.P0.setAnalogValue(512);
-  int period = 1000000.0/(float)freq;
-
-  uBit.io.speaker.setAnalogPeriodUs(period);
-  uBit.io.P0.setAnalogPeriodUs(period);
-  return;
+  toneEngine->setSlide(slide, playback_sleep);
+  toneEngine->play(freq, from);
 }
 
-void play_note(uint8_t note) {
+void play_note(uint8_t note, int from = -1) {
     if(note == 0) {
-        target_freq = 0;
+        playfreq(0);
         return;
     }
             
-    // A 440hz
-    int f = 440.0 * pow(2, ((float)(note - 58)/12.0));
-    target_freq = f;
+    // Note 58 is A4 (440Hz), so note 1 is C0.
+    playfreq(melody_frequency(note - 1), from);
 
     uBit.serial.printf("%d \r\n", note);
 }
  
-void playback_ticker() {
-    // Thread forever
-    while(1) {
-
-        if(target_freq == 0) {
-            current_freq = 0;
-            playfreq(0);
-        } else {
-            current_freq += (target_freq - current_freq) / slide;
-            playfreq(current_freq);
-        }
-        fiber_sleep(playback_sleep);
-    }
-}
- 
 
 // Wake up the device
 void wake()
@@ -191,14 +186,14 @@ void wake()
     for(int i=0; i<255; i++) {
         uBit.display.setBrightness(i);
         uBit.sleep(10);
-	    target_freq = i;
+	    playfreq(i);
     }
 
     // Fade out all LEDs.
     for(int i=255; i>0; i--) {
         uBit.display.setBrightness(i);
         uBit.sleep(10);
-	    target_freq = i;
+	    playfreq(i);
     }
 	play_note(0);
     
@@ -212,13 +207,13 @@ void wake()
     for(int j=0; j<20; j++) {
         int k = 0;
         for(int i=0; i<3; i++) {
-            currentFrame = MicroBitImage(wakeAnim[i]);
+            currentFrame = wakeAnim[i].image();
 	        play_note((3*j) + k*5);
             k = k + 2;
             uBit.display.print(currentFrame,0,0,0,animDelay);
         }
         for(int i=2; i>-1; i--) {
-            currentFrame = MicroBitImage(wakeAnim[i]);
+            currentFrame = wakeAnim[i].image();
 	        play_note((3 * j) + k*5);
             k++;
             uBit.display.print(currentFrame,0,0,0,animDelay);
@@ -255,12 +250,12 @@ void intro()
     // Introduce the micro:bit.
     uBit.display.image.clear();
     chatter = true;
-    uBit.display.scroll("HELLO", 150);
+    scroller->scroll("HELLO", 150);
     chatter = false;
 
     slide = 5;
-    MicroBitImage smiley("0,0,0,0, 0\n0,255,0,255,0\n0,0,0,0,0\n255,0,0,0,255\n0,255,255,255,0\n");
-    uBit.display.print(smiley);
+    static constexpr auto smiley = IMAGE("0,0,0,0, 0\n0,255,0,255,0\n0,0,0,0,0\n255,0,0,0,255\n0,255,255,255,0\n");
+    uBit.display.print(smiley.image());
     uBit.display.setBrightness(0);
     for(int b = 0; b < 255; b++) {
         uBit.sleep(2000 / 255);
@@ -292,26 +287,15 @@ void pressButtonA()
    // uBit.display.print("A");
    uBit.messageBus.listen(MICROBIT_ID_BUTTON_A, MICROBIT_BUTTON_EVT_CLICK, OOB_onButtonA);
     
-    // Wait for a button press.
-    while(!button_a_pressed) {
-        uBit.display.print("A");
-        uBit.sleep(500);
-        if(button_a_pressed) break;
-    
-        currentFrame = MicroBitImage(topArrow[0]);
-        uBit.display.print(currentFrame,0,0,0,100);
-       uBit.sleep(100);
-        if(button_a_pressed) break;
-    
-       currentFrame = MicroBitImage(topArrow[0]);
-        uBit.display.print(currentFrame,0,0,0,100);
-       uBit.sleep(100);
-        if(button_a_pressed) break;
-    }
+    // Prompt until the button is pressed. The prompt animates itself, so we can just wait for the click.
+    animationEngine->playAsync(buttonAPrompt, buttonAPromptDurations, 2, ANIMATION_ENGINE_REPEAT_FOREVER);
+    if(!button_a_pressed)
+        fiber_wait_for_event(MICROBIT_ID_BUTTON_A, MICROBIT_BUTTON_EVT_CLICK);
+    animationEngine->stop();
     
     // SADHBH'S animation goes here.
     for(int i=0; i<10; i++) {
-        currentFrame = MicroBitImage(explosionTime[i]);
+        currentFrame = explosionTime[i].image();
         uBit.display.print(currentFrame,0,0,0,100);
         play_note(basenote + (i * 5)) ;
     }
@@ -342,12 +326,12 @@ void pressButtonB()
         uBit.sleep(500);
         if(button_b_pressed) break;
     
-         currentFrame = MicroBitImage(topArrow[4]);
+         currentFrame = topArrow[4].image();
         uBit.display.print(currentFrame,0,0,0,100);
        uBit.sleep(100);
        if(button_b_pressed)break;
     
-       currentFrame = MicroBitImage(topArrow[4]);
+       currentFrame = topArrow[4].image();
         uBit.display.print(currentFrame,0,0,0,100);
        uBit.sleep(100);
         if(button_b_pressed)break;
@@ -355,7 +339,7 @@ void pressButtonB()
     
     // SADHBH'S animation goes here.
     for(int i=0; i<10; i++) {
-        currentFrame = MicroBitImage(twistyTime[i]);
+        currentFrame = twistyTime[i].image();
         uBit.display.print(currentFrame,0,0,0,100);
         play_note(basenote + (9*5) - (i * 5)) ;
     }
@@ -385,12 +369,12 @@ void pressLogoButton()
         uBit.sleep(500);
         if(button_logo_pressed) break;
     
-        currentFrame = MicroBitImage(topArrow[2]);
+        currentFrame = topArrow[2].image();
         uBit.display.print(currentFrame,0,0,0,100);
         uBit.sleep(100);
         if(button_logo_pressed)break;
     
-        currentFrame = MicroBitImage(topArrow[2]);
+        currentFrame = topArrow[2].image();
         uBit.display.print(currentFrame,0,0,0,100);
         uBit.sleep(100);
         if(button_logo_pressed)break;
@@ -398,7 +382,7 @@ void pressLogoButton()
     
     // SADHBH'S animation goes here.
     for(int i=0; i<10; i++) {
-        currentFrame = MicroBitImage(twistyTime[i]);
+        currentFrame = twistyTime[i].image();
         uBit.display.print(currentFrame,0,0,0,100);
         play_note(basenote + (9*5) - (i * 5)) ;
     }
@@ -442,7 +426,7 @@ void turn()
     
     playback_sleep = 100;
 
-    uBit.display.scroll("SHAKE!", 200);
+    scroller->scroll("SHAKE!", 200);
 
     uBit.accelerometer.setRange(8);
 
@@ -476,7 +460,7 @@ void turn()
         shakeCount = max(shakeCount, 0);
         
         // Display an image matching the shake intensity measured
-        currentFrame = MicroBitImage(shake[shakeCount]);
+        currentFrame = shake[shakeCount].image();
         uBit.display.print(currentFrame);
         if(shakeCount > 0) {
             play_note(basenote + 7*shakeCount);
@@ -491,7 +475,7 @@ void turn()
          timeout += 150;
 
          if(((timeout % 3000) == 0) && !shake_detected) {
-            uBit.display.scroll("SHAKE!", 200);
+            scroller->scroll("SHAKE!", 200);
          }
 
     }
@@ -517,7 +501,7 @@ void insertNewTarget()
  
 void dotChaser()
 {
-    uBit.display.scroll("TILT", 200);
+    scroller->scroll("TILT", 200);
     
     slide = 1;
     int score = 0;
@@ -538,16 +522,15 @@ void dotChaser()
         
         updateAccelPosition();
         
-        uBit.display.image.clear();
-        uBit.display.image.setPixelValue(accelX, accelY, 255);
-        uBit.display.image.setPixelValue(targetX, targetY, toggle);
+        Bitboard player = Bitboard::pixel(accelX, accelY);
+        Bitboard target = Bitboard::pixel(targetX, targetY);
+        (toggle ? player | target : player & ~target).render(uBit.display.image);
         
-        if(targetX == accelX && targetY == accelY) {
+        if(player.collides(target)) {
             play_note(0);
             uBit.sleep(100);
             for(int z = 0; z < 4; z++) {
-                current_freq = 2000;
-                play_note(basenote + 12*z);
+                play_note(basenote + 12*z, 2000);
                 uBit.sleep(100);
             }
             insertNewTarget();
@@ -566,7 +549,7 @@ void dotChaser()
         }
 
         if(timeout > 5000) {
-            uBit.display.scroll("TILT", 200);
+            scroller->scroll("TILT", 200);
             timeout = 0;
         }
         
@@ -579,8 +562,7 @@ void dotChaser()
     play_note(0); 
     // Fade out last dot.
     for(int z = 0; z < 10; z++) {
-           current_freq = 2000;
-           play_note(basenote + 12*(z%5));
+           play_note(basenote + 12*(z%5), 2000);
            uBit.sleep(100);
     }
     play_note(0);
@@ -598,7 +580,6 @@ void dotChaser()
     mode++;
 }
  
-#define SNAKE_EMPTY 0
 #define SNAKE_UP    1
 #define SNAKE_LEFT  2
 #define SNAKE_RIGHT 3
@@ -616,26 +597,32 @@ struct Point
 Point           head;                 // Location of the head of our snake.
 Point           tail;                 // Location of the tail of our snake.
 Point           food;                 // Location of food.
-MicroBitImage   map(5,5);  
+Bitboard        body;                 // Cells occupied by the snake, other than its head.
+Bitboard        trail[2];             // Direction the snake left each body cell in, less one, as two bit planes.
+ 
  
+void set_trail(Point p, int direction)
+{
+    trail[0].set(p.x, p.y, (direction - 1) & 1);
+    trail[1].set(p.x, p.y, (direction - 1) & 2);
+}
+ 
+int get_trail(Point p)
+{
+    return 1 + trail[0].get(p.x, p.y) + 2 * trail[1].get(p.x, p.y);
+}
  
 void place_food()
 {
-    int r = uBit.random(24);
-    int x = 0; int y = 0;
-    
-    while (r > 0)
-    {
-        x = (x+1) % 5;
-        if (x == 0)
-            y = (y+1) % 5;
-            
-        if(map.getPixelValue(x,y) == SNAKE_EMPTY)
-            r--;
-    }
+    // Pick any cell the snake isn't in.
+    Bitboard empty = ~(body | Bitboard::pixel(head.x, head.y));
+    if (empty.isEmpty())
+        return;
+
+    int i = empty.indexOf(uBit.random(empty.count()));
     
-    food.x = x;
-    food.y = y;
+    food.x = i % 5;
+    food.y = i / 5;
 }
  
 void snake()
@@ -651,18 +638,13 @@ void snake()
     head.x = head.y = 2;
     snakeLength = 1;
     growing = 0;
-    map.clear();
-        
-    uBit.display.image.setPixelValue(head.x, head.y, 255);
+    body = Bitboard();
         
     // Add some random food.    
     place_food();
         
     while (1)
     {    
-        // Flash the food is necessary;       
-        uBit.display.image.setPixelValue(food.x, food.y, uBit.systemTime() % 1000 < 500 ? 0 : 255);
-          
         int dx = uBit.accelerometer.getX();
         int dy = uBit.accelerometer.getY();
         
@@ -696,21 +678,20 @@ void snake()
             }
         }           
         
-        int status = map.getPixelValue(newHead.x, newHead.y);
-        if (status == SNAKE_UP || status == SNAKE_DOWN || status == SNAKE_LEFT || status == SNAKE_RIGHT)
+        if (body.get(newHead.x, newHead.y))
         {
             ManagedString s("GAME OVER! SCORE: ");
             ManagedString s2(snakeLength-1);
             
-            uBit.display.scroll(s);
-            uBit.display.scroll(s2);
+            scroller->scroll(s);
+            scroller->scroll(s2);
             
             return;            
         }
                                           
         // move the head.       
-        map.setPixelValue(head.x, head.y, hdirection);
-        uBit.display.image.setPixelValue(newHead.x, newHead.y, 255);
+        body.set(head.x, head.y);
+        set_trail(head, hdirection);
  
         if (growing)
         {
@@ -720,9 +701,8 @@ void snake()
         else
         {        
             // move the tail.
-            tdirection = map.getPixelValue(tail.x,tail.y);     
-            map.setPixelValue(tail.x, tail.y, SNAKE_EMPTY);         
-            uBit.display.image.setPixelValue(tail.x, tail.y, 0);
+            tdirection = get_trail(tail);
+            body.set(tail.x, tail.y, false);
     
             // Move our record of the tail's location.        
             if (snakeLength == 1)
@@ -757,6 +737,12 @@ void snake()
             place_food();
         }
       
+        // Draw the snake, flashing the food.
+        Bitboard frame = body | Bitboard::pixel(head.x, head.y);
+        if (uBit.systemTime() % 1000 >= 500)
+            frame |= Bitboard::pixel(food.x, food.y);
+        frame.render(uBit.display.image);
+      
         uBit.sleep(SNAKE_FRAME_DELAY);   
     }   
 }
@@ -764,11 +750,11 @@ void snake()
 void OOB_onButtonAExtra() {
     uBit.display.stopAnimation();
     for(int i=0; i<10; i++) {
-        currentFrame = MicroBitImage(explosionTime[i]);
+        currentFrame = explosionTime[i].image();
         uBit.display.print(currentFrame,0,0,0,100);
         play_note(basenote + (i * 5)) ;
     }
-    currentFrame = MicroBitImage(heart[0]);     
+    currentFrame = heart[0].image();     
     play_note(0);
     uBit.display.image.clear();
     uBit.display.print(currentFrame,0,0,0,400); 
@@ -778,12 +764,12 @@ void OOB_onButtonAExtra() {
 void OOB_onButtonBExtra() {
     uBit.display.stopAnimation();
     for(int i=0; i<10; i++) {
-        currentFrame = MicroBitImage(twistyTime[i]);
+        currentFrame = twistyTime[i].image();
         uBit.display.print(currentFrame,0,0,0,100);
         play_note(basenote + (9*5) - (i * 5)) ;
     }
     play_note(0);
-    currentFrame = MicroBitImage(heart[0]);     
+    currentFrame = heart[0].image();     
     uBit.display.image.clear();
     uBit.display.print(currentFrame,0,0,0,400); 
     mode++;
@@ -798,14 +784,14 @@ void next()
             uBit.sleep(100);
         }
         play_note(0);
-        uBit.display.scroll("WOW!", 200);
+        scroller->scroll("WOW!", 200);
      }
 
     int nRuns = 0;
     while(!uBit.buttonA.isPressed() && !uBit.buttonB.isPressed() && mode == NEXT){
         for(int i=0; i<10; i++) {
             if(nRuns<3) play_note(basenote + (3 * (i % 4))); 
-            currentFrame = MicroBitImage(twistyTime[i]);
+            currentFrame = twistyTime[i].image();
             uBit.display.print(currentFrame,0,0,0,100);
              if(uBit.buttonA.isPressed() && uBit.buttonB.isPressed()){
                 uBit.display.stopAnimation();
@@ -816,7 +802,7 @@ void next()
         }
          for(int i=0; i<10; i++) {
             if(nRuns<3) play_note(basenote + (5 * (i % 4))); 
-            currentFrame = MicroBitImage(explosionTime[i]);
+            currentFrame = explosionTime[i].image();
             uBit.display.print(currentFrame,0,0,0,100);
            if(uBit.buttonA.isPressed() && uBit.buttonB.isPressed()){
                 uBit.display.stopAnimation();
@@ -826,7 +812,7 @@ void next()
             if(uBit.buttonB.isPressed()) OOB_onButtonBExtra();
         }
         play_note(0); 
-        currentFrame = MicroBitImage(heart[0]);     
+        currentFrame = heart[0].image();     
         uBit.display.print(currentFrame,0,0,0,400); 
         uBit.sleep(100);
         if(uBit.buttonA.isPressed() && uBit.buttonB.isPressed()){
@@ -841,13 +827,13 @@ void next()
 }
 
 void make_noise() {
-    uBit.display.scroll("MAKE NOISE!", 200);
+    scroller->scroll("MAKE NOISE!", 200);
     level_meter();
     mode++;
 }
 
 void clap() {
-    uBit.display.scroll("CLAP!", 200);
+    scroller->scroll("CLAP!", 200);
     mems_clap_test(1);
     mode++;
 }
@@ -860,10 +846,18 @@ void onLogoTouch(MicroBitEvent e) {
 void
 out_of_box_experience_v2()
 {   
-    target_freq = 0;
-    current_freq = 0;
+    if (toneEngine == NULL)
+    {
+        toneEngine = new GlideToneEngine(NRF_PWM2);
+        toneEngine->connectPin(uBit.io.speaker, 0);
+        toneEngine->connectPin(uBit.io.P0, 1);
+    }
+
+    if (animationEngine == NULL)
+        animationEngine = new AnimationEngine(uBit.display);
 
-    create_fiber(playback_ticker);
+    if (scroller == NULL)
+        scroller = new ScrollCache(uBit.display);
    
     /* Disable logo touch to mute
     uBit.io.logo.isTouched();
@@ -921,4 +915,101 @@ out_of_box_experience_v2()
     }      
 }
 
+// ---------------------------
+// Image literal benchmark.
+// Shows every frame of the OOB animations both ways: parsed from the CSV strings the animations used to be held as,
+// and wrapped from the compile time literals they're held as now. Reports the cycles and heap allocations each costs
+// per frame, including the print to the display and the release of the frame afterwards.
+#define OOB_IMAGE_BENCHMARK_ROUNDS              10
+
+struct OOBAnimation {
+    const ImageLiteral<5, 5>    *frames;
+    int                         length;
+};
+
+static const OOBAnimation oobAnimations[] = {
+    { shake, sizeof(shake) / sizeof(shake[0]) },
+    { wakeAnim, sizeof(wakeAnim) / sizeof(wakeAnim[0]) },
+    { explosionTime, sizeof(explosionTime) / sizeof(explosionTime[0]) },
+    { twistyTime, sizeof(twistyTime) / sizeof(twistyTime[0]) },
+    { heart, sizeof(heart) / sizeof(heart[0]) },
+    { arrowDisintegrationTime, sizeof(arrowDisintegrationTime) / sizeof(arrowDisintegrationTime[0]) },
+    { bottomArrow, sizeof(bottomArrow) / sizeof(bottomArrow[0]) },
+    { topArrow, sizeof(topArrow) / sizeof(topArrow[0]) }
+};
+
+// Regenerate the CSV string a frame was written as, so the benchmark parses exactly what the animations used to.
+static void image_literal_to_csv(const ImageLiteral<5, 5> &frame, char *csv)
+{
+    for (int i = 0; i < 25; i++)
+    {
+        int v = frame.data[i];
+
+        if (v >= 100)
+            *csv++ = '0' + v / 100;
+        if (v >= 10)
+            *csv++ = '0' + (v / 10) % 10;
+        *csv++ = '0' + v % 10;
+        *csv++ = (i % 5 == 4) ? '\n' : ',';
+    }
+
+    *csv = 0;
+}
+
+// Heap blocks live in RAM, read-only images in flash.
+static bool image_on_heap(MicroBitImage &image)
+{
+    return (uint32_t)image.getBitmap() >= 0x20000000;
+}
+
+void oob_image_benchmark()
+{
+    char csv[25 * 4 + 1];
+    uint32_t parseCycles = 0, literalCycles = 0;
+    int parseAllocations = 0, literalAllocations = 0;
+    int frames = 0;
+
+    cycle_counter_enable();
+    uBit.display.setBrightness(255);
+
+    for (int round = 0; round < OOB_IMAGE_BENCHMARK_ROUNDS; round++)
+    {
+        for (const OOBAnimation &animation : oobAnimations)
+        {
+            for (int i = 0; i < animation.length; i++)
+            {
+                image_literal_to_csv(animation.frames[i], csv);
+
+                uint32_t start = cycle_counter_read();
+                currentFrame = MicroBitImage(csv);
+                uBit.display.print(currentFrame);
+                parseCycles += cycle_counter_read() - start;
+
+                if (image_on_heap(currentFrame))
+                    parseAllocations++;
+
+                // Release the parsed frame, and charge that to the parse too.
+                start = cycle_counter_read();
+                currentFrame = MicroBitImage();
+                parseCycles += cycle_counter_read() - start;
 
+                start = cycle_counter_read();
+                currentFrame = animation.frames[i].image();
+                uBit.display.print(currentFrame);
+                literalCycles += cycle_counter_read() - start;
+
+                if (image_on_heap(currentFrame))
+                    literalAllocations++;
+
+                frames++;
+            }
+        }
+    }
+
+    DMESG("OOB_IMAGE_BENCHMARK: [FRAMES: %d]", frames);
+    DMESG("   CSV:     %d cycles/frame, %d allocations/frame (x100)", parseCycles / frames, parseAllocations * 100 / frames);
+    DMESG("   LITERAL: %d cycles/frame, %d allocations/frame (x100)", literalCycles / frames, literalAllocations * 100 / frames);
+    DMESG("   SAVED:   %d cycles/frame, %d allocations/frame (x100)", (parseCycles - literalCycles) / frames, (parseAllocations - literalAllocations) * 100 / frames);
+
+    uBit.display.clear();
+}
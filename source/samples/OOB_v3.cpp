@@ -2,6 +2,9 @@
 #include "Synthesizer.h"
 #include "StreamRecording.h"
 #include "LowPassFilter.h"
+#include "MelodyPlayer.h"
+#include "FrameBuffer.h"
+#include "SensingDisplay.h"
 #include "Tests.h"
 
 const char * const heart =
@@ -68,14 +71,13 @@ const char * const moon =
     "000,000,255,255,000\n";
 static const MicroBitImage MOON(moon);
 
-// MakeCode melodies in the format NOTE[octave][:duration]
-static const int DEFAULT_TEMPO_BPM = 120;
-static const int MS_PER_BPM = (60000 / DEFAULT_TEMPO_BPM) / 4;
-static const int NOTE_LEN = 6;
-#define TUNE_LEN(tune) (sizeof(tune) / sizeof(tune[0]))
+// MakeCode melodies in the format NOTE[octave][:duration], compiled into note tables at build time
+static constexpr auto MELODY_POWER_UP = MELODY("G4:1 C5 E G:2 E:1 G:3");
+static constexpr auto MELODY_POWER_DOWN = MELODY("G5:1 D# C G4:2 B5:1 C:3");
 
-static const char MELODY_POWER_UP[][NOTE_LEN] = {"G4:1", "C5", "E", "G:2", "E:1", "G:3"};
-static const char MELODY_POWER_DOWN[][NOTE_LEN] = {"G5:1", "D#", "C", "G4:2", "B5:1", "C:3"};
+static MelodyPlayer *melodyPlayer = NULL;
+static FrameBuffer *frameBuffer = NULL;
+static SensingDisplay *sensingDisplay = NULL;
 
 
 /**
@@ -90,91 +92,24 @@ static const char MELODY_POWER_DOWN[][NOTE_LEN] = {"G5:1", "D#", "C", "G4:2", "B
  * @param high - Maximum value.
  */
 static void plotBarGraph(uint32_t value, int high) {
+    MicroBitImage &frame = frameBuffer->image();
     float v = (float)value / (float)high;
     float dv = 1.0 / 16.0;
     float k = 0;
     for (int y = 4; y >= 0; --y) {
         for (int x = 0; x < 3; ++x) {
             if (k > v) {
-                uBit.display.image.setPixelValue(2 - x, y, 0);
-                uBit.display.image.setPixelValue(2 + x, y, 0);
+                frame.setPixelValue(2 - x, y, 0);
+                frame.setPixelValue(2 + x, y, 0);
             } else {
-                uBit.display.image.setPixelValue(2 - x, y, 255);
-                uBit.display.image.setPixelValue(2 + x, y, 255);
+                frame.setPixelValue(2 - x, y, 255);
+                frame.setPixelValue(2 + x, y, 255);
             }
             k += dv;
         }
     }
-}
-
-static void playMelody(const char melody[][NOTE_LEN], size_t len) {
-    DMESG("Tune len: %d", len);
-
-    // Starting from default values, optional octave & duration values are remembered
-    int octave = 4;
-    int durationMs = 4 * MS_PER_BPM;
-
-    for (size_t i = 0; i < len; i++) {
-        const char *note = melody[i];
-        const char *note_char = &melody[i][0];
-        int distanceFromA = 0;
-        int frequency = 0;
-        bool rest = false;
-
-        // First process the note, as its distance from A
-        switch (*note_char) {
-            case 'A': distanceFromA = 0; break;
-            case 'B': distanceFromA = 2; break;
-            case 'C': distanceFromA = -9; break;
-            case 'D': distanceFromA = -7; break;
-            case 'E': distanceFromA = -5; break;
-            case 'F': distanceFromA = -4; break;
-            case 'G': distanceFromA = -2; break;
-            case 'R': rest = true; break;
-            default: target_panic(123); break;
-        }
-
-        // Then process the optional #/b modifiers and/or scale
-        note_char++;
-        while (*note_char != ':' && *note_char != '\0') {
-            if (*note_char == '#') {
-                distanceFromA++;
-            } else if (*note_char == 'b') {
-                distanceFromA--;
-            } else if ((*note_char >= '0') && (*note_char <= '9')) {
-                octave = (*note_char - '0');
-            } else {
-                target_panic(124);
-            }
-            note_char++;
-        }
-
-        // If an optional duration is present, calculate the delay in ms
-        // Note, only a single digit implemented right now
-        if (*note_char == ':') {
-            note_char++;
-            if ((*note_char < '0') || (*note_char > '9'))  target_panic(125);
-            durationMs = atoi((const char*)note_char) * MS_PER_BPM;
-        }
-
-        // Calculate note frequency, or keep it as zero for a rest
-        if (!rest) {
-            float distanceFromA4 = (octave - 4) * 12 + distanceFromA;
-            frequency = 440.0 * pow(2, distanceFromA4 / 12.0);
-        }
-
-        // Play the tone/rest for the calculated duration
-        DMESG("%s -> f:%u, ms:%d", note, frequency, durationMs);
-        if (frequency) {
-            uBit.audio.virtualOutputPin.setAnalogPeriodUs(1000000 / frequency);
-            uBit.audio.virtualOutputPin.setAnalogValue(127);
-        }
-        uBit.sleep(durationMs);
-        uBit.audio.virtualOutputPin.setAnalogValue(0);
-
-        // Short break between notes
-        uBit.sleep(10);
-    }
+    // Show the whole frame at once, and wait until the back buffer is free to draw the next.
+    frameBuffer->swap();
 }
 
 static void onButtonA(MicroBitEvent) {
@@ -192,17 +127,17 @@ static void onButtonB(MicroBitEvent) {
 static void onButtonAB(MicroBitEvent) {
     DMESG("Button A+B");
 
-    int lightLevel = uBit.display.readLightLevel();
+    // A fresh reading from the sensing display, which blanks the LEDs for a single sensing slot, rather than switching
+    // the display into its light sensing mode and back.
+    int lightLevel = sensingDisplay->senseLightLevel();
     DMESG("Light level: %d", lightLevel);
-    // Reset display mode to disable light level reading & avoid LED flicker
-    uBit.display.setDisplayMode(DisplayMode::DISPLAY_MODE_BLACK_AND_WHITE);
 
     if (lightLevel > 50) {
         uBit.display.print(SUN);
-        playMelody(MELODY_POWER_UP, TUNE_LEN(MELODY_POWER_UP));
+        melodyPlayer->play(MELODY_POWER_UP);
     } else {
         uBit.display.print(MOON);
-        playMelody(MELODY_POWER_DOWN, TUNE_LEN(MELODY_POWER_DOWN));
+        melodyPlayer->play(MELODY_POWER_DOWN);
     }
 }
 
@@ -235,7 +170,6 @@ static void onButtonLogo(MicroBitEvent) {
         int audioLevel = (int)uBit.audio.levelSPL->getValue();
         DMESG("Audio level: %d", audioLevel);
         plotBarGraph(audioLevel, 255);
-        uBit.sleep(5);
     }
     // At this point either the logo has been released or the recording is done
     recording->stop();
@@ -303,6 +237,14 @@ static void onStart() {
 }
 
 void out_of_box_experience() {
+    melodyPlayer = new MelodyPlayer(uBit.audio.virtualOutputPin);
+    frameBuffer = new FrameBuffer(uBit.display);
+
+    // Refresh the display on TIMER0, so the logo can still sense touch, and only sense light when A+B is pressed.
+    sensingDisplay = new SensingDisplay(uBit.display);
+    sensingDisplay->setLightSensing(SENSING_DISPLAY_DEFAULT_TIMEOUT_US, 0);
+    sensingDisplay->enable();
+
     uBit.messageBus.listen(MICROBIT_ID_BUTTON_A, MICROBIT_BUTTON_EVT_CLICK, onButtonA);
     uBit.messageBus.listen(MICROBIT_ID_BUTTON_B, MICROBIT_BUTTON_EVT_CLICK, onButtonB);
     uBit.messageBus.listen(MICROBIT_ID_BUTTON_AB, MICROBIT_BUTTON_EVT_CLICK, onButtonAB);
@@ -0,0 +1,166 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PinGroup.h"
+
+/**
+ * Creates a pin group, taking over its pins. Every pin is left as an input, and must not be used through
+ * NRF52Pin or by any other peripheral from then on.
+ * @param pins the pins in the group.
+ * @param count the number of pins, up to 32.
+ * @param pull the pull on every pin, which applies while it's an input. The default leaves them high impedance.
+ */
+PinGroup::PinGroup(NRF52Pin *const *pins, int count, PullMode pull)
+{
+    uint32_t pullBits = GPIO_PIN_CNF_PULL_Disabled;
+
+    if (pull == PullMode::Up)
+        pullBits = GPIO_PIN_CNF_PULL_Pullup;
+    else if (pull == PullMode::Down)
+        pullBits = GPIO_PIN_CNF_PULL_Pulldown;
+
+    this->count = min(count, PIN_GROUP_MAX_PINS);
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        mask[p] = 0;
+
+    for (int i = 0; i < this->count; i++)
+    {
+        // Let CODAL release the pin from anything else, then configure it ourselves, replacing the pull CODAL may have
+        // left on it. From then on we only touch the port's OUT and DIR registers.
+        pins[i]->getDigitalValue();
+
+        port[i] = pins[i]->name >> 5;
+        bit[i] = pins[i]->name & 31;
+        mask[port[i]] |= 1UL << bit[i];
+
+        gpio(port[i])->PIN_CNF[bit[i]] = (GPIO_PIN_CNF_DIR_Input << GPIO_PIN_CNF_DIR_Pos) |
+                                         (GPIO_PIN_CNF_INPUT_Connect << GPIO_PIN_CNF_INPUT_Pos) |
+                                         (pullBits << GPIO_PIN_CNF_PULL_Pos) |
+                                         (GPIO_PIN_CNF_DRIVE_S0S1 << GPIO_PIN_CNF_DRIVE_Pos) |
+                                         (GPIO_PIN_CNF_SENSE_Disabled << GPIO_PIN_CNF_SENSE_Pos);
+    }
+}
+
+/**
+ * Compiles the given levels for the group, so that they can be applied with write(const PinGroupState &).
+ * @param value the level of each pin, with bit i for the i'th pin.
+ */
+PinGroupState PinGroup::compile(uint32_t value) const
+{
+    PinGroupState state;
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        state.set[p] = 0;
+
+    for (int i = 0; i < count; i++)
+        if (value & (1UL << i))
+            state.set[port[i]] |= 1UL << bit[i];
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        state.clr[p] = mask[p] & ~state.set[p];
+
+    return state;
+}
+
+/**
+ * Sets the level of every pin in the group.
+ * @param value the level of each pin, with bit i for the i'th pin.
+ */
+void PinGroup::write(uint32_t value) const
+{
+    write(compile(value));
+}
+
+/**
+ * Reads the level of every pin in the group.
+ * @return the level of each pin, with bit i for the i'th pin.
+ */
+uint32_t PinGroup::read() const
+{
+    uint32_t in[PIN_GROUP_PORTS];
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        in[p] = mask[p] ? gpio(p)->IN : 0;
+
+    return decode(in);
+}
+
+/**
+ * Converts raw port input values into the levels of the pins in the group, so that ports can be read (or
+ * sampled) first and decoded later.
+ * @param in the value of each port's IN register.
+ * @return the level of each pin, with bit i for the i'th pin.
+ */
+uint32_t PinGroup::decode(const uint32_t *in) const
+{
+    uint32_t value = 0;
+
+    for (int i = 0; i < count; i++)
+        if (in[port[i]] & (1UL << bit[i]))
+            value |= 1UL << i;
+
+    return value;
+}
+
+/**
+ * Makes some pins of the group outputs, and the rest inputs.
+ * Each port's DIR register is written once, so the group's pins on a port all change direction together.
+ * @param outputs a bit for each pin that should be an output, with bit i for the i'th pin.
+ */
+void PinGroup::setDirection(uint32_t outputs) const
+{
+    PinGroupState state = compile(outputs);
+
+    // DIR is read, modified and written back, so interrupts are held off to stop anything else on the port changing
+    // direction in between and being overwritten.
+    target_disable_irq();
+
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        if (mask[p])
+            gpio(p)->DIR = (gpio(p)->DIR & ~mask[p]) | state.set[p];
+
+    target_enable_irq();
+}
+
+/**
+ * Makes every pin in the group an output.
+ */
+void PinGroup::output() const
+{
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        if (mask[p])
+            gpio(p)->DIRSET = mask[p];
+}
+
+/**
+ * Makes every pin in the group an input. Unless the group was created with a pull, they are high impedance.
+ */
+void PinGroup::input() const
+{
+    for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        if (mask[p])
+            gpio(p)->DIRCLR = mask[p];
+}
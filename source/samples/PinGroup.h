@@ -0,0 +1,161 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+
+#ifndef PIN_GROUP_H
+#define PIN_GROUP_H
+
+#define PIN_GROUP_MAX_PINS                      32
+#define PIN_GROUP_PORTS                         2
+
+/**
+ * Levels for a pin group, compiled into the masks written to each port's OUTSET and OUTCLR registers.
+ */
+struct PinGroupState
+{
+    uint32_t    set[PIN_GROUP_PORTS];
+    uint32_t    clr[PIN_GROUP_PORTS];
+};
+
+/**
+ * A set of GPIO pins that are read, written and switched between input and output together.
+ *
+ * The pins are compiled into a mask for each GPIO port, so a write is one OUTSET and one OUTCLR register write per
+ * port, and a direction change one DIR write per port. Writing a group of N pins through NRF52Pin would take N
+ * calls, each with its own mode checks. The level writes are separate stores, though: the pins going high
+ * change together, then a cycle or two later the pins going low, then the same for port 1. Anything that must never
+ * see a mix of old and new levels has to allow for that.
+ *
+ * The group owns its pins outright. The constructor configures each pin itself (as an input, with no pull unless one
+ * is asked for), and from then on only the port registers are used. CODAL is not told: NRF52Pin still believes each pin
+ * is the input it was before, so the pins must not be used through NRF52Pin, or by any other peripheral, while the
+ * group is in use.
+ *
+ * Bit i of any value read or written corresponds to the i'th pin given when the group was created.
+ */
+class PinGroup
+{
+    int         count;
+    uint8_t     port[PIN_GROUP_MAX_PINS];
+    uint8_t     bit[PIN_GROUP_MAX_PINS];
+    uint32_t    mask[PIN_GROUP_PORTS];
+
+    /**
+     * The registers of the given GPIO port.
+     */
+    static NRF_GPIO_Type *gpio(int port)
+    {
+        return port ? NRF_P1 : NRF_P0;
+    }
+
+    public:
+    /**
+     * Creates a pin group, taking over its pins. Every pin is left as an input, and must not be used through
+     * NRF52Pin or by any other peripheral from then on.
+     * @param pins the pins in the group.
+     * @param count the number of pins, up to 32.
+     * @param pull the pull on every pin, which applies while it's an input. The default leaves them high impedance.
+     */
+    PinGroup(NRF52Pin *const *pins, int count, PullMode pull = PullMode::None);
+
+    /**
+     * Compiles the given levels for the group, so that they can be applied with write(const PinGroupState &).
+     * @param value the level of each pin, with bit i for the i'th pin.
+     */
+    PinGroupState compile(uint32_t value) const;
+
+    /**
+     * Applies levels compiled by compile(). Pins that are currently inputs take the level when next made outputs.
+     */
+    void write(const PinGroupState &state) const
+    {
+        for (int p = 0; p < PIN_GROUP_PORTS; p++)
+        {
+            if (mask[p])
+            {
+                gpio(p)->OUTSET = state.set[p];
+                gpio(p)->OUTCLR = state.clr[p];
+            }
+        }
+    }
+
+    /**
+     * Sets the level of every pin in the group.
+     * @param value the level of each pin, with bit i for the i'th pin.
+     */
+    void write(uint32_t value) const;
+
+    /**
+     * Reads the level of every pin in the group.
+     * @return the level of each pin, with bit i for the i'th pin.
+     */
+    uint32_t read() const;
+
+    /**
+     * Converts raw port input values into the levels of the pins in the group, so that ports can be read (or
+     * sampled) first and decoded later.
+     * @param in the value of each port's IN register.
+     * @return the level of each pin, with bit i for the i'th pin.
+     */
+    uint32_t decode(const uint32_t *in) const;
+
+    /**
+     * The pins of the group on the given GPIO port.
+     * @param port the port, 0 or 1.
+     * @return a bit for each pin in the group, at its position in the port's registers.
+     */
+    uint32_t getMask(int port) const
+    {
+        return mask[port];
+    }
+
+    /**
+     * Makes some pins of the group outputs, and the rest inputs. The pins on each port change direction together, with
+     * port 0 switched just before port 1.
+     * @param outputs a bit for each pin that should be an output, with bit i for the i'th pin.
+     */
+    void setDirection(uint32_t outputs) const;
+
+    /**
+     * Makes every pin in the group an output.
+     */
+    void output() const;
+
+    /**
+     * Makes every pin in the group an input. Unless the group was created with a pull, they are high impedance.
+     */
+    void input() const;
+
+    /**
+     * The number of pins in the group.
+     */
+    int size() const
+    {
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,387 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PulseMeter.h"
+#include "Tests.h"
+
+/**
+ * Creates a pulse meter.
+ * @param pin the pin to measure. It's made a digital input, keeping any pull already set.
+ * @param clock the timer used to time edges, which must not be shared.
+ * @param counter the timer used to count edges, which must not be shared.
+ * @param gpioteChannel the GPIOTE channel to use.
+ * @param ppiChannel the first of four consecutive PPI channels to use.
+ * @param ppiGroup the first of two consecutive PPI channel groups to use.
+ * @param id the ID to use for events raised by this component.
+ */
+PulseMeter::PulseMeter(NRF52Pin &pin, NRF_TIMER_Type *clock, NRF_TIMER_Type *counter, int gpioteChannel, int ppiChannel, int ppiGroup, uint16_t id) : pin(pin)
+{
+    this->downstream = NULL;
+    this->clock = clock;
+    this->counter = counter;
+    this->id = id;
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->ppiGroup = ppiGroup;
+    this->gateMs = PULSE_METER_DEFAULT_GATE_MS;
+    this->timeoutMs = PULSE_METER_DEFAULT_TIMEOUT_MS;
+    this->running = false;
+    this->initialLevel = 0;
+    this->referenced = false;
+
+    for (int i = 0; i < PULSE_METER_CHANNELS; i++)
+        value[i] = 0;
+
+    resetStatistics();
+
+    uBit.messageBus.listen(id, PULSE_METER_EVT_GATE, this, &PulseMeter::onGate, MESSAGE_BUS_LISTENER_IMMEDIATE);
+}
+
+/**
+ * Gate event handler, which takes a measurement from the hardware.
+ */
+void PulseMeter::onGate(MicroBitEvent)
+{
+    if (!running)
+        return;
+
+    uint32_t count, odd, even, now;
+
+    // The edge times only belong with the count if no edge arrived while they were read.
+    do
+    {
+        counter->TASKS_CAPTURE[0] = 1;
+        count = counter->CC[0];
+        odd = clock->CC[PULSE_METER_ODD_CC];
+        even = clock->CC[PULSE_METER_EVEN_CC];
+        clock->TASKS_CAPTURE[PULSE_METER_NOW_CC] = 1;
+        now = clock->CC[PULSE_METER_NOW_CC];
+        counter->TASKS_CAPTURE[0] = 1;
+    } while (counter->CC[0] != count);
+
+    // Odd edges take the pin away from its starting level, so they rise if it started low.
+    uint32_t rising = initialLevel ? count / 2 : (count + 1) / 2;
+    uint32_t riseTime = initialLevel ? even : odd;
+    uint32_t fallTime = initialLevel ? odd : even;
+    int level = initialLevel ^ (count & 1);
+
+    uint32_t timeout = (uint32_t)timeoutMs * (PULSE_METER_CLOCK_HZ / 1000);
+
+    if (referenced && rising != referenceCount)
+    {
+        uint32_t periods = rising - referenceCount;
+        uint32_t ticks = riseTime - referenceTime;
+
+        value[PULSE_METER_FREQUENCY] = (uint32_t)((uint64_t)periods * PULSE_METER_CLOCK_HZ * 1000 / ticks);
+        value[PULSE_METER_PERIOD] = (uint32_t)((uint64_t)ticks * 1000000000 / PULSE_METER_CLOCK_HZ / periods);
+
+        // The latest whole high or low phase, as a fraction of the average period. There's been a falling edge, as
+        // there have been two rising edges.
+        uint64_t scale = (uint64_t)periods * PULSE_METER_DUTY_SCALE;
+        uint64_t duty;
+
+        if ((int32_t)(fallTime - riseTime) > 0)
+            duty = (fallTime - riseTime) * scale / ticks;
+        else
+            duty = PULSE_METER_DUTY_SCALE - min((uint64_t)PULSE_METER_DUTY_SCALE, (riseTime - fallTime) * scale / ticks);
+
+        value[PULSE_METER_DUTY] = (uint32_t)min(duty, (uint64_t)PULSE_METER_DUTY_SCALE);
+    }
+    else if (!referenced || now - referenceTime > timeout)
+    {
+        // No signal, or not yet two rising edges to measure between.
+        if (referenced)
+            timeouts++;
+
+        referenced = false;
+        value[PULSE_METER_FREQUENCY] = 0;
+        value[PULSE_METER_PERIOD] = 0;
+        value[PULSE_METER_DUTY] = level ? PULSE_METER_DUTY_SCALE : 0;
+    }
+
+    // Measure the next gate from the latest rising edge, unless it's too old to belong to the signal now.
+    if (rising && (referenced ? rising != referenceCount : now - riseTime <= timeout))
+    {
+        referenced = true;
+        referenceCount = rising;
+        referenceTime = riseTime;
+    }
+
+    gates++;
+    edgeCount = count;
+
+    if (downstream)
+        downstream->pullRequest();
+
+    Event(id, PULSE_METER_EVT_DATA_READY);
+}
+
+/**
+ * Begins measuring.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int PulseMeter::start()
+{
+    if (running)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel >= 8 || ppiChannel < 0 || ppiChannel + 4 > 20 || ppiGroup < 0 || ppiGroup + 2 > 6)
+        return DEVICE_INVALID_PARAMETER;
+
+    int oddGroup = ppiGroup;
+    int evenGroup = ppiGroup + 1;
+
+    initialLevel = pin.getDigitalValue();
+
+    clock->TASKS_STOP = 1;
+    clock->TASKS_CLEAR = 1;
+    clock->MODE = TIMER_MODE_MODE_Timer;
+    clock->BITMODE = TIMER_BITMODE_BITMODE_32Bit;
+    clock->PRESCALER = 0;
+    clock->SHORTS = 0;
+    clock->INTENCLR = 0xFFFFFFFF;
+
+    counter->TASKS_STOP = 1;
+    counter->TASKS_CLEAR = 1;
+    counter->MODE = TIMER_MODE_MODE_Counter;
+    counter->BITMODE = TIMER_BITMODE_BITMODE_32Bit;
+    counter->SHORTS = 0;
+    counter->INTENCLR = 0xFFFFFFFF;
+
+    NRF_GPIOTE->EVENTS_IN[gpioteChannel] = 0;
+    NRF_GPIOTE->CONFIG[gpioteChannel] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                        (pin.name << GPIOTE_CONFIG_PSEL_Pos) |
+                                        (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos);
+
+    // Every edge triggers all four channels, but only the two in the group enabled at the time act on it: one captures
+    // the clock and hands over to the other group, the other disables its own group and counts the edge. The groups
+    // only change after the edge that changed them, so each edge is seen by exactly one.
+    for (int i = 0; i < 4; i++)
+        NRF_PPI->CH[ppiChannel + i].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[gpioteChannel];
+
+    NRF_PPI->CH[ppiChannel].TEP = (uint32_t) &clock->TASKS_CAPTURE[PULSE_METER_ODD_CC];
+    NRF_PPI->FORK[ppiChannel].TEP = (uint32_t) &NRF_PPI->TASKS_CHG[evenGroup].EN;
+    NRF_PPI->CH[ppiChannel + 1].TEP = (uint32_t) &NRF_PPI->TASKS_CHG[oddGroup].DIS;
+    NRF_PPI->FORK[ppiChannel + 1].TEP = (uint32_t) &counter->TASKS_COUNT;
+
+    NRF_PPI->CH[ppiChannel + 2].TEP = (uint32_t) &clock->TASKS_CAPTURE[PULSE_METER_EVEN_CC];
+    NRF_PPI->FORK[ppiChannel + 2].TEP = (uint32_t) &NRF_PPI->TASKS_CHG[oddGroup].EN;
+    NRF_PPI->CH[ppiChannel + 3].TEP = (uint32_t) &NRF_PPI->TASKS_CHG[evenGroup].DIS;
+    NRF_PPI->FORK[ppiChannel + 3].TEP = (uint32_t) &counter->TASKS_COUNT;
+
+    NRF_PPI->CHG[oddGroup] = 3 << ppiChannel;
+    NRF_PPI->CHG[evenGroup] = 3 << (ppiChannel + 2);
+
+    // The first edge is odd.
+    NRF_PPI->CHENCLR = 3 << (ppiChannel + 2);
+    NRF_PPI->CHENSET = 3 << ppiChannel;
+
+    clock->TASKS_START = 1;
+    counter->TASKS_START = 1;
+
+    referenced = false;
+    value[PULSE_METER_FREQUENCY] = 0;
+    value[PULSE_METER_PERIOD] = 0;
+    value[PULSE_METER_DUTY] = initialLevel ? PULSE_METER_DUTY_SCALE : 0;
+
+    running = true;
+    system_timer_event_every_us(gateMs * 1000, id, PULSE_METER_EVT_GATE);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops measuring.
+ */
+void PulseMeter::stop()
+{
+    if (!running)
+        return;
+
+    system_timer_cancel_event(id, PULSE_METER_EVT_GATE);
+
+    running = false;
+
+    NRF_PPI->CHENCLR = 15 << ppiChannel;
+    NRF_PPI->CHG[ppiGroup] = 0;
+    NRF_PPI->CHG[ppiGroup + 1] = 0;
+
+    for (int i = 0; i < 4; i++)
+        NRF_PPI->FORK[ppiChannel + i].TEP = 0;
+
+    NRF_GPIOTE->CONFIG[gpioteChannel] = 0;
+
+    clock->TASKS_STOP = 1;
+    counter->TASKS_STOP = 1;
+}
+
+/**
+ * Determines if the meter is measuring.
+ */
+bool PulseMeter::isRunning()
+{
+    return running;
+}
+
+/**
+ * Defines how often a measurement is taken, and how long without a rising edge before the signal is taken to have
+ * stopped.
+ * @param gateMs the time between measurements, in milliseconds.
+ * @param timeoutMs the time without a rising edge after which the frequency is 0, from gateMs to
+ * PULSE_METER_MAX_TIMEOUT_MS.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int PulseMeter::setGateTime(int gateMs, int timeoutMs)
+{
+    if (gateMs <= 0 || timeoutMs < gateMs || timeoutMs > PULSE_METER_MAX_TIMEOUT_MS)
+        return DEVICE_INVALID_PARAMETER;
+
+    bool wasRunning = running;
+
+    stop();
+    this->gateMs = gateMs;
+    this->timeoutMs = timeoutMs;
+
+    if (wasRunning)
+        start();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the frequency of the signal at the last measurement.
+ * @return the frequency in Hz, or 0 if there is no signal.
+ */
+float PulseMeter::getFrequency()
+{
+    return value[PULSE_METER_FREQUENCY] / 1000.0f;
+}
+
+/**
+ * Determines the period of the signal at the last measurement.
+ * @return the period in microseconds, or 0 if there is no signal.
+ */
+float PulseMeter::getPeriod()
+{
+    return value[PULSE_METER_PERIOD] / 1000.0f;
+}
+
+/**
+ * Determines the duty cycle of the signal at the last measurement.
+ * @return the time high as a percentage of the period. With no signal, 100 if the pin is high and 0 if it's low.
+ */
+float PulseMeter::getDutyCycle()
+{
+    return value[PULSE_METER_DUTY] * 100.0f / PULSE_METER_DUTY_SCALE;
+}
+
+/**
+ * Provide the last measurement taken to our downstream caller.
+ */
+ManagedBuffer PulseMeter::pull()
+{
+    ManagedBuffer buffer(sizeof(value));
+
+    target_disable_irq();
+    memcpy(&buffer[0], value, sizeof(value));
+    target_enable_irq();
+
+    return buffer;
+}
+
+/**
+ * Define a downstream component for data stream.
+ * @sink The component that data will be delivered to, when it is available
+ */
+void PulseMeter::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+/**
+ * Determines if this source is connected to a downstream component.
+ */
+bool PulseMeter::isConnected()
+{
+    return downstream != NULL;
+}
+
+/**
+ * Disconnect any downstream component.
+ */
+void PulseMeter::disconnect()
+{
+    downstream = NULL;
+}
+
+/**
+ * Determine the data format of the buffers streamed out of this component.
+ */
+int PulseMeter::getFormat()
+{
+    return DATASTREAM_FORMAT_32BIT_UNSIGNED;
+}
+
+/**
+ * Defines the data format of the buffers streamed out of this component.
+ * @param format DATASTREAM_FORMAT_32BIT_UNSIGNED.
+ * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+ */
+int PulseMeter::setFormat(int format)
+{
+    return format == DATASTREAM_FORMAT_32BIT_UNSIGNED ? DEVICE_OK : DEVICE_NOT_SUPPORTED;
+}
+
+/**
+ * Determine the rate at which samples are streamed out of this component.
+ */
+float PulseMeter::getSampleRate()
+{
+    return 1000.0f / gateMs;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void PulseMeter::resetStatistics()
+{
+    gates = 0;
+    edgeCount = 0;
+    timeouts = 0;
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void PulseMeter::printStatistics()
+{
+    DMESG("PULSE_METER: [GATE: %d ms] [TIMEOUT: %d ms]", gateMs, timeoutMs);
+    DMESG("   GATES: %d", gates);
+    DMESG("   EDGES: %d", edgeCount);
+    DMESG("   TIMEOUTS: %d", timeouts);
+    DMESG("   FREQUENCY: %d mHz", value[PULSE_METER_FREQUENCY]);
+    DMESG("   PERIOD: %d ns", value[PULSE_METER_PERIOD]);
+    DMESG("   DUTY: %d.%02d %%", value[PULSE_METER_DUTY] / 100, value[PULSE_METER_DUTY] % 100);
+}
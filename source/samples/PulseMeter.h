@@ -0,0 +1,219 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef PULSE_METER_H
+#define PULSE_METER_H
+
+#define PULSE_METER_ID                          3107
+
+#define PULSE_METER_EVT_GATE                    1
+#define PULSE_METER_EVT_DATA_READY              2
+
+#define PULSE_METER_CLOCK_HZ                    16000000
+
+// Update every 100ms, and report no signal once there's been no rising edge for a second.
+#define PULSE_METER_DEFAULT_GATE_MS             100
+#define PULSE_METER_DEFAULT_TIMEOUT_MS          1000
+#define PULSE_METER_MAX_TIMEOUT_MS              10000
+
+// Each buffer streamed holds the frequency in mHz, the period in ns and the duty cycle in hundredths of a percent.
+#define PULSE_METER_CHANNELS                    3
+#define PULSE_METER_FREQUENCY                   0
+#define PULSE_METER_PERIOD                      1
+#define PULSE_METER_DUTY                        2
+#define PULSE_METER_DUTY_SCALE                  10000
+
+// Capture registers of the clock timer.
+#define PULSE_METER_ODD_CC                      1
+#define PULSE_METER_EVEN_CC                     2
+#define PULSE_METER_NOW_CC                      3
+
+// Default peripheral resources. One GPIOTE channel, four consecutive PPI channels and two consecutive PPI channel
+// groups. The PPI channels are clear of GreyscaleMatrix (0 to 9), the only other sample that can run alongside, as the
+// rest all need TIMER0 or TIMER3 too.
+#define PULSE_METER_DEFAULT_GPIOTE              5
+#define PULSE_METER_DEFAULT_PPI                 10
+#define PULSE_METER_DEFAULT_PPI_GROUP           0
+
+/**
+ * A DataSource that measures the frequency, period and duty cycle of a digital signal on a pin, without any work by
+ * the CPU on each edge.
+ *
+ * The pin's GPIOTE channel, in toggle mode, counts every edge on a TIMER in counter mode, and captures a free running
+ * 16MHz clock TIMER. The capture alternates between two registers on odd and even edges, by way of two PPI channel
+ * groups that take turns: the group enabled on an edge captures into its register, disables itself and enables the
+ * other. So the time of the latest rising edge and the latest falling edge are always held by the hardware, along with
+ * the number of edges.
+ *
+ * The clock defaults to TIMER3, which CODAL otherwise uses for capacitive touch, so touch sensing can't be used at the
+ * same time. The counter defaults to TIMER0, which is free unless BLE is enabled, when the SoftDevice owns it.
+ *
+ * Once per gate time (driven by the system timer) all three are read together, and the frequency found by reciprocal
+ * counting: the rising edges since the last gate over the time between the last rising edge of each gate. This is as
+ * accurate at 1Hz as at 1MHz, rather than being limited to one count in the gate. The duty cycle is the latest high or
+ * low phase, over that average period.
+ */
+class PulseMeter : public DataSource
+{
+    DataSink        *downstream;
+    NRF52Pin        &pin;
+    NRF_TIMER_Type  *clock;
+    NRF_TIMER_Type  *counter;
+    uint16_t        id;
+    int             gpioteChannel;
+    int             ppiChannel;
+    int             ppiGroup;
+    int             gateMs;
+    int             timeoutMs;
+    bool            running;
+    int             initialLevel;           // The level of the pin when started, which tells odd edges from even.
+
+    // The reference for reciprocal counting: the last rising edge seen at a previous gate.
+    bool            referenced;
+    uint32_t        referenceCount;
+    uint32_t        referenceTime;
+
+    uint32_t        value[PULSE_METER_CHANNELS];
+
+    uint32_t        gates;
+    uint32_t        edgeCount;
+    uint32_t        timeouts;
+
+    /**
+     * Gate event handler, which takes a measurement from the hardware.
+     */
+    void onGate(MicroBitEvent);
+
+    public:
+    /**
+     * Creates a pulse meter.
+     * @param pin the pin to measure. It's made a digital input, keeping any pull already set.
+     * @param clock the timer used to time edges, which must not be shared.
+     * @param counter the timer used to count edges, which must not be shared.
+     * @param gpioteChannel the GPIOTE channel to use.
+     * @param ppiChannel the first of four consecutive PPI channels to use.
+     * @param ppiGroup the first of two consecutive PPI channel groups to use.
+     * @param id the ID to use for events raised by this component.
+     */
+    PulseMeter(NRF52Pin &pin, NRF_TIMER_Type *clock = NRF_TIMER3, NRF_TIMER_Type *counter = NRF_TIMER0, int gpioteChannel = PULSE_METER_DEFAULT_GPIOTE, int ppiChannel = PULSE_METER_DEFAULT_PPI, int ppiGroup = PULSE_METER_DEFAULT_PPI_GROUP, uint16_t id = PULSE_METER_ID);
+
+    /**
+     * Begins measuring.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int start();
+
+    /**
+     * Stops measuring.
+     */
+    void stop();
+
+    /**
+     * Determines if the meter is measuring.
+     */
+    bool isRunning();
+
+    /**
+     * Defines how often a measurement is taken, and how long without a rising edge before the signal is taken to have
+     * stopped.
+     * @param gateMs the time between measurements, in milliseconds.
+     * @param timeoutMs the time without a rising edge after which the frequency is 0, from gateMs to
+     * PULSE_METER_MAX_TIMEOUT_MS.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setGateTime(int gateMs, int timeoutMs = PULSE_METER_DEFAULT_TIMEOUT_MS);
+
+    /**
+     * Determines the frequency of the signal at the last measurement.
+     * @return the frequency in Hz, or 0 if there is no signal.
+     */
+    float getFrequency();
+
+    /**
+     * Determines the period of the signal at the last measurement.
+     * @return the period in microseconds, or 0 if there is no signal.
+     */
+    float getPeriod();
+
+    /**
+     * Determines the duty cycle of the signal at the last measurement.
+     * @return the time high as a percentage of the period. With no signal, 100 if the pin is high and 0 if it's low.
+     */
+    float getDutyCycle();
+
+    /**
+     * Provide the last measurement taken to our downstream caller.
+     */
+    virtual ManagedBuffer pull();
+
+    /**
+     * Define a downstream component for data stream.
+     * @sink The component that data will be delivered to, when it is available
+     */
+    virtual void connect(DataSink &sink);
+
+    /**
+     * Determines if this source is connected to a downstream component.
+     */
+    virtual bool isConnected();
+
+    /**
+     * Disconnect any downstream component.
+     */
+    virtual void disconnect();
+
+    /**
+     * Determine the data format of the buffers streamed out of this component.
+     */
+    virtual int getFormat();
+
+    /**
+     * Defines the data format of the buffers streamed out of this component.
+     * @param format DATASTREAM_FORMAT_32BIT_UNSIGNED.
+     * @return DEVICE_OK on success, or DEVICE_NOT_SUPPORTED for any other format.
+     */
+    virtual int setFormat(int format);
+
+    /**
+     * Determine the rate at which samples are streamed out of this component.
+     */
+    virtual float getSampleRate();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
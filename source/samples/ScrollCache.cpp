@@ -0,0 +1,217 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ScrollCache.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+/**
+ * Creates a scroll cache.
+ * @param display the display to scroll text on.
+ */
+ScrollCache::ScrollCache(MicroBitDisplay &display) : display(display)
+{
+    this->clock = 0;
+
+    for (int i = 0; i < SCROLL_CACHE_ENTRIES; i++)
+    {
+        entries[i].columns = NULL;
+        entries[i].length = 0;
+        entries[i].lastUsed = 0;
+    }
+
+    resetStatistics();
+    cycle_counter_enable();
+}
+
+/**
+ * Rasterises text into a strip.
+ */
+int ScrollCache::render(ScrollStrip &strip, ManagedString text)
+{
+    // Every character and the gap after it, then enough blank columns for the last character to scroll off.
+    int length = text.length() * (SCROLL_CACHE_GLYPH_WIDTH + SCROLL_CACHE_SPACING) + SCROLL_CACHE_GLYPH_WIDTH;
+    uint8_t *columns = (uint8_t *) malloc(length);
+
+    if (columns == NULL)
+        return DEVICE_NO_RESOURCES;
+
+    // Let the display's own font rendering draw each glyph, once.
+    MicroBitImage glyph(SCROLL_CACHE_GLYPH_WIDTH, 5);
+    uint8_t *c = columns;
+
+    memset(columns, 0, length);
+
+    for (int i = 0; i < text.length(); i++)
+    {
+        glyph.clear();
+        glyph.print(text.charAt(i));
+
+        for (int x = 0; x < SCROLL_CACHE_GLYPH_WIDTH; x++, c++)
+            for (int y = 0; y < 5; y++)
+                if (glyph.getPixelValue(x, y))
+                    *c |= 1 << y;
+
+        c += SCROLL_CACHE_SPACING;
+    }
+
+    strip.text = text;
+    strip.columns = columns;
+    strip.length = length;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Finds the strip for the given text, rendering it into the least recently used entry if it isn't cached.
+ * @return the strip, or NULL if there isn't the memory to render it.
+ */
+ScrollStrip *ScrollCache::lookup(ManagedString text)
+{
+    ScrollStrip *victim = &entries[0];
+
+    clock++;
+
+    for (int i = 0; i < SCROLL_CACHE_ENTRIES; i++)
+    {
+        ScrollStrip &e = entries[i];
+
+        if (e.columns && e.text == text)
+        {
+            e.lastUsed = clock;
+            hits++;
+            return &e;
+        }
+
+        if (e.columns == NULL || (victim->columns && e.lastUsed < victim->lastUsed))
+            victim = &e;
+    }
+
+    if (victim->columns)
+    {
+        free(victim->columns);
+        victim->columns = NULL;
+    }
+
+    uint32_t start = cycle_counter_read();
+
+    if (render(*victim, text) != DEVICE_OK)
+        return NULL;
+
+    renderCycles += cycle_counter_read() - start;
+    victim->lastUsed = clock;
+    misses++;
+
+    return victim;
+}
+
+/**
+ * Scrolls the given text across the display from right to left, blocking the calling fiber until it has gone.
+ * @param text the text to scroll.
+ * @param delay the time each step is shown for, in milliseconds.
+ */
+int ScrollCache::scroll(ManagedString text, int delay)
+{
+    if (delay <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    ScrollStrip *strip = lookup(text);
+
+    if (strip == NULL)
+        return DEVICE_NO_RESOURCES;
+
+    display.stopAnimation();
+
+    // Whatever is on the display scrolls off to the left ahead of the text.
+    Bitboard frame = Bitboard::fromImage(display.image);
+
+    for (int i = 0; i < strip->length; i++)
+    {
+        uint32_t start = cycle_counter_read();
+        uint32_t column = 0;
+
+        for (int y = 0; y < 5; y++)
+            if (strip->columns[i] & (1 << y))
+                column |= 1UL << (y * BITBOARD_WIDTH + BITBOARD_WIDTH - 1);
+
+        frame = frame.shift(-1, 0) | Bitboard(column);
+        frame.render(display.image);
+
+        stepCycles += cycle_counter_read() - start;
+        steps++;
+
+        uBit.sleep(delay);
+    }
+
+    return DEVICE_OK;
+}
+
+/**
+ * Scrolls the given number across the display from right to left, blocking the calling fiber until it has gone.
+ * @param number the number to scroll.
+ * @param delay the time each step is shown for, in milliseconds.
+ */
+int ScrollCache::scroll(int number, int delay)
+{
+    return scroll(ManagedString(number), delay);
+}
+
+/**
+ * Frees every cached strip.
+ */
+void ScrollCache::clear()
+{
+    for (int i = 0; i < SCROLL_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].columns)
+        {
+            free(entries[i].columns);
+            entries[i].columns = NULL;
+            entries[i].text = ManagedString();
+        }
+    }
+}
+
+/**
+ * Clears the statistics.
+ */
+void ScrollCache::resetStatistics()
+{
+    hits = 0;
+    misses = 0;
+    steps = 0;
+    stepCycles = 0;
+    renderCycles = 0;
+}
+
+/**
+ * Output the cache and per step statistics gathered to the DMESG buffer.
+ */
+void ScrollCache::printStatistics()
+{
+    DMESG("SCROLL_CACHE: [HITS: %d, MISSES: %d]", hits, misses);
+    DMESG("   RENDER: %d cycles/string", misses ? (int)(renderCycles / misses) : 0);
+    DMESG("   STEP: %d cycles [STEPS: %d]", steps ? (int)(stepCycles / steps) : 0, steps);
+}
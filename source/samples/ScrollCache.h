@@ -0,0 +1,117 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "Bitboard.h"
+
+#ifndef SCROLL_CACHE_H
+#define SCROLL_CACHE_H
+
+#define SCROLL_CACHE_ENTRIES                    8
+#define SCROLL_CACHE_DEFAULT_SPEED              120
+#define SCROLL_CACHE_GLYPH_WIDTH                5
+#define SCROLL_CACHE_SPACING                    1
+
+/**
+ * A string rasterised into a strip of display columns. Each byte is one column, with bit r lit for row r.
+ */
+struct ScrollStrip
+{
+    ManagedString   text;
+    uint8_t         *columns;
+    int             length;
+    uint32_t        lastUsed;
+};
+
+/**
+ * Scrolls text across the display from strips of pre-rendered columns.
+ *
+ * The first time a string is scrolled it is rasterised once into a ScrollStrip, and the most recently used strips are
+ * kept, so scrolling the same string again costs no rendering at all. Each step of a scroll shifts the frame on the
+ * display left and brings in the next column of the strip, as a Bitboard: a few instructions, plus writing the frame
+ * into the display buffer.
+ */
+class ScrollCache
+{
+    MicroBitDisplay     &display;
+    ScrollStrip         entries[SCROLL_CACHE_ENTRIES];
+    uint32_t            clock;
+
+    // Statistics.
+    int                 hits;
+    int                 misses;
+    int                 steps;
+    uint32_t            stepCycles;
+    uint32_t            renderCycles;
+
+    /**
+     * Finds the strip for the given text, rendering it into the least recently used entry if it isn't cached.
+     * @return the strip, or NULL if there isn't the memory to render it.
+     */
+    ScrollStrip *lookup(ManagedString text);
+
+    /**
+     * Rasterises text into a strip.
+     */
+    static int render(ScrollStrip &strip, ManagedString text);
+
+    public:
+    /**
+     * Creates a scroll cache.
+     * @param display the display to scroll text on.
+     */
+    ScrollCache(MicroBitDisplay &display);
+
+    /**
+     * Scrolls the given text across the display from right to left, blocking the calling fiber until it has gone.
+     * @param text the text to scroll.
+     * @param delay the time each step is shown for, in milliseconds.
+     */
+    int scroll(ManagedString text, int delay = SCROLL_CACHE_DEFAULT_SPEED);
+
+    /**
+     * Scrolls the given number across the display from right to left, blocking the calling fiber until it has gone.
+     * @param number the number to scroll.
+     * @param delay the time each step is shown for, in milliseconds.
+     */
+    int scroll(int number, int delay = SCROLL_CACHE_DEFAULT_SPEED);
+
+    /**
+     * Frees every cached strip.
+     */
+    void clear();
+
+    /**
+     * Clears the statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the cache and per step statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
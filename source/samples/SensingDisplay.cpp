@@ -0,0 +1,502 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "SensingDisplay.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+// The matrix pins, as a PinGroup: the rows in bits 0..4, then the columns in bits 5..9.
+#define MATRIX_ROW(n)                           (1 << (n))
+#define MATRIX_COLS                             0x3E0
+#define MATRIX_COL(n)                           (1 << (5 + (n)))
+
+// The phases of the refresh.
+#define SENSING_DISPLAY_PHASE_ROW_ON            0
+#define SENSING_DISPLAY_PHASE_ROW_OFF           1
+#define SENSING_DISPLAY_PHASE_CHARGE            2
+#define SENSING_DISPLAY_PHASE_SENSE             3
+
+SensingDisplay *SensingDisplay::instance = NULL;
+
+/**
+ * The log of a recovery time, as log2(us) in 24.8 fixed point. The fraction is a straight line between powers of two,
+ * which is within 0.09 of the true log, and cheap enough to work out in the refresh interrupt.
+ */
+static int recovery_log(uint32_t us)
+{
+    if (us == 0)
+        us = 1;
+
+    int msb = 31 - __builtin_clz(us);
+    uint32_t fraction = msb >= 8 ? us >> (msb - 8) : us << (8 - msb);
+
+    return (msb << 8) + (fraction & 0xFF);
+}
+
+/**
+ * Creates a sensing display driver.
+ * @param display the display, whose image is shown.
+ * @param timer the timer to use, which must not be shared. The default, TIMER0, belongs to the SoftDevice when BLE
+ * is enabled.
+ * @param irqn the interrupt of the given timer.
+ * @param gpioteChannel the first of three consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of three consecutive PPI channels to use.
+ */
+SensingDisplay::SensingDisplay(MicroBitDisplay &display, NRF_TIMER_Type *timer, IRQn_Type irqn, int gpioteChannel, int ppiChannel) : display(display), timer(timer, irqn)
+{
+    this->pins = NULL;
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->row = 0;
+    this->phase = SENSING_DISPLAY_PHASE_ROW_ON;
+    this->deadline = 0;
+    this->onTime = SENSING_DISPLAY_ROW_US;
+    this->lightLevel = 0;
+    this->recoveryUs = 0;
+    this->senseRequested = false;
+    this->senseAnswering = false;
+    this->enabled = false;
+
+    setLightSensing(SENSING_DISPLAY_DEFAULT_TIMEOUT_US, SENSING_DISPLAY_DEFAULT_DUTY);
+    setLightCalibration(SENSING_DISPLAY_DEFAULT_BRIGHT_US, SENSING_DISPLAY_DEFAULT_DARK_US);
+    resetStatistics();
+}
+
+/**
+ * Timer interrupt handler, which moves the refresh on to its next phase.
+ */
+void SensingDisplay::onTimer(uint16_t channels)
+{
+    if ((channels & 1) && instance)
+        instance->refresh();
+}
+
+/**
+ * Moves the refresh on to its next phase, and schedules the one after.
+ */
+void SensingDisplay::refresh()
+{
+    uint32_t start = cycle_counter_read();
+    int wait;
+
+    if (phase == SENSING_DISPLAY_PHASE_ROW_ON)
+    {
+        // Dimmed: turn the row off for the rest of its slot.
+        blank();
+        phase = SENSING_DISPLAY_PHASE_ROW_OFF;
+        wait = SENSING_DISPLAY_ROW_US - onTime;
+    }
+    else if (phase == SENSING_DISPLAY_PHASE_CHARGE)
+    {
+        startSensing();
+        phase = SENSING_DISPLAY_PHASE_SENSE;
+        wait = timeoutUs;
+    }
+    else
+    {
+        if (phase == SENSING_DISPLAY_PHASE_SENSE)
+        {
+            stopSensing();
+            row = SENSING_DISPLAY_ROWS;
+        }
+        else if (++row == SENSING_DISPLAY_ROWS)
+        {
+            frames++;
+
+            // The end of a frame. Fit in a sensing slot if one is due, or has been asked for.
+            bool due = senseInterval && --framesToSense <= 0;
+
+            if (due || senseRequested)
+            {
+                // A reading asked for gets the full timeout, so it can't be discarded.
+                if (senseRequested)
+                {
+                    timeoutUs = maxTimeoutUs;
+                    senseAnswering = true;
+                }
+
+                blank();
+                phase = SENSING_DISPLAY_PHASE_CHARGE;
+                deadline += SENSING_DISPLAY_CHARGE_US;
+                timer.setCompare(0, deadline);
+                irqCycles += cycle_counter_read() - start;
+                return;
+            }
+        }
+
+        if (row == SENSING_DISPLAY_ROWS)
+            row = 0;
+
+        showRow(row);
+
+        // Rows that are fully on (or off) are left as they are for the whole slot.
+        if (onTime > 0 && onTime < SENSING_DISPLAY_ROW_US)
+        {
+            phase = SENSING_DISPLAY_PHASE_ROW_ON;
+            wait = onTime;
+        }
+        else
+        {
+            phase = SENSING_DISPLAY_PHASE_ROW_OFF;
+            wait = SENSING_DISPLAY_ROW_US;
+        }
+    }
+
+    // Compare against the schedule rather than the current time, so the slots never drift however late we are.
+    deadline += wait;
+    timer.setCompare(0, deadline);
+
+    irqCycles += cycle_counter_read() - start;
+}
+
+/**
+ * Lights the given row of the display's image.
+ */
+void SensingDisplay::showRow(int r)
+{
+    uint8_t *pixels = display.image.getBitmap() + r * display.image.getWidth();
+    uint32_t value = MATRIX_COLS;
+
+    if (onTime)
+    {
+        value |= MATRIX_ROW(r);
+
+        // The columns are active low.
+        for (int x = 0; x < 5; x++)
+            if (pixels[x])
+                value &= ~MATRIX_COL(x);
+    }
+
+    pins->write(value);
+}
+
+/**
+ * Turns off every LED and reverse biases them, ready for a sensing slot.
+ */
+void SensingDisplay::blank()
+{
+    pins->write(MATRIX_COLS);
+}
+
+/**
+ * Releases the rows, starting a light measurement.
+ */
+void SensingDisplay::startSensing()
+{
+    NRF_TIMER_Type *t = timer.timer;
+
+    // Note the start time, and preset each row's capture register to the timeout, which it keeps if it never rises.
+    t->TASKS_CAPTURE[1] = 1;
+    senseStart = t->CC[1];
+    senseTimeoutUs = timeoutUs;
+    uint32_t timeout = senseStart + senseTimeoutUs;
+
+    for (int i = 0; i < SENSING_DISPLAY_SENSED_ROWS; i++)
+        t->CC[1 + i] = timeout;
+
+    // Handing a row to GPIOTE as an input releases it. The rows that aren't sensed stay low.
+    for (int i = 0; i < SENSING_DISPLAY_SENSED_ROWS; i++)
+    {
+        NRF52Pin *row = uBit.ledRowPins[SENSING_DISPLAY_FIRST_SENSED_ROW + i];
+
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                                (row->name << GPIOTE_CONFIG_PSEL_Pos) |
+                                                (GPIOTE_CONFIG_POLARITY_LoToHi << GPIOTE_CONFIG_POLARITY_Pos);
+    }
+}
+
+/**
+ * Collects the light measurement, hands the rows back to GPIO, and ranges the timeout for the next slot.
+ */
+void SensingDisplay::stopSensing()
+{
+    NRF_TIMER_Type *t = timer.timer;
+    int total = 0;
+    int logs = 0;
+    int slowest = 0;
+    bool timedOut = false;
+
+    for (int i = 0; i < SENSING_DISPLAY_SENSED_ROWS; i++)
+    {
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = 0;
+
+        int us = min((int)(t->CC[1 + i] - senseStart), senseTimeoutUs);
+
+        total += us;
+        logs += recovery_log(us);
+        slowest = max(slowest, us);
+        timedOut = timedOut || us >= senseTimeoutUs;
+    }
+
+    recoveryUs = total / SENSING_DISPLAY_SENSED_ROWS;
+    senses++;
+
+    if (timedOut && senseTimeoutUs < maxTimeoutUs)
+    {
+        // Too dark to tell from this slot: try again with a longer one.
+        timeoutUs = min(senseTimeoutUs * 2, maxTimeoutUs);
+        timeouts++;
+    }
+    else
+    {
+        // A quicker recovery means more light, on a log scale, as the photocurrent varies over several decades.
+        int level = (darkLog - logs / SENSING_DISPLAY_SENSED_ROWS) * 255 / (darkLog - brightLog);
+        lightLevel = min(max(level, 0), 255);
+
+        if (slowest < senseTimeoutUs / 4)
+            timeoutUs = max(senseTimeoutUs / 2, min(SENSING_DISPLAY_MIN_TIMEOUT_US, maxTimeoutUs));
+    }
+
+    // The next slot is spaced out to keep to the duty with the timeout it will have.
+    updateInterval();
+    framesToSense = senseInterval;
+
+    if (senseAnswering)
+    {
+        senseAnswering = false;
+        senseRequested = false;
+    }
+}
+
+/**
+ * Works out how many frames to leave between sensing slots, to keep to the duty with the current timeout.
+ */
+void SensingDisplay::updateInterval()
+{
+    int slot = SENSING_DISPLAY_CHARGE_US + timeoutUs;
+
+    // The fewest frames between slots for which slot / (frames * SENSING_DISPLAY_FRAME_US + slot) <= duty / 100.
+    senseInterval = duty ? max(1, (slot * (100 - duty) + duty * SENSING_DISPLAY_FRAME_US - 1) / (duty * SENSING_DISPLAY_FRAME_US)) : 0;
+}
+
+/**
+ * Disables the display's own refresh, and starts this one.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int SensingDisplay::enable()
+{
+    if (enabled)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + SENSING_DISPLAY_SENSED_ROWS > 8 || ppiChannel < 0 || ppiChannel + SENSING_DISPLAY_SENSED_ROWS > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    display.disable();
+
+    if (pins == NULL)
+    {
+        NRF52Pin *matrix[10];
+
+        for (int i = 0; i < 5; i++)
+        {
+            matrix[i] = uBit.ledRowPins[i];
+            matrix[5 + i] = uBit.ledColPins[i];
+        }
+
+        pins = new PinGroup(matrix, 10);
+    }
+
+    blank();
+    pins->output();
+
+    for (int i = 0; i < SENSING_DISPLAY_SENSED_ROWS; i++)
+    {
+        int p = ppiChannel + i;
+
+        NRF_PPI->CH[p].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[gpioteChannel + i];
+        NRF_PPI->CH[p].TEP = (uint32_t) &timer.timer->TASKS_CAPTURE[1 + i];
+        NRF_PPI->CHENSET = 1 << p;
+    }
+
+    cycle_counter_enable();
+
+    instance = this;
+    enabled = true;
+    row = SENSING_DISPLAY_ROWS - 1;
+    phase = SENSING_DISPLAY_PHASE_ROW_OFF;
+    framesToSense = senseInterval;
+
+    timer.setClockSpeed(1000);
+    timer.setBitMode(BitMode32);
+    timer.setIRQ(onTimer);
+    timer.enable();
+
+    deadline = timer.captureCounter() + SENSING_DISPLAY_ROW_US;
+    timer.setCompare(0, deadline);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops this refresh, and hands the matrix back to the display.
+ */
+void SensingDisplay::disable()
+{
+    if (!enabled)
+        return;
+
+    timer.disable();
+    enabled = false;
+
+    for (int i = 0; i < SENSING_DISPLAY_SENSED_ROWS; i++)
+    {
+        NRF_PPI->CHENCLR = 1 << (ppiChannel + i);
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = 0;
+    }
+
+    pins->input();
+    display.enable();
+}
+
+/**
+ * Defines how light is measured.
+ * @param timeoutUs the longest time the rows are given to recover in each sensing slot, in microseconds. Longer
+ * times can tell apart lower light levels, but make the slots in dim light long enough to be seen as flicker.
+ * @param duty the largest share of the time spent sensing, as a percentage, or 0 to only sense when asked by
+ * senseLightLevel(). The sensing slots are spaced out by whole frames to keep below this.
+ */
+int SensingDisplay::setLightSensing(int timeoutUs, int duty)
+{
+    if (timeoutUs <= 0 || duty < 0 || duty >= 100)
+        return DEVICE_INVALID_PARAMETER;
+
+    target_disable_irq();
+    this->maxTimeoutUs = timeoutUs;
+    this->timeoutUs = min(SENSING_DISPLAY_MIN_TIMEOUT_US, timeoutUs);
+    this->duty = duty;
+    updateInterval();
+    this->framesToSense = senseInterval;
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the scale of the light level.
+ * @param brightUs the recovery time, in microseconds, that reads as 255.
+ * @param darkUs the recovery time, in microseconds, that reads as 0. This should be no more than the timeout.
+ */
+int SensingDisplay::setLightCalibration(int brightUs, int darkUs)
+{
+    if (brightUs <= 0 || darkUs <= brightUs)
+        return DEVICE_INVALID_PARAMETER;
+
+    target_disable_irq();
+    brightLog = recovery_log(brightUs);
+    darkLog = recovery_log(darkUs);
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the share of the time actually spent sensing, as a percentage.
+ */
+int SensingDisplay::getLightSensingDuty()
+{
+    int slot = SENSING_DISPLAY_CHARGE_US + timeoutUs;
+
+    return senseInterval ? slot * 100 / (senseInterval * SENSING_DISPLAY_FRAME_US + slot) : 0;
+}
+
+/**
+ * Determines the light level falling on the display, from the last sensing slot.
+ * @return the light level, from 0 (dark, or not measured) to 255 (bright).
+ */
+int SensingDisplay::readLightLevel()
+{
+    return lightLevel;
+}
+
+/**
+ * Takes a reading of the light level falling on the display now, blocking the calling fiber until it is done.
+ * The rows are given the full timeout to recover, so a single slot is enough whatever the light, and the display
+ * is blank for the length of it (up to the timeout, 40ms by default).
+ * @return the light level, from 0 (dark) to 255 (bright), or DEVICE_NOT_SUPPORTED if this isn't enabled.
+ */
+int SensingDisplay::senseLightLevel()
+{
+    if (!enabled)
+        return DEVICE_NOT_SUPPORTED;
+
+    // The slot starts at the end of the current frame (or the next, if a slot is already under way), and the request
+    // is cleared when it ends.
+    senseRequested = true;
+
+    while (senseRequested)
+        fiber_sleep(1);
+
+    return lightLevel;
+}
+
+/**
+ * Determines the average time the sensed rows took to recover in the last sensing slot, for calibration.
+ * @return the time in microseconds. Rows that didn't recover count as the timeout.
+ */
+int SensingDisplay::getRecoveryTime()
+{
+    return recoveryUs;
+}
+
+/**
+ * Defines the brightness of the lit pixels.
+ * @param brightness the brightness, from 0 to 255.
+ */
+int SensingDisplay::setBrightness(int brightness)
+{
+    if (brightness < 0 || brightness > 255)
+        return DEVICE_INVALID_PARAMETER;
+
+    onTime = brightness * SENSING_DISPLAY_ROW_US / 255;
+    return DEVICE_OK;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void SensingDisplay::resetStatistics()
+{
+    target_disable_irq();
+    frames = 0;
+    senses = 0;
+    timeouts = 0;
+    irqCycles = 0;
+    statisticsStart = system_timer_current_time_us();
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void SensingDisplay::printStatistics()
+{
+    int elapsed = (int)(system_timer_current_time_us() - statisticsStart);
+
+    DMESG("SENSING_DISPLAY: [TIMEOUT: %d us, up to %d us] [EVERY: %d frames] [DUTY: %d%%]", timeoutUs, maxTimeoutUs, senseInterval, getLightSensingDuty());
+    DMESG("   FRAMES: %d [%d Hz]", frames, elapsed ? (int)(frames * 1000000ULL / elapsed) : 0);
+    DMESG("   SENSES: %d [%d Hz] [TIMED OUT: %d]", senses, elapsed ? (int)(senses * 1000000ULL / elapsed) : 0, timeouts);
+    DMESG("   LIGHT LEVEL: %d [RECOVERY: %d us]", lightLevel, recoveryUs);
+    DMESG("   CPU: %d cycles/frame [%d.%d%%]", frames ? irqCycles / frames : 0, elapsed ? (int)(irqCycles / 64 * 100ULL / elapsed) : 0, elapsed ? (int)(irqCycles / 64 * 1000ULL / elapsed % 10) : 0);
+}
@@ -0,0 +1,240 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "PinGroup.h"
+
+#ifndef SENSING_DISPLAY_H
+#define SENSING_DISPLAY_H
+
+// Each row is shown for 1ms, so the display refreshes at 200Hz between light sensing slots.
+#define SENSING_DISPLAY_ROWS                    5
+#define SENSING_DISPLAY_ROW_US                  1000
+#define SENSING_DISPLAY_FRAME_US                (SENSING_DISPLAY_ROWS * SENSING_DISPLAY_ROW_US)
+
+// The middle three rows are sensed, each captured on its own compare register, after the one that schedules the refresh.
+#define SENSING_DISPLAY_SENSED_ROWS             3
+#define SENSING_DISPLAY_FIRST_SENSED_ROW        1
+
+// The LEDs are reverse biased for this long before each sensing slot. The rows are then given up to the timeout to
+// recover, which is ranged between these limits to suit the light.
+#define SENSING_DISPLAY_CHARGE_US               50
+#define SENSING_DISPLAY_MIN_TIMEOUT_US          250
+#define SENSING_DISPLAY_DEFAULT_TIMEOUT_US      40000
+#define SENSING_DISPLAY_DEFAULT_DUTY            10
+
+// The recovery times that read as a light level of 255 (a lamp close by) and 0 (dark, as MatrixLightSensor's timeout).
+#define SENSING_DISPLAY_DEFAULT_BRIGHT_US       100
+#define SENSING_DISPLAY_DEFAULT_DARK_US         40000
+
+// Default peripheral resources. One GPIOTE and one PPI channel per sensed row, as used by MatrixLightSensor.
+#define SENSING_DISPLAY_DEFAULT_GPIOTE          0
+#define SENSING_DISPLAY_DEFAULT_PPI             10
+
+/**
+ * A driver for the LED matrix that measures ambient light as part of its refresh, in place of the display's own.
+ *
+ * The matrix is scanned a row at a time from the compare interrupt of a dedicated TIMER, showing the display's image
+ * (so print(), scroll() and anything else that draws into uBit.display.image keep working). Every few frames, between
+ * the last row of one frame and the first of the next, a light sensing slot is scheduled: the LEDs are reverse biased,
+ * the middle three rows released, and the time each takes to recover is captured by the same TIMER through GPIOTE and
+ * PPI, as MatrixLightSensor does. The slot comes round at a fixed cadence, so it takes the same small share of every
+ * LED's on time. The result is kept, so readLightLevel() costs nothing to call and can be polled as often as needed.
+ * senseLightLevel() takes a fresh reading on demand instead, for programs that only want one now and then.
+ *
+ * The rows recover in about 100us under a lamp, and take from a few to tens of milliseconds in a room. A slot that
+ * long every few frames would be seen, so the timeout starts short and is ranged to suit the light: it doubles (up to
+ * the limit given to setLightSensing()) while rows fail to recover within it, and halves while they all recover in
+ * under a quarter of it. A reading in which a row timed out before the timeout reached its limit is discarded. The
+ * slots are spaced out to keep to the duty given, so in dim light they are long but rare, and may be seen as a faint
+ * flicker: lower the limit to trade away the darkest readings for that.
+ *
+ * The light level is the log of the recovery time, scaled between the calibration points given to
+ * setLightCalibration(), so each halving of the recovery time adds the same amount. With the defaults each halving
+ * adds about 30, so a room reads from about 20 to 120, rather than all reading close to 0 as it would on a straight
+ * line scale.
+ *
+ * The share of time spent sensing is configurable with setLightSensing(), and the CPU time spent in the refresh
+ * interrupt is measured and reported by printStatistics().
+ *
+ * Pixels are shown on or off, at the brightness given to setBrightness().
+ *
+ * This needs a TIMER to itself, with four compare registers. The default is TIMER0, which is free unless BLE is
+ * enabled, when it belongs to the SoftDevice. CODAL owns all the others: TIMER1 is the system timer, TIMER2 the ADC's,
+ * TIMER3 runs capacitive touch (the touch pins in touch mode, and the logo) and TIMER4 the display's own refresh. In a
+ * BLE build, TIMER3 can be given instead, as long as nothing senses touch while this is enabled.
+ */
+class SensingDisplay
+{
+    MicroBitDisplay     &display;
+    NRFLowLevelTimer    timer;
+    PinGroup            *pins;
+    int                 gpioteChannel;
+    int                 ppiChannel;
+
+    int                 row;                // The row being shown, or SENSING_DISPLAY_ROWS during a sensing slot.
+    int                 phase;
+    uint32_t            deadline;           // The time of the next compare, in timer ticks.
+    uint32_t            senseStart;         // The time the rows were released in the current sensing slot.
+    int                 senseTimeoutUs;     // The timeout of the current sensing slot.
+    int                 onTime;             // The time each row is lit for, from the brightness.
+    int                 timeoutUs;          // The timeout of the next sensing slot, ranged to suit the light.
+    int                 maxTimeoutUs;
+    int                 duty;
+    int                 brightLog;          // The log of the calibration points, from recovery_log().
+    int                 darkLog;
+    int                 senseInterval;      // The number of frames from one sensing slot to the next, or 0 if disabled.
+    int                 framesToSense;
+    volatile bool       senseRequested;     // Set to fit in a sensing slot at the end of the current frame.
+    bool                senseAnswering;     // Set while the slot asked for is under way.
+    volatile int        lightLevel;
+    volatile int        recoveryUs;
+    bool                enabled;
+
+    uint32_t            frames;
+    volatile uint32_t   senses;
+    uint32_t            timeouts;
+    uint32_t            irqCycles;
+    CODAL_TIMESTAMP     statisticsStart;
+
+    static SensingDisplay *instance;
+
+    /**
+     * Timer interrupt handler, which moves the refresh on to its next phase.
+     */
+    static void onTimer(uint16_t channels);
+
+    /**
+     * Moves the refresh on to its next phase, and schedules the one after.
+     */
+    void refresh();
+
+    /**
+     * Lights the given row of the display's image.
+     */
+    void showRow(int r);
+
+    /**
+     * Turns off every LED and reverse biases them, ready for a sensing slot.
+     */
+    void blank();
+
+    /**
+     * Releases the rows, starting a light measurement.
+     */
+    void startSensing();
+
+    /**
+     * Collects the light measurement, hands the rows back to GPIO, and ranges the timeout for the next slot.
+     */
+    void stopSensing();
+
+    /**
+     * Works out how many frames to leave between sensing slots, to keep to the duty with the current timeout.
+     */
+    void updateInterval();
+
+    public:
+    /**
+     * Creates a sensing display driver.
+     * @param display the display, whose image is shown.
+     * @param timer the timer to use, which must not be shared. The default, TIMER0, belongs to the SoftDevice when BLE
+     * is enabled.
+     * @param irqn the interrupt of the given timer.
+     * @param gpioteChannel the first of three consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of three consecutive PPI channels to use.
+     */
+    SensingDisplay(MicroBitDisplay &display, NRF_TIMER_Type *timer = NRF_TIMER0, IRQn_Type irqn = TIMER0_IRQn, int gpioteChannel = SENSING_DISPLAY_DEFAULT_GPIOTE, int ppiChannel = SENSING_DISPLAY_DEFAULT_PPI);
+
+    /**
+     * Disables the display's own refresh, and starts this one.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int enable();
+
+    /**
+     * Stops this refresh, and hands the matrix back to the display.
+     */
+    void disable();
+
+    /**
+     * Defines how light is measured.
+     * @param timeoutUs the longest time the rows are given to recover in each sensing slot, in microseconds. Longer
+     * times can tell apart lower light levels, but make the slots in dim light long enough to be seen as flicker.
+     * @param duty the largest share of the time spent sensing, as a percentage, or 0 to only sense when asked by
+     * senseLightLevel(). The sensing slots are spaced out by whole frames to keep below this.
+     */
+    int setLightSensing(int timeoutUs, int duty);
+
+    /**
+     * Defines the scale of the light level.
+     * @param brightUs the recovery time, in microseconds, that reads as 255.
+     * @param darkUs the recovery time, in microseconds, that reads as 0. This should be no more than the timeout.
+     */
+    int setLightCalibration(int brightUs, int darkUs);
+
+    /**
+     * Determines the share of the time actually spent sensing, as a percentage.
+     */
+    int getLightSensingDuty();
+
+    /**
+     * Determines the light level falling on the display, from the last sensing slot.
+     * @return the light level, from 0 (dark, or not measured) to 255 (bright).
+     */
+    int readLightLevel();
+
+    /**
+     * Takes a reading of the light level falling on the display now, blocking the calling fiber until it is done.
+     * The rows are given the full timeout to recover, so a single slot is enough whatever the light, and the display
+     * is blank for the length of it (up to the timeout, 40ms by default).
+     * @return the light level, from 0 (dark) to 255 (bright), or DEVICE_NOT_SUPPORTED if this isn't enabled.
+     */
+    int senseLightLevel();
+
+    /**
+     * Determines the average time the sensed rows took to recover in the last sensing slot, for calibration.
+     * @return the time in microseconds. Rows that didn't recover count as the timeout.
+     */
+    int getRecoveryTime();
+
+    /**
+     * Defines the brightness of the lit pixels.
+     * @param brightness the brightness, from 0 to 255.
+     */
+    int setBrightness(int brightness);
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,480 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "SoftSerial.h"
+
+SoftSerial *SoftSerial::instance = NULL;
+
+/**
+ * Creates a software UART.
+ * @param tx the pin to transmit on. It's held high while idle.
+ * @param rx the pin to receive on. It's made a digital input, keeping any pull already set.
+ * @param baud the baud rate, from SOFT_SERIAL_MIN_BAUD to SOFT_SERIAL_MAX_BAUD.
+ * @param clock the timer used to time both directions, which must have six compare registers (TIMER3 or TIMER4),
+ * and must not be shared.
+ * @param clockIrqn the interrupt of the clock timer.
+ * @param counter the timer used to count RX edges, which must not be shared.
+ * @param counterIrqn the interrupt of the counter timer.
+ * @param gpioteChannel the first of two consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of four consecutive PPI channels to use.
+ * @param bufferSize the size of each of the TX and RX buffers, as a power of two.
+ */
+SoftSerial::SoftSerial(NRF52Pin &tx, NRF52Pin &rx, int baud, NRF_TIMER_Type *clock, IRQn_Type clockIrqn, NRF_TIMER_Type *counter, IRQn_Type counterIrqn, int gpioteChannel, int ppiChannel, int bufferSize) : tx(tx), rx(rx), clock(clock, clockIrqn), counter(counter, counterIrqn), encoder(SOFT_SERIAL_CLOCK_HZ, SOFT_SERIAL_DEFAULT_BAUD), decoder(SOFT_SERIAL_CLOCK_HZ, SOFT_SERIAL_DEFAULT_BAUD)
+{
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->running = false;
+
+    // Round down to a power of two, so the buffer indices can be masked.
+    while (bufferSize & (bufferSize - 1))
+        bufferSize &= bufferSize - 1;
+
+    this->bufferSize = max(bufferSize, 2);
+    this->txBuffer = new uint8_t[this->bufferSize];
+    this->rxBuffer = new uint8_t[this->bufferSize];
+    this->txHead = 0;
+    this->txTail = 0;
+    this->rxHead = 0;
+    this->rxTail = 0;
+
+    if (setBaud(baud) != DEVICE_OK)
+        setBaud(SOFT_SERIAL_DEFAULT_BAUD);
+
+    resetStatistics();
+}
+
+/**
+ * Clock interrupt handler.
+ */
+void SoftSerial::onClock(uint16_t channels)
+{
+    SoftSerial *s = instance;
+
+    if (s == NULL)
+        return;
+
+    // Transitions complete in the order they were queued. Free their compare registers, so the PPI channels can't fire
+    // again when the clock wraps.
+    while (s->txQueued && (channels & (1 << s->txFirst)))
+    {
+        NRF_PPI->CHENCLR = 1 << (s->ppiChannel + s->txFirst);
+        s->clock.clearCompare(s->txFirst);
+
+        s->txFirst = (s->txFirst + 1) % SOFT_SERIAL_TX_COMPARES;
+        s->txQueued--;
+    }
+
+    if (channels & ((1 << SOFT_SERIAL_TX_COMPARES) - 1))
+        s->fillTransmitter();
+
+    if (channels & (1 << SOFT_SERIAL_DEADLINE_CC))
+        s->serviceReceiver();
+}
+
+/**
+ * Counter interrupt handler.
+ */
+void SoftSerial::onCounter(uint16_t channels)
+{
+    if ((channels & 1) && instance)
+        instance->serviceReceiver();
+}
+
+/**
+ * Captures the time on the clock. Must only be called with interrupts disabled, or from the interrupt handlers.
+ */
+uint32_t SoftSerial::now()
+{
+    clock.timer->TASKS_CAPTURE[SOFT_SERIAL_NOW_CC] = 1;
+    return clock.timer->CC[SOFT_SERIAL_NOW_CC];
+}
+
+/**
+ * Determines the time and level of the next transition on the TX pin, taking the next byte from the buffer if
+ * needed.
+ * @return true if there is a transition to make, false if there is nothing left to send.
+ */
+bool SoftSerial::nextTransition(uint32_t &time, int &level)
+{
+    // Should the line have gone idle, the next frame starts shortly.
+    uint32_t earliest = now() + SOFT_SERIAL_TX_MIN_LEAD * 2;
+
+    while (!encoder.next(earliest, time, level))
+    {
+        if (txTail == txHead)
+            return false;
+
+        encoder.load(txBuffer[txTail]);
+        txTail = (txTail + 1) & (bufferSize - 1);
+        txBytes++;
+    }
+
+    return true;
+}
+
+/**
+ * Queues transitions on the TX pin until the compare registers are all in use, or there is nothing left to send.
+ */
+void SoftSerial::fillTransmitter()
+{
+    uint32_t time;
+    int level;
+
+    while (txQueued < SOFT_SERIAL_TX_COMPARES && nextTransition(time, level))
+    {
+        // Too late for the compare to catch. Making the transition now could overtake those still queued, so abandon
+        // the frame instead. Those queued are all earlier, so they'll have been made by the time the encoder starts
+        // again.
+        if ((int32_t)(time - now()) < SOFT_SERIAL_TX_MIN_LEAD)
+        {
+            txLate++;
+
+            if (encoder.abort(now() + SOFT_SERIAL_TX_MIN_LEAD * 2) == SOFT_SERIAL_TX_DAMAGED)
+                txDamaged++;
+
+            continue;
+        }
+
+        volatile uint32_t *task = level ? &NRF_GPIOTE->TASKS_SET[gpioteChannel] : &NRF_GPIOTE->TASKS_CLR[gpioteChannel];
+        int cc = (txFirst + txQueued) % SOFT_SERIAL_TX_COMPARES;
+
+        NRF_PPI->CH[ppiChannel + cc].TEP = (uint32_t) task;
+        clock.setCompare(cc, time);
+        NRF_PPI->CHENSET = 1 << (ppiChannel + cc);
+        txQueued++;
+    }
+}
+
+/**
+ * Hands the edges seen on the RX pin to the decoder, and finishes any frame whose stop bit has passed.
+ */
+void SoftSerial::serviceReceiver()
+{
+    NRF_TIMER_Type *c = counter.timer;
+    int g = gpioteChannel + 1;
+
+    while (1)
+    {
+        // Taken first, so that every edge before this time is pending below.
+        uint32_t time = now();
+        uint32_t counted;
+
+        do
+        {
+            if (NRF_GPIOTE->EVENTS_IN[g])
+            {
+                // Read the timestamp before clearing the event, so that an edge in between is seen as lost.
+                uint32_t timestamp = clock.timer->CC[SOFT_SERIAL_RX_CC];
+                NRF_GPIOTE->EVENTS_IN[g] = 0;
+
+                handled++;
+                received(decoder.edge(timestamp));
+            }
+
+            c->TASKS_CAPTURE[1] = 1;
+            counted = c->CC[1];
+        } while (counted != handled && NRF_GPIOTE->EVENTS_IN[g]);
+
+        // Edges that came too close together to be timed. Drop the frame, and wait for the next start bit.
+        if (counted != handled)
+        {
+            rxLostEdges += counted - handled;
+            handled = counted;
+            decoder.reset((rx.name < 32 ? NRF_P0->IN >> rx.name : NRF_P1->IN >> (rx.name - 32)) & 1);
+        }
+
+        received(decoder.advance(time));
+
+        // Interrupt on the next edge. If one has arrived since we looked, its compare has been missed, so go round again.
+        c->CC[0] = handled + 1;
+        c->TASKS_CAPTURE[1] = 1;
+        if (c->CC[1] != handled)
+            continue;
+
+        if (!decoder.isReceiving())
+            break;
+
+        // Interrupt once the stop bit has been sampled, in case the frame ends without an edge. Again, go round if
+        // that's already passed.
+        uint32_t deadline = decoder.getDeadline();
+        clock.setCompare(SOFT_SERIAL_DEADLINE_CC, deadline);
+
+        if ((int32_t)(deadline - now()) > 0)
+            break;
+    }
+}
+
+/**
+ * Stores the result of the decoder.
+ */
+void SoftSerial::received(int result)
+{
+    if (result >= 0)
+    {
+        int next = (rxHead + 1) & (bufferSize - 1);
+
+        if (next == rxTail)
+        {
+            rxOverruns++;
+        }
+        else
+        {
+            rxBuffer[rxHead] = result;
+            rxHead = next;
+            rxBytes++;
+        }
+    }
+    else if (result == SOFT_SERIAL_RX_FRAMING_ERROR)
+    {
+        rxFramingErrors++;
+    }
+    else if (result == SOFT_SERIAL_RX_NOISE)
+    {
+        rxNoise++;
+    }
+}
+
+/**
+ * Starts sending and receiving.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int SoftSerial::start()
+{
+    if (running)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + 2 > 8 || ppiChannel < 0 || ppiChannel + SOFT_SERIAL_TX_COMPARES + 1 > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    int txGpiote = gpioteChannel;
+    int rxGpiote = gpioteChannel + 1;
+    int rxPpi = ppiChannel + SOFT_SERIAL_TX_COMPARES;
+
+    // Let CODAL release the pins from anything else. The TX pin stays a high output underneath GPIOTE, so it idles
+    // high when we stop.
+    tx.setDigitalValue(1);
+    decoder.reset(rx.getDigitalValue());
+
+    txHead = txTail;
+    txFirst = 0;
+    txQueued = 0;
+    handled = 0;
+    instance = this;
+
+    clock.setClockSpeed(SOFT_SERIAL_CLOCK_HZ / 1000);
+    clock.setBitMode(BitMode32);
+    clock.setIRQ(onClock);
+
+    counter.setMode(TimerModeCounter);
+    counter.setBitMode(BitMode32);
+    counter.setIRQ(onCounter);
+    counter.reset();
+    counter.setCompare(0, 1);
+
+    NRF_GPIOTE->CONFIG[txGpiote] = (GPIOTE_CONFIG_MODE_Task << GPIOTE_CONFIG_MODE_Pos) |
+                                   (tx.name << GPIOTE_CONFIG_PSEL_Pos) |
+                                   (GPIOTE_CONFIG_OUTINIT_High << GPIOTE_CONFIG_OUTINIT_Pos);
+
+    for (int i = 0; i < SOFT_SERIAL_TX_COMPARES; i++)
+        NRF_PPI->CH[ppiChannel + i].EEP = (uint32_t) &clock.timer->EVENTS_COMPARE[i];
+
+    NRF_GPIOTE->EVENTS_IN[rxGpiote] = 0;
+    NRF_GPIOTE->CONFIG[rxGpiote] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                   (rx.name << GPIOTE_CONFIG_PSEL_Pos) |
+                                   (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos);
+
+    NRF_PPI->CH[rxPpi].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[rxGpiote];
+    NRF_PPI->CH[rxPpi].TEP = (uint32_t) &clock.timer->TASKS_CAPTURE[SOFT_SERIAL_RX_CC];
+    NRF_PPI->FORK[rxPpi].TEP = (uint32_t) &counter.timer->TASKS_COUNT;
+    NRF_PPI->CHENSET = 1 << rxPpi;
+
+    clock.enable();
+    counter.enable();
+
+    // A bit period is 8.7us at 115200 baud, which the display and audio interrupts could easily take between them.
+    clock.setIRQPriority(SOFT_SERIAL_IRQ_PRIORITY);
+    counter.setIRQPriority(SOFT_SERIAL_IRQ_PRIORITY);
+
+    target_disable_irq();
+    encoder.reset(now());
+    target_enable_irq();
+
+    running = true;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops sending and receiving. Anything waiting to be sent is discarded, and the TX pin is left high.
+ */
+void SoftSerial::stop()
+{
+    if (!running)
+        return;
+
+    clock.disable();
+    counter.disable();
+
+    for (int i = 0; i <= SOFT_SERIAL_TX_COMPARES; i++)
+        NRF_PPI->CHENCLR = 1 << (ppiChannel + i);
+
+    NRF_PPI->FORK[ppiChannel + SOFT_SERIAL_TX_COMPARES].TEP = 0;
+    NRF_GPIOTE->CONFIG[gpioteChannel] = 0;
+    NRF_GPIOTE->CONFIG[gpioteChannel + 1] = 0;
+
+    tx.setDigitalValue(1);
+
+    txHead = txTail;
+    encoder.reset(0);
+    txQueued = 0;
+    running = false;
+}
+
+/**
+ * Changes the baud rate, restarting if running. Anything waiting to be sent is discarded.
+ * @param baud the baud rate, from SOFT_SERIAL_MIN_BAUD to SOFT_SERIAL_MAX_BAUD.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the baud rate is out of range.
+ */
+int SoftSerial::setBaud(int baud)
+{
+    if (baud < SOFT_SERIAL_MIN_BAUD || baud > SOFT_SERIAL_MAX_BAUD)
+        return DEVICE_INVALID_PARAMETER;
+
+    bool wasRunning = running;
+    stop();
+
+    this->baud = baud;
+
+    encoder.setBaud(SOFT_SERIAL_CLOCK_HZ, baud);
+    decoder.setBaud(SOFT_SERIAL_CLOCK_HZ, baud);
+
+    if (wasRunning)
+        start();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the baud rate.
+ */
+int SoftSerial::getBaud()
+{
+    return baud;
+}
+
+/**
+ * Queues bytes to be sent, as many as there is room for. Never blocks.
+ * @param data the bytes to send.
+ * @param length the number of bytes to send.
+ * @return the number of bytes queued, from 0 to length.
+ */
+int SoftSerial::write(const uint8_t *data, int length)
+{
+    int n = 0;
+
+    while (n < length)
+    {
+        int next = (txHead + 1) & (bufferSize - 1);
+
+        if (next == txTail)
+            break;
+
+        txBuffer[txHead] = data[n++];
+        txHead = next;
+    }
+
+    // The transmitter may be idle, or may have run out of bytes part way through queueing transitions.
+    if (running && n)
+    {
+        target_disable_irq();
+        fillTransmitter();
+        target_enable_irq();
+    }
+
+    return n;
+}
+
+/**
+ * Takes received bytes from the buffer, as many as are available. Never blocks.
+ * @param data the buffer to fill.
+ * @param length the size of the buffer.
+ * @return the number of bytes read, from 0 to length.
+ */
+int SoftSerial::read(uint8_t *data, int length)
+{
+    int n = 0;
+
+    while (n < length && rxTail != rxHead)
+    {
+        data[n++] = rxBuffer[rxTail];
+        rxTail = (rxTail + 1) & (bufferSize - 1);
+    }
+
+    return n;
+}
+
+/**
+ * Determines the number of received bytes waiting to be read.
+ */
+int SoftSerial::available()
+{
+    return (rxHead - rxTail) & (bufferSize - 1);
+}
+
+/**
+ * Determines whether anything is still waiting to be sent, or being sent.
+ */
+bool SoftSerial::isTransmitting()
+{
+    return txHead != txTail || encoder.isSending() || txQueued;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void SoftSerial::resetStatistics()
+{
+    target_disable_irq();
+    txBytes = 0;
+    txLate = 0;
+    txDamaged = 0;
+    rxBytes = 0;
+    rxFramingErrors = 0;
+    rxNoise = 0;
+    rxOverruns = 0;
+    rxLostEdges = 0;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void SoftSerial::printStatistics()
+{
+    DMESG("SOFT_SERIAL: [BAUD: %d]", baud);
+    DMESG("   TX: [BYTES: %d] [RESENT FRAMES: %d] [DAMAGED FRAMES: %d]", txBytes, txLate, txDamaged);
+    DMESG("   RX: [BYTES: %d] [OVERRUNS: %d]", rxBytes, rxOverruns);
+    DMESG("   RX ERRORS: [FRAMING: %d] [NOISE: %d] [LOST EDGES: %d]", rxFramingErrors, rxNoise, rxLostEdges);
+}
@@ -0,0 +1,233 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+#include "SoftSerialDecoder.h"
+#include "SoftSerialEncoder.h"
+
+#ifndef SOFT_SERIAL_H
+#define SOFT_SERIAL_H
+
+#define SOFT_SERIAL_CLOCK_HZ                    16000000
+#define SOFT_SERIAL_DEFAULT_BAUD                115200
+#define SOFT_SERIAL_MIN_BAUD                    1200
+#define SOFT_SERIAL_MAX_BAUD                    1000000
+#define SOFT_SERIAL_DEFAULT_BUFFER_SIZE         256
+
+// Capture registers of the clock timer. The first SOFT_SERIAL_TX_COMPARES hold the next few transitions on the TX pin,
+// so the interrupt has that many bit periods to queue the next one.
+#define SOFT_SERIAL_TX_COMPARES                 3
+#define SOFT_SERIAL_RX_CC                       3
+#define SOFT_SERIAL_DEADLINE_CC                 4
+#define SOFT_SERIAL_NOW_CC                      5
+
+// The least time ahead, in clock ticks, that a TX transition can be given to the timer and still be sure to happen.
+#define SOFT_SERIAL_TX_MIN_LEAD                 32
+
+// The interrupt priority of both timers.
+#define SOFT_SERIAL_IRQ_PRIORITY                2
+
+// Default peripheral resources. Two GPIOTE channels (TX, then RX) and four PPI channels (three for TX, one for RX).
+#define SOFT_SERIAL_DEFAULT_GPIOTE              6
+#define SOFT_SERIAL_DEFAULT_PPI                 16
+
+/**
+ * A UART in software, on any two pins, timed by the hardware rather than by the CPU.
+ *
+ * TX: each change of level on the TX pin is a compare on a free running 16MHz TIMER, whose PPI channel drives the
+ * pin through a GPIOTE SET or CLR task, so the bit timing is exact however late the interrupt runs. Bytes are turned
+ * into transitions a few at a time, as the compares are used up.
+ *
+ * RX: the RX pin's GPIOTE channel captures the same TIMER on every edge, and (through the PPI fork) counts the edge on
+ * a second TIMER, whose compare interrupt hands the timestamp to a SoftSerialDecoder. A compare at the middle of each
+ * stop bit finishes frames that end without an edge. As with EdgeCapture, the counter stands in for GPIOTE's own
+ * interrupt (which belongs to CODAL), and tells us when edges came too close together to be seen.
+ *
+ * The clock defaults to TIMER3, which CODAL otherwise uses for capacitive touch, so touch sensing can't be used at the
+ * same time. TIMER4, the only other timer with six compare registers, runs the display. The counter defaults to
+ * TIMER0, which is free unless BLE is enabled, when the SoftDevice owns it.
+ *
+ * Both interrupts run at priority 2, the highest the SoftDevice leaves to applications (it keeps 0, 1 and 4). A
+ * transition the interrupt is too late to queue in time is never made out of turn. If the receiver has seen part of the
+ * frame, the line is instead held low through the frame's stop bit, so that the receiver sees a framing error rather
+ * than a wrong byte, then the byte is sent again from its start bit (see SoftSerialEncoder). Only an interrupt late
+ * enough to miss the whole rest of the frame, with the line high, lets a wrong byte through; these are counted. Reads
+ * and writes only copy to and from the buffers, and never block.
+ */
+class SoftSerial
+{
+    NRF52Pin                &tx;
+    NRF52Pin                &rx;
+    NRFLowLevelTimer        clock;
+    NRFLowLevelTimer        counter;
+    int                     gpioteChannel;
+    int                     ppiChannel;
+    int                     baud;
+    bool                    running;
+
+    uint8_t                 *txBuffer;
+    uint8_t                 *rxBuffer;
+    int                     bufferSize;
+    volatile int            txHead;             // The next byte to be written.
+    volatile int            txTail;             // The next byte to be sent.
+    volatile int            rxHead;             // The next byte to be received.
+    volatile int            rxTail;             // The next byte to be read.
+
+    // The transmitter.
+    SoftSerialEncoder       encoder;
+    volatile uint8_t        txFirst;            // The compare register of the oldest transition queued.
+    volatile uint8_t        txQueued;           // The number of transitions queued.
+
+    // The receiver.
+    SoftSerialDecoder       decoder;
+    uint32_t                handled;            // Edges handed to the decoder, to compare with the hardware count.
+
+    // Statistics.
+    uint32_t                txBytes;
+    uint32_t                txLate;
+    uint32_t                txDamaged;
+    uint32_t                rxBytes;
+    uint32_t                rxFramingErrors;
+    uint32_t                rxNoise;
+    uint32_t                rxOverruns;
+    uint32_t                rxLostEdges;
+
+    static SoftSerial       *instance;
+
+    /**
+     * Clock interrupt handler.
+     */
+    static void onClock(uint16_t channels);
+
+    /**
+     * Counter interrupt handler.
+     */
+    static void onCounter(uint16_t channels);
+
+    /**
+     * Captures the time on the clock. Must only be called with interrupts disabled, or from the interrupt handlers.
+     */
+    uint32_t now();
+
+    /**
+     * Determines the time and level of the next transition on the TX pin, taking the next byte from the buffer if
+     * needed.
+     * @return true if there is a transition to make, false if there is nothing left to send.
+     */
+    bool nextTransition(uint32_t &time, int &level);
+
+    /**
+     * Queues transitions on the TX pin until the compare registers are all in use, or there is nothing left to send.
+     */
+    void fillTransmitter();
+
+    /**
+     * Hands the edges seen on the RX pin to the decoder, and finishes any frame whose stop bit has passed.
+     */
+    void serviceReceiver();
+
+    /**
+     * Stores the result of the decoder.
+     */
+    void received(int result);
+
+    public:
+    /**
+     * Creates a software UART.
+     * @param tx the pin to transmit on. It's held high while idle.
+     * @param rx the pin to receive on. It's made a digital input, keeping any pull already set.
+     * @param baud the baud rate, from SOFT_SERIAL_MIN_BAUD to SOFT_SERIAL_MAX_BAUD.
+     * @param clock the timer used to time both directions, which must have six compare registers (TIMER3 or TIMER4),
+     * and must not be shared.
+     * @param clockIrqn the interrupt of the clock timer.
+     * @param counter the timer used to count RX edges, which must not be shared.
+     * @param counterIrqn the interrupt of the counter timer.
+     * @param gpioteChannel the first of two consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of four consecutive PPI channels to use.
+     * @param bufferSize the size of each of the TX and RX buffers, as a power of two.
+     */
+    SoftSerial(NRF52Pin &tx, NRF52Pin &rx, int baud = SOFT_SERIAL_DEFAULT_BAUD, NRF_TIMER_Type *clock = NRF_TIMER3, IRQn_Type clockIrqn = TIMER3_IRQn, NRF_TIMER_Type *counter = NRF_TIMER0, IRQn_Type counterIrqn = TIMER0_IRQn, int gpioteChannel = SOFT_SERIAL_DEFAULT_GPIOTE, int ppiChannel = SOFT_SERIAL_DEFAULT_PPI, int bufferSize = SOFT_SERIAL_DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Starts sending and receiving.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int start();
+
+    /**
+     * Stops sending and receiving. Anything waiting to be sent is discarded, and the TX pin is left high.
+     */
+    void stop();
+
+    /**
+     * Changes the baud rate, restarting if running. Anything waiting to be sent is discarded.
+     * @param baud the baud rate, from SOFT_SERIAL_MIN_BAUD to SOFT_SERIAL_MAX_BAUD.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the baud rate is out of range.
+     */
+    int setBaud(int baud);
+
+    /**
+     * Determines the baud rate.
+     */
+    int getBaud();
+
+    /**
+     * Queues bytes to be sent, as many as there is room for. Never blocks.
+     * @param data the bytes to send.
+     * @param length the number of bytes to send.
+     * @return the number of bytes queued, from 0 to length.
+     */
+    int write(const uint8_t *data, int length);
+
+    /**
+     * Takes received bytes from the buffer, as many as are available. Never blocks.
+     * @param data the buffer to fill.
+     * @param length the size of the buffer.
+     * @return the number of bytes read, from 0 to length.
+     */
+    int read(uint8_t *data, int length);
+
+    /**
+     * Determines the number of received bytes waiting to be read.
+     */
+    int available();
+
+    /**
+     * Determines whether anything is still waiting to be sent, or being sent.
+     */
+    bool isTransmitting();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "SoftSerialDecoder.h"
+
+/**
+ * Creates a decoder, idle with the line high.
+ * @param clockHz the rate of the clock that edges are timed with.
+ * @param baud the baud rate to decode.
+ */
+SoftSerialDecoder::SoftSerialDecoder(uint32_t clockHz, uint32_t baud)
+{
+    setBaud(clockHz, baud);
+}
+
+/**
+ * Changes the baud rate, abandoning any frame being received.
+ * @param clockHz the rate of the clock that edges are timed with.
+ * @param baud the baud rate to decode.
+ */
+void SoftSerialDecoder::setBaud(uint32_t clockHz, uint32_t baud)
+{
+    // Rounded to the nearest tick, from the start edge each time so the error doesn't build up over the frame.
+    for (int b = 0; b < SOFT_SERIAL_FRAME_BITS; b++)
+        sample[b] = (uint32_t)(((2ULL * b + 1) * clockHz + baud) / (2ULL * baud));
+
+    start = 0;
+    reset(1);
+}
+
+/**
+ * Abandons any frame being received, and waits for the next start edge.
+ * @param level the level of the line now.
+ */
+void SoftSerialDecoder::reset(int level)
+{
+    this->level = level ? 1 : 0;
+    bit = SOFT_SERIAL_FRAME_BITS;
+}
+
+/**
+ * Decodes an edge on the line.
+ * @param time the time of the edge.
+ * @return the byte completed by the edge, SOFT_SERIAL_RX_NONE if no frame was completed, SOFT_SERIAL_RX_FRAMING_ERROR
+ * if a frame was completed without a stop bit, or SOFT_SERIAL_RX_NOISE if a start edge was too short to be a start
+ * bit.
+ */
+int SoftSerialDecoder::edge(uint32_t time)
+{
+    // Every bit sampled before the edge has the old level. This may finish the frame, in time for the edge to start
+    // the next one.
+    int result = advance(time);
+
+    level = !level;
+
+    if (bit == SOFT_SERIAL_FRAME_BITS && level == 0)
+    {
+        start = time;
+        bits = 0;
+        bit = 0;
+    }
+
+    return result;
+}
+
+/**
+ * Decodes the line up to the given time, during which it has not changed since the last edge.
+ * @param time the time the line is known to be stable until. This may be earlier than the last edge.
+ * @return as for edge().
+ */
+int SoftSerialDecoder::advance(uint32_t time)
+{
+    if (bit == SOFT_SERIAL_FRAME_BITS)
+        return SOFT_SERIAL_RX_NONE;
+
+    int32_t elapsed = (int32_t)(time - start);
+
+    while (bit < SOFT_SERIAL_FRAME_BITS && elapsed > (int32_t)sample[bit])
+    {
+        bits |= level << bit;
+        bit++;
+
+        // A start bit that's gone by its middle was a glitch. Wait for the next falling edge.
+        if (bit == 1 && level)
+        {
+            bit = SOFT_SERIAL_FRAME_BITS;
+            return SOFT_SERIAL_RX_NOISE;
+        }
+    }
+
+    if (bit < SOFT_SERIAL_FRAME_BITS)
+        return SOFT_SERIAL_RX_NONE;
+
+    if (!(bits & (1 << (SOFT_SERIAL_FRAME_BITS - 1))))
+        return SOFT_SERIAL_RX_FRAMING_ERROR;
+
+    return (bits >> 1) & 0xFF;
+}
@@ -0,0 +1,112 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <stdint.h>
+
+#ifndef SOFT_SERIAL_DECODER_H
+#define SOFT_SERIAL_DECODER_H
+
+// Eight data bits, no parity and one stop bit, framed by the start bit.
+#define SOFT_SERIAL_FRAME_BITS                  10
+
+// Results of SoftSerialDecoder::edge() and SoftSerialDecoder::advance() other than a received byte.
+#define SOFT_SERIAL_RX_NONE                     -1
+#define SOFT_SERIAL_RX_FRAMING_ERROR            -2
+#define SOFT_SERIAL_RX_NOISE                    -3
+
+/**
+ * The receive state machine of SoftSerial, kept free of any hardware so that it can be run (and tested) on the host
+ * as well as on the device.
+ *
+ * The decoder is given the time of every edge on the line, in ticks of some clock, rather than samples of the line.
+ * A falling edge while idle starts a frame, and from then on each bit takes the level the line had at the middle of
+ * the bit: every bit whose middle passes before an edge has the level from before it. Times only need to be accurate,
+ * not timely, so edges can be handed over some time after they happen, as long as they're handed over in order. When
+ * the line stops changing, the frame is finished by advance(), which must be called once the stop bit has been
+ * sampled (at getDeadline()).
+ */
+class SoftSerialDecoder
+{
+    uint32_t    sample[SOFT_SERIAL_FRAME_BITS];     // The middle of each bit, in ticks from the start edge.
+    uint32_t    start;                              // The time of the start edge of the current frame.
+    uint16_t    bits;                               // The bits sampled so far, in the order received.
+    uint8_t     bit;                                // The next bit to sample, or SOFT_SERIAL_FRAME_BITS when idle.
+    uint8_t     level;                              // The level of the line after the last edge.
+
+    public:
+    /**
+     * Creates a decoder, idle with the line high.
+     * @param clockHz the rate of the clock that edges are timed with.
+     * @param baud the baud rate to decode.
+     */
+    SoftSerialDecoder(uint32_t clockHz, uint32_t baud);
+
+    /**
+     * Changes the baud rate, abandoning any frame being received.
+     * @param clockHz the rate of the clock that edges are timed with.
+     * @param baud the baud rate to decode.
+     */
+    void setBaud(uint32_t clockHz, uint32_t baud);
+
+    /**
+     * Abandons any frame being received, and waits for the next start edge.
+     * @param level the level of the line now.
+     */
+    void reset(int level);
+
+    /**
+     * Decodes an edge on the line.
+     * @param time the time of the edge.
+     * @return the byte completed by the edge, SOFT_SERIAL_RX_NONE if no frame was completed, SOFT_SERIAL_RX_FRAMING_ERROR
+     * if a frame was completed without a stop bit, or SOFT_SERIAL_RX_NOISE if a start edge was too short to be a start
+     * bit.
+     */
+    int edge(uint32_t time);
+
+    /**
+     * Decodes the line up to the given time, during which it has not changed since the last edge.
+     * @param time the time the line is known to be stable until. This may be earlier than the last edge.
+     * @return as for edge().
+     */
+    int advance(uint32_t time);
+
+    /**
+     * Determines whether a frame is being received.
+     */
+    bool isReceiving() const
+    {
+        return bit < SOFT_SERIAL_FRAME_BITS;
+    }
+
+    /**
+     * Determines the time after which advance() will complete the current frame.
+     */
+    uint32_t getDeadline() const
+    {
+        return start + sample[SOFT_SERIAL_FRAME_BITS - 1] + 1;
+    }
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SoftSerialEncoder.h"
+
+/**
+ * Creates an encoder, idle with the line high.
+ * @param clockHz the rate of the clock that transitions are timed with.
+ * @param baud the baud rate to send at.
+ */
+SoftSerialEncoder::SoftSerialEncoder(uint32_t clockHz, uint32_t baud)
+{
+    setBaud(clockHz, baud);
+}
+
+/**
+ * Changes the baud rate, abandoning anything being sent.
+ * @param clockHz the rate of the clock that transitions are timed with.
+ * @param baud the baud rate to send at.
+ */
+void SoftSerialEncoder::setBaud(uint32_t clockHz, uint32_t baud)
+{
+    // Rounded to the nearest tick, from the start edge each time so the error doesn't build up over the frame.
+    for (int b = 0; b <= SOFT_SERIAL_FRAME_BITS; b++)
+        bitTime[b] = (uint32_t)(((uint64_t)b * clockHz + baud / 2) / baud);
+
+    reset(0);
+}
+
+/**
+ * Abandons anything being sent, with the line left high.
+ * @param time the earliest time the next frame can start.
+ */
+void SoftSerialEncoder::reset(uint32_t time)
+{
+    start = time - bitTime[SOFT_SERIAL_FRAME_BITS];
+    frame = 0;
+    pending = 0;
+    bit = SOFT_SERIAL_FRAME_BITS;
+    level = 1;
+}
+
+/**
+ * Gives a byte to send once the current frame is finished. Must only be called when next() has returned false.
+ * @param byte the byte to send.
+ */
+void SoftSerialEncoder::load(uint8_t byte)
+{
+    pending = (byte << 1) | (1 << (SOFT_SERIAL_FRAME_BITS - 1));
+}
+
+/**
+ * Determines the time and level of the next transition on the line.
+ * @param earliest the earliest time a transition can be made, should the line have gone idle.
+ * @param time set to the time of the transition.
+ * @param level set to the level of the line after the transition.
+ * @return true if there is a transition to make, or false if another byte is needed.
+ */
+bool SoftSerialEncoder::next(uint32_t earliest, uint32_t &time, int &level)
+{
+    while (1)
+    {
+        if (bit == SOFT_SERIAL_FRAME_BITS)
+        {
+            if (!pending)
+                return false;
+
+            frame = pending;
+            pending = 0;
+            bit = 0;
+
+            start += bitTime[SOFT_SERIAL_FRAME_BITS];
+
+            if ((int32_t)(earliest - start) > 0)
+                start = earliest;
+        }
+
+        int l = (frame >> bit) & 1;
+
+        if (l != this->level)
+        {
+            time = start + bitTime[bit];
+            level = l;
+            this->level = l;
+            bit++;
+            return true;
+        }
+
+        bit++;
+    }
+}
+
+/**
+ * Gives up on the transition last returned by next(), which could not be made. Transitions before it must all
+ * have been made by the time given. The frame is sent again, after a break if the receiver has seen part of it.
+ * @param earliest the earliest time a transition can be made.
+ * @return SOFT_SERIAL_TX_RESTARTED if the receiver saw nothing of the frame, SOFT_SERIAL_TX_BROKEN if the line is
+ * held low through the frame's stop bit first, or SOFT_SERIAL_TX_DAMAGED if the stop bit has already passed, so
+ * the receiver has taken the damaged frame for a byte.
+ */
+int SoftSerialEncoder::abort(uint32_t earliest)
+{
+    // The transition wasn't made, so the line is still at the level from before it.
+    level = !level;
+
+    // The middle of the stop bit, where the receiver samples it.
+    uint32_t stop = start + (bitTime[SOFT_SERIAL_FRAME_BITS - 1] + bitTime[SOFT_SERIAL_FRAME_BITS]) / 2;
+
+    // Only a missed start bit leaves the receiver with nothing. Once the line has stayed high past the stop bit,
+    // the receiver has already finished the frame, and a break would only start another.
+    if (level && (bit == 1 || (int32_t)(earliest - stop) >= 0))
+    {
+        int result = bit == 1 ? SOFT_SERIAL_TX_RESTARTED : SOFT_SERIAL_TX_DAMAGED;
+        start = earliest;
+        bit = 0;
+        return result;
+    }
+
+    // Hold the line low for nine bits from now. The missed transition was at least a bit after the start edge, so that
+    // reaches past the end of the frame's stop bit, and the receiver sees a framing error. The line then goes high for
+    // the stop bit of the break, and the byte follows a bit later.
+    pending = frame;
+    frame = 1 << (SOFT_SERIAL_FRAME_BITS - 1);
+    start = earliest;
+    bit = 0;
+
+    return SOFT_SERIAL_TX_BROKEN;
+}
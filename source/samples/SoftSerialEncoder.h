@@ -0,0 +1,112 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stdint.h>
+#include "SoftSerialDecoder.h"
+
+#ifndef SOFT_SERIAL_ENCODER_H
+#define SOFT_SERIAL_ENCODER_H
+
+// Results of SoftSerialEncoder::abort().
+#define SOFT_SERIAL_TX_RESTARTED                0
+#define SOFT_SERIAL_TX_BROKEN                   1
+#define SOFT_SERIAL_TX_DAMAGED                  2
+
+/**
+ * The transmit state machine of SoftSerial, kept free of any hardware so that it can be run (and tested) on the host
+ * as well as on the device.
+ *
+ * Bytes are turned into the times and levels of the transitions on the line, one at a time, for the caller to make
+ * in order. Frames follow each other back to back, unless the line has gone idle, when the next starts as soon as it
+ * can.
+ *
+ * When the caller can't make a transition in time, abort() makes sure the receiver can't take the damaged frame for
+ * a good one before the byte is sent again: the line is held low through the stop bit of the frame (a framing error),
+ * then returned high for a bit before the byte is sent again from its start bit.
+ */
+class SoftSerialEncoder
+{
+    uint32_t    bitTime[SOFT_SERIAL_FRAME_BITS + 1];    // Each bit boundary, in ticks from the start edge.
+    uint32_t    start;                                  // The time of the start edge of the current frame.
+    uint16_t    frame;                                  // The frame being sent, start bit first.
+    uint16_t    pending;                                // The frame to send next, or 0 if there is none.
+    uint8_t     bit;                                    // The next bit of the frame, or SOFT_SERIAL_FRAME_BITS when done.
+    uint8_t     level;                                  // The level of the last transition given out.
+
+    public:
+    /**
+     * Creates an encoder, idle with the line high.
+     * @param clockHz the rate of the clock that transitions are timed with.
+     * @param baud the baud rate to send at.
+     */
+    SoftSerialEncoder(uint32_t clockHz, uint32_t baud);
+
+    /**
+     * Changes the baud rate, abandoning anything being sent.
+     * @param clockHz the rate of the clock that transitions are timed with.
+     * @param baud the baud rate to send at.
+     */
+    void setBaud(uint32_t clockHz, uint32_t baud);
+
+    /**
+     * Abandons anything being sent, with the line left high.
+     * @param time the earliest time the next frame can start.
+     */
+    void reset(uint32_t time);
+
+    /**
+     * Gives a byte to send once the current frame is finished. Must only be called when next() has returned false.
+     * @param byte the byte to send.
+     */
+    void load(uint8_t byte);
+
+    /**
+     * Determines the time and level of the next transition on the line.
+     * @param earliest the earliest time a transition can be made, should the line have gone idle.
+     * @param time set to the time of the transition.
+     * @param level set to the level of the line after the transition.
+     * @return true if there is a transition to make, or false if another byte is needed.
+     */
+    bool next(uint32_t earliest, uint32_t &time, int &level);
+
+    /**
+     * Gives up on the transition last returned by next(), which could not be made. Transitions before it must all
+     * have been made by the time given. The frame is sent again, after a break if the receiver has seen part of it.
+     * @param earliest the earliest time a transition can be made.
+     * @return SOFT_SERIAL_TX_RESTARTED if the receiver saw nothing of the frame, SOFT_SERIAL_TX_BROKEN if the line is
+     * held low through the frame's stop bit first, or SOFT_SERIAL_TX_DAMAGED if the stop bit has already passed, so
+     * the receiver has taken the damaged frame for a byte.
+     */
+    int abort(uint32_t earliest);
+
+    /**
+     * Determines whether a frame is being sent, or waiting to be sent again.
+     */
+    bool isSending() const
+    {
+        return bit < SOFT_SERIAL_FRAME_BITS || pending;
+    }
+};
+
+#endif
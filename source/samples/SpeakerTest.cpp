@@ -8,9 +8,12 @@
 #include "SerialStreamer.h"
 #include "Synthesizer.h"
 #include "SoundEmojiSynthesizer.h"
+#include "AdaptiveRateOutput.h"
 #include "SoundSynthesizerEffects.h"
 #include "Mixer2.h"
 #include "SoundOutputPin.h"
+#include "AdpcmSource.h"
+#include "HelloClip.h"
 #include "Tests.h"
 
 //#define SPEAKER_TEST_DIFFERENTIAL
@@ -19,576 +22,298 @@ static const uint8_t square[] = {128};
 static const uint8_t middleC[] = {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 static const uint8_t middleD[] = {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 static const uint8_t middleE[] = {255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
-static const uint8_t hello[] = {
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
-    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x81, 0x81, 0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7F, 
-    0x7F, 0x80, 0x81, 0x81, 0x81, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x80, 0x81, 0x80, 0x80, 0x7F, 
-    0x7E, 0x7E, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7F, 0x7E, 0x7C, 0x7B, 0x7D, 0x80, 0x82, 0x82, 
-    0x81, 0x7F, 0x7D, 0x7D, 0x7E, 0x7F, 0x82, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7D, 0x7F, 
-    0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 0x7F, 0x81, 0x83, 0x83, 0x81, 0x7E, 0x7C, 0x7E, 
-    0x81, 0x82, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7F, 
-    0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x81, 0x81, 0x80, 0x7F, 0x80, 0x80, 0x7E, 0x7D, 0x7F, 0x82, 0x83, 0x80, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7E, 0x7E, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x80, 0x83, 0x84, 
-    0x83, 0x7E, 0x7A, 0x79, 0x7C, 0x7E, 0x81, 0x85, 0x87, 0x83, 0x7D, 0x7B, 0x7D, 0x7E, 0x7E, 0x80, 
-    0x84, 0x85, 0x82, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 0x7F, 0x83, 0x86, 0x82, 0x7B, 0x7B, 0x82, 0x82, 
-    0x7C, 0x7D, 0x82, 0x82, 0x81, 0x81, 0x7F, 0x7D, 0x80, 0x82, 0x7E, 0x7C, 0x7D, 0x7D, 0x80, 0x84, 
-    0x82, 0x7C, 0x7D, 0x84, 0x84, 0x7E, 0x7C, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x7C, 0x7C, 
-    0x80, 0x82, 0x7F, 0x7F, 0x82, 0x81, 0x7E, 0x7D, 0x7E, 0x81, 0x84, 0x82, 0x80, 0x81, 0x81, 0x7D, 
-    0x7B, 0x7E, 0x7F, 0x7F, 0x81, 0x82, 0x81, 0x7D, 0x79, 0x79, 0x81, 0x86, 0x87, 0x85, 0x82, 0x80, 
-    0x7D, 0x7A, 0x79, 0x7F, 0x84, 0x82, 0x7F, 0x82, 0x82, 0x7B, 0x79, 0x7D, 0x7E, 0x7D, 0x81, 0x88, 
-    0x8B, 0x88, 0x81, 0x7B, 0x7A, 0x7C, 0x7B, 0x7A, 0x7F, 0x87, 0x86, 0x7C, 0x79, 0x7D, 0x7B, 0x77, 
-    0x7C, 0x85, 0x88, 0x88, 0x89, 0x84, 0x7A, 0x78, 0x7C, 0x7E, 0x7F, 0x82, 0x81, 0x7F, 0x83, 0x80, 
-    0x74, 0x74, 0x7D, 0x82, 0x83, 0x85, 0x85, 0x82, 0x82, 0x83, 0x80, 0x79, 0x7A, 0x81, 0x85, 0x81, 
-    0x7C, 0x7D, 0x81, 0x85, 0x82, 0x76, 0x71, 0x7B, 0x85, 0x87, 0x89, 0x89, 0x83, 0x7D, 0x79, 0x77, 
-    0x79, 0x80, 0x86, 0x88, 0x85, 0x7F, 0x77, 0x72, 0x75, 0x7E, 0x82, 0x85, 0x8B, 0x8B, 0x83, 0x7D, 
-    0x7B, 0x77, 0x77, 0x80, 0x89, 0x8D, 0x8D, 0x85, 0x75, 0x6D, 0x72, 0x76, 0x7A, 0x87, 0x91, 0x8E, 
-    0x87, 0x80, 0x73, 0x6C, 0x72, 0x7D, 0x88, 0x94, 0x97, 0x8C, 0x7B, 0x6E, 0x68, 0x6C, 0x79, 0x87, 
-    0x92, 0x92, 0x8B, 0x85, 0x7B, 0x6D, 0x6D, 0x7A, 0x86, 0x8E, 0x8F, 0x88, 0x81, 0x7C, 0x77, 0x71, 
-    0x71, 0x7A, 0x85, 0x89, 0x88, 0x84, 0x7C, 0x77, 0x79, 0x7D, 0x7F, 0x83, 0x86, 0x86, 0x84, 0x82, 
-    0x7D, 0x77, 0x78, 0x7E, 0x86, 0x8A, 0x85, 0x7E, 0x7D, 0x7C, 0x77, 0x7A, 0x83, 0x86, 0x84, 0x82, 
-    0x7E, 0x7B, 0x7E, 0x81, 0x7D, 0x7E, 0x86, 0x84, 0x7F, 0x82, 0x7E, 0x78, 0x7F, 0x84, 0x7C, 0x78, 
-    0x7E, 0x83, 0x83, 0x7F, 0x7A, 0x7C, 0x84, 0x87, 0x83, 0x7B, 0x78, 0x7D, 0x84, 0x86, 0x84, 0x82, 
-    0x80, 0x7C, 0x7A, 0x7B, 0x7A, 0x7D, 0x83, 0x83, 0x81, 0x85, 0x87, 0x82, 0x81, 0x84, 0x82, 0x7B, 
-    0x76, 0x75, 0x7B, 0x84, 0x88, 0x84, 0x81, 0x7E, 0x78, 0x72, 0x74, 0x7C, 0x87, 0x91, 0x93, 0x8B, 
-    0x7F, 0x76, 0x73, 0x78, 0x7C, 0x80, 0x85, 0x87, 0x85, 0x7D, 0x73, 0x73, 0x7B, 0x7E, 0x7B, 0x7F, 
-    0x87, 0x8C, 0x8B, 0x84, 0x7C, 0x79, 0x7B, 0x7D, 0x7C, 0x7E, 0x81, 0x85, 0x87, 0x81, 0x7C, 0x7D, 
-    0x7E, 0x7C, 0x7C, 0x80, 0x82, 0x85, 0x82, 0x7B, 0x7C, 0x7D, 0x7C, 0x7E, 0x84, 0x87, 0x88, 0x86, 
-    0x7E, 0x7A, 0x7E, 0x84, 0x87, 0x85, 0x7F, 0x7C, 0x80, 0x86, 0x80, 0x78, 0x7D, 0x84, 0x83, 0x82, 
-    0x85, 0x83, 0x80, 0x84, 0x85, 0x80, 0x83, 0x87, 0x83, 0x80, 0x81, 0x79, 0x77, 0x83, 0x85, 0x7D, 
-    0x78, 0x78, 0x78, 0x7A, 0x7C, 0x7C, 0x7C, 0x7C, 0x81, 0x84, 0x7E, 0x7A, 0x7B, 0x76, 0x73, 0x7A, 
-    0x7F, 0x7D, 0x7D, 0x7F, 0x7B, 0x74, 0x6F, 0x6E, 0x72, 0x78, 0x78, 0x72, 0x6C, 0x6E, 0x6F, 0x68, 
-    0x62, 0x6B, 0x82, 0xA8, 0xCA, 0xC0, 0x98, 0x88, 0x8D, 0x86, 0x86, 0x9E, 0xAA, 0xA2, 0x9D, 0x8C, 
-    0x69, 0x51, 0x50, 0x50, 0x55, 0x6A, 0x77, 0x79, 0x83, 0x8C, 0x7C, 0x68, 0x70, 0x85, 0x90, 0x9B, 
-    0xA8, 0xA8, 0x9C, 0x8D, 0x83, 0x7C, 0x79, 0x78, 0x80, 0x8D, 0x97, 0x9B, 0x96, 0x8C, 0x7F, 0x75, 
-    0x73, 0x7C, 0x8B, 0x93, 0x8F, 0x88, 0x81, 0x75, 0x6A, 0x65, 0x68, 0x72, 0x80, 0x8A, 0x8B, 0x87, 
-    0x83, 0x7D, 0x77, 0x79, 0x85, 0x8F, 0x92, 0x93, 0x8F, 0x82, 0x71, 0x64, 0x61, 0x63, 0x69, 0x73, 
-    0x7D, 0x80, 0x79, 0x74, 0x71, 0x68, 0x61, 0x68, 0x73, 0x79, 0x79, 0x76, 0x6E, 0x63, 0x4E, 0x38, 
-    0x2B, 0x35, 0x46, 0x51, 0x81, 0xD7, 0xFE, 0xBC, 0x72, 0x77, 0x93, 0x86, 0x7E, 0xA4, 0xCE, 0xD4, 
-    0xB6, 0x84, 0x5D, 0x4F, 0x4A, 0x43, 0x4D, 0x69, 0x7F, 0x8F, 0x9F, 0x98, 0x70, 0x51, 0x60, 0x80, 
-    0x8E, 0x97, 0xAA, 0xB3, 0xA4, 0x8C, 0x7B, 0x6E, 0x5F, 0x53, 0x56, 0x6F, 0x92, 0xA2, 0x94, 0x7A, 
-    0x6B, 0x63, 0x5F, 0x67, 0x79, 0x8C, 0x98, 0x99, 0x90, 0x85, 0x7F, 0x75, 0x65, 0x63, 0x75, 0x84, 
-    0x87, 0x8A, 0x8D, 0x83, 0x72, 0x6C, 0x73, 0x78, 0x7A, 0x83, 0x90, 0x93, 0x8B, 0x83, 0x85, 0x84, 
-    0x7D, 0x7B, 0x83, 0x8B, 0x8E, 0x8F, 0x8D, 0x88, 0x83, 0x7A, 0x74, 0x7A, 0x88, 0x8F, 0x8E, 0x8C, 
-    0x8B, 0x89, 0x88, 0x86, 0x84, 0x84, 0x88, 0x8B, 0x8A, 0x84, 0x7B, 0x72, 0x6F, 0x71, 0x73, 0x76, 
-    0x7C, 0x82, 0x83, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 0x7E, 0x81, 0x83, 0x80, 0x7B, 0x78, 0x72, 0x6B, 
-    0x64, 0x62, 0x61, 0x5B, 0x55, 0x56, 0x59, 0x55, 0x50, 0x4D, 0x73, 0xCE, 0xFD, 0xB2, 0x57, 0x67, 
-    0x9E, 0x98, 0x7C, 0x8A, 0xB6, 0xD2, 0xB9, 0x77, 0x4D, 0x59, 0x64, 0x4F, 0x44, 0x5B, 0x77, 0x8E, 
-    0xA2, 0x9C, 0x73, 0x5A, 0x6B, 0x83, 0x89, 0x90, 0xA3, 0xAE, 0xA5, 0x97, 0x8F, 0x85, 0x70, 0x57, 
-    0x52, 0x6D, 0x92, 0xA1, 0x93, 0x7C, 0x6F, 0x69, 0x64, 0x64, 0x70, 0x81, 0x8F, 0x96, 0x95, 0x93, 
-    0x93, 0x89, 0x72, 0x63, 0x6E, 0x82, 0x89, 0x8A, 0x8D, 0x8A, 0x7C, 0x70, 0x6F, 0x6E, 0x6B, 0x6F, 
-    0x7F, 0x8B, 0x89, 0x84, 0x85, 0x83, 0x7C, 0x7A, 0x81, 0x87, 0x87, 0x8A, 0x90, 0x91, 0x86, 0x78, 
-    0x74, 0x78, 0x7D, 0x7C, 0x7A, 0x7E, 0x86, 0x8A, 0x8A, 0x89, 0x87, 0x83, 0x82, 0x83, 0x86, 0x88, 
-    0x87, 0x82, 0x7D, 0x7A, 0x79, 0x79, 0x77, 0x76, 0x77, 0x7A, 0x7C, 0x7F, 0x81, 0x80, 0x7F, 0x81, 
-    0x82, 0x81, 0x7F, 0x7E, 0x7A, 0x74, 0x6E, 0x69, 0x65, 0x63, 0x5D, 0x52, 0x48, 0x45, 0x6C, 0xCE, 
-    0xFE, 0xA8, 0x45, 0x5E, 0xA9, 0xA5, 0x75, 0x78, 0xB3, 0xE7, 0xD3, 0x83, 0x54, 0x6A, 0x77, 0x4F, 
-    0x30, 0x47, 0x73, 0x91, 0x9F, 0x94, 0x77, 0x69, 0x6E, 0x6B, 0x66, 0x78, 0x9A, 0xA9, 0xA5, 0xA4, 
-    0xAA, 0xA0, 0x7A, 0x51, 0x49, 0x64, 0x85, 0x96, 0x94, 0x8A, 0x83, 0x7B, 0x6B, 0x5C, 0x5B, 0x67, 
-    0x79, 0x86, 0x8C, 0x97, 0xAA, 0xA6, 0x81, 0x64, 0x6A, 0x79, 0x7A, 0x7C, 0x8C, 0x98, 0x94, 0x8A, 
-    0x82, 0x75, 0x64, 0x5E, 0x69, 0x76, 0x7D, 0x85, 0x90, 0x91, 0x87, 0x7D, 0x7C, 0x80, 0x84, 0x83, 
-    0x85, 0x90, 0x96, 0x8C, 0x82, 0x82, 0x7E, 0x75, 0x74, 0x78, 0x7A, 0x80, 0x89, 0x89, 0x83, 0x85, 
-    0x87, 0x81, 0x7B, 0x7C, 0x7F, 0x81, 0x86, 0x87, 0x81, 0x7C, 0x7C, 0x7A, 0x76, 0x73, 0x75, 0x78, 
-    0x7C, 0x7F, 0x81, 0x85, 0x85, 0x80, 0x7B, 0x79, 0x79, 0x73, 0x6C, 0x67, 0x60, 0x57, 0x4F, 0x49, 
-    0x55, 0x9C, 0xF4, 0xDA, 0x5E, 0x37, 0x8E, 0xC7, 0x97, 0x61, 0x7B, 0xCF, 0xF8, 0xB6, 0x5D, 0x5F, 
-    0x92, 0x80, 0x37, 0x1E, 0x4C, 0x85, 0x9D, 0x8F, 0x73, 0x75, 0x8C, 0x85, 0x60, 0x56, 0x77, 0x95, 
-    0x9A, 0x9A, 0xA9, 0xB8, 0xA8, 0x78, 0x4F, 0x52, 0x71, 0x82, 0x80, 0x7D, 0x84, 0x91, 0x93, 0x7D, 
-    0x63, 0x5D, 0x68, 0x6F, 0x6F, 0x78, 0x94, 0xAD, 0xA6, 0x88, 0x79, 0x80, 0x7C, 0x67, 0x62, 0x79, 
-    0x93, 0x99, 0x93, 0x8D, 0x86, 0x7C, 0x71, 0x69, 0x64, 0x67, 0x76, 0x88, 0x90, 0x8F, 0x94, 0x9A, 
-    0x90, 0x79, 0x6F, 0x7B, 0x84, 0x81, 0x7F, 0x8A, 0x93, 0x92, 0x87, 0x7A, 0x74, 0x76, 0x78, 0x77, 
-    0x7B, 0x85, 0x8E, 0x95, 0x97, 0x8F, 0x7F, 0x73, 0x6F, 0x71, 0x78, 0x7E, 0x7E, 0x7A, 0x7A, 0x7E, 
-    0x7C, 0x74, 0x6B, 0x68, 0x6E, 0x78, 0x81, 0x85, 0x83, 0x7C, 0x75, 0x6C, 0x60, 0x56, 0x4D, 0x4B, 
-    0x7E, 0xDA, 0xE8, 0x86, 0x4B, 0x88, 0xC3, 0x9B, 0x56, 0x59, 0xA6, 0xED, 0xD2, 0x7A, 0x62, 0x95, 
-    0x9E, 0x58, 0x22, 0x34, 0x6D, 0x91, 0x87, 0x6C, 0x75, 0x98, 0x96, 0x6F, 0x63, 0x7F, 0x90, 0x83, 
-    0x7D, 0x95, 0xB7, 0xB9, 0x90, 0x66, 0x68, 0x82, 0x86, 0x70, 0x5C, 0x60, 0x78, 0x8D, 0x8A, 0x7C, 
-    0x79, 0x7C, 0x75, 0x68, 0x66, 0x75, 0x89, 0x8B, 0x7F, 0x83, 0x9F, 0xA9, 0x8D, 0x6F, 0x71, 0x7F, 
-    0x7D, 0x76, 0x7B, 0x87, 0x8D, 0x8D, 0x87, 0x7B, 0x70, 0x6B, 0x6A, 0x68, 0x6D, 0x80, 0x91, 0x91, 
-    0x8D, 0x97, 0xA2, 0x98, 0x7E, 0x6C, 0x71, 0x80, 0x8C, 0x8F, 0x8B, 0x89, 0x8D, 0x8E, 0x85, 0x78, 
-    0x6F, 0x6D, 0x73, 0x7D, 0x86, 0x8F, 0x96, 0x8E, 0x7F, 0x78, 0x76, 0x6E, 0x68, 0x6E, 0x78, 0x80, 
-    0x83, 0x84, 0x80, 0x78, 0x70, 0x69, 0x62, 0x5E, 0x5F, 0x65, 0x66, 0x61, 0x5D, 0x71, 0xB2, 0xE1, 
-    0xAB, 0x55, 0x65, 0xBA, 0xC7, 0x7F, 0x52, 0x7D, 0xD0, 0xE3, 0x96, 0x55, 0x76, 0xAA, 0x85, 0x3A, 
-    0x2F, 0x5D, 0x7D, 0x72, 0x5C, 0x67, 0x94, 0xA4, 0x7D, 0x5F, 0x78, 0x98, 0x8D, 0x70, 0x72, 0x97, 
-    0xB6, 0xAA, 0x87, 0x7F, 0x96, 0x9E, 0x87, 0x6B, 0x61, 0x69, 0x78, 0x7D, 0x77, 0x79, 0x82, 0x81, 
-    0x76, 0x6B, 0x68, 0x71, 0x77, 0x6D, 0x67, 0x7C, 0x97, 0x97, 0x88, 0x88, 0x93, 0x96, 0x8C, 0x81, 
-    0x81, 0x8B, 0x8E, 0x87, 0x85, 0x88, 0x86, 0x7E, 0x76, 0x6E, 0x6A, 0x6F, 0x73, 0x6C, 0x6D, 0x7D, 
-    0x87, 0x83, 0x81, 0x86, 0x8A, 0x8B, 0x8B, 0x85, 0x82, 0x89, 0x92, 0x93, 0x91, 0x8D, 0x8D, 0x8E, 
-    0x86, 0x78, 0x75, 0x7B, 0x78, 0x72, 0x76, 0x7D, 0x78, 0x72, 0x75, 0x7B, 0x79, 0x6F, 0x68, 0x6B, 
-    0x74, 0x7A, 0x78, 0x72, 0x6A, 0x65, 0x65, 0x66, 0x60, 0x6F, 0xA0, 0xB3, 0x86, 0x6B, 0x9A, 0xC9, 
-    0xAD, 0x75, 0x6A, 0x9A, 0xCB, 0xBA, 0x7B, 0x69, 0x97, 0xAF, 0x83, 0x4F, 0x4A, 0x68, 0x7D, 0x6D, 
-    0x52, 0x5D, 0x81, 0x83, 0x66, 0x65, 0x84, 0x91, 0x7B, 0x6A, 0x7A, 0x9C, 0xA5, 0x8A, 0x77, 0x8D, 
-    0xAB, 0xA8, 0x8F, 0x80, 0x83, 0x88, 0x84, 0x77, 0x6D, 0x70, 0x77, 0x78, 0x75, 0x75, 0x77, 0x78, 
-    0x75, 0x6B, 0x67, 0x72, 0x7B, 0x74, 0x70, 0x82, 0x96, 0x97, 0x8D, 0x88, 0x8C, 0x91, 0x8D, 0x83, 
-    0x81, 0x85, 0x88, 0x8D, 0x90, 0x8E, 0x89, 0x86, 0x7E, 0x76, 0x77, 0x7B, 0x74, 0x69, 0x6E, 0x7B, 
-    0x82, 0x7E, 0x79, 0x7C, 0x84, 0x8A, 0x87, 0x7E, 0x7C, 0x83, 0x8F, 0x94, 0x90, 0x89, 0x89, 0x8B, 
-    0x86, 0x7D, 0x78, 0x75, 0x75, 0x78, 0x7D, 0x80, 0x7B, 0x73, 0x71, 0x70, 0x6A, 0x5F, 0x57, 0x54, 
-    0x58, 0x60, 0x64, 0x75, 0x94, 0x9B, 0x7E, 0x72, 0x95, 0xB6, 0xA3, 0x7D, 0x7D, 0xAB, 0xD0, 0xB8, 
-    0x85, 0x85, 0xB0, 0xB7, 0x87, 0x5E, 0x62, 0x77, 0x76, 0x5E, 0x51, 0x62, 0x71, 0x63, 0x54, 0x60, 
-    0x76, 0x77, 0x6B, 0x68, 0x78, 0x8C, 0x8D, 0x7E, 0x7D, 0x95, 0xAB, 0xA9, 0x9D, 0x9A, 0xA0, 0xA5, 
-    0x9C, 0x89, 0x7F, 0x82, 0x82, 0x7B, 0x77, 0x73, 0x6A, 0x66, 0x68, 0x64, 0x61, 0x66, 0x67, 0x60, 
-    0x60, 0x6F, 0x7E, 0x82, 0x80, 0x84, 0x95, 0xA5, 0xA4, 0x9A, 0x96, 0x96, 0x95, 0x95, 0x93, 0x89, 
-    0x82, 0x88, 0x8D, 0x87, 0x83, 0x80, 0x74, 0x67, 0x68, 0x6D, 0x69, 0x62, 0x65, 0x70, 0x7F, 0x89, 
-    0x88, 0x86, 0x8A, 0x8D, 0x8B, 0x88, 0x89, 0x8B, 0x8F, 0x8F, 0x8A, 0x87, 0x87, 0x85, 0x7E, 0x78, 
-    0x74, 0x6B, 0x64, 0x65, 0x6A, 0x6B, 0x65, 0x5C, 0x5D, 0x65, 0x6A, 0x77, 0x8F, 0x8F, 0x78, 0x7A, 
-    0x9F, 0xAD, 0x90, 0x76, 0x84, 0xA9, 0xB9, 0x98, 0x74, 0x83, 0xAF, 0xB2, 0x89, 0x6E, 0x7A, 0x8E, 
-    0x87, 0x67, 0x58, 0x6A, 0x79, 0x67, 0x58, 0x6D, 0x86, 0x7A, 0x5E, 0x5A, 0x70, 0x82, 0x77, 0x62, 
-    0x67, 0x85, 0x99, 0x97, 0x93, 0x99, 0x9E, 0x9C, 0x97, 0x90, 0x8B, 0x89, 0x85, 0x85, 0x8C, 0x91, 
-    0x8B, 0x83, 0x7E, 0x7A, 0x75, 0x6F, 0x66, 0x5C, 0x5B, 0x66, 0x72, 0x76, 0x72, 0x72, 0x7A, 0x83, 
-    0x83, 0x80, 0x84, 0x8A, 0x8B, 0x8E, 0x95, 0x99, 0x99, 0x9C, 0x9D, 0x98, 0x94, 0x91, 0x8B, 0x83, 
-    0x7E, 0x7A, 0x74, 0x72, 0x72, 0x6F, 0x6D, 0x6D, 0x6C, 0x6D, 0x73, 0x79, 0x77, 0x77, 0x7B, 0x80, 
-    0x82, 0x84, 0x86, 0x86, 0x8B, 0x8F, 0x8A, 0x83, 0x85, 0x86, 0x7E, 0x72, 0x69, 0x66, 0x68, 0x64, 
-    0x60, 0x75, 0x8F, 0x82, 0x61, 0x6C, 0x99, 0xA3, 0x7F, 0x66, 0x7D, 0xAA, 0xB7, 0x91, 0x75, 0x96, 
-    0xC2, 0xB4, 0x86, 0x79, 0x8C, 0x93, 0x7D, 0x62, 0x62, 0x75, 0x74, 0x5C, 0x59, 0x77, 0x83, 0x6C, 
-    0x5A, 0x66, 0x7C, 0x7E, 0x6A, 0x5B, 0x6F, 0x8F, 0x94, 0x85, 0x86, 0x98, 0x9E, 0x95, 0x8A, 0x89, 
-    0x8D, 0x8D, 0x85, 0x83, 0x8C, 0x8F, 0x85, 0x7F, 0x85, 0x87, 0x80, 0x78, 0x6F, 0x6B, 0x71, 0x79, 
-    0x75, 0x6E, 0x6E, 0x78, 0x82, 0x83, 0x79, 0x77, 0x7F, 0x85, 0x83, 0x85, 0x89, 0x88, 0x89, 0x90, 
-    0x94, 0x90, 0x8E, 0x8C, 0x89, 0x88, 0x8C, 0x8B, 0x85, 0x7F, 0x7F, 0x81, 0x80, 0x7C, 0x75, 0x74, 
-    0x78, 0x7C, 0x7B, 0x77, 0x71, 0x6D, 0x72, 0x78, 0x74, 0x6C, 0x6E, 0x77, 0x7D, 0x80, 0x81, 0x7C, 
-    0x77, 0x78, 0x77, 0x6F, 0x68, 0x6D, 0x81, 0x94, 0x8B, 0x78, 0x86, 0xAA, 0xAC, 0x89, 0x77, 0x8A, 
-    0xA3, 0x9C, 0x7B, 0x6F, 0x8E, 0xA8, 0x93, 0x72, 0x79, 0x93, 0x8F, 0x6F, 0x5F, 0x71, 0x84, 0x76, 
-    0x5D, 0x66, 0x86, 0x87, 0x68, 0x5F, 0x7A, 0x8C, 0x7C, 0x61, 0x62, 0x7D, 0x8E, 0x82, 0x72, 0x7B, 
-    0x90, 0x95, 0x8D, 0x89, 0x8E, 0x91, 0x8E, 0x88, 0x89, 0x8C, 0x87, 0x7B, 0x79, 0x83, 0x87, 0x7F, 
-    0x77, 0x74, 0x76, 0x7B, 0x7B, 0x73, 0x6C, 0x6F, 0x78, 0x7F, 0x7E, 0x7B, 0x80, 0x8B, 0x8F, 0x8D, 
-    0x8E, 0x8F, 0x88, 0x83, 0x89, 0x8C, 0x87, 0x84, 0x84, 0x86, 0x8A, 0x8D, 0x84, 0x79, 0x78, 0x7D, 
-    0x7C, 0x75, 0x71, 0x75, 0x80, 0x88, 0x86, 0x80, 0x7F, 0x80, 0x7D, 0x7C, 0x7B, 0x74, 0x6F, 0x71, 
-    0x75, 0x73, 0x6F, 0x6B, 0x67, 0x66, 0x69, 0x68, 0x63, 0x70, 0x89, 0x8A, 0x76, 0x7C, 0xA0, 0xB0, 
-    0x9A, 0x85, 0x93, 0xB3, 0xB6, 0x94, 0x7E, 0x95, 0xB0, 0xA1, 0x80, 0x7C, 0x8B, 0x8B, 0x75, 0x63, 
-    0x68, 0x74, 0x68, 0x51, 0x55, 0x72, 0x7B, 0x66, 0x5B, 0x6C, 0x82, 0x81, 0x70, 0x68, 0x77, 0x88, 
-    0x87, 0x81, 0x87, 0x92, 0x94, 0x95, 0x99, 0x99, 0x93, 0x8F, 0x8E, 0x90, 0x8E, 0x83, 0x75, 0x74, 
-    0x7C, 0x7C, 0x74, 0x71, 0x71, 0x71, 0x72, 0x73, 0x72, 0x6E, 0x6D, 0x6F, 0x78, 0x80, 0x82, 0x82, 
-    0x88, 0x8E, 0x93, 0x98, 0x97, 0x8F, 0x8E, 0x96, 0x95, 0x8D, 0x89, 0x89, 0x89, 0x8D, 0x8F, 0x85, 
-    0x7C, 0x7C, 0x79, 0x71, 0x6B, 0x67, 0x65, 0x69, 0x73, 0x79, 0x7B, 0x7E, 0x80, 0x82, 0x84, 0x84, 
-    0x7F, 0x7A, 0x79, 0x79, 0x79, 0x76, 0x6E, 0x65, 0x63, 0x65, 0x64, 0x71, 0x86, 0x7D, 0x63, 0x71, 
-    0x9F, 0xAA, 0x88, 0x75, 0x8E, 0xB2, 0xB4, 0x92, 0x81, 0xA1, 0xBF, 0xAA, 0x86, 0x84, 0x93, 0x8F, 
-    0x7C, 0x6F, 0x73, 0x79, 0x6C, 0x59, 0x5F, 0x76, 0x72, 0x58, 0x52, 0x68, 0x79, 0x71, 0x62, 0x63, 
-    0x75, 0x81, 0x7F, 0x7E, 0x8A, 0x95, 0x94, 0x95, 0x9D, 0xA0, 0x9A, 0x92, 0x8E, 0x91, 0x93, 0x88, 
-    0x7B, 0x7C, 0x83, 0x81, 0x77, 0x70, 0x6C, 0x6B, 0x6F, 0x71, 0x69, 0x65, 0x6A, 0x73, 0x79, 0x79, 
-    0x78, 0x7C, 0x85, 0x8C, 0x93, 0x98, 0x95, 0x91, 0x96, 0x9E, 0x9F, 0x99, 0x91, 0x8C, 0x8C, 0x8E, 
-    0x8A, 0x81, 0x77, 0x72, 0x76, 0x79, 0x73, 0x6A, 0x6A, 0x70, 0x74, 0x73, 0x72, 0x74, 0x79, 0x7E, 
-    0x80, 0x7A, 0x73, 0x73, 0x78, 0x77, 0x6D, 0x60, 0x5C, 0x61, 0x6C, 0x81, 0x90, 0x7F, 0x6C, 0x88, 
-    0xB6, 0xAD, 0x7C, 0x75, 0x9E, 0xBA, 0xA8, 0x83, 0x7F, 0xA1, 0xB1, 0x95, 0x7E, 0x8B, 0x93, 0x81, 
-    0x70, 0x71, 0x77, 0x6E, 0x58, 0x50, 0x67, 0x7C, 0x6C, 0x55, 0x61, 0x83, 0x8D, 0x78, 0x67, 0x6E, 
-    0x83, 0x88, 0x7E, 0x7B, 0x8A, 0x95, 0x96, 0x9B, 0xA2, 0x9E, 0x92, 0x8C, 0x8C, 0x8C, 0x82, 0x70, 
-    0x69, 0x77, 0x82, 0x7A, 0x71, 0x74, 0x77, 0x76, 0x79, 0x78, 0x6E, 0x66, 0x6B, 0x76, 0x7F, 0x80, 
-    0x7E, 0x86, 0x94, 0x9D, 0x9F, 0x9D, 0x93, 0x87, 0x8B, 0x94, 0x8D, 0x81, 0x82, 0x88, 0x88, 0x8B, 
-    0x8F, 0x84, 0x75, 0x72, 0x75, 0x71, 0x6C, 0x68, 0x6B, 0x74, 0x7D, 0x7F, 0x7F, 0x7E, 0x7A, 0x76, 
-    0x78, 0x75, 0x67, 0x5D, 0x5D, 0x5C, 0x58, 0x5D, 0x6F, 0x92, 0x9E, 0x7B, 0x7A, 0xBC, 0xD6, 0x92, 
-    0x62, 0x8A, 0xB4, 0xAA, 0x89, 0x78, 0x93, 0xBE, 0xB6, 0x85, 0x79, 0x88, 0x7A, 0x5E, 0x56, 0x5B, 
-    0x58, 0x51, 0x51, 0x6B, 0x90, 0x90, 0x6E, 0x6C, 0x8E, 0x9B, 0x85, 0x6F, 0x69, 0x72, 0x8C, 0x9F, 
-    0x96, 0x86, 0x8C, 0x9D, 0xA3, 0x95, 0x79, 0x65, 0x66, 0x6A, 0x6B, 0x70, 0x6F, 0x69, 0x74, 0x8D, 
-    0x92, 0x85, 0x7C, 0x76, 0x72, 0x7D, 0x8B, 0x83, 0x77, 0x84, 0xA2, 0xB4, 0xA7, 0x91, 0x91, 0x9A, 
-    0x8D, 0x79, 0x73, 0x69, 0x60, 0x72, 0x87, 0x81, 0x7A, 0x81, 0x82, 0x81, 0x88, 0x80, 0x69, 0x66, 
-    0x77, 0x85, 0x8C, 0x89, 0x81, 0x86, 0x95, 0x92, 0x81, 0x72, 0x6B, 0x69, 0x6C, 0x69, 0x5C, 0x50, 
-    0x49, 0x47, 0x4B, 0x5D, 0x95, 0xC4, 0x96, 0x59, 0x9A, 0xFB, 0xC5, 0x4F, 0x5C, 0xC0, 0xE2, 0xB2, 
-    0x79, 0x7A, 0xB3, 0xC7, 0x83, 0x46, 0x4F, 0x5C, 0x47, 0x44, 0x5E, 0x69, 0x5F, 0x60, 0x7D, 0xA3, 
-    0xA8, 0x82, 0x64, 0x7C, 0xA6, 0xA8, 0x8E, 0x7D, 0x80, 0x97, 0xB1, 0xA9, 0x83, 0x6B, 0x71, 0x78, 
-    0x70, 0x5E, 0x4B, 0x4B, 0x5E, 0x72, 0x7B, 0x78, 0x74, 0x7B, 0x8D, 0x91, 0x84, 0x80, 0x86, 0x86, 
-    0x8C, 0xA2, 0xAC, 0x96, 0x83, 0x91, 0xA7, 0x9C, 0x7C, 0x6C, 0x74, 0x82, 0x85, 0x80, 0x79, 0x72, 
-    0x78, 0x8B, 0x93, 0x7E, 0x68, 0x6D, 0x7D, 0x83, 0x7E, 0x76, 0x74, 0x7C, 0x8A, 0x92, 0x89, 0x7C, 
-    0x7A, 0x85, 0x8C, 0x85, 0x7D, 0x7A, 0x78, 0x7A, 0x7E, 0x75, 0x5D, 0x4D, 0x4D, 0x4B, 0x41, 0x46, 
-    0x70, 0xB1, 0xBA, 0x7B, 0x6F, 0xC8, 0xED, 0x8F, 0x49, 0x82, 0xD2, 0xD3, 0x9C, 0x77, 0x90, 0xC1, 
-    0xAD, 0x5C, 0x38, 0x50, 0x58, 0x43, 0x48, 0x67, 0x78, 0x77, 0x7D, 0x92, 0xA5, 0x9D, 0x77, 0x5E, 
-    0x76, 0x99, 0x96, 0x7F, 0x7C, 0x90, 0xAA, 0xB0, 0x91, 0x6C, 0x67, 0x71, 0x66, 0x58, 0x5D, 0x68, 
-    0x72, 0x80, 0x8D, 0x93, 0x8E, 0x81, 0x7A, 0x7C, 0x7C, 0x76, 0x73, 0x75, 0x7C, 0x8D, 0x9E, 0x99, 
-    0x87, 0x82, 0x8B, 0x8F, 0x83, 0x77, 0x7E, 0x89, 0x84, 0x85, 0x9E, 0xA4, 0x88, 0x7D, 0x8C, 0x8D, 
-    0x7D, 0x6E, 0x65, 0x6B, 0x81, 0x85, 0x76, 0x73, 0x81, 0x88, 0x83, 0x7C, 0x77, 0x76, 0x79, 0x80, 
-    0x82, 0x7D, 0x75, 0x71, 0x70, 0x6B, 0x5A, 0x46, 0x42, 0x5A, 0x74, 0x7B, 0x7C, 0x93, 0xB8, 0xBD, 
-    0x9B, 0x8B, 0xA6, 0xB3, 0x97, 0x84, 0x94, 0xAC, 0xAE, 0x92, 0x73, 0x70, 0x7B, 0x69, 0x47, 0x42, 
-    0x58, 0x68, 0x6E, 0x7B, 0x89, 0x8D, 0x90, 0x92, 0x8D, 0x86, 0x82, 0x7E, 0x79, 0x7C, 0x88, 0x90, 
-    0x92, 0x8B, 0x80, 0x7B, 0x7C, 0x72, 0x5F, 0x57, 0x62, 0x70, 0x7B, 0x83, 0x88, 0x8D, 0x93, 0x95, 
-    0x8B, 0x7D, 0x79, 0x7A, 0x75, 0x73, 0x7E, 0x8C, 0x8F, 0x8C, 0x8E, 0x90, 0x8B, 0x83, 0x7E, 0x81, 
-    0x82, 0x7F, 0x7E, 0x87, 0x8F, 0x8D, 0x8C, 0x8C, 0x84, 0x7C, 0x7C, 0x79, 0x6E, 0x6C, 0x76, 0x7D, 
-    0x7F, 0x81, 0x84, 0x8A, 0x90, 0x8B, 0x82, 0x7F, 0x80, 0x7D, 0x79, 0x75, 0x6E, 0x64, 0x5D, 0x53, 
-    0x47, 0x4C, 0x5F, 0x68, 0x66, 0x7D, 0xAA, 0xB6, 0x91, 0x80, 0xA2, 0xBC, 0xA4, 0x87, 0x94, 0xB5, 
-    0xBB, 0x9A, 0x79, 0x7B, 0x88, 0x76, 0x50, 0x45, 0x59, 0x6B, 0x6F, 0x72, 0x7C, 0x8B, 0x99, 0x97, 
-    0x88, 0x80, 0x87, 0x87, 0x7C, 0x77, 0x7D, 0x83, 0x86, 0x83, 0x7A, 0x76, 0x7E, 0x7B, 0x6B, 0x63, 
-    0x6A, 0x73, 0x77, 0x7B, 0x83, 0x8E, 0x95, 0x91, 0x89, 0x84, 0x80, 0x7B, 0x74, 0x6D, 0x6F, 0x7C, 
-    0x88, 0x85, 0x7F, 0x87, 0x97, 0x96, 0x8B, 0x89, 0x8D, 0x8D, 0x90, 0x94, 0x92, 0x8E, 0x8C, 0x86, 
-    0x82, 0x7F, 0x74, 0x66, 0x64, 0x6D, 0x70, 0x6D, 0x6E, 0x73, 0x79, 0x84, 0x8A, 0x85, 0x81, 0x88, 
-    0x8E, 0x89, 0x80, 0x79, 0x70, 0x64, 0x5A, 0x59, 0x5D, 0x62, 0x6C, 0x81, 0x9A, 0xA9, 0x9B, 0x7C, 
-    0x7B, 0x98, 0x9B, 0x7E, 0x79, 0x9A, 0xB5, 0xAF, 0x94, 0x7F, 0x80, 0x82, 0x68, 0x43, 0x3F, 0x5C, 
-    0x73, 0x76, 0x7F, 0x94, 0xA5, 0xAA, 0xA3, 0x93, 0x88, 0x89, 0x85, 0x77, 0x73, 0x7E, 0x85, 0x80, 
-    0x78, 0x73, 0x72, 0x71, 0x69, 0x60, 0x61, 0x6B, 0x73, 0x7A, 0x86, 0x93, 0x98, 0x96, 0x93, 0x91, 
-    0x8C, 0x86, 0x7F, 0x72, 0x6A, 0x6D, 0x76, 0x78, 0x71, 0x6D, 0x77, 0x85, 0x89, 0x84, 0x84, 0x8B, 
-    0x96, 0x9F, 0x9F, 0x9B, 0x9B, 0x98, 0x90, 0x8D, 0x8A, 0x7E, 0x75, 0x77, 0x78, 0x72, 0x70, 0x70, 
-    0x69, 0x66, 0x6B, 0x70, 0x6D, 0x6D, 0x76, 0x80, 0x83, 0x7E, 0x79, 0x72, 0x6A, 0x63, 0x60, 0x62, 
-    0x70, 0x8D, 0xAE, 0xB2, 0x91, 0x81, 0x9E, 0xB1, 0x92, 0x72, 0x7F, 0x9E, 0xA4, 0x8D, 0x74, 0x74, 
-    0x82, 0x7D, 0x5E, 0x49, 0x54, 0x6C, 0x77, 0x79, 0x7C, 0x86, 0x98, 0xA4, 0x9B, 0x8A, 0x8A, 0x93, 
-    0x8E, 0x81, 0x7F, 0x88, 0x8A, 0x7F, 0x70, 0x67, 0x6B, 0x74, 0x6C, 0x5C, 0x60, 0x73, 0x80, 0x84, 
-    0x87, 0x8D, 0x95, 0x9C, 0x98, 0x8A, 0x88, 0x92, 0x8E, 0x76, 0x6A, 0x75, 0x7E, 0x78, 0x6F, 0x6E, 
-    0x73, 0x77, 0x73, 0x6F, 0x76, 0x83, 0x86, 0x88, 0x93, 0x9F, 0xA1, 0x9E, 0x9A, 0x92, 0x8B, 0x89, 
-    0x84, 0x78, 0x71, 0x78, 0x7F, 0x7A, 0x70, 0x6F, 0x75, 0x73, 0x68, 0x63, 0x69, 0x6D, 0x68, 0x64, 
-    0x69, 0x70, 0x73, 0x78, 0x84, 0x9F, 0xC2, 0xC6, 0x97, 0x6F, 0x83, 0xA0, 0x90, 0x6E, 0x71, 0x93, 
-    0xAB, 0x9F, 0x7A, 0x68, 0x74, 0x77, 0x54, 0x35, 0x3F, 0x61, 0x7A, 0x88, 0x8E, 0x8F, 0x9D, 0xB5, 
-    0xB1, 0x8E, 0x7D, 0x88, 0x8D, 0x81, 0x7D, 0x8B, 0x97, 0x93, 0x81, 0x70, 0x6F, 0x73, 0x68, 0x53, 
-    0x4E, 0x59, 0x68, 0x76, 0x80, 0x86, 0x8C, 0x96, 0x99, 0x8F, 0x89, 0x92, 0x99, 0x8E, 0x81, 0x81, 
-    0x89, 0x8D, 0x8A, 0x82, 0x7C, 0x7A, 0x78, 0x73, 0x70, 0x74, 0x77, 0x75, 0x74, 0x7B, 0x86, 0x8D, 
-    0x8C, 0x89, 0x87, 0x88, 0x8A, 0x8B, 0x83, 0x7A, 0x79, 0x79, 0x74, 0x73, 0x76, 0x76, 0x6E, 0x6A, 
-    0x6D, 0x6E, 0x67, 0x5D, 0x58, 0x5D, 0x6A, 0x7E, 0xA5, 0xCD, 0xC4, 0x98, 0x92, 0xB3, 0xB2, 0x89, 
-    0x75, 0x87, 0x9C, 0x9D, 0x87, 0x70, 0x75, 0x89, 0x79, 0x45, 0x2C, 0x41, 0x5B, 0x63, 0x69, 0x71, 
-    0x7F, 0x9A, 0xAE, 0xA9, 0x97, 0x92, 0x94, 0x8D, 0x80, 0x7C, 0x85, 0x95, 0x97, 0x85, 0x79, 0x82, 
-    0x88, 0x76, 0x5F, 0x59, 0x5C, 0x5F, 0x6A, 0x78, 0x80, 0x89, 0x94, 0x90, 0x80, 0x81, 0x90, 0x90, 
-    0x7A, 0x6C, 0x77, 0x8D, 0x9B, 0x99, 0x91, 0x8F, 0x90, 0x88, 0x7A, 0x77, 0x7A, 0x76, 0x6F, 0x70, 
-    0x79, 0x84, 0x8E, 0x8B, 0x7D, 0x79, 0x83, 0x86, 0x77, 0x6C, 0x75, 0x7F, 0x79, 0x71, 0x7A, 0x87, 
-    0x83, 0x75, 0x6F, 0x6E, 0x65, 0x59, 0x5B, 0x64, 0x67, 0x73, 0xA1, 0xCA, 0xB7, 0x88, 0x85, 0xA1, 
-    0x9C, 0x7A, 0x72, 0x8B, 0xA1, 0x9D, 0x88, 0x80, 0x94, 0xA4, 0x88, 0x56, 0x45, 0x58, 0x69, 0x6B, 
-    0x69, 0x6C, 0x78, 0x8F, 0x9E, 0x95, 0x88, 0x8D, 0x93, 0x86, 0x78, 0x79, 0x83, 0x8A, 0x88, 0x7C, 
-    0x78, 0x83, 0x8A, 0x7F, 0x70, 0x69, 0x66, 0x65, 0x6A, 0x71, 0x78, 0x85, 0x90, 0x8A, 0x80, 0x8B, 
-    0x9E, 0x96, 0x7B, 0x70, 0x79, 0x81, 0x82, 0x82, 0x83, 0x85, 0x89, 0x89, 0x83, 0x82, 0x84, 0x83, 
-    0x80, 0x7E, 0x7E, 0x82, 0x88, 0x89, 0x85, 0x82, 0x82, 0x7C, 0x73, 0x73, 0x78, 0x74, 0x68, 0x66, 
-    0x72, 0x7E, 0x7F, 0x79, 0x71, 0x6A, 0x67, 0x68, 0x6B, 0x6E, 0x76, 0x90, 0xB3, 0xBC, 0xA2, 0x91, 
-    0x9D, 0xA3, 0x8F, 0x79, 0x79, 0x87, 0x8D, 0x82, 0x73, 0x75, 0x87, 0x8B, 0x72, 0x57, 0x54, 0x64, 
-    0x6F, 0x70, 0x6F, 0x75, 0x86, 0x9B, 0xA1, 0x97, 0x92, 0x99, 0x98, 0x86, 0x77, 0x79, 0x82, 0x82, 
-    0x78, 0x72, 0x79, 0x85, 0x89, 0x7D, 0x6F, 0x6C, 0x6F, 0x6E, 0x6C, 0x6D, 0x76, 0x82, 0x88, 0x83, 
-    0x84, 0x93, 0x9D, 0x95, 0x86, 0x80, 0x82, 0x85, 0x85, 0x7F, 0x7B, 0x81, 0x88, 0x84, 0x7C, 0x7B, 
-    0x7D, 0x7B, 0x75, 0x6E, 0x72, 0x7F, 0x89, 0x89, 0x87, 0x8C, 0x92, 0x8C, 0x80, 0x7D, 0x7E, 0x75, 
-    0x67, 0x62, 0x6B, 0x76, 0x79, 0x73, 0x6C, 0x6A, 0x6B, 0x68, 0x66, 0x6C, 0x7D, 0x98, 0xAE, 0xAB, 
-    0x9A, 0x9A, 0xAB, 0xAB, 0x91, 0x80, 0x8B, 0x99, 0x92, 0x7D, 0x70, 0x79, 0x8A, 0x83, 0x66, 0x55, 
-    0x5E, 0x69, 0x67, 0x63, 0x68, 0x73, 0x7D, 0x85, 0x87, 0x88, 0x8E, 0x96, 0x92, 0x87, 0x84, 0x8C, 
-    0x92, 0x8D, 0x85, 0x84, 0x88, 0x8A, 0x85, 0x7A, 0x72, 0x6F, 0x6D, 0x69, 0x67, 0x6A, 0x70, 0x75, 
-    0x75, 0x74, 0x7B, 0x8B, 0x93, 0x8F, 0x8B, 0x91, 0x94, 0x8E, 0x8A, 0x8D, 0x90, 0x8C, 0x86, 0x84, 
-    0x87, 0x87, 0x80, 0x79, 0x74, 0x6F, 0x6A, 0x6E, 0x77, 0x7C, 0x7D, 0x7F, 0x86, 0x89, 0x87, 0x86, 
-    0x85, 0x7D, 0x6F, 0x6A, 0x70, 0x77, 0x78, 0x74, 0x72, 0x71, 0x71, 0x6F, 0x69, 0x63, 0x65, 0x73, 
-    0x88, 0x9B, 0x9E, 0x99, 0x9F, 0xAC, 0xAA, 0x9A, 0x93, 0x9B, 0x9C, 0x8D, 0x7B, 0x76, 0x7F, 0x88, 
-    0x81, 0x6E, 0x64, 0x69, 0x6C, 0x67, 0x65, 0x69, 0x6E, 0x73, 0x79, 0x7D, 0x81, 0x8E, 0x9B, 0x93, 
-    0x83, 0x80, 0x88, 0x8A, 0x82, 0x7D, 0x80, 0x87, 0x8A, 0x87, 0x85, 0x87, 0x85, 0x7B, 0x70, 0x6C, 
-    0x6B, 0x69, 0x68, 0x6A, 0x6B, 0x6F, 0x7A, 0x84, 0x86, 0x89, 0x91, 0x92, 0x8A, 0x87, 0x90, 0x97, 
-    0x92, 0x8B, 0x8A, 0x8E, 0x90, 0x8D, 0x85, 0x7E, 0x7B, 0x77, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 
-    0x7F, 0x85, 0x88, 0x85, 0x80, 0x7C, 0x7B, 0x7B, 0x78, 0x73, 0x6F, 0x71, 0x73, 0x72, 0x6D, 0x6A, 
-    0x6A, 0x69, 0x67, 0x67, 0x6F, 0x82, 0x9A, 0x9F, 0x94, 0x93, 0xA3, 0xAA, 0x9D, 0x94, 0x99, 0x9F, 
-    0x97, 0x88, 0x7E, 0x84, 0x8D, 0x87, 0x71, 0x62, 0x67, 0x6E, 0x6C, 0x6A, 0x6C, 0x6C, 0x6D, 0x74, 
-    0x7B, 0x7C, 0x81, 0x89, 0x86, 0x7D, 0x7F, 0x8C, 0x91, 0x8C, 0x83, 0x7F, 0x83, 0x8C, 0x8F, 0x8E, 
-    0x8C, 0x89, 0x82, 0x78, 0x74, 0x77, 0x77, 0x6E, 0x62, 0x5F, 0x68, 0x77, 0x7D, 0x78, 0x75, 0x7C, 
-    0x82, 0x81, 0x82, 0x87, 0x89, 0x88, 0x8C, 0x91, 0x93, 0x97, 0x9B, 0x97, 0x8F, 0x8A, 0x88, 0x83, 
-    0x7F, 0x7D, 0x7D, 0x7C, 0x7A, 0x79, 0x7B, 0x81, 0x87, 0x84, 0x7B, 0x77, 0x79, 0x7A, 0x77, 0x71, 
-    0x6F, 0x71, 0x74, 0x75, 0x73, 0x72, 0x73, 0x71, 0x6B, 0x65, 0x65, 0x6B, 0x76, 0x86, 0x96, 0x97, 
-    0x8D, 0x8E, 0x9C, 0xA1, 0x93, 0x8A, 0x90, 0x99, 0x94, 0x89, 0x85, 0x8D, 0x96, 0x92, 0x81, 0x75, 
-    0x79, 0x7F, 0x76, 0x69, 0x67, 0x6C, 0x6C, 0x69, 0x67, 0x69, 0x70, 0x78, 0x77, 0x71, 0x75, 0x83, 
-    0x8B, 0x8B, 0x89, 0x8C, 0x94, 0x9B, 0x9C, 0x99, 0x99, 0x99, 0x90, 0x83, 0x7C, 0x7D, 0x7B, 0x72, 
-    0x67, 0x5E, 0x5F, 0x66, 0x6A, 0x64, 0x5F, 0x65, 0x6F, 0x70, 0x6F, 0x7B, 0x8D, 0x93, 0x8E, 0x91, 
-    0xA0, 0xAD, 0xAD, 0xA7, 0xA4, 0xA2, 0x9B, 0x92, 0x8A, 0x86, 0x83, 0x7C, 0x72, 0x6E, 0x72, 0x75, 
-    0x72, 0x6C, 0x68, 0x6A, 0x6E, 0x71, 0x71, 0x71, 0x76, 0x7C, 0x7E, 0x82, 0x86, 0x88, 0x87, 0x84, 
-    0x7F, 0x7A, 0x76, 0x6F, 0x66, 0x63, 0x66, 0x70, 0x81, 0x8B, 0x83, 0x7C, 0x87, 0x94, 0x8D, 0x82, 
-    0x8B, 0x9B, 0x9E, 0x95, 0x90, 0x95, 0xA0, 0xA4, 0x96, 0x84, 0x81, 0x87, 0x7E, 0x6D, 0x66, 0x68, 
-    0x66, 0x61, 0x5F, 0x61, 0x67, 0x71, 0x75, 0x6E, 0x6F, 0x80, 0x8E, 0x89, 0x80, 0x86, 0x92, 0x97, 
-    0x95, 0x98, 0x9F, 0xA1, 0x99, 0x8E, 0x89, 0x89, 0x82, 0x73, 0x65, 0x5E, 0x5A, 0x5A, 0x5F, 0x62, 
-    0x60, 0x65, 0x70, 0x73, 0x70, 0x76, 0x84, 0x89, 0x86, 0x88, 0x96, 0xA4, 0xAB, 0xAC, 0xAC, 0xAC, 
-    0xA8, 0x9F, 0x93, 0x8B, 0x83, 0x7A, 0x71, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x71, 0x6F, 0x71, 0x75, 
-    0x74, 0x72, 0x76, 0x7A, 0x78, 0x79, 0x83, 0x8C, 0x8B, 0x86, 0x87, 0x88, 0x80, 0x76, 0x72, 0x70, 
-    0x6C, 0x66, 0x64, 0x65, 0x66, 0x6C, 0x7F, 0x90, 0x87, 0x78, 0x7F, 0x95, 0x94, 0x80, 0x7E, 0x92, 
-    0xA0, 0x9A, 0x90, 0x94, 0xA5, 0xAD, 0x9F, 0x8A, 0x86, 0x8F, 0x8E, 0x7C, 0x6E, 0x6D, 0x6E, 0x67, 
-    0x60, 0x5C, 0x5E, 0x65, 0x69, 0x61, 0x5C, 0x6C, 0x82, 0x83, 0x76, 0x77, 0x87, 0x92, 0x91, 0x91, 
-    0x99, 0xA0, 0x9E, 0x98, 0x94, 0x96, 0x9A, 0x96, 0x86, 0x75, 0x6D, 0x6F, 0x70, 0x68, 0x5C, 0x5A, 
-    0x65, 0x6A, 0x64, 0x64, 0x75, 0x80, 0x78, 0x70, 0x7C, 0x8E, 0x95, 0x94, 0x97, 0x9F, 0xA4, 0xA5, 
-    0xA7, 0xAA, 0xA8, 0x9F, 0x91, 0x86, 0x82, 0x7E, 0x78, 0x71, 0x6D, 0x69, 0x69, 0x6D, 0x6E, 0x6B, 
-    0x6A, 0x6C, 0x6B, 0x6C, 0x73, 0x7F, 0x83, 0x81, 0x85, 0x90, 0x95, 0x91, 0x8C, 0x8A, 0x85, 0x78, 
-    0x6E, 0x6B, 0x6B, 0x67, 0x62, 0x5C, 0x59, 0x61, 0x79, 0x89, 0x7D, 0x6F, 0x80, 0x9A, 0x9A, 0x8D, 
-    0x95, 0xAD, 0xB4, 0xA5, 0x99, 0x9F, 0xAD, 0xAE, 0x98, 0x81, 0x80, 0x89, 0x83, 0x6E, 0x61, 0x5F, 
-    0x5C, 0x54, 0x4E, 0x4D, 0x54, 0x61, 0x67, 0x63, 0x66, 0x7D, 0x93, 0x92, 0x84, 0x83, 0x91, 0x99, 
-    0x95, 0x94, 0x9D, 0xA5, 0xA1, 0x94, 0x8D, 0x91, 0x94, 0x88, 0x72, 0x65, 0x68, 0x70, 0x72, 0x6C, 
-    0x68, 0x6B, 0x73, 0x76, 0x73, 0x75, 0x7D, 0x7E, 0x74, 0x6F, 0x7D, 0x8F, 0x92, 0x8D, 0x8F, 0x94, 
-    0x94, 0x91, 0x92, 0x90, 0x8A, 0x87, 0x88, 0x88, 0x88, 0x8B, 0x8B, 0x86, 0x80, 0x7D, 0x7E, 0x7F, 
-    0x7C, 0x76, 0x73, 0x77, 0x79, 0x77, 0x79, 0x81, 0x81, 0x76, 0x71, 0x7A, 0x80, 0x7A, 0x73, 0x74, 
-    0x76, 0x77, 0x79, 0x7D, 0x7F, 0x7E, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x77, 0x6E, 0x6F, 0x84, 
-    0x93, 0x86, 0x76, 0x83, 0x94, 0x8A, 0x78, 0x81, 0x95, 0x96, 0x88, 0x80, 0x8A, 0x9C, 0xA2, 0x94, 
-    0x82, 0x83, 0x91, 0x91, 0x82, 0x79, 0x7C, 0x7C, 0x74, 0x6D, 0x67, 0x66, 0x69, 0x66, 0x58, 0x51, 
-    0x61, 0x73, 0x72, 0x68, 0x70, 0x85, 0x8E, 0x89, 0x8A, 0x96, 0x9E, 0x99, 0x92, 0x93, 0x9E, 0xA7, 
-    0xA4, 0x97, 0x8D, 0x8C, 0x8D, 0x87, 0x78, 0x6B, 0x68, 0x6C, 0x69, 0x60, 0x62, 0x71, 0x76, 0x69, 
-    0x63, 0x72, 0x81, 0x7E, 0x74, 0x77, 0x83, 0x8A, 0x8B, 0x90, 0x94, 0x96, 0x9A, 0x9B, 0x94, 0x8C, 
-    0x8E, 0x93, 0x8C, 0x7D, 0x7A, 0x83, 0x86, 0x7B, 0x6F, 0x73, 0x7A, 0x77, 0x6F, 0x72, 0x7E, 0x82, 
-    0x7D, 0x7B, 0x82, 0x89, 0x87, 0x80, 0x7C, 0x7D, 0x80, 0x7F, 0x7B, 0x7A, 0x7E, 0x81, 0x81, 0x7E, 
-    0x7A, 0x7B, 0x7B, 0x76, 0x6E, 0x6D, 0x72, 0x74, 0x71, 0x70, 0x72, 0x7B, 0x8B, 0x91, 0x83, 0x77, 
-    0x83, 0x90, 0x84, 0x71, 0x7C, 0x96, 0x9A, 0x8A, 0x83, 0x91, 0xA0, 0x9B, 0x87, 0x79, 0x7E, 0x89, 
-    0x86, 0x7B, 0x78, 0x81, 0x85, 0x80, 0x77, 0x74, 0x74, 0x72, 0x6A, 0x60, 0x63, 0x73, 0x7E, 0x77, 
-    0x6C, 0x74, 0x85, 0x87, 0x7D, 0x7B, 0x86, 0x8C, 0x89, 0x89, 0x92, 0x9D, 0xA2, 0x9D, 0x94, 0x8E, 
-    0x8F, 0x91, 0x88, 0x79, 0x72, 0x76, 0x79, 0x74, 0x6F, 0x72, 0x77, 0x72, 0x6A, 0x69, 0x70, 0x76, 
-    0x72, 0x6E, 0x71, 0x7B, 0x83, 0x84, 0x82, 0x83, 0x86, 0x88, 0x87, 0x85, 0x87, 0x8C, 0x8D, 0x88, 
-    0x83, 0x86, 0x8E, 0x8F, 0x87, 0x82, 0x87, 0x8D, 0x89, 0x83, 0x86, 0x8C, 0x89, 0x80, 0x7C, 0x7D, 
-    0x7F, 0x7D, 0x78, 0x73, 0x73, 0x78, 0x7A, 0x77, 0x76, 0x7B, 0x7F, 0x7D, 0x7A, 0x7D, 0x82, 0x82, 
-    0x7D, 0x79, 0x7C, 0x81, 0x7F, 0x79, 0x76, 0x77, 0x77, 0x73, 0x70, 0x70, 0x6F, 0x6B, 0x6D, 0x79, 
-    0x82, 0x7B, 0x74, 0x7F, 0x8E, 0x8B, 0x7E, 0x81, 0x94, 0x9B, 0x90, 0x87, 0x90, 0x9E, 0xA0, 0x96, 
-    0x8B, 0x8A, 0x91, 0x93, 0x8B, 0x83, 0x83, 0x84, 0x80, 0x7A, 0x75, 0x74, 0x72, 0x6D, 0x66, 0x61, 
-    0x65, 0x6D, 0x6E, 0x64, 0x62, 0x70, 0x7F, 0x7E, 0x79, 0x7F, 0x88, 0x89, 0x86, 0x8A, 0x90, 0x93, 
-    0x94, 0x94, 0x90, 0x8E, 0x94, 0x9B, 0x93, 0x82, 0x7D, 0x85, 0x85, 0x7B, 0x76, 0x7A, 0x7C, 0x75, 
-    0x6E, 0x72, 0x78, 0x77, 0x70, 0x6B, 0x6B, 0x6E, 0x74, 0x79, 0x79, 0x76, 0x78, 0x83, 0x88, 0x85, 
-    0x83, 0x8A, 0x8D, 0x86, 0x82, 0x88, 0x8F, 0x8C, 0x85, 0x85, 0x89, 0x89, 0x84, 0x83, 0x83, 0x82, 
-    0x7F, 0x80, 0x82, 0x80, 0x7F, 0x82, 0x84, 0x81, 0x7F, 0x83, 0x87, 0x83, 0x7F, 0x82, 0x86, 0x84, 
-    0x81, 0x81, 0x81, 0x7E, 0x79, 0x77, 0x77, 0x76, 0x74, 0x71, 0x71, 0x71, 0x74, 0x76, 0x76, 0x77, 
-    0x78, 0x7A, 0x7C, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7A, 0x7B, 0x80, 0x87, 0x86, 0x7D, 0x7A, 0x85, 
-    0x8F, 0x88, 0x7C, 0x7F, 0x8A, 0x8B, 0x82, 0x7D, 0x84, 0x8C, 0x8A, 0x80, 0x7C, 0x85, 0x92, 0x92, 
-    0x89, 0x85, 0x8C, 0x90, 0x8E, 0x8B, 0x87, 0x81, 0x7D, 0x7A, 0x75, 0x70, 0x72, 0x77, 0x73, 0x67, 
-    0x66, 0x72, 0x7A, 0x73, 0x6A, 0x6E, 0x75, 0x75, 0x76, 0x7D, 0x85, 0x88, 0x8B, 0x8E, 0x90, 0x94, 
-    0x9B, 0x9E, 0x95, 0x89, 0x89, 0x8F, 0x8D, 0x85, 0x80, 0x80, 0x7D, 0x78, 0x77, 0x79, 0x79, 0x75, 
-    0x6E, 0x6B, 0x6A, 0x6D, 0x72, 0x75, 0x73, 0x71, 0x75, 0x7C, 0x7F, 0x7D, 0x7E, 0x80, 0x80, 0x7E, 
-    0x7F, 0x86, 0x8C, 0x8B, 0x87, 0x87, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x88, 0x85, 0x89, 0x8C, 0x8B, 
-    0x87, 0x86, 0x86, 0x83, 0x80, 0x7F, 0x7E, 0x7C, 0x79, 0x77, 0x78, 0x79, 0x7B, 0x7D, 0x7C, 0x7A, 
-    0x7A, 0x7D, 0x7F, 0x7F, 0x7C, 0x7A, 0x7D, 0x80, 0x80, 0x7E, 0x7E, 0x7F, 0x80, 0x7D, 0x7C, 0x7D, 
-    0x7F, 0x7E, 0x7A, 0x78, 0x7A, 0x7B, 0x78, 0x73, 0x71, 0x72, 0x74, 0x73, 0x73, 0x78, 0x7D, 0x7D, 
-    0x7A, 0x7E, 0x88, 0x8B, 0x86, 0x84, 0x8B, 0x92, 0x91, 0x8B, 0x8A, 0x8F, 0x93, 0x91, 0x8E, 0x8E, 
-    0x90, 0x92, 0x8D, 0x86, 0x81, 0x81, 0x80, 0x7A, 0x74, 0x73, 0x76, 0x77, 0x75, 0x72, 0x71, 0x74, 
-    0x76, 0x72, 0x6D, 0x70, 0x76, 0x79, 0x77, 0x77, 0x7D, 0x83, 0x85, 0x83, 0x83, 0x84, 0x87, 0x87, 
-    0x86, 0x85, 0x87, 0x8A, 0x89, 0x84, 0x82, 0x86, 0x89, 0x84, 0x7F, 0x80, 0x85, 0x87, 0x84, 0x82, 
-    0x84, 0x85, 0x82, 0x7D, 0x7C, 0x7D, 0x7C, 0x78, 0x77, 0x79, 0x7B, 0x7A, 0x78, 0x77, 0x75, 0x75, 
-    0x76, 0x76, 0x75, 0x75, 0x79, 0x7D, 0x7D, 0x7C, 0x80, 0x84, 0x83, 0x80, 0x81, 0x85, 0x87, 0x87, 
-    0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8B, 0x8B, 0x8A, 0x88, 0x87, 0x86, 0x85, 0x83, 0x81, 0x7F, 0x7C, 
-    0x7D, 0x80, 0x80, 0x7D, 0x7C, 0x7E, 0x7F, 0x7D, 0x7C, 0x7E, 0x7F, 0x7D, 0x7C, 0x7F, 0x81, 0x82, 
-    0x82, 0x80, 0x7F, 0x7E, 0x7E, 0x7D, 0x7C, 0x7B, 0x7B, 0x7C, 0x7B, 0x78, 0x78, 0x7B, 0x7C, 0x76, 
-    0x72, 0x74, 0x77, 0x75, 0x72, 0x71, 0x71, 0x73, 0x76, 0x76, 0x74, 0x76, 0x7E, 0x83, 0x83, 0x84, 
-    0x8D, 0x95, 0x94, 0x8F, 0x90, 0x95, 0x97, 0x93, 0x8D, 0x8D, 0x91, 0x92, 0x8D, 0x88, 0x87, 0x87, 
-    0x82, 0x7A, 0x76, 0x76, 0x74, 0x72, 0x72, 0x73, 0x73, 0x75, 0x79, 0x7B, 0x77, 0x77, 0x7C, 0x80, 
-    0x7E, 0x7B, 0x7F, 0x84, 0x84, 0x82, 0x83, 0x87, 0x87, 0x84, 0x82, 0x82, 0x83, 0x83, 0x82, 0x7F, 
-    0x7D, 0x7D, 0x7F, 0x7F, 0x7D, 0x7B, 0x7B, 0x7C, 0x7C, 0x7B, 0x7D, 0x80, 0x81, 0x80, 0x7F, 0x81, 
-    0x85, 0x85, 0x81, 0x80, 0x81, 0x81, 0x7F, 0x7D, 0x7D, 0x7D, 0x7B, 0x79, 0x77, 0x77, 0x77, 0x78, 
-    0x78, 0x78, 0x78, 0x7A, 0x7E, 0x80, 0x7F, 0x7E, 0x80, 0x82, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 
-    0x85, 0x88, 0x8A, 0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88, 0x87, 0x85, 0x86, 0x88, 0x89, 0x87, 
-    0x87, 0x88, 0x87, 0x81, 0x7F, 0x81, 0x81, 0x7D, 0x7A, 0x7C, 0x7C, 0x7A, 0x7A, 0x7D, 0x7E, 0x7A, 
-    0x77, 0x78, 0x79, 0x77, 0x75, 0x74, 0x75, 0x75, 0x75, 0x77, 0x7A, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 
-    0x7A, 0x7A, 0x7A, 0x7A, 0x79, 0x79, 0x7B, 0x7D, 0x7D, 0x7C, 0x7D, 0x7F, 0x7D, 0x7C, 0x7E, 0x83, 
-    0x83, 0x80, 0x81, 0x87, 0x89, 0x89, 0x8A, 0x8D, 0x8E, 0x8C, 0x8C, 0x8E, 0x8E, 0x8B, 0x88, 0x88, 
-    0x89, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x84, 0x83, 0x80, 0x7F, 0x7E, 0x7D, 0x7A, 0x79, 0x7A, 
-    0x79, 0x77, 0x76, 0x76, 0x75, 0x74, 0x73, 0x74, 0x74, 0x72, 0x71, 0x75, 0x78, 0x79, 0x7A, 0x7C, 
-    0x7E, 0x7E, 0x80, 0x83, 0x84, 0x80, 0x7F, 0x82, 0x85, 0x84, 0x83, 0x85, 0x87, 0x85, 0x83, 0x84, 
-    0x85, 0x84, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x83, 
-    0x83, 0x81, 0x7E, 0x7F, 0x80, 0x7F, 0x7B, 0x79, 0x7A, 0x7B, 0x7A, 0x7A, 0x7D, 0x80, 0x7F, 0x7E, 
-    0x80, 0x84, 0x85, 0x84, 0x83, 0x84, 0x85, 0x87, 0x8A, 0x8B, 0x8A, 0x8A, 0x8C, 0x8C, 0x8B, 0x89, 
-    0x89, 0x89, 0x85, 0x81, 0x80, 0x81, 0x81, 0x7F, 0x7D, 0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x78, 0x76, 
-    0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x75, 0x74, 0x75, 0x77, 0x78, 0x76, 0x76, 0x78, 0x7A, 0x7B, 
-    0x7C, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x82, 0x82, 0x83, 0x85, 0x86, 0x86, 0x87, 0x8A, 0x8C, 0x8B, 0x8A, 0x8A, 0x8B, 0x8B, 
-    0x89, 0x88, 0x89, 0x89, 0x86, 0x85, 0x85, 0x85, 0x82, 0x7E, 0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x79, 0x78, 0x79, 0x7A, 0x79, 0x79, 0x7A, 0x7A, 0x78, 0x78, 0x7A, 0x7C, 0x7C, 0x7A, 0x7A, 0x7B, 
-    0x7B, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x82, 0x85, 0x87, 
-    0x86, 0x86, 0x86, 0x87, 0x87, 0x86, 0x85, 0x84, 0x84, 0x82, 0x80, 0x7F, 0x7F, 0x7E, 0x7C, 0x7C, 
-    0x7C, 0x7B, 0x7B, 0x7C, 0x7E, 0x7C, 0x7B, 0x7D, 0x7E, 0x7E, 0x7E, 0x80, 0x83, 0x83, 0x82, 0x83, 
-    0x85, 0x84, 0x83, 0x82, 0x82, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x81, 0x81, 0x80, 0x81, 0x83, 
-    0x83, 0x81, 0x80, 0x82, 0x84, 0x84, 0x83, 0x83, 0x85, 0x86, 0x84, 0x83, 0x82, 0x81, 0x7F, 0x7D, 
-    0x7C, 0x7C, 0x7B, 0x7A, 0x7A, 0x79, 0x7A, 0x7B, 0x7C, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7A, 0x7A, 
-    0x7B, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x81, 0x82, 0x82, 0x81, 0x82, 
-    0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 
-    0x81, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x82, 0x84, 0x83, 0x82, 0x83, 0x85, 0x84, 0x81, 0x81, 0x83, 
-    0x84, 0x83, 0x82, 0x81, 0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x7D, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x82, 
-    0x82, 0x81, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7E, 
-    0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7A, 0x7B, 0x7D, 0x80, 0x81, 0x80, 0x81, 0x83, 0x84, 0x84, 0x84, 
-    0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7B, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 
-    0x82, 0x82, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 
-    0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7C, 0x7C, 0x7D, 0x7E, 
-    0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x81, 0x81, 0x81, 0x82, 0x84, 0x85, 0x84, 
-    0x83, 0x83, 0x83, 0x81, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x81, 0x7F, 0x7F, 0x7F, 0x7E, 
-    0x7D, 0x7C, 0x7D, 0x7D, 0x7D, 0x7C, 0x7D, 0x7D, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 
-    0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x82, 
-    0x82, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7E, 0x7E, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x82, 
-    0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 
-    0x7D, 0x7B, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 
-    0x82, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7D, 0x7C, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 
-    0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x83, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 
-    0x83, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7E, 
-    0x7C, 0x7B, 0x7C, 0x7B, 0x7A, 0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7C, 0x7D, 0x7E, 0x7D, 0x7E, 0x7F, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 
-    0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7E, 0x7D, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 
-    0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x82, 0x85, 0x88, 0x88, 0x87, 0x85, 0x81, 
-    0x7E, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7C, 0x79, 0x78, 0x78, 0x79, 0x7A, 0x7C, 0x7D, 
-    0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 
-    0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x81, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7D, 
-    0x7C, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 
-    0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x81, 0x81, 0x81, 0x80, 0x7E, 0x7D, 0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7D, 
-    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7F, 
-    0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 
-    0x7E, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 
-    0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x80, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7E, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7E, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F
+
+// IMA ADPCM, 16000 Hz, 9102 samples, block align 256. Generated by utils/adpcm_encode.py
+static const uint8_t hello_adpcm[] = {
+    0x8E, 0x23, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x77, 0xD7, 0x08, 0xB7, 0x08, 0x87, 
+    0x80, 0x0C, 0x08, 0x08, 0x08, 0x70, 0x8B, 0x80, 0x50, 0xC0, 0x83, 0x80, 0x80, 0x00, 0x88, 0x00, 
+    0x3F, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x03, 0x08, 0xF8, 0x59, 0x8B, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x78, 0x77, 0xF1, 0x48, 0x08, 0x0C, 0x03, 
+    0x88, 0x00, 0x0F, 0x83, 0xB8, 0xC4, 0x03, 0x0C, 0x83, 0x0C, 0x48, 0x80, 0x3C, 0xC0, 0x03, 0x08, 
+    0x8D, 0x80, 0xB5, 0x08, 0x58, 0x08, 0x0C, 0xC3, 0x80, 0x80, 0xB5, 0x80, 0x08, 0x85, 0x00, 0x3D, 
+    0x08, 0xC8, 0x84, 0x4B, 0x08, 0xC8, 0x80, 0x04, 0x8C, 0x84, 0x80, 0x80, 0x3C, 0xC0, 0x08, 0xC4, 
+    0x30, 0xC0, 0x48, 0x3B, 0x3B, 0xD0, 0x80, 0xB4, 0x08, 0x08, 0x05, 0x8C, 0x80, 0x80, 0x60, 0xB8, 
+    0x08, 0x68, 0xB8, 0x40, 0x08, 0x3C, 0x3C, 0xC0, 0x30, 0xC8, 0xB3, 0x08, 0x85, 0xC0, 0x30, 0xD0, 
+    0x83, 0x80, 0x0C, 0x08, 0x08, 0x78, 0x08, 0xC8, 0x84, 0x3B, 0xC0, 0x80, 0x04, 0xC8, 0x30, 0x80, 
+    0x80, 0x08, 0x8F, 0x80, 0x50, 0x8B, 0x04, 0x3C, 0xB8, 0xB4, 0x03, 0x0D, 0x48, 0x08, 0x0C, 0x08, 
+    0x08, 0xC4, 0x30, 0x80, 0x80, 0x80, 0x80, 0x00, 0xF8, 0xE3, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0xAF, 0x80, 0x80, 0x70, 0x0B, 0x88, 0x80, 0x00, 0x78, 0x0B, 0x88, 0x07, 0x0C, 0x83, 0x8B, 0x58, 
+    0x80, 0x80, 0x80, 0xF0, 0x30, 0x08, 0x3D, 0x80, 0x80, 0xD8, 0x84, 0x80, 0x0C, 0x08, 0x58, 0xC0, 
+    0x08, 0x30, 0x00, 0x88, 0x00, 0x88, 0x80, 0xAF, 0x06, 0x0C, 0x83, 0x3C, 0x8B, 0xB5, 0x80, 0x08, 
+    0x80, 0x08, 0x07, 0x0C, 0x08, 0x08, 0x88, 0x87, 0x0B, 0x80, 0x04, 0x08, 0x08, 0xE8, 0x03, 0x08, 
+    0x08, 0x08, 0x3F, 0x0C, 0x00, 0x00, 0x25, 0x00, 0x80, 0x08, 0xF0, 0x30, 0x88, 0x00, 0x8D, 0x84, 
+    0x0B, 0x08, 0x08, 0x08, 0x87, 0x80, 0xD0, 0x80, 0x40, 0x08, 0x3C, 0xD0, 0x80, 0xB4, 0x08, 0x58, 
+    0x08, 0xB8, 0xC4, 0x80, 0x80, 0x50, 0x8B, 0x40, 0xB8, 0xC4, 0x30, 0x3C, 0x80, 0x80, 0x80, 0x3E, 
+    0x80, 0x80, 0xE0, 0x48, 0x08, 0x0C, 0x08, 0x84, 0x4B, 0x8B, 0x80, 0x85, 0xC0, 0x80, 0x08, 0x80, 
+    0x08, 0x07, 0x3C, 0x08, 0x0C, 0x48, 0x8B, 0x04, 0xC8, 0x80, 0x80, 0x80, 0x06, 0x3C, 0x08, 0xC8, 
+    0x84, 0xC0, 0x80, 0xB4, 0x83, 0x8B, 0x08, 0x78, 0x80, 0x80, 0x8C, 0x04, 0x08, 0x08, 0x3E, 0x08, 
+    0x3C, 0x80, 0x80, 0x80, 0x80, 0x8F, 0x58, 0xB8, 0x80, 0x50, 0x08, 0x8C, 0xB4, 0x80, 0x80, 0x80, 
+    0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x78, 0x07, 0x00, 0x08, 0x08, 0x88, 0x00, 0x88, 0xDF, 
+    0x86, 0x80, 0xD0, 0x48, 0x0B, 0x08, 0x08, 0x08, 0x08, 0x78, 0x0B, 0x68, 0xB8, 0x30, 0x00, 0x3E, 
+    0x8B, 0x80, 0x50, 0x80, 0x80, 0x08, 0x0F, 0x83, 0x80, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0x27, 0x8E, 0x40, 0x08, 0x80, 0x08, 0x80, 0x08, 0x8F, 0x88, 0x00, 0x88, 0x07, 0x0C, 0xC3, 
+    0x30, 0x4B, 0x08, 0x0D, 0x48, 0x08, 0xB8, 0x88, 0x00, 0x88, 0x00, 0x08, 0x27, 0x08, 0x08, 0x9F, 
+    0x85, 0xC0, 0x03, 0x08, 0x0D, 0xC3, 0x80, 0x84, 0x0B, 0x08, 0x58, 0x80, 0x8C, 0x04, 0x0C, 0x08, 
+    0x08, 0x68, 0x08, 0x3C, 0xC0, 0x83, 0x4B, 0x08, 0x8C, 0x80, 0x80, 0x86, 0x80, 0x8B, 0x85, 0x4B, 
+    0x08, 0x8C, 0x04, 0x0C, 0x08, 0x48, 0xC0, 0x80, 0xB4, 0x83, 0x8B, 0x68, 0x0B, 0x48, 0x80, 0x3C, 
+    0xC0, 0x08, 0x58, 0x08, 0xC8, 0x80, 0x40, 0x80, 0x80, 0x80, 0x80, 0xF0, 0x59, 0x08, 0x08, 0x8C, 
+    0x80, 0x80, 0x06, 0x8C, 0x00, 0xFF, 0x26, 0x00, 0x80, 0x58, 0x08, 0x08, 0x8C, 0x40, 0x80, 0xD0, 
+    0x08, 0x58, 0x08, 0x08, 0xD8, 0x30, 0x80, 0xE0, 0x80, 0x80, 0x50, 0x08, 0xC8, 0x48, 0x0B, 0x48, 
+    0x80, 0xD0, 0x08, 0x80, 0x85, 0x80, 0x00, 0x0E, 0x88, 0x04, 0x08, 0xC8, 0x08, 0x08, 0x86, 0x80, 
+    0x80, 0x8D, 0x40, 0x80, 0x80, 0xE0, 0xB8, 0x84, 0x84, 0xB4, 0xBB, 0x84, 0x30, 0x40, 0xC0, 0xCB, 
+    0x08, 0x30, 0x35, 0xB8, 0x8C, 0x80, 0x70, 0x81, 0x8D, 0x89, 0x20, 0x03, 0x88, 0xB5, 0x8B, 0x34, 
+    0x00, 0x9F, 0x80, 0x8A, 0x17, 0x89, 0xA9, 0x68, 0x11, 0xA0, 0xAA, 0xEB, 0x39, 0x17, 0x90, 0xBA, 
+    0x10, 0x62, 0x92, 0xAA, 0xC9, 0x29, 0x23, 0x08, 0xAB, 0x83, 0x4C, 0x45, 0xB8, 0xAE, 0x42, 0xB1, 
+    0x19, 0x08, 0x88, 0x20, 0x83, 0xC0, 0x0B, 0x0C, 0x43, 0x83, 0xBC, 0x00, 0x3C, 0x08, 0x08, 0x17, 
+    0xBA, 0x03, 0xAF, 0x54, 0xC1, 0x0A, 0x81, 0x89, 0x34, 0x08, 0xDC, 0x18, 0x01, 0x61, 0x91, 0xAF, 
+    0x28, 0x21, 0x14, 0xEB, 0x19, 0x00, 0x41, 0xA0, 0x8C, 0x88, 0x21, 0x34, 0xFC, 0x30, 0xB8, 0x30, 
+    0x90, 0xA0, 0x39, 0xE2, 0x09, 0x30, 0x95, 0x0E, 0x84, 0x9A, 0x11, 0x18, 0x99, 0xB0, 0x68, 0xA1, 
+    0x38, 0xC8, 0x19, 0x34, 0xBA, 0x01, 0x9F, 0x12, 0x28, 0x91, 0xCE, 0x60, 0x02, 0xA8, 0xA9, 0x8A, 
+    0x26, 0x99, 0x82, 0x9E, 0x02, 0x38, 0x16, 0xC9, 0x8B, 0x81, 0x38, 0x87, 0x9C, 0x92, 0x29, 0x15, 
+    0x08, 0xEA, 0x18, 0x00, 0x81, 0x28, 0xFA, 0x49, 0x01, 0x00, 0x89, 0x90, 0x0D, 0x23, 0xBA, 0x40, 
+    0xA2, 0xBF, 0x34, 0x01, 0xB0, 0xBB, 0x18, 0x35, 0xA1, 0xDC, 0x2A, 0x14, 0x31, 0xC8, 0x9B, 0x0A, 
+    0x46, 0x81, 0xFB, 0x09, 0x11, 0x24, 0x99, 0xDA, 0x2A, 0x33, 0x05, 0xDB, 0x9A, 0x40, 0x23, 0xA0, 
+    0xBA, 0x8E, 0x24, 0x01, 0x00, 0x08, 0x40, 0x00, 0x9A, 0xA9, 0x48, 0x14, 0x98, 0xAB, 0x21, 0x30, 
+    0x82, 0xA9, 0xDD, 0x30, 0x25, 0xBB, 0x88, 0x2B, 0x17, 0x89, 0x9A, 0x21, 0x1B, 0x87, 0x1A, 0xCA, 
+    0x14, 0xAB, 0x33, 0xB0, 0x1C, 0x16, 0xBA, 0x3A, 0x05, 0x98, 0xA9, 0x09, 0x39, 0x87, 0x28, 0xC1, 
+    0x28, 0xE9, 0x8A, 0x53, 0xA2, 0x99, 0xBC, 0x51, 0x44, 0xB0, 0xCB, 0x18, 0x21, 0x11, 0xC9, 0x8D, 
+    0x13, 0x29, 0x24, 0xC8, 0x9B, 0x10, 0x18, 0x32, 0xE2, 0x0B, 0xA1, 0x40, 0x21, 0xFA, 0x00, 0x19, 
+    0x15, 0x90, 0xAD, 0x32, 0x92, 0xAC, 0x43, 0xCC, 0x32, 0x88, 0x81, 0x3A, 0xD0, 0x22, 0xBA, 0xF1, 
+    0x7A, 0xA0, 0x89, 0x00, 0x81, 0x80, 0x14, 0xBB, 0xB0, 0x7B, 0x92, 0x10, 0xDB, 0x8A, 0x42, 0xB8, 
+    0x1C, 0xD0, 0x4A, 0x77, 0x94, 0x9B, 0x80, 0x30, 0x91, 0xB8, 0xBF, 0x80, 0x21, 0x02, 0x12, 0xEB, 
+    0x31, 0x22, 0x02, 0xCB, 0xAA, 0x88, 0x52, 0x12, 0xB9, 0xAD, 0x39, 0x25, 0xA9, 0xBA, 0x9D, 0x31, 
+    0x34, 0x90, 0xB9, 0x1A, 0x36, 0x81, 0xE9, 0xBC, 0x08, 0x32, 0x03, 0xAA, 0xD9, 0x3B, 0x25, 0x98, 
+    0xDB, 0xCE, 0x19, 0x22, 0x77, 0xB3, 0x0C, 0x91, 0x38, 0x03, 0xDB, 0x9A, 0x88, 0x31, 0x22, 0x92, 
+    0xAF, 0x21, 0x02, 0x03, 0xCA, 0xAA, 0xAA, 0x60, 0x15, 0xB9, 0x99, 0x18, 0x33, 0x02, 0xBA, 0xB9, 
+    0x8F, 0x24, 0x00, 0xA0, 0x9C, 0x11, 0x30, 0x14, 0xAB, 0x80, 0x8B, 0x44, 0x00, 0xA8, 0xDB, 0x2A, 
+    0x17, 0x80, 0x98, 0x88, 0x88, 0x12, 0xC8, 0xCD, 0x08, 0x10, 0x33, 0x90, 0x88, 0x8A, 0x41, 0xC2, 
+    0xAC, 0xBD, 0x8D, 0xB8, 0x0B, 0xB2, 0x9C, 0x77, 0x27, 0x0F, 0x82, 0x09, 0x13, 0xE9, 0x09, 0x90, 
+    0x18, 0x22, 0x81, 0xAD, 0x22, 0x00, 0x22, 0xB9, 0xA9, 0xDC, 0x48, 0x14, 0xB9, 0x89, 0x09, 0x32, 
+    0x23, 0x88, 0xB8, 0xCF, 0x00, 0xEE, 0x46, 0x00, 0x13, 0x00, 0xB9, 0x8B, 0x98, 0x72, 0x82, 0x09, 
+    0xA8, 0x28, 0x83, 0x32, 0xF0, 0x9D, 0x11, 0x88, 0x31, 0x82, 0x98, 0x8A, 0x30, 0x81, 0xBE, 0x9A, 
+    0xA0, 0x19, 0x24, 0x33, 0xA9, 0x14, 0xBA, 0xF9, 0xAF, 0xAB, 0xC8, 0xBE, 0x79, 0x77, 0xC9, 0x30, 
+    0xA8, 0x30, 0x93, 0xAE, 0x01, 0x9A, 0x31, 0x12, 0xA9, 0x0A, 0x88, 0x73, 0x81, 0x18, 0xE9, 0x8B, 
+    0x32, 0x82, 0x89, 0xB9, 0x8B, 0x53, 0x12, 0x52, 0xF8, 0x1B, 0x81, 0x20, 0x82, 0x9A, 0xCB, 0x29, 
+    0x23, 0x42, 0xB0, 0x8C, 0x11, 0x00, 0x15, 0xBB, 0x98, 0x8D, 0x11, 0x52, 0xA8, 0x01, 0xBA, 0x10, 
+    0x41, 0xC0, 0x0B, 0xB9, 0x2B, 0x53, 0x12, 0x04, 0xBD, 0x09, 0xCD, 0xBA, 0xBD, 0x6A, 0x77, 0xF2, 
+    0x39, 0x91, 0x1A, 0x14, 0xCB, 0x20, 0xC9, 0x29, 0x13, 0xA8, 0x20, 0xB9, 0x49, 0x03, 0x10, 0xB3, 
+    0xDF, 0x20, 0x81, 0x08, 0x01, 0xBB, 0x29, 0x81, 0x72, 0x83, 0x9D, 0x80, 0x8A, 0x53, 0x80, 0x99, 
+    0xA9, 0x99, 0x41, 0x14, 0x18, 0xA1, 0x9F, 0x11, 0x88, 0x23, 0xB8, 0x9D, 0x00, 0x10, 0x43, 0x02, 
+    0xFB, 0x9A, 0x20, 0x01, 0x89, 0x81, 0xCC, 0x29, 0x25, 0x81, 0xAB, 0xCD, 0xBA, 0x78, 0x77, 0xAB, 
+    0x32, 0xCA, 0x40, 0x93, 0x8D, 0x01, 0xBB, 0x41, 0x92, 0x09, 0x83, 0x8C, 0x12, 0x89, 0x53, 0xC8, 
+    0x0C, 0x02, 0xAA, 0x30, 0x83, 0x9A, 0xA1, 0x8B, 0x45, 0xA0, 0x70, 0xC1, 0x8A, 0x82, 0x19, 0x11, 
+    0x90, 0xBB, 0x89, 0x29, 0x47, 0x90, 0x32, 0xFB, 0x0A, 0x22, 0x80, 0x08, 0xA0, 0xAD, 0x28, 0x23, 
+    0x24, 0xEB, 0x89, 0x9A, 0x32, 0x12, 0x90, 0xAD, 0xBB, 0x0A, 0x04, 0xAB, 0x77, 0x87, 0x0E, 0x04, 
+    0x9B, 0x51, 0xB0, 0x2B, 0xA3, 0x8E, 0x12, 0x98, 0x30, 0xB1, 0x2A, 0x93, 0x0C, 0x34, 0xC9, 0x28, 
+    0xB1, 0x9C, 0x11, 0x91, 0x00, 0xF9, 0x44, 0x00, 0x01, 0xAB, 0x39, 0xC2, 0x79, 0x04, 0x8A, 0x02, 
+    0xAA, 0x38, 0xA0, 0x18, 0xC9, 0xBB, 0x3A, 0xD2, 0x70, 0x93, 0x18, 0x01, 0xA8, 0x49, 0x04, 0x99, 
+    0x08, 0xFC, 0x18, 0x99, 0x21, 0xAA, 0x31, 0xF9, 0x1A, 0x23, 0xB8, 0xAC, 0x08, 0x7B, 0x77, 0x9B, 
+    0x53, 0xBA, 0x49, 0x93, 0x8D, 0x12, 0xCB, 0x28, 0x92, 0x1B, 0x04, 0x8B, 0x14, 0xAA, 0x52, 0xB1, 
+    0x3A, 0x84, 0xAB, 0x00, 0xB8, 0x0A, 0x02, 0x09, 0x00, 0xE9, 0x49, 0xB3, 0x79, 0x04, 0x8A, 0x10, 
+    0xA9, 0x18, 0x20, 0x81, 0x9B, 0xBE, 0x20, 0xCC, 0x51, 0x92, 0x09, 0x23, 0xC9, 0x39, 0x17, 0xA9, 
+    0x00, 0xBA, 0x9A, 0x28, 0x23, 0xDC, 0x89, 0xFB, 0x8A, 0x21, 0x72, 0x07, 0x9B, 0x35, 0xCA, 0x40, 
+    0xA3, 0x8D, 0x13, 0xAD, 0x10, 0x98, 0x19, 0xA2, 0x2A, 0x03, 0x8A, 0x44, 0xB0, 0x68, 0x02, 0x8A, 
+    0x01, 0xD9, 0x1A, 0x98, 0x99, 0x9A, 0x90, 0x29, 0xC0, 0x70, 0x14, 0x08, 0x35, 0xA8, 0x09, 0x08, 
+    0xC9, 0x2A, 0xB2, 0xA9, 0xBF, 0x28, 0xB9, 0x51, 0x25, 0x90, 0x11, 0x98, 0x00, 0x02, 0x9C, 0x90, 
+    0xAE, 0xD9, 0x0A, 0x02, 0xDB, 0x30, 0x62, 0x07, 0x0C, 0x15, 0xAB, 0x51, 0xB1, 0x1C, 0x04, 0x9C, 
+    0x20, 0xB9, 0x29, 0xB2, 0x4B, 0x94, 0x8C, 0x23, 0xC9, 0x50, 0x82, 0x18, 0x80, 0x99, 0x98, 0x88, 
+    0x22, 0xCA, 0xA9, 0xAA, 0xCD, 0x48, 0x13, 0x09, 0x33, 0x90, 0x42, 0x10, 0x15, 0x10, 0xB0, 0xAA, 
+    0xCE, 0x9A, 0x8B, 0xA8, 0x09, 0x19, 0x46, 0x09, 0x32, 0x11, 0x82, 0x26, 0xDB, 0x00, 0xEC, 0x9A, 
+    0x90, 0x79, 0x97, 0x0B, 0x16, 0xAB, 0x52, 0xB0, 0x3A, 0x95, 0x9B, 0x02, 0xCA, 0x20, 0xB8, 0x58, 
+    0xB1, 0x1A, 0x04, 0xBB, 0x54, 0x90, 0x38, 0x90, 0x0A, 0x00, 0x9A, 0x13, 0xAC, 0x12, 0xCB, 0x9C, 
+    0x32, 0xB9, 0x68, 0x03, 0x00, 0xF9, 0x3C, 0x00, 0x38, 0x93, 0x21, 0x08, 0x17, 0x99, 0x99, 0x28, 
+    0xD8, 0x0C, 0x80, 0xDA, 0x28, 0x82, 0xDB, 0x3A, 0xA4, 0x1D, 0x33, 0x02, 0xCB, 0x80, 0xBE, 0x72, 
+    0x96, 0x2A, 0x06, 0x9C, 0x31, 0xC9, 0x49, 0xA2, 0x1C, 0x82, 0x9C, 0x31, 0xCA, 0x41, 0xC0, 0x49, 
+    0x91, 0x8B, 0x24, 0xAA, 0x32, 0xA1, 0x18, 0x90, 0x09, 0xB1, 0x8E, 0x13, 0xBB, 0x19, 0x02, 0xBD, 
+    0x51, 0x82, 0x39, 0x16, 0x09, 0xB0, 0x3A, 0xB2, 0x8A, 0x32, 0xF3, 0x8F, 0x81, 0x9A, 0x51, 0x82, 
+    0x8A, 0x90, 0x88, 0xAD, 0x11, 0xB8, 0xBA, 0x39, 0xE9, 0x77, 0xB1, 0x70, 0xA1, 0x2A, 0x04, 0xAC, 
+    0x32, 0xCA, 0x18, 0xB0, 0x0B, 0xB3, 0x0E, 0x05, 0x9A, 0x42, 0xA8, 0x29, 0x03, 0x19, 0x03, 0x10, 
+    0xA8, 0x8A, 0x91, 0xDF, 0x28, 0xA8, 0x09, 0x18, 0x90, 0x8A, 0x71, 0x03, 0x30, 0x33, 0x93, 0x8E, 
+    0x84, 0x9C, 0x80, 0x12, 0xAF, 0x88, 0xAB, 0x8A, 0x62, 0x02, 0x01, 0x11, 0xB8, 0x8C, 0x80, 0xFA, 
+    0x8C, 0x80, 0x66, 0xC9, 0x71, 0xA0, 0x29, 0x03, 0x9C, 0x43, 0xCA, 0x18, 0xA0, 0x0A, 0xA1, 0x1C, 
+    0x84, 0x9C, 0x33, 0xB9, 0x40, 0x82, 0x38, 0x83, 0x30, 0xA0, 0x9C, 0x01, 0xCE, 0x20, 0xB9, 0x9A, 
+    0x18, 0xD1, 0x29, 0x24, 0x80, 0x52, 0x33, 0x92, 0x4B, 0x04, 0xCB, 0x8A, 0xA1, 0xCE, 0x19, 0xA1, 
+    0x8C, 0x22, 0x88, 0x31, 0x13, 0xCD, 0x20, 0xF8, 0x9C, 0x32, 0x27, 0xBB, 0x56, 0xC8, 0x38, 0x92, 
+    0x8C, 0x13, 0xBB, 0x12, 0xBB, 0x10, 0xFA, 0x38, 0xB3, 0x1C, 0x16, 0xAA, 0x21, 0xA1, 0x38, 0x83, 
+    0x21, 0xC9, 0x0A, 0xB8, 0xAF, 0x33, 0xBA, 0x01, 0x18, 0xD8, 0x2B, 0x25, 0x80, 0x73, 0x11, 0xA9, 
+    0x1C, 0xA2, 0x0C, 0x82, 0x11, 0xCD, 0x19, 0xA9, 0x19, 0x34, 0x81, 0xA8, 0x1A, 0xFA, 0x0E, 0x98, 
+    0x61, 0x16, 0x0C, 0x16, 0x00, 0x12, 0x50, 0x00, 0x3B, 0x93, 0x9B, 0x53, 0xD8, 0x18, 0xA9, 0x08, 
+    0x98, 0x40, 0x84, 0x8B, 0x05, 0xA9, 0x19, 0x24, 0xA9, 0x30, 0xB1, 0xAF, 0x00, 0x00, 0x88, 0x62, 
+    0xA0, 0x89, 0x39, 0xA3, 0x3B, 0x57, 0xB9, 0x10, 0xBA, 0xA9, 0x5A, 0x93, 0x29, 0x80, 0xA1, 0x9F, 
+    0x33, 0x81, 0x1A, 0x85, 0xBC, 0x8A, 0x91, 0xBC, 0x8A, 0x71, 0x67, 0xBA, 0x54, 0xCA, 0x30, 0xA1, 
+    0x0A, 0x03, 0xBC, 0x00, 0x89, 0x12, 0x09, 0x44, 0xC0, 0x2A, 0x84, 0x9A, 0x30, 0x93, 0xAE, 0x10, 
+    0xA9, 0x0B, 0x43, 0x81, 0x29, 0x04, 0x8B, 0x01, 0x71, 0xC2, 0x2B, 0x94, 0xAD, 0x21, 0x90, 0x99, 
+    0x51, 0xC1, 0x0B, 0x13, 0x99, 0x18, 0x15, 0xBA, 0x48, 0xA1, 0x8A, 0x19, 0xC1, 0xCF, 0x88, 0x09, 
+    0x77, 0xB1, 0x69, 0xC1, 0x2A, 0x03, 0xAB, 0x32, 0xF9, 0x19, 0x88, 0x10, 0x81, 0x20, 0x81, 0xBC, 
+    0x43, 0xA8, 0x28, 0x04, 0xCC, 0x18, 0x99, 0x10, 0x22, 0x12, 0xB9, 0x0A, 0xA0, 0x19, 0x73, 0x85, 
+    0x9B, 0x02, 0xCB, 0x32, 0x89, 0x27, 0x9D, 0x82, 0xBA, 0x1A, 0x06, 0x8A, 0x13, 0xA9, 0x89, 0x31, 
+    0xA0, 0x9C, 0xB8, 0xEF, 0x38, 0x05, 0x30, 0x06, 0x9B, 0x22, 0xAC, 0x32, 0xD0, 0x0C, 0x90, 0x8D, 
+    0x12, 0x11, 0x02, 0x00, 0x99, 0x89, 0x1A, 0x34, 0xB0, 0x9C, 0xD0, 0x9D, 0x32, 0x22, 0x12, 0x02, 
+    0xDC, 0x09, 0x89, 0x44, 0x80, 0x00, 0xB9, 0x2B, 0xA0, 0x78, 0x82, 0x08, 0xBC, 0x98, 0x8E, 0x23, 
+    0x01, 0x41, 0xA2, 0x9D, 0x90, 0xA9, 0xDC, 0xCA, 0x1C, 0x16, 0x48, 0x17, 0x9B, 0x23, 0xCA, 0x41, 
+    0xB0, 0x0C, 0xA1, 0x9D, 0x22, 0x80, 0x22, 0x82, 0xAB, 0x82, 0x9B, 0x22, 0x91, 0x9D, 0x93, 0xAF, 
+    0x31, 0x10, 0x53, 0x81, 0x9B, 0xAA, 0xCB, 0x61, 0x83, 0x3A, 0x87, 0x8A, 0x81, 0x11, 0x99, 0xB8, 
+    0xAA, 0xCF, 0x28, 0x80, 0x00, 0xEE, 0x3D, 0x00, 0x22, 0x15, 0x99, 0x32, 0xDA, 0xBB, 0xBD, 0x18, 
+    0x42, 0x57, 0x91, 0x0D, 0x03, 0x8C, 0x24, 0xB8, 0x0B, 0xD0, 0x8C, 0x23, 0x10, 0x33, 0x91, 0xAC, 
+    0x90, 0x9B, 0x14, 0xA9, 0x89, 0xC8, 0x0B, 0x34, 0x53, 0x14, 0x98, 0xA8, 0xBA, 0xAE, 0x30, 0xB1, 
+    0x49, 0x16, 0x89, 0x42, 0x82, 0x88, 0xB9, 0x9A, 0xAF, 0x00, 0x9A, 0xC0, 0x29, 0xA3, 0x60, 0x04, 
+    0xA9, 0xCA, 0x9A, 0x70, 0x37, 0xD1, 0x39, 0xB1, 0x1C, 0x13, 0xCB, 0x28, 0xE8, 0x1A, 0x13, 0x00, 
+    0x41, 0x91, 0x8B, 0x92, 0x8B, 0x03, 0xCD, 0x1A, 0xA2, 0x0D, 0x25, 0x10, 0x11, 0x92, 0x8D, 0x93, 
+    0xAF, 0x12, 0x99, 0x18, 0x90, 0x28, 0x15, 0x30, 0x05, 0x89, 0xAB, 0xA9, 0x9E, 0x21, 0xC9, 0x28, 
+    0xD8, 0x19, 0x91, 0x3A, 0x23, 0x73, 0x77, 0xC0, 0x1A, 0x92, 0x8B, 0x24, 0xD8, 0x19, 0xB8, 0x1C, 
+    0x33, 0x02, 0x20, 0x84, 0x9E, 0x10, 0x8A, 0x22, 0xC8, 0x0B, 0xA0, 0x8E, 0x31, 0x22, 0x11, 0x03, 
+    0xAB, 0x24, 0xCC, 0x28, 0x81, 0xAB, 0x89, 0x9B, 0x22, 0x99, 0x57, 0x82, 0x89, 0x00, 0xD1, 0x8C, 
+    0xA0, 0x18, 0xD0, 0x19, 0xC0, 0x9D, 0x42, 0x57, 0x84, 0x8C, 0x02, 0x9C, 0x21, 0xA8, 0x0B, 0xA3, 
+    0xCF, 0x12, 0x01, 0x10, 0x24, 0xB8, 0x08, 0xA9, 0x18, 0x04, 0xAC, 0x12, 0xCD, 0x08, 0x20, 0x22, 
+    0x32, 0xE9, 0x30, 0xD8, 0x1A, 0x25, 0x98, 0x08, 0xBA, 0x19, 0xB9, 0x40, 0x34, 0xD9, 0x28, 0xD1, 
+    0x2B, 0x93, 0x3B, 0x96, 0xAB, 0xB0, 0x0D, 0x03, 0x74, 0x87, 0x8B, 0x82, 0x8B, 0x32, 0xB8, 0x49, 
+    0xD2, 0x9E, 0x11, 0x80, 0x10, 0x23, 0xA9, 0x01, 0xCA, 0x20, 0x81, 0x9B, 0x24, 0xCC, 0x99, 0x10, 
+    0x22, 0x35, 0xC9, 0x63, 0xD9, 0x19, 0x81, 0x00, 0x18, 0xA0, 0x18, 0x98, 0x89, 0x33, 0xB1, 0x0B, 
+    0xCF, 0x28, 0xF9, 0x38, 0x00, 0xFE, 0x3F, 0x00, 0xA0, 0xAB, 0x09, 0x11, 0x76, 0x17, 0x9B, 0x01, 
+    0xBA, 0x20, 0xB1, 0x0B, 0x15, 0xBE, 0x28, 0x82, 0x10, 0x63, 0x90, 0x18, 0xC8, 0x0B, 0x82, 0xAA, 
+    0x52, 0xC1, 0x8B, 0x80, 0x08, 0x44, 0x91, 0x50, 0xA3, 0x9D, 0x00, 0x90, 0x2A, 0x93, 0x8C, 0x80, 
+    0xCB, 0x71, 0x83, 0x18, 0xA2, 0x9D, 0xB0, 0x9E, 0x32, 0xA1, 0x9A, 0x90, 0x49, 0x77, 0x82, 0x0A, 
+    0x02, 0xAD, 0x21, 0xB9, 0x2B, 0x94, 0xAF, 0x11, 0x90, 0x21, 0x21, 0x00, 0x31, 0xD9, 0x28, 0xA2, 
+    0x8B, 0x02, 0xFB, 0x9A, 0xA8, 0x18, 0x33, 0x90, 0x76, 0x92, 0x29, 0x90, 0x1A, 0x91, 0x8C, 0x81, 
+    0xBC, 0xBA, 0x2B, 0x27, 0x00, 0x04, 0x88, 0xD8, 0x9E, 0x12, 0x90, 0x88, 0x88, 0xCB, 0x71, 0x26, 
+    0x80, 0x21, 0xC8, 0x29, 0xC8, 0x8C, 0x21, 0xDA, 0x1A, 0x80, 0x19, 0x12, 0x22, 0x72, 0xA3, 0x8D, 
+    0x02, 0xAA, 0x21, 0x91, 0x08, 0xF8, 0x9B, 0x98, 0x18, 0x20, 0x37, 0x10, 0x03, 0xAB, 0x26, 0xAA, 
+    0x18, 0x91, 0xAE, 0xA9, 0x09, 0x10, 0x20, 0x44, 0xA2, 0xAC, 0x88, 0xCA, 0x2B, 0x91, 0xAD, 0x90, 
+    0x89, 0x77, 0x17, 0x89, 0x12, 0x9A, 0x20, 0xDA, 0x1A, 0x92, 0xAF, 0x10, 0x08, 0x08, 0x20, 0x02, 
+    0x41, 0xB9, 0x70, 0x91, 0x8B, 0x31, 0x91, 0x98, 0xCD, 0x19, 0xC0, 0x8D, 0x52, 0x91, 0x29, 0x82, 
+    0x10, 0x81, 0x32, 0x30, 0xB3, 0xAF, 0xB9, 0x9A, 0x90, 0x99, 0x72, 0x93, 0x9E, 0x00, 0xB9, 0x19, 
+    0x02, 0x89, 0xA0, 0xCF, 0x30, 0x66, 0x83, 0x0A, 0x14, 0x9C, 0x21, 0xC9, 0x28, 0x92, 0xAE, 0x10, 
+    0xCA, 0x18, 0x90, 0x08, 0x43, 0xB8, 0x72, 0x02, 0x19, 0x33, 0xA0, 0x80, 0xDE, 0x09, 0xA9, 0xAD, 
+    0x20, 0xA1, 0x3A, 0x05, 0x58, 0x15, 0x09, 0x24, 0x90, 0x89, 0xBA, 0xAB, 0xB9, 0x9F, 0x11, 0xA9, 
+    0x09, 0x22, 0x08, 0x63, 0x00, 0xFE, 0x3A, 0x00, 0x22, 0x80, 0xCA, 0xAB, 0xCE, 0x19, 0x55, 0xA2, 
+    0x39, 0xA4, 0x3B, 0x05, 0x9A, 0x32, 0xD1, 0x8D, 0xA1, 0x9D, 0x00, 0x89, 0x10, 0x23, 0x0B, 0x47, 
+    0x99, 0x31, 0x91, 0x21, 0xC1, 0x9C, 0xB0, 0xBE, 0x8A, 0x28, 0x80, 0x52, 0x91, 0x72, 0x91, 0x40, 
+    0x23, 0x08, 0xA0, 0xEB, 0x9A, 0xBB, 0x19, 0x00, 0x90, 0x19, 0x83, 0x4A, 0x94, 0x70, 0x85, 0x09, 
+    0xB8, 0x9C, 0x99, 0x9B, 0x01, 0x74, 0x97, 0x1A, 0x84, 0x8B, 0x24, 0x99, 0x40, 0xA1, 0x8D, 0x81, 
+    0xAC, 0x08, 0x99, 0x09, 0x12, 0xAB, 0x67, 0x98, 0x20, 0x82, 0x20, 0x81, 0x9A, 0x11, 0xFA, 0x9D, 
+    0x00, 0xBA, 0x38, 0xA2, 0x78, 0xA3, 0x3A, 0x16, 0x08, 0x12, 0x00, 0x80, 0xCC, 0x9B, 0xA9, 0x9B, 
+    0x0A, 0x02, 0x8A, 0x81, 0x70, 0x17, 0x18, 0x23, 0xAA, 0xB8, 0xBF, 0x88, 0xA9, 0x9A, 0x74, 0x95, 
+    0x2A, 0x86, 0x19, 0x13, 0xAB, 0x31, 0xE0, 0x0C, 0x91, 0x9C, 0x88, 0x99, 0x18, 0x14, 0x19, 0x37, 
+    0xA8, 0x20, 0x92, 0x38, 0x92, 0xAD, 0x11, 0xDD, 0x0A, 0x01, 0x99, 0x21, 0x91, 0x41, 0xD0, 0x59, 
+    0x04, 0x09, 0x01, 0x09, 0xA8, 0x09, 0x08, 0x82, 0xCC, 0x09, 0xA0, 0xAC, 0x13, 0x2A, 0x07, 0x9E, 
+    0x23, 0xBA, 0x00, 0x10, 0x13, 0xB8, 0x88, 0x01, 0xF8, 0x0F, 0x37, 0xCA, 0x33, 0xDA, 0x41, 0xA0, 
+    0x2A, 0x14, 0xCB, 0x30, 0xB8, 0x1B, 0xB8, 0xBA, 0x28, 0xFA, 0x5B, 0x04, 0x1A, 0x16, 0x09, 0x12, 
+    0xA8, 0x30, 0x93, 0xAD, 0x88, 0xF9, 0x8A, 0x80, 0x0A, 0x15, 0x9C, 0x34, 0xA9, 0x31, 0x82, 0x12, 
+    0x21, 0xD0, 0x1B, 0xC2, 0x8F, 0x02, 0xBB, 0x21, 0xC9, 0x51, 0x91, 0x39, 0x82, 0x9C, 0x10, 0xA8, 
+    0x38, 0x82, 0xCB, 0x81, 0xED, 0x28, 0xA1, 0x18, 0x57, 0xB1, 0x3B, 0xB5, 0x2D, 0x05, 0x9A, 0x32, 
+    0xC9, 0x1B, 0x82, 0x8B, 0x00, 0x01, 0x3E, 0x00, 0xA1, 0x9B, 0x88, 0xCD, 0x61, 0x92, 0x2B, 0x05, 
+    0x8A, 0x13, 0x88, 0x34, 0xA2, 0xAC, 0x10, 0xDD, 0x09, 0x91, 0x1A, 0xA2, 0x8C, 0x33, 0xAA, 0x71, 
+    0x03, 0x09, 0x02, 0x98, 0x41, 0xB0, 0x2C, 0x06, 0x9C, 0x31, 0xBA, 0x32, 0xFA, 0x09, 0x80, 0xBB, 
+    0x40, 0x90, 0x49, 0x93, 0x3B, 0x85, 0xBB, 0x52, 0xC9, 0x1A, 0xB8, 0x8A, 0xC9, 0x71, 0x97, 0x29, 
+    0x85, 0x0B, 0x16, 0x9A, 0x31, 0xA0, 0x0C, 0x01, 0xBA, 0x00, 0xBA, 0x8B, 0xC9, 0xAD, 0x42, 0xD0, 
+    0x58, 0x84, 0x19, 0x03, 0x19, 0x12, 0x00, 0x9A, 0x44, 0xFC, 0x29, 0xA8, 0x19, 0xA0, 0x2B, 0x82, 
+    0xAC, 0x28, 0x24, 0xA0, 0x71, 0x93, 0x49, 0xB1, 0x3A, 0x94, 0x0C, 0x01, 0x8B, 0x88, 0x0A, 0xA2, 
+    0x49, 0xC2, 0x49, 0xB4, 0x2B, 0x94, 0x0B, 0xC8, 0x9D, 0x88, 0xBA, 0x80, 0x15, 0x10, 0x21, 0x13, 
+    0x89, 0x80, 0x1D, 0x77, 0xC0, 0x59, 0xA3, 0x0D, 0x03, 0x9B, 0x42, 0xC8, 0x39, 0x05, 0x9B, 0x22, 
+    0x99, 0xBA, 0x9B, 0xBC, 0x31, 0xFB, 0x6A, 0xA2, 0x1B, 0x83, 0x40, 0x04, 0x11, 0x21, 0x14, 0xCD, 
+    0x28, 0xB8, 0x0B, 0xB9, 0x18, 0xB8, 0x9F, 0x18, 0x23, 0xA9, 0x54, 0x91, 0x01, 0x90, 0x70, 0x93, 
+    0x89, 0x02, 0x18, 0xB9, 0x5B, 0x93, 0x9C, 0xB0, 0x9B, 0xB9, 0x9E, 0x10, 0x32, 0xC9, 0x50, 0x82, 
+    0xAC, 0x24, 0xA0, 0x28, 0xD1, 0x19, 0x92, 0x9F, 0x11, 0xEB, 0x09, 0x92, 0x50, 0x03, 0x3A, 0x37, 
+    0x9A, 0x44, 0xB8, 0x38, 0x92, 0x0A, 0x21, 0xCE, 0x0B, 0xC9, 0x9B, 0x12, 0xAA, 0x39, 0xE3, 0x2C, 
+    0x24, 0x89, 0x35, 0x91, 0x18, 0x02, 0x99, 0x52, 0xD9, 0x39, 0xD2, 0x0B, 0x14, 0x9A, 0x02, 0xEB, 
+    0x08, 0xC8, 0x18, 0x92, 0x8A, 0x0B, 0x81, 0x89, 0x67, 0x88, 0x33, 0xA9, 0x50, 0x01, 0x18, 0x11, 
+    0x81, 0x98, 0xAC, 0xA9, 0x00, 0x03, 0x2A, 0x00, 0xBD, 0x1D, 0x84, 0x9B, 0x13, 0xAB, 0x14, 0xAB, 
+    0x27, 0x81, 0x9B, 0x89, 0xA9, 0x0B, 0xC3, 0x8F, 0x14, 0xBF, 0x21, 0xA9, 0x89, 0x33, 0xB0, 0x73, 
+    0x07, 0x50, 0x82, 0x09, 0x12, 0xBB, 0x38, 0xC0, 0x8C, 0xC8, 0xAD, 0x90, 0x88, 0x00, 0x41, 0xB1, 
+    0x68, 0x92, 0x3A, 0x85, 0x19, 0x83, 0xAB, 0x10, 0x98, 0xAD, 0x20, 0xC0, 0x8A, 0x82, 0x5A, 0x14, 
+    0x99, 0x73, 0xC0, 0x08, 0xA0, 0x8A, 0xB0, 0xCB, 0x80, 0x82, 0x80, 0x66, 0x92, 0x29, 0x13, 0x2A, 
+    0x01, 0x5A, 0x25, 0x99, 0x09, 0x08, 0xA1, 0x1D, 0x24, 0x0C, 0xA1, 0xCF, 0x81, 0xBB, 0x82, 0x8A, 
+    0x15, 0xBD, 0x11, 0xBA, 0x29, 0x88, 0x45, 0x82, 0x09, 0x89, 0x80, 0xB0, 0x78, 0x03, 0x2A, 0xB4, 
+    0x4A, 0x17, 0x1B, 0x17, 0x18, 0x11, 0x0A, 0x82, 0xBC, 0x10, 0x98, 0xC0, 0xA9, 0xA0, 0x9F, 0x98, 
+    0x8D, 0x80, 0x9B, 0xA0, 0xA9, 0x82, 0xAD, 0x47, 0x10, 0x21, 0x38, 0x14, 0x9D, 0x33, 0x99, 0x33, 
+    0xCB, 0x21, 0xFA, 0x89, 0x90, 0x08, 0x08, 0x28, 0x32, 0x06, 0xDC, 0x11, 0xE9, 0x09, 0x91, 0x48, 
+    0x93, 0x28, 0x07, 0x98, 0x01, 0x33, 0x91, 0x30, 0xA0, 0x8D, 0xF0, 0x8D, 0x00, 0x9A, 0x99, 0x88, 
+    0xC0, 0xAA, 0x80, 0x80, 0xB3, 0x3B, 0x27, 0x0C, 0x43, 0x11, 0x14, 0x80, 0x22, 0xBA, 0x3B, 0x40, 
+    0x03, 0x08, 0x68, 0x38, 0x27, 0x28, 0x27, 0x99, 0x10, 0xC0, 0x19, 0xE8, 0x09, 0xC8, 0xAD, 0x98, 
+    0x80, 0xA0, 0x19, 0xA2, 0x20, 0xF0, 0x30, 0x03, 0x0D, 0x01, 0x01, 0xA8, 0x08, 0x78, 0x15, 0x08, 
+    0x63, 0x92, 0x08, 0x81, 0xA9, 0x0A, 0xBE, 0x89, 0xCA, 0x08, 0x8A, 0x63, 0xAB, 0x24, 0x08, 0x64, 
+    0x88, 0x21, 0xA9, 0x89, 0xAC, 0x20, 0x8A, 0x06, 0x2A, 0x04, 0xAC, 0x34, 0x98, 0x58, 0xB1, 0x9A, 
+    0xDA, 0x9C, 0xA0, 0x89, 0x00, 0xF9, 0x2A, 0x00, 0x22, 0xB3, 0x8B, 0x04, 0x0C, 0x83, 0x0C, 0x03, 
+    0x04, 0x08, 0x77, 0x01, 0x19, 0x08, 0xA0, 0x08, 0x32, 0x17, 0xA0, 0xA0, 0xAB, 0xFB, 0x0B, 0x41, 
+    0x80, 0x20, 0x08, 0x88, 0x00, 0x84, 0x80, 0xF0, 0xCC, 0x08, 0xA8, 0x20, 0x33, 0x00, 0x88, 0xCD, 
+    0x30, 0xF0, 0x18, 0x80, 0x80, 0x80, 0x27, 0x00, 0x35, 0x9A, 0x52, 0xDA, 0x38, 0x91, 0xAA, 0xD0, 
+    0x98, 0xA8, 0x3A, 0x42, 0x25, 0xA8, 0x20, 0xB3, 0xAF, 0x20, 0x28, 0xB0, 0xCB, 0xB0, 0x0C, 0xAC, 
+    0x63, 0x16, 0x19, 0x22, 0x88, 0xA9, 0xAB, 0x08, 0xC8, 0xAE, 0x80, 0x8A, 0x8A, 0x80, 0x74, 0x10, 
+    0x20, 0x62, 0x08, 0x10, 0xB0, 0x00, 0xAC, 0x8B, 0x84, 0xC0, 0x30, 0x84, 0x80, 0x04, 0x0C, 0x83, 
+    0xFC, 0x89, 0xA2, 0x8C, 0x22, 0x8A, 0x33, 0xF0, 0x28, 0x24, 0x08, 0x52, 0xA2, 0x0A, 0xE8, 0x8B, 
+    0xA2, 0x8A, 0x33, 0xC0, 0x48, 0x3B, 0x34, 0x08, 0x53, 0x08, 0xEC, 0x8B, 0xA0, 0xBA, 0x83, 0xC0, 
+    0x03, 0xAF, 0x28, 0xA2, 0x38, 0x04, 0x33, 0xD0, 0x30, 0x03, 0x04, 0xC8, 0x24, 0xF0, 0x08, 0x82, 
+    0x38, 0x0B, 0x0C, 0xB8, 0x88, 0x8C, 0x37, 0x08, 0x3B, 0x80, 0x80, 0x8C, 0x70, 0xA3, 0x80, 0xC0, 
+    0x80, 0xBC, 0x00, 0x8C, 0xB4, 0xFB, 0x11, 0x00, 0x38, 0x08, 0x43, 0xC0, 0x08, 0x48, 0x84, 0x0B, 
+    0x03, 0x08, 0x8D, 0x80, 0x17, 0xB0, 0xBB, 0x80, 0xF0, 0x9C, 0x28, 0x20, 0x30, 0x43, 0x43, 0x80, 
+    0x3C, 0x30, 0xBC, 0x80, 0x44, 0xB8, 0xC0, 0x3B, 0x04, 0xBC, 0x80, 0x80, 0xBD, 0xAF, 0xA2, 0xAA, 
+    0x02, 0x08, 0x27, 0xA2, 0x32, 0xB3, 0x08, 0x84, 0x40, 0x80, 0x85, 0x80, 0x80, 0xE0, 0xB0, 0xC8, 
+    0xB8, 0x58, 0xB8, 0x40, 0x83, 0x00, 0x58, 0x80, 0x35, 0x0C, 0x83, 0x8B, 0xD0, 0x8B, 0xC8, 0x8B, 
+    0x08, 0x8D, 0x34, 0x8B, 0x00, 0xFE, 0x23, 0x00, 0x04, 0x08, 0x68, 0xB8, 0x34, 0xC3, 0x0B, 0xC8, 
+    0x80, 0xBC, 0x4B, 0xC3, 0x30, 0x08, 0x58, 0x80, 0x80, 0x35, 0xB4, 0x80, 0x80, 0x50, 0xBC, 0x40, 
+    0xB8, 0xB8, 0x0D, 0x48, 0x08, 0x48, 0x80, 0x80, 0x80, 0x06, 0x03, 0xD8, 0x3B, 0xC0, 0xC8, 0xC0, 
+    0x30, 0x48, 0x8B, 0x0C, 0xC8, 0x0B, 0x84, 0x40, 0x08, 0x58, 0xB8, 0x80, 0x40, 0x77, 0x03, 0xA9, 
+    0xBD, 0x18, 0x10, 0x80, 0xE9, 0x9B, 0x10, 0x31, 0x22, 0x28, 0x33, 0x03, 0xC8, 0x08, 0x44, 0x83, 
+    0x40, 0x08, 0x08, 0xBD, 0xCF, 0x99, 0x28, 0x80, 0xBA, 0xBB, 0x80, 0x80, 0x45, 0x48, 0x32, 0x03, 
+    0x84, 0x80, 0x50, 0x48, 0x08, 0x0C, 0x8B, 0x0C, 0x08, 0x84, 0x8B, 0x08, 0xF0, 0x08, 0x08, 0x08, 
+    0x05, 0x84, 0x40, 0x08, 0x8C, 0x80, 0xBC, 0x0D, 0x08, 0x08, 0xD8, 0x80, 0x04, 0x08, 0x08, 0x68, 
+    0x80, 0x40, 0xC0, 0x08, 0x84, 0x8B, 0x04, 0x08, 0x85, 0x80, 0x8C, 0x00, 0xD8, 0x03, 0x08, 0x0E, 
+    0x83, 0xBC, 0x40, 0xB8, 0x08, 0x44, 0x0B, 0x03, 0xE0, 0x80, 0xB4, 0xB8, 0x84, 0x80, 0x80, 0x86, 
+    0xC0, 0x03, 0x08, 0x58, 0x08, 0x3C, 0x40, 0x08, 0xC8, 0xC8, 0x0B, 0xC4, 0x8A, 0x80, 0xD0, 0x03, 
+    0x08, 0x3D, 0x80, 0x34, 0x84, 0x80, 0x80, 0xE0, 0x03, 0x08, 0x08, 0xC5, 0x0E, 0x08, 0x0B, 0x83, 
+    0x80, 0x80, 0x08, 0x06, 0x03, 0x08, 0x85, 0x00, 0xD8, 0x08, 0xED, 0x19, 0xA0, 0x38, 0xB8, 0x0C, 
+    0x43, 0x08, 0x03, 0x04, 0x8C, 0x80, 0x80, 0x60, 0x83, 0x00, 0x88, 0xBE, 0x30, 0x50, 0x08, 0x80, 
+    0xD8, 0xC0, 0xAC, 0x83, 0x80, 0x40, 0xD0, 0x80, 0xC0, 0x08, 0x84, 0x84, 0x84, 0x80, 0x84, 0x80, 
+    0x80, 0x00, 0x88, 0xF0, 0x8C, 0x30, 0x00, 0x08, 0x0F, 0x08, 0x48, 0x30, 0x04, 0x08, 0xBD, 0x80, 
+    0xBC, 0x30, 0xD0, 0x30, 0x00, 0xFE, 0x24, 0x00, 0x0C, 0x88, 0x00, 0x68, 0x30, 0x34, 0x40, 0xB8, 
+    0x58, 0x8B, 0x40, 0xB8, 0x08, 0xD8, 0xBC, 0x80, 0x00, 0x44, 0x30, 0x80, 0x80, 0x0E, 0x0C, 0x83, 
+    0x0C, 0x08, 0xD8, 0x80, 0xD0, 0x4B, 0x38, 0x08, 0x34, 0x80, 0x50, 0x08, 0x3C, 0x84, 0x8B, 0x80, 
+    0x8C, 0x8C, 0x40, 0x8B, 0x35, 0xC8, 0x80, 0x80, 0x8C, 0x00, 0x88, 0x80, 0xBF, 0x08, 0x04, 0x3C, 
+    0x84, 0x80, 0x04, 0x08, 0x58, 0x08, 0x8C, 0x00, 0xD8, 0x30, 0x80, 0x50, 0x30, 0x0C, 0x08, 0xD8, 
+    0x08, 0x04, 0x8C, 0x80, 0x8C, 0x80, 0x80, 0x0E, 0x03, 0x0D, 0x83, 0x0C, 0x03, 0x08, 0x80, 0x08, 
+    0x08, 0x80, 0x08, 0x37, 0x80, 0x80, 0x80, 0xF0, 0x83, 0x80, 0x70, 0x01, 0xF0, 0xB8, 0x80, 0x80, 
+    0x60, 0xB8, 0x58, 0xBB, 0x08, 0x08, 0x68, 0x80, 0x80, 0x80, 0x80, 0x70, 0x80, 0x80, 0xB6, 0x80, 
+    0x80, 0x0D, 0x88, 0x85, 0x00, 0x88, 0xD0, 0x03, 0x08, 0x68, 0x80, 0xD0, 0x80, 0xC0, 0x08, 0x08, 
+    0x3D, 0x80, 0x8C, 0x80, 0x80, 0x60, 0x80, 0x80, 0x60, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 
+    0x80, 0x08, 0x80, 0x08, 0x80, 0xFF, 0x8A, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x37, 
+    0x80, 0x80, 0x80, 0x80, 0x3F, 0xF0, 0x0A, 0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x05, 0x78, 0x08, 
+    0x0C, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x78, 0x83, 0x80, 0x80, 0x80, 0x80, 0xF0, 
+    0x83, 0x80, 0xF0, 0xF3, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0xB7, 0x50, 0xB8, 0x88, 0x80, 0x00, 
+    0x88, 0x17, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0xF3, 0x08, 0xB4, 0x08, 0x58, 0x08, 
+    0x08, 0x0D, 0x08, 0x08, 0x08, 0x78, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x6B, 0xB8, 0xC0, 
+    0x08, 0x08, 0x68, 0x08, 0x00, 0x00, 0x25, 0x00, 0x80, 0x8C, 0x80, 0x80, 0x80, 0x07, 0x08, 0x0D, 
+    0x08, 0x3C, 0x08, 0x08, 0x60, 0x8B, 0x58, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x9F, 0x50, 0x0C, 
+    0x08, 0x08, 0x08, 0x78, 0x80, 0x80, 0x08, 0x80, 0x0F, 0x08, 0x08, 0xC4, 0x80, 0x80, 0x80, 0x80, 
+    0x07, 0x08, 0x08, 0x08, 0x08, 0xF0, 0x59, 0x08, 0x08, 0x08, 0x0E, 0x08, 0x08, 0x08, 0x86, 0x8B, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x70, 0x8B, 0x07, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 
+    0xDF, 0x80, 0x80, 0x80, 0x80, 0x70, 0xE2, 0x48, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9F, 0x08, 
+    0x08, 0x78, 0x0B, 0x58, 0x80, 0x80, 0x80, 0xF0, 0x48, 0x08, 0xC8, 0x30, 0x0C, 0x08, 0x08, 0x08, 
+    0x87, 0x4B, 0x08, 0xC8, 0x30, 0xC0, 0x08, 0x08, 0x08, 0x78, 0x0B, 0x48, 0x80, 0x80, 0x80, 0x80, 
+    0x80, 0xB7, 0x80, 0x80, 0xF0, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x80, 
+    0x80, 0x70, 0xE5, 0x80, 0x84, 0x0B, 0x84, 0x8B, 0x04, 0x08, 0x08, 0x08, 0x3F, 0x08, 0xC8, 0x58, 
+    0x8B, 0x80, 0xB5, 0x80, 0x58, 0x08, 0x08, 0x80, 0x3D, 0x80, 0x80, 0x80, 0x8F, 0x40, 0xB8, 0x08, 
+    0xB5, 0x08, 0x58, 0x8B, 0x40, 0x80, 0x3C, 0x80, 0x4C, 0x08, 0xC8, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x70, 0x02, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0xFF, 0x09, 0x08, 0x88, 0x00, 0x88, 
+    0x47, 0x0E, 0x03, 0x08, 0x08, 0x88, 0x00, 0x08, 0xAF, 0x86, 0x8B, 0x80, 0x80, 0x80, 0x80, 0x80, 
+    0x00, 0x88, 0x00, 0x88, 0x70, 0x17, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0xFF, 0x88, 0x80, 
+    0x80, 0x80, 0x08, 0x37, 0xF0, 0x83, 0x80, 0x80, 0x00, 0x3F, 0x08, 0xD8, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x80, 0x08, 0x70, 0x00, 0xFF, 0x1E, 0x00, 0x80, 0x07, 0x00, 0x88, 0x00, 0x88, 0x00, 0x3F, 
+    0x08, 0x08, 0x08, 0x08, 0x3F, 0x08, 0x08, 0x08, 0xF8, 0x6A, 0xC0, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0xB7, 0x08, 0x08, 0x08, 0x17, 0x08, 0x08, 0x08, 0x3F, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 
+    0x80, 0xF8, 0x8D, 0xB7, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x08, 0x70, 0x85, 0x80, 0x80, 
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xF8, 0x03, 0xFF, 0x80, 0x80, 0x08, 0x80, 0x08, 0x70, 
+    0x8B, 0x80, 0xB7, 0xB5, 0x03, 0x88, 0x00, 0x3F, 0x08, 0x08, 0x08, 0x08, 0xF8, 0xB3, 0x08, 0x88, 
+    0x80, 0x00, 0x88, 0x27, 0x0E, 0x48, 0x08, 0x08, 0x3D, 0x8B, 0x40, 0x80, 0xD0, 0x03, 0xC8, 0x08, 
+    0x04, 0x8C, 0x84, 0x80, 0x0C, 0x03, 0xD8, 0x03, 0xD0, 0x30, 0x08, 0x08, 0x08, 0x0F, 0x88, 0x80, 
+    0x00, 0xB6, 0x08, 0x88, 0x00, 0x78, 0xC0, 0x30, 0x08, 0x08, 0x3E, 0x80, 0x3C, 0xC0, 0x08, 0xB4, 
+    0x08, 0x08, 0x88, 0x00, 0x07, 0x3C, 0x80, 0x80, 0x08, 0x3F, 0x80, 0x08, 0x3D, 0xC0, 0xC3, 0x30, 
+    0x8B, 0x08, 0xB5, 0x08, 0x08, 0x86, 0xC0, 0x03, 0x08, 0x08, 0xF8, 0x30, 0x08, 0x08, 0x08, 0x0F, 
+    0x08, 0x48, 0x80, 0x80, 0xE0, 0x03, 0x8C, 0x84, 0x80, 0x80, 0x0D, 0x08, 0x58, 0x8B, 0x80, 0x00, 
+    0x86, 0x8B, 0x80, 0x80, 0x70, 0x8B, 0x80, 0x80, 0x70, 0x08, 0xC8, 0x30, 0x80, 0x80, 0x3E, 0x80, 
+    0xD0, 0x80, 0x04, 0x88, 0x80, 0x00, 0x88, 0xF0, 0x03, 0x88, 0x80, 0x00, 0x88, 0x00, 0xF8, 0xF3, 
+    0x48, 0xB8, 0x80, 0x80, 0x80, 0x70, 0xC0, 0x83, 0x8B, 0x85, 0x4B, 0xB8, 0x80, 0x08, 0x80, 0x80, 
+    0x78, 0x81, 0x3D, 0xC0, 0x80, 0x58, 0x08, 0x3C, 0x80, 0x0C, 0x48, 0xC0, 0x80, 0x84, 0xC0, 0x83, 
+    0x8B, 0x85, 0x80, 0x0C, 0x00, 0xFF, 0x25, 0x00, 0xB4, 0x48, 0xB8, 0x80, 0x80, 0x00, 
 };
 
 static MemorySource *sampleSource = NULL;
@@ -601,6 +326,8 @@ static SoundEmojiSynthesizer* emojiSynth2 = NULL;
 static SerialStreamer *streamer = NULL;
 static Mixer2 *mixer = NULL;
 static SoundOutputPin *virtualPin = NULL;
+static AdpcmSource *adpcmSource = NULL;
+static AdaptiveRateOutput *adaptiveOutput = NULL;
 
 
 void
@@ -706,26 +433,35 @@ mixer_test()
     DMESG("MIXER_TEST: STARTING...");
 
     if (emojiSynth == NULL)
-        emojiSynth = new SoundEmojiSynthesizer(DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_0);
+        emojiSynth = new SoundEmojiSynthesizer(DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_0, 16000);
+
+    if (sampleSource == NULL){
+        sampleSource = new MemorySource();
+        sampleSource->setFormat(DATASTREAM_FORMAT_8BIT_UNSIGNED);
+        sampleSource->setBufferSize(512);
+    }
 
     DMESG("MIXER_TEST: SYNTH INITIALISED... ");
 
     if (mixer == NULL)
         mixer = new Mixer2();
 
+    if (adaptiveOutput == NULL)
+        adaptiveOutput = new AdaptiveRateOutput(*mixer);
+
     DMESG("MIXER_TEST: MIXER INITIALISED... ");
 
+    // The output stage hands the PWM one COUNTERTOP per sample, so the mixer can change rate without a glitch.
     if (speaker == NULL)
-        speaker = new NRF52PWM(NRF_PWM1, *mixer, 44100);
+        speaker = new NRF52PWM(NRF_PWM1, *adaptiveOutput, 44100);
 
     DMESG("MIXER_TEST: PWM INITIALISED... ");
 
     emojiSynth->setSampleRange(1023);
-    mixer->setSampleRange(speaker->getSampleRange());
     mixer->setOrMask(0x8000);
-    mixer->addChannel(*emojiSynth);
+    adaptiveOutput->addChannel(*emojiSynth, 16000);
 
-    speaker->setDecoderMode(PWM_DECODER_LOAD_Common);
+    speaker->setDecoderMode(PWM_DECODER_LOAD_WaveForm);
     speaker->connectPin(uBit.io.P0, 0);
     //speaker->connectPin(uBit.io.speaker, 1);
 
@@ -747,9 +483,32 @@ mixer_test()
 
     while(1)
     {
+        // Play everything twice, first at a fixed 44.1kHz and then adapting, so the saving is measured on the same mix.
         DMESG("MIXER_TEST: PLAY... ");
-        emojiSynth->play(b);
-        uBit.sleep(3000);
+        adaptiveOutput->resetStatistics();
+
+        for (int adaptive = 0; adaptive < 2; adaptive++)
+        {
+            adaptiveOutput->setAdaptive(adaptive);
+            emojiSynth->play(b);
+            uBit.sleep(3000);
+        }
+
+        adaptiveOutput->printStatistics();
+
+        // Bring a second channel in and out again, so the output rate is seen to follow the channels present.
+        DMESG("MIXER_TEST: PLAY HELLO... ");
+        adaptiveOutput->resetStatistics();
+
+        for (int adaptive = 0; adaptive < 2; adaptive++)
+        {
+            adaptiveOutput->setAdaptive(adaptive);
+            MixerChannel *helloChannel = adaptiveOutput->addChannel(*sampleSource, 16000, 255);
+            sampleSource->play(hello, sizeof(hello));
+            adaptiveOutput->removeChannel(helloChannel);
+        }
+
+        adaptiveOutput->printStatistics();
     }
 
     // Should never get here...
@@ -839,20 +598,23 @@ speaker_pin_test()
     if (mixer == NULL)
         mixer = new Mixer2();
 
+    if (adaptiveOutput == NULL)
+        adaptiveOutput = new AdaptiveRateOutput(*mixer);
+
     DMESG("SPEAKER_PIN_TEST: MIXER INITIALISED... ");
 
     if (speaker == NULL)
-        speaker = new NRF52PWM(NRF_PWM1, *mixer, 44100);
+        speaker = new NRF52PWM(NRF_PWM1, *adaptiveOutput, 44100);
 
     DMESG("SPEAKER_PIN_TEST: PWM INITIALISED... ");
 
     if (virtualPin == NULL)
         virtualPin = new SoundOutputPin(*mixer);
 
-    mixer->setSampleRange(speaker->getSampleRange());
+    // The virtual pin only plays square waves of a few hundred Hz, which the lowest output rate carries well.
     mixer->setOrMask(0x8000);
 
-    speaker->setDecoderMode(PWM_DECODER_LOAD_Common);
+    speaker->setDecoderMode(PWM_DECODER_LOAD_WaveForm);
     speaker->connectPin(uBit.io.P0, 0);
     //speaker->connectPin(uBit.io.speaker, 1);
 
@@ -877,6 +639,7 @@ speaker_pin_test()
         uBit.sleep(500);
         virtualPin->setAnalogValue(512);
 
+        adaptiveOutput->printStatistics();
     }
 
     // Should never get here...
@@ -943,6 +706,25 @@ say_hello()
     }
 }
 
+void
+say_hello_adpcm()
+{
+    DMESG("HELLO ADPCM TEST: STARTING...");
+
+    if (adpcmSource == NULL)
+        adpcmSource = new AdpcmSource(16000);
+
+    uBit.audio.mixer.addChannel(*adpcmSource, 16000, 255);
+
+    while(1)
+    {
+        DMESG("PLAY HELLO [%d bytes, was %d]\n", sizeof(hello_adpcm), sizeof(hello));
+        adpcmSource->resetStatistics();
+        adpcmSource->play(hello_adpcm, sizeof(hello_adpcm));
+        adpcmSource->printStatistics();
+    }
+}
+
 
 void
 speaker_test(int plays)
@@ -1,13 +1,16 @@
 #include "MicroBit.h"
 #include "Tests.h"
+#include "ScrollCache.h"
 
 void
 temperature_test()
 {
+    ScrollCache scroller(uBit.display);
+
     while(1)
     {
         DMESG("TEMPERATURE: %d", uBit.thermometer.getTemperature());
-        uBit.display.scroll(uBit.thermometer.getTemperature());
+        scroller.scroll(uBit.thermometer.getTemperature());
     }
 }
 
@@ -21,11 +21,16 @@ void display_test1();
 void display_test2();
 void concurrent_display_test();
 void fade_test();
+void pin_group_benchmark();
 void mems_mic_test();
 void mems_mic_zero_offset_test();
 void speaker_test(int plays);
 void speaker_test2(int plays);
 void gpio_test();
+void edge_capture_benchmark();
+void soft_serial_loopback_test();
+void pulse_meter_test();
+void pulse_meter_stream_test();
 void highDriveTest();
 void radio_rx_test();
 void radio_rx_test2();
@@ -37,7 +42,11 @@ void compass_test2();
 void button_blinky_test();
 void spirit_level();
 void edge_connector_test();
+void logic_analyzer_test();
+void logic_analyzer_benchmark();
 void analog_test();
+void analog_scan_test();
+void analog_scan_benchmark();
 void mems_clap_test(int wait_for_clap = 0);
 void mems_clap_test_spl(int wait_for_clap = 0);
 void showSerialNumber();
@@ -63,12 +72,19 @@ void display_button_icon_test();
 void display_brightness_test();
 void pwm_test();
 void pwm_pin_test();
+void waveform_generator_test();
 void cap_touch_test();
 void cap_touch_test_raw();
+void touch_sampler_test();
+void touch_classifier_test();
+void touch_trace_test();
 void light_level_test_raw();
 void display_brightness_AB_test();
 void display_lightlevel_test();
 void display_lightlevel_test2();
+void animation_engine_test();
+void bitboard_test();
+void scroll_cache_test();
 void mems_mic_drift_test();
 void mc_clap_test();
 void synthesizer_test();
@@ -92,14 +108,18 @@ void mixer_test();
 void mixer_test2();
 void speaker_pin_test();
 void say_hello();
+void say_hello_adpcm();
 void stream_mixer_to_serial();
 void out_of_box_experience_v2();
 void out_of_box_experience();
+void oob_image_benchmark();
 void level_meter();
 void init_clap_detect();
 void ble_test();
 void deepsleep_test( int test);
 void neopixel_test();
+void neopixel_benchmark();
+void neopixel_effects_test();
 void stream_test_mic_activate();
 void stream_test_getValue_interval();
 void stream_test_record();
@@ -0,0 +1,221 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "TouchClassifier.h"
+
+#include <stddef.h>
+
+/**
+ * Creates a classifier, with every channel calibrating.
+ * @param count the number of channels.
+ * @param threshold the least increase in a sample that can be told from noise, as a touch.
+ * @param ceiling the sample given when a pin didn't rise, up to TOUCH_CLASSIFIER_MAX_CEILING.
+ */
+TouchClassifier::TouchClassifier(int count, uint32_t threshold, uint32_t ceiling)
+{
+    this->count = count > 0 ? count : 0;
+    this->channels = new TouchClassifierChannel[this->count];
+    // Limited so that the touched level, threshold * 2 above the untouched level, still fits with its fraction.
+    if (threshold > TOUCH_CLASSIFIER_MAX_CEILING / 4)
+        threshold = TOUCH_CLASSIFIER_MAX_CEILING / 4;
+
+    this->threshold = (int32_t)threshold << TOUCH_CLASSIFIER_FRACTION_BITS;
+
+    setCeiling(ceiling);
+    setFilter(TOUCH_CLASSIFIER_DEFAULT_SMOOTHING, TOUCH_CLASSIFIER_DEFAULT_DRIFT);
+    reset();
+}
+
+/**
+ * Destructor.
+ */
+TouchClassifier::~TouchClassifier()
+{
+    delete[] channels;
+}
+
+/**
+ * Defines how quickly the levels follow the samples, as shifts: each sample moves them by 1/2^shift of the
+ * difference.
+ * @param smoothingShift the smoothing of the samples, from 0 (none) to 15.
+ * @param driftShift how slowly the untouched and touched levels follow the smoothed samples, from 0 to 20.
+ */
+void TouchClassifier::setFilter(int smoothingShift, int driftShift)
+{
+    this->smoothingShift = smoothingShift < 0 ? 0 : smoothingShift > 15 ? 15 : smoothingShift;
+    this->driftShift = driftShift < 0 ? 0 : driftShift > 20 ? 20 : driftShift;
+}
+
+/**
+ * Defines the sample given when a pin didn't rise.
+ * @param ceiling the sample, up to TOUCH_CLASSIFIER_MAX_CEILING.
+ */
+void TouchClassifier::setCeiling(uint32_t ceiling)
+{
+    this->ceiling = ceiling > TOUCH_CLASSIFIER_MAX_CEILING ? TOUCH_CLASSIFIER_MAX_CEILING : ceiling;
+}
+
+/**
+ * Recalibrates one channel from its next samples. The channel should not be touched while calibrating.
+ * @param channel the channel.
+ */
+void TouchClassifier::reset(int channel)
+{
+    if (channel < 0 || channel >= count)
+        return;
+
+    TouchClassifierChannel &c = channels[channel];
+
+    c.level = 0;
+    c.lo = 0;
+    c.hi = 0;
+    c.sum = 0;
+    c.calibrating = 1 << TOUCH_CLASSIFIER_CALIBRATION_SHIFT;
+    c.touched = 0;
+}
+
+/**
+ * Recalibrates every channel from their next samples.
+ */
+void TouchClassifier::reset()
+{
+    for (int i = 0; i < count; i++)
+        reset(i);
+}
+
+/**
+ * Classifies the next sample of a channel.
+ * @param channel the channel.
+ * @param sample the sample, which increases with capacitance.
+ * @return TOUCH_CLASSIFIER_TOUCH or TOUCH_CLASSIFIER_RELEASE if the channel has just been touched or released, or
+ * TOUCH_CLASSIFIER_NONE.
+ */
+int TouchClassifier::update(int channel, uint32_t sample)
+{
+    if (channel < 0 || channel >= count)
+        return TOUCH_CLASSIFIER_NONE;
+
+    TouchClassifierChannel &c = channels[channel];
+    bool saturated = sample >= ceiling;
+
+    if (saturated)
+        sample = ceiling;
+
+    if (c.calibrating)
+    {
+        c.sum += sample;
+
+        if (--c.calibrating == 0)
+        {
+            c.lo = (int32_t)(((uint64_t)c.sum << TOUCH_CLASSIFIER_FRACTION_BITS) >> TOUCH_CLASSIFIER_CALIBRATION_SHIFT);
+            c.hi = c.lo + 2 * threshold;
+            c.level = c.lo;
+        }
+
+        return TOUCH_CLASSIFIER_NONE;
+    }
+
+    c.level += (((int32_t)sample << TOUCH_CLASSIFIER_FRACTION_BITS) - c.level) >> smoothingShift;
+
+    int32_t mid = c.lo + ((c.hi - c.lo) >> 1);
+    int32_t band = (c.hi - c.lo) >> TOUCH_CLASSIFIER_HYSTERESIS_SHIFT;
+    int result = TOUCH_CLASSIFIER_NONE;
+
+    if (!c.touched && c.level > mid + band)
+    {
+        c.touched = 1;
+        result = TOUCH_CLASSIFIER_TOUCH;
+    }
+    else if (c.touched && c.level < mid - band)
+    {
+        c.touched = 0;
+        result = TOUCH_CLASSIFIER_RELEASE;
+    }
+
+    // Each level follows the smoothed sample while it's on that level's side of the midpoint, so slow changes in the
+    // pin or the finger are tracked, but the levels keep apart by at least the threshold either side of the midpoint.
+    if (!saturated)
+    {
+        if (!c.touched && c.level < mid)
+            c.lo += (c.level - c.lo) >> driftShift;
+
+        if (c.touched && c.level > mid)
+            c.hi += (c.level - c.hi) >> driftShift;
+    }
+
+    if (c.hi < c.lo + 2 * threshold)
+        c.hi = c.lo + 2 * threshold;
+
+    return result;
+}
+
+/**
+ * Determines if a channel is being touched.
+ */
+bool TouchClassifier::isTouched(int channel)
+{
+    return channel >= 0 && channel < count && channels[channel].touched;
+}
+
+/**
+ * Determines if a channel has finished calibrating.
+ */
+bool TouchClassifier::isCalibrated(int channel)
+{
+    return channel >= 0 && channel < count && channels[channel].calibrating == 0;
+}
+
+/**
+ * Determines the smoothed sample of a channel, in sample units.
+ */
+uint32_t TouchClassifier::getLevel(int channel)
+{
+    return channel >= 0 && channel < count ? channels[channel].level >> TOUCH_CLASSIFIER_FRACTION_BITS : 0;
+}
+
+/**
+ * Determines the untouched level of a channel, in sample units.
+ */
+uint32_t TouchClassifier::getBaseline(int channel)
+{
+    return channel >= 0 && channel < count ? channels[channel].lo >> TOUCH_CLASSIFIER_FRACTION_BITS : 0;
+}
+
+/**
+ * Determines the touched level of a channel, in sample units.
+ */
+uint32_t TouchClassifier::getTouchLevel(int channel)
+{
+    return channel >= 0 && channel < count ? channels[channel].hi >> TOUCH_CLASSIFIER_FRACTION_BITS : 0;
+}
+
+/**
+ * Determines the number of channels.
+ */
+int TouchClassifier::getCount()
+{
+    return count;
+}
@@ -0,0 +1,167 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include <stdint.h>
+
+#ifndef TOUCH_CLASSIFIER_H
+#define TOUCH_CLASSIFIER_H
+
+// Results of TouchClassifier::update().
+#define TOUCH_CLASSIFIER_NONE                   0
+#define TOUCH_CLASSIFIER_TOUCH                  1
+#define TOUCH_CLASSIFIER_RELEASE                2
+
+// Levels are held with 8 fractional bits, so that slow drift still moves them.
+#define TOUCH_CLASSIFIER_FRACTION_BITS          8
+
+// The untouched level is the mean of the first 16 samples.
+#define TOUCH_CLASSIFIER_CALIBRATION_SHIFT      4
+
+// The hysteresis band either side of the midpoint between the levels, as a fraction of the distance between them.
+#define TOUCH_CLASSIFIER_HYSTERESIS_SHIFT       3
+
+// Defaults suit 1kHz scans: the level follows samples over about 8ms, and the untouched and touched levels follow it
+// over about a second.
+#define TOUCH_CLASSIFIER_DEFAULT_THRESHOLD      500
+#define TOUCH_CLASSIFIER_DEFAULT_SMOOTHING      3
+#define TOUCH_CLASSIFIER_DEFAULT_DRIFT          10
+#define TOUCH_CLASSIFIER_MAX_CEILING            0x3FFFFF
+
+/**
+ * The state of one channel of a TouchClassifier. Levels are in sample units, with TOUCH_CLASSIFIER_FRACTION_BITS
+ * fractional bits.
+ */
+struct TouchClassifierChannel
+{
+    int32_t     level;                  // The smoothed sample.
+    int32_t     lo;                     // The untouched level.
+    int32_t     hi;                     // The touched level.
+    uint32_t    sum;                    // The sum of the samples taken so far while calibrating.
+    uint16_t    calibrating;            // The samples still to be taken before the untouched level is known.
+    uint8_t     touched;
+};
+
+/**
+ * Decides which of a number of capacitive touch channels are being touched, from a stream of samples for each, such as
+ * the rise times of a TouchSampler. The classifier is kept free of any hardware so that it can be run (and tested) on
+ * the host as well as on the device, and uses only integer arithmetic, so it's cheap enough to run on every sample of
+ * every pin in an interrupt handler at kHz scan rates.
+ *
+ * Each channel tracks two levels: untouched, and touched, starting threshold * 2 above untouched. The smoothed sample
+ * is classified against the midpoint between them, with a hysteresis band either side so it can't chatter. Drift is
+ * compensated by letting each level follow the smoothed sample slowly while it's on that level's side of the midpoint,
+ * and the two are never allowed closer than threshold * 2. Samples at or above the ceiling (a pin that didn't rise at
+ * all) count as touched, but don't move the levels.
+ */
+class TouchClassifier
+{
+    TouchClassifierChannel  *channels;
+    int                     count;
+    int32_t                 threshold;
+    uint32_t                ceiling;
+    uint8_t                 smoothingShift;
+    uint8_t                 driftShift;
+
+    public:
+    /**
+     * Creates a classifier, with every channel calibrating.
+     * @param count the number of channels.
+     * @param threshold the least increase in a sample that can be told from noise, as a touch.
+     * @param ceiling the sample given when a pin didn't rise, up to TOUCH_CLASSIFIER_MAX_CEILING.
+     */
+    TouchClassifier(int count, uint32_t threshold = TOUCH_CLASSIFIER_DEFAULT_THRESHOLD, uint32_t ceiling = TOUCH_CLASSIFIER_MAX_CEILING);
+
+    /**
+     * Destructor.
+     */
+    ~TouchClassifier();
+
+    /**
+     * Defines how quickly the levels follow the samples, as shifts: each sample moves them by 1/2^shift of the
+     * difference.
+     * @param smoothingShift the smoothing of the samples, from 0 (none) to 15.
+     * @param driftShift how slowly the untouched and touched levels follow the smoothed samples, from 0 to 20.
+     */
+    void setFilter(int smoothingShift, int driftShift);
+
+    /**
+     * Defines the sample given when a pin didn't rise.
+     * @param ceiling the sample, up to TOUCH_CLASSIFIER_MAX_CEILING.
+     */
+    void setCeiling(uint32_t ceiling);
+
+    /**
+     * Recalibrates one channel from its next samples. The channel should not be touched while calibrating.
+     * @param channel the channel.
+     */
+    void reset(int channel);
+
+    /**
+     * Recalibrates every channel from their next samples.
+     */
+    void reset();
+
+    /**
+     * Classifies the next sample of a channel.
+     * @param channel the channel.
+     * @param sample the sample, which increases with capacitance.
+     * @return TOUCH_CLASSIFIER_TOUCH or TOUCH_CLASSIFIER_RELEASE if the channel has just been touched or released, or
+     * TOUCH_CLASSIFIER_NONE.
+     */
+    int update(int channel, uint32_t sample);
+
+    /**
+     * Determines if a channel is being touched.
+     */
+    bool isTouched(int channel);
+
+    /**
+     * Determines if a channel has finished calibrating.
+     */
+    bool isCalibrated(int channel);
+
+    /**
+     * Determines the smoothed sample of a channel, in sample units.
+     */
+    uint32_t getLevel(int channel);
+
+    /**
+     * Determines the untouched level of a channel, in sample units.
+     */
+    uint32_t getBaseline(int channel);
+
+    /**
+     * Determines the touched level of a channel, in sample units.
+     */
+    uint32_t getTouchLevel(int channel);
+
+    /**
+     * Determines the number of channels.
+     */
+    int getCount();
+};
+
+#endif
@@ -0,0 +1,397 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "TouchSampler.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+
+TouchSampler *TouchSampler::instance = NULL;
+
+/**
+ * Creates a touch sampler.
+ * @param pins the pins to measure, each of which needs a pull up resistor to charge it, such as those on the
+ * edge connector.
+ * @param count the number of pins, up to TOUCH_SAMPLER_MAX_PINS.
+ * @param clock the timer used to time and start the scans. This must have six compare registers (TIMER3 or
+ * TIMER4), and must not be shared.
+ * @param irqn the interrupt of the clock timer.
+ * @param gpioteChannel the first of 'count' consecutive GPIOTE channels to use.
+ * @param ppiChannel the first of 'count' consecutive PPI channels to use.
+ * @param id the ID to use for events raised by this component.
+ */
+TouchSampler::TouchSampler(NRF52Pin *const *pins, int count, NRF_TIMER_Type *clock, IRQn_Type irqn, int gpioteChannel, int ppiChannel, uint16_t id) : clock(clock, irqn)
+{
+    this->count = min(count, TOUCH_SAMPLER_MAX_PINS);
+    this->gpioteChannel = gpioteChannel;
+    this->ppiChannel = ppiChannel;
+    this->id = id;
+    this->running = false;
+    this->classifier = NULL;
+
+    for (int i = 0; i < this->count; i++)
+    {
+        this->pins[i] = pins[i];
+        this->values[i] = 0;
+    }
+
+    this->periodTicks = TOUCH_SAMPLER_CLOCK_HZ / TOUCH_SAMPLER_DEFAULT_RATE;
+    this->timeoutTicks = TOUCH_SAMPLER_DEFAULT_TIMEOUT_US * (TOUCH_SAMPLER_CLOCK_HZ / 1000000);
+    this->released = 0;
+    this->scans = 0;
+    this->waiting = false;
+
+    cycle_counter_enable();
+    resetStatistics();
+}
+
+/**
+ * Clock interrupt handler.
+ */
+void TouchSampler::onClock(uint16_t channels)
+{
+    if (!instance)
+        return;
+
+    uint32_t start = cycle_counter_read();
+
+    if (channels & (1 << TOUCH_SAMPLER_TIMEOUT_CC))
+        instance->onTimeout();
+
+    if (channels & (1 << TOUCH_SAMPLER_PERIOD_CC))
+        instance->onRelease();
+
+    uint32_t cycles = cycle_counter_read() - start;
+    instance->isrCycles += cycles;
+    if (cycles > instance->isrCyclesMax)
+        instance->isrCyclesMax = cycles;
+}
+
+/**
+ * Releases every pin, starting a measurement.
+ */
+void TouchSampler::onRelease()
+{
+    NRF_TIMER_Type *c = clock.timer;
+
+    for (int i = 0; i < count; i++)
+        NRF_GPIOTE->EVENTS_IN[gpioteChannel + i] = 0;
+
+    // Event mode makes each pin an input, overriding the GPIO driving it low, so this is what lets them rise.
+    for (int i = 0; i < count; i++)
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+                                                (pins[i]->name << GPIOTE_CONFIG_PSEL_Pos) |
+                                                (GPIOTE_CONFIG_POLARITY_LoToHi << GPIOTE_CONFIG_POLARITY_Pos);
+
+    c->TASKS_CAPTURE[TOUCH_SAMPLER_TIMEOUT_CC] = 1;
+    released = c->CC[TOUCH_SAMPLER_TIMEOUT_CC];
+    c->CC[TOUCH_SAMPLER_TIMEOUT_CC] = released + timeoutTicks;
+}
+
+/**
+ * Takes the rise time of every pin, and starts discharging them.
+ */
+void TouchSampler::onTimeout()
+{
+    NRF_TIMER_Type *c = clock.timer;
+
+    for (int i = 0; i < count; i++)
+    {
+        int g = gpioteChannel + i;
+        uint32_t value = timeoutTicks;
+
+        // A pin that rose after the timeout, before we got here, still counts as a timeout.
+        if (NRF_GPIOTE->EVENTS_IN[g])
+        {
+            value = min(c->CC[i] - released, timeoutTicks);
+            NRF_GPIOTE->EVENTS_IN[g] = 0;
+        }
+
+        // Give the pin back to the GPIO, which drives it low until the next scan.
+        NRF_GPIOTE->CONFIG[g] = 0;
+
+        values[i] = value;
+
+        if (value >= timeoutTicks)
+            timeouts[i]++;
+
+        if (measured == 0 || value < minimum[i])
+            minimum[i] = value;
+
+        if (measured == 0 || value > maximum[i])
+            maximum[i] = value;
+
+        if (classifier)
+        {
+            int result = classifier->update(i, value);
+
+            if (result == TOUCH_CLASSIFIER_TOUCH)
+                Event(id, TOUCH_SAMPLER_EVT_TOUCH + i);
+            else if (result == TOUCH_CLASSIFIER_RELEASE)
+                Event(id, TOUCH_SAMPLER_EVT_RELEASE + i);
+        }
+    }
+
+    measured++;
+    scans++;
+
+    // The next scan starts at the period compare, which the timer hasn't reached yet, so a new rate can be applied now.
+    c->CC[TOUCH_SAMPLER_PERIOD_CC] = periodTicks;
+
+    if (waiting)
+    {
+        waiting = false;
+        Event(id, TOUCH_SAMPLER_EVT_SCAN);
+    }
+}
+
+/**
+ * Starts scanning.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+ */
+int TouchSampler::start()
+{
+    if (running)
+        return DEVICE_OK;
+
+    if (gpioteChannel < 0 || gpioteChannel + count > 8 || ppiChannel < 0 || ppiChannel + count > 20)
+        return DEVICE_INVALID_PARAMETER;
+
+    instance = this;
+
+    // Discharge every pin until the first scan.
+    for (int i = 0; i < count; i++)
+    {
+        int g = gpioteChannel + i;
+        int p = ppiChannel + i;
+
+        // The pin rises through the board's pull up alone, so it must have no internal pull. Tell CODAL, and clear it
+        // from the pin's configuration too, as that is what applies while GPIOTE has the pin as an input.
+        pins[i]->setPull(PullMode::None);
+        pins[i]->setDigitalValue(0);
+
+        NRF_GPIO_Type *port = pins[i]->name < 32 ? NRF_P0 : NRF_P1;
+        port->PIN_CNF[pins[i]->name & 31] &= ~GPIO_PIN_CNF_PULL_Msk;
+
+        NRF_GPIOTE->CONFIG[g] = 0;
+        NRF_GPIOTE->EVENTS_IN[g] = 0;
+
+        NRF_PPI->CH[p].EEP = (uint32_t) &NRF_GPIOTE->EVENTS_IN[g];
+        NRF_PPI->CH[p].TEP = (uint32_t) &clock.timer->TASKS_CAPTURE[i];
+        NRF_PPI->CHENSET = 1 << p;
+    }
+
+    clock.setClockSpeed(TOUCH_SAMPLER_CLOCK_HZ / 1000);
+    clock.setBitMode(BitMode32);
+    clock.setIRQ(onClock);
+    clock.reset();
+
+    // Each scan starts when the timer reaches the period and clears itself. The timeout is set by each scan.
+    clock.timer->SHORTS = TIMER_SHORTS_COMPARE5_CLEAR_Msk;
+    clock.setCompare(TOUCH_SAMPLER_PERIOD_CC, periodTicks);
+    clock.setCompare(TOUCH_SAMPLER_TIMEOUT_CC, 0xFFFFFFFF);
+
+    running = true;
+    clock.enable();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Stops scanning, leaving every pin driven low.
+ */
+void TouchSampler::stop()
+{
+    if (!running)
+        return;
+
+    clock.disable();
+    clock.timer->SHORTS = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        NRF_PPI->CHENCLR = 1 << (ppiChannel + i);
+        NRF_GPIOTE->CONFIG[gpioteChannel + i] = 0;
+    }
+
+    running = false;
+}
+
+/**
+ * Defines how often the pins are measured. Takes effect from the next scan.
+ * @param rate the number of scans a second.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if a scan wouldn't fit the timeout and the time to
+ * discharge the pins.
+ */
+int TouchSampler::setScanRate(int rate)
+{
+    if (rate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    uint32_t period = TOUCH_SAMPLER_CLOCK_HZ / rate;
+
+    if (period < timeoutTicks + TOUCH_SAMPLER_MIN_DISCHARGE_US * (TOUCH_SAMPLER_CLOCK_HZ / 1000000))
+        return DEVICE_INVALID_PARAMETER;
+
+    periodTicks = period;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the number of scans a second.
+ */
+int TouchSampler::getScanRate()
+{
+    return TOUCH_SAMPLER_CLOCK_HZ / periodTicks;
+}
+
+/**
+ * Defines how long to wait for a pin to rise. Takes effect from the next scan.
+ * @param timeoutUs the timeout, in microseconds.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if a scan wouldn't fit the timeout and the time to
+ * discharge the pins.
+ */
+int TouchSampler::setTimeout(int timeoutUs)
+{
+    if (timeoutUs <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    uint32_t timeout = timeoutUs * (TOUCH_SAMPLER_CLOCK_HZ / 1000000);
+
+    if (periodTicks < timeout + TOUCH_SAMPLER_MIN_DISCHARGE_US * (TOUCH_SAMPLER_CLOCK_HZ / 1000000))
+        return DEVICE_INVALID_PARAMETER;
+
+    timeoutTicks = timeout;
+
+    if (classifier)
+        classifier->setCeiling(timeoutTicks);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Attaches a classifier, which is given the rise time of every pin as each scan completes, in interrupt context.
+ * TOUCH_SAMPLER_EVT_TOUCH and TOUCH_SAMPLER_EVT_RELEASE events, plus the index of the pin, are raised as it
+ * decides each pin has been touched or released. Its ceiling is set to the timeout.
+ * @param classifier the classifier, with a channel for each pin, or NULL to detach it.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the classifier has too few channels.
+ */
+int TouchSampler::setClassifier(TouchClassifier *classifier)
+{
+    if (classifier && classifier->getCount() < count)
+        return DEVICE_INVALID_PARAMETER;
+
+    if (classifier)
+        classifier->setCeiling(timeoutTicks);
+
+    target_disable_irq();
+    this->classifier = classifier;
+    target_enable_irq();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the rise time of a pin in the latest scan.
+ * @param pin the index of the pin, in the array given to TouchSampler.
+ * @return the rise time in clock ticks (1/16us), the timeout if the pin didn't rise, or 0 if there has been no scan.
+ */
+uint32_t TouchSampler::getValue(int pin)
+{
+    if (pin < 0 || pin >= count)
+        return 0;
+
+    return values[pin];
+}
+
+/**
+ * Copies the rise time of every pin in the latest scan, all from the same scan.
+ * @param values space for a rise time for each pin, in clock ticks.
+ * @return the number of scans made so far.
+ */
+uint32_t TouchSampler::read(uint32_t *values)
+{
+    target_disable_irq();
+
+    for (int i = 0; i < count; i++)
+        values[i] = this->values[i];
+
+    uint32_t n = scans;
+
+    target_enable_irq();
+
+    return n;
+}
+
+/**
+ * Blocks the calling fiber until the next scan is complete.
+ */
+void TouchSampler::waitForScan()
+{
+    if (!running)
+        return;
+
+    // Wait with interrupts off until this fiber is queued, so a scan can't end in between.
+    target_disable_irq();
+    waiting = true;
+    fiber_wake_on_event(id, TOUCH_SAMPLER_EVT_SCAN);
+    target_enable_irq();
+
+    schedule();
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void TouchSampler::resetStatistics()
+{
+    target_disable_irq();
+
+    for (int i = 0; i < TOUCH_SAMPLER_MAX_PINS; i++)
+    {
+        minimum[i] = 0;
+        maximum[i] = 0;
+        timeouts[i] = 0;
+    }
+
+    measured = 0;
+    isrCycles = 0;
+    isrCyclesMax = 0;
+    target_enable_irq();
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void TouchSampler::printStatistics()
+{
+    DMESG("TOUCH_SAMPLER: [PINS: %d] [RATE: %d Hz] [SCANS: %d]", count, getScanRate(), measured);
+
+    for (int i = 0; i < count; i++)
+        DMESG("   PIN %d: [LAST: %d] [MIN: %d] [MAX: %d] [TIMEOUTS: %d]", i, values[i], minimum[i], maximum[i], timeouts[i]);
+
+    DMESG("   INTERRUPTS: [AVG: %d cycles] [MAX: %d cycles]", measured ? isrCycles / (2 * measured) : 0, isrCyclesMax);
+}
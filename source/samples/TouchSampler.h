@@ -0,0 +1,202 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#include "MicroBit.h"
+#include "TouchClassifier.h"
+
+#ifndef TOUCH_SAMPLER_H
+#define TOUCH_SAMPLER_H
+
+#define TOUCH_SAMPLER_ID                        3110
+
+#define TOUCH_SAMPLER_EVT_SCAN                  1
+
+// Raised for each pin as it's touched and released, when a classifier is attached: add the index of the pin.
+#define TOUCH_SAMPLER_EVT_TOUCH                 0x10
+#define TOUCH_SAMPLER_EVT_RELEASE               0x20
+
+#define TOUCH_SAMPLER_CLOCK_HZ                  16000000
+
+// The clock timer has a capture register for each pin, one for the end of the measurement and one for the scan period.
+#define TOUCH_SAMPLER_MAX_PINS                  4
+#define TOUCH_SAMPLER_TIMEOUT_CC                4
+#define TOUCH_SAMPLER_PERIOD_CC                 5
+
+// Scan 100 times a second, giving up on a pin that hasn't risen after 4ms. Each pin is held low for at least 100us
+// between measurements, which is plenty to discharge it.
+#define TOUCH_SAMPLER_DEFAULT_RATE              100
+#define TOUCH_SAMPLER_DEFAULT_TIMEOUT_US        4000
+#define TOUCH_SAMPLER_MIN_DISCHARGE_US          100
+
+// Default peripheral resources. One GPIOTE channel and one PPI channel per pin.
+#define TOUCH_SAMPLER_DEFAULT_GPIOTE            4
+#define TOUCH_SAMPLER_DEFAULT_PPI               15
+
+/**
+ * Measures the capacitance of a few pins at once, as the time each takes to rise through its pull up resistor, timed to
+ * a 16MHz clock tick by the hardware rather than by a polling loop.
+ *
+ * Between measurements each pin is driven low by its GPIO, discharging it. A measurement starts by putting the pin's
+ * GPIOTE channel into event mode, which takes the pin over as an input, releasing every pin within a few ticks of each
+ * other. As each pin crosses the logic high threshold, its GPIOTE event captures the clock TIMER into that pin's
+ * capture register through PPI. At the timeout, an interrupt takes the rise times, and disables the GPIOTE channels,
+ * which gives the pins back to the GPIO to be discharged again.
+ *
+ * Scans are started by the clock TIMER's own compare, so the scan rate is exact, and the CPU only runs for two short
+ * interrupts per scan, whatever the number of pins. A fiber can wait for each scan with waitForScan(), or a
+ * TouchClassifier can be attached to classify every scan in the interrupt and raise touch and release events.
+ */
+class TouchSampler
+{
+    NRF52Pin                *pins[TOUCH_SAMPLER_MAX_PINS];
+    int                     count;
+    NRFLowLevelTimer        clock;
+    int                     gpioteChannel;
+    int                     ppiChannel;
+    uint16_t                id;
+    bool                    running;
+    TouchClassifier         *classifier;
+
+    uint32_t                periodTicks;
+    uint32_t                timeoutTicks;
+    uint32_t                released;           // The clock when the pins were released for the current scan.
+
+    volatile uint32_t       values[TOUCH_SAMPLER_MAX_PINS];
+    volatile uint32_t       scans;
+    volatile bool           waiting;
+
+    // Statistics.
+    uint32_t                minimum[TOUCH_SAMPLER_MAX_PINS];
+    uint32_t                maximum[TOUCH_SAMPLER_MAX_PINS];
+    uint32_t                timeouts[TOUCH_SAMPLER_MAX_PINS];
+    uint32_t                measured;
+    uint32_t                isrCycles;
+    uint32_t                isrCyclesMax;
+
+    static TouchSampler     *instance;
+
+    /**
+     * Clock interrupt handler.
+     */
+    static void onClock(uint16_t channels);
+
+    /**
+     * Releases every pin, starting a measurement.
+     */
+    void onRelease();
+
+    /**
+     * Takes the rise time of every pin, and starts discharging them.
+     */
+    void onTimeout();
+
+    public:
+    /**
+     * Creates a touch sampler.
+     * @param pins the pins to measure, each of which needs a pull up resistor to charge it, such as those on the
+     * edge connector.
+     * @param count the number of pins, up to TOUCH_SAMPLER_MAX_PINS.
+     * @param clock the timer used to time and start the scans. This must have six compare registers (TIMER3 or
+     * TIMER4), and must not be shared.
+     * @param irqn the interrupt of the clock timer.
+     * @param gpioteChannel the first of 'count' consecutive GPIOTE channels to use.
+     * @param ppiChannel the first of 'count' consecutive PPI channels to use.
+     * @param id the ID to use for events raised by this component.
+     */
+    TouchSampler(NRF52Pin *const *pins, int count, NRF_TIMER_Type *clock = NRF_TIMER3, IRQn_Type irqn = TIMER3_IRQn, int gpioteChannel = TOUCH_SAMPLER_DEFAULT_GPIOTE, int ppiChannel = TOUCH_SAMPLER_DEFAULT_PPI, uint16_t id = TOUCH_SAMPLER_ID);
+
+    /**
+     * Starts scanning.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the peripheral resources given are out of range.
+     */
+    int start();
+
+    /**
+     * Stops scanning, leaving every pin driven low.
+     */
+    void stop();
+
+    /**
+     * Defines how often the pins are measured. Takes effect from the next scan.
+     * @param rate the number of scans a second.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if a scan wouldn't fit the timeout and the time to
+     * discharge the pins.
+     */
+    int setScanRate(int rate);
+
+    /**
+     * Determines the number of scans a second.
+     */
+    int getScanRate();
+
+    /**
+     * Defines how long to wait for a pin to rise. Takes effect from the next scan.
+     * @param timeoutUs the timeout, in microseconds.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if a scan wouldn't fit the timeout and the time to
+     * discharge the pins.
+     */
+    int setTimeout(int timeoutUs);
+
+    /**
+     * Attaches a classifier, which is given the rise time of every pin as each scan completes, in interrupt context.
+     * TOUCH_SAMPLER_EVT_TOUCH and TOUCH_SAMPLER_EVT_RELEASE events, plus the index of the pin, are raised as it
+     * decides each pin has been touched or released. Its ceiling is set to the timeout.
+     * @param classifier the classifier, with a channel for each pin, or NULL to detach it.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER if the classifier has too few channels.
+     */
+    int setClassifier(TouchClassifier *classifier);
+
+    /**
+     * Determines the rise time of a pin in the latest scan.
+     * @param pin the index of the pin, in the array given to TouchSampler.
+     * @return the rise time in clock ticks (1/16us), the timeout if the pin didn't rise, or 0 if there has been no scan.
+     */
+    uint32_t getValue(int pin);
+
+    /**
+     * Copies the rise time of every pin in the latest scan, all from the same scan.
+     * @param values space for a rise time for each pin, in clock ticks.
+     * @return the number of scans made so far.
+     */
+    uint32_t read(uint32_t *values);
+
+    /**
+     * Blocks the calling fiber until the next scan is complete.
+     */
+    void waitForScan();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
@@ -0,0 +1,364 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "WaveformGenerator.h"
+#include "CycleCounter.h"
+#include "Tests.h"
+#include <math.h>
+
+/**
+ * Creates a waveform generator. Every channel is silent, at 1kHz.
+ * @param pwm the PWM instance to use, which must not be shared.
+ * @param samples the number of steps in each cycle.
+ */
+WaveformGenerator::WaveformGenerator(NRF_PWM_Type *pwm, int samples)
+{
+    this->pwm = pwm;
+    this->samples = max(samples, 2);
+    this->active = 0;
+    this->running = false;
+    this->swapping = false;
+    this->cycleTicks = WAVEFORM_GENERATOR_CLOCK_HZ / 1000;
+
+    for (int i = 0; i < 2; i++)
+        table[i] = new uint16_t[this->samples * WAVEFORM_GENERATOR_STEP];
+
+    for (int c = 0; c < WAVEFORM_GENERATOR_CHANNELS; c++)
+    {
+        channel[c].shape = WAVEFORM_SILENT;
+        channel[c].amplitude = WAVEFORM_GENERATOR_MAX_AMPLITUDE;
+        channel[c].phase = 0;
+        channel[c].custom = NULL;
+        channel[c].customLength = 0;
+    }
+
+    cycle_counter_enable();
+    resetStatistics();
+    update();
+}
+
+/**
+ * Determine the level of a channel at the given step of the cycle.
+ * @return the level, from -32767 to 32767.
+ */
+int WaveformGenerator::level(const WaveformChannel &c, int step)
+{
+    // The position in the cycle, from 0 to 65535.
+    uint32_t x = (((uint32_t)step << 16) / samples + (uint32_t)c.phase * 65536 / 360) & 0xFFFF;
+
+    switch (c.shape)
+    {
+        case WAVEFORM_SINE:
+            return (int)(sinf(x * (2.0f * 3.14159265f / 65536.0f)) * 32767.0f);
+
+        case WAVEFORM_TRIANGLE:
+            return x < 32768 ? (int)x * 2 - 32767 : 32767 - ((int)x - 32768) * 2;
+
+        case WAVEFORM_SAWTOOTH:
+            return max((int)x - 32768, -32767);
+
+        case WAVEFORM_SQUARE:
+            return x < 32768 ? 32767 : -32767;
+
+        case WAVEFORM_CUSTOM:
+            return c.custom[(x * c.customLength) >> 16];
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Builds the table not being played from the current settings, and hands it to the PWM.
+ */
+void WaveformGenerator::update()
+{
+    waitForSwap();
+
+    uint32_t start = cycle_counter_read();
+    uint16_t *t = table[!active];
+
+    // Spread the remainder of the cycle over the steps, so that its length is exact.
+    uint32_t top = cycleTicks / samples;
+    uint32_t extra = cycleTicks % samples;
+    uint32_t error = 0;
+
+    for (int s = 0; s < samples; s++)
+    {
+        uint32_t stepTop = top;
+
+        error += extra;
+        if (error >= (uint32_t)samples)
+        {
+            error -= samples;
+            stepTop++;
+        }
+
+        // Falling edge polarity, so the output is high for the first 'compare' ticks of the step.
+        for (int c = 0; c < WAVEFORM_GENERATOR_CHANNELS; c++)
+        {
+            int l = level(channel[c], s) * channel[c].amplitude / WAVEFORM_GENERATOR_MAX_AMPLITUDE;
+            t[s * WAVEFORM_GENERATOR_STEP + c] = 0x8000 | ((stepTop * (uint32_t)(l + 32768)) >> 16);
+        }
+
+        t[s * WAVEFORM_GENERATOR_STEP + 3] = stepTop;
+    }
+
+    active = !active;
+
+    builds++;
+    buildCycles += cycle_counter_read() - start;
+
+    if (running)
+    {
+        pwm->SEQ[0].PTR = (uint32_t) table[active];
+        pwm->SEQ[1].PTR = (uint32_t) table[active];
+
+        // Any sequence started from now on plays the new table. One started between the writes above and here may
+        // have too, but waiting for another start of it costs no more than a cycle.
+        pwm->EVENTS_SEQSTARTED[0] = 0;
+        pwm->EVENTS_SEQSTARTED[1] = 0;
+        swapping = true;
+    }
+}
+
+/**
+ * Blocks the calling fiber until the PWM has stopped reading the table it was last moved from.
+ */
+void WaveformGenerator::waitForSwap()
+{
+    if (!swapping)
+        return;
+
+    if (!(pwm->EVENTS_SEQSTARTED[0] && pwm->EVENTS_SEQSTARTED[1]))
+    {
+        swapWaits++;
+
+        while (running && !(pwm->EVENTS_SEQSTARTED[0] && pwm->EVENTS_SEQSTARTED[1]))
+            fiber_sleep(1);
+    }
+
+    swapping = false;
+}
+
+/**
+ * Routes a channel to a pin.
+ * @param pin the pin to drive.
+ * @param channel the channel, from 0 to 2.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int WaveformGenerator::connectPin(Pin &pin, int channel)
+{
+    if (channel < 0 || channel >= WAVEFORM_GENERATOR_CHANNELS)
+        return DEVICE_INVALID_PARAMETER;
+
+    // Let CODAL release the pin from anything else, and leave it a low output for whenever the PWM is disabled.
+    pin.setDigitalValue(0);
+
+    pwm->PSEL.OUT[channel] = (pin.name << PWM_PSEL_OUT_PIN_Pos) | (PWM_PSEL_OUT_CONNECT_Connected << PWM_PSEL_OUT_CONNECT_Pos);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Disconnects a channel from its pin.
+ * @param channel the channel, from 0 to 2.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int WaveformGenerator::disconnectPin(int channel)
+{
+    if (channel < 0 || channel >= WAVEFORM_GENERATOR_CHANNELS)
+        return DEVICE_INVALID_PARAMETER;
+
+    pwm->PSEL.OUT[channel] = (PWM_PSEL_OUT_CONNECT_Disconnected << PWM_PSEL_OUT_CONNECT_Pos);
+
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the waveform of a channel. Takes effect at the next cycle boundary.
+ * @param channel the channel, from 0 to 2.
+ * @param shape one of the WAVEFORM_ shapes other than WAVEFORM_CUSTOM.
+ * @param amplitude the amplitude, out of WAVEFORM_GENERATOR_MAX_AMPLITUDE.
+ * @param phase the phase, in degrees.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int WaveformGenerator::setWaveform(int channel, int shape, int amplitude, int phase)
+{
+    if (channel < 0 || channel >= WAVEFORM_GENERATOR_CHANNELS || shape < WAVEFORM_SILENT || shape >= WAVEFORM_CUSTOM || amplitude < 0 || amplitude > WAVEFORM_GENERATOR_MAX_AMPLITUDE)
+        return DEVICE_INVALID_PARAMETER;
+
+    WaveformChannel &c = this->channel[channel];
+
+    c.shape = shape;
+    c.amplitude = amplitude;
+    c.phase = (phase % 360 + 360) % 360;
+    c.custom = NULL;
+    c.customLength = 0;
+
+    update();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Defines a channel to play one cycle given as samples, resampled to the steps of the cycle. Takes effect at the
+ * next cycle boundary. The samples are not copied, and must not change while in use.
+ * @param channel the channel, from 0 to 2.
+ * @param cycle the samples of the cycle, from -32767 to 32767.
+ * @param length the number of samples.
+ * @param amplitude the amplitude, out of WAVEFORM_GENERATOR_MAX_AMPLITUDE.
+ * @param phase the phase, in degrees.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int WaveformGenerator::setCustomWaveform(int channel, const int16_t *cycle, int length, int amplitude, int phase)
+{
+    if (channel < 0 || channel >= WAVEFORM_GENERATOR_CHANNELS || cycle == NULL || length <= 0 || amplitude < 0 || amplitude > WAVEFORM_GENERATOR_MAX_AMPLITUDE)
+        return DEVICE_INVALID_PARAMETER;
+
+    WaveformChannel &c = this->channel[channel];
+
+    c.shape = WAVEFORM_CUSTOM;
+    c.amplitude = amplitude;
+    c.phase = (phase % 360 + 360) % 360;
+    c.custom = cycle;
+    c.customLength = length;
+
+    update();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Defines the frequency of every channel. Takes effect at the next cycle boundary.
+ * @param frequency the frequency in Hz. The range depends on the number of steps in a cycle: with 64, it is 7.7Hz
+ * to 15.6kHz.
+ * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+ */
+int WaveformGenerator::setFrequency(float frequency)
+{
+    if (frequency <= 0.0f)
+        return DEVICE_INVALID_PARAMETER;
+
+    float ticks = WAVEFORM_GENERATOR_CLOCK_HZ / frequency + 0.5f;
+
+    if (ticks < (float)samples * WAVEFORM_GENERATOR_MIN_TOP || ticks >= (float)samples * WAVEFORM_GENERATOR_MAX_TOP + 1)
+        return DEVICE_INVALID_PARAMETER;
+
+    cycleTicks = (uint32_t)ticks;
+    update();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Determines the frequency actually played, after rounding the cycle to a whole number of ticks.
+ */
+float WaveformGenerator::getFrequency()
+{
+    return (float)WAVEFORM_GENERATOR_CLOCK_HZ / cycleTicks;
+}
+
+/**
+ * Starts playing.
+ */
+void WaveformGenerator::start()
+{
+    if (running)
+        return;
+
+    pwm->ENABLE = (PWM_ENABLE_ENABLE_Enabled << PWM_ENABLE_ENABLE_Pos);
+    pwm->MODE = (PWM_MODE_UPDOWN_Up << PWM_MODE_UPDOWN_Pos);
+    pwm->PRESCALER = (PWM_PRESCALER_PRESCALER_DIV_1 << PWM_PRESCALER_PRESCALER_Pos);
+    pwm->DECODER = (PWM_DECODER_LOAD_WaveForm << PWM_DECODER_LOAD_Pos) | (PWM_DECODER_MODE_RefreshCount << PWM_DECODER_MODE_Pos);
+
+    // Sequence 0 then sequence 1, each one cycle, then back to sequence 0 forever.
+    pwm->LOOP = 1;
+
+    for (int n = 0; n < 2; n++)
+    {
+        pwm->SEQ[n].PTR = (uint32_t) table[active];
+        pwm->SEQ[n].CNT = samples * WAVEFORM_GENERATOR_STEP;
+        pwm->SEQ[n].REFRESH = 0;
+        pwm->SEQ[n].ENDDELAY = 0;
+    }
+
+    pwm->SHORTS = PWM_SHORTS_LOOPSDONE_SEQSTART0_Msk;
+    pwm->INTEN = 0;
+
+    running = true;
+    pwm->TASKS_SEQSTART[0] = 1;
+}
+
+/**
+ * Stops playing, at the end of the current PWM step.
+ */
+void WaveformGenerator::stop()
+{
+    if (!running)
+        return;
+
+    pwm->SHORTS = 0;
+    pwm->EVENTS_STOPPED = 0;
+    pwm->TASKS_STOP = 1;
+
+    while (!pwm->EVENTS_STOPPED);
+
+    pwm->ENABLE = (PWM_ENABLE_ENABLE_Disabled << PWM_ENABLE_ENABLE_Pos);
+
+    running = false;
+    swapping = false;
+}
+
+/**
+ * Determines if the generator is playing.
+ */
+bool WaveformGenerator::isRunning()
+{
+    return running;
+}
+
+/**
+ * Reset the statistics gathered.
+ */
+void WaveformGenerator::resetStatistics()
+{
+    builds = 0;
+    buildCycles = 0;
+    swapWaits = 0;
+}
+
+/**
+ * Output the statistics gathered to the DMESG buffer.
+ */
+void WaveformGenerator::printStatistics()
+{
+    DMESG("WAVEFORM_GENERATOR: [FREQUENCY: %d mHz] [STEPS: %d] [TICKS: %d]", (int)(getFrequency() * 1000), samples, cycleTicks);
+    DMESG("   BUILDS: %d [AVG: %d cycles]", builds, builds ? buildCycles / builds : 0);
+    DMESG("   SWAP WAITS: %d", swapWaits);
+
+    for (int c = 0; c < WAVEFORM_GENERATOR_CHANNELS; c++)
+        DMESG("   CHANNEL %d: [SHAPE: %d] [AMPLITUDE: %d] [PHASE: %d]", c, channel[c].shape, channel[c].amplitude, channel[c].phase);
+}
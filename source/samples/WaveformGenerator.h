@@ -0,0 +1,194 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MicroBit.h"
+
+#ifndef WAVEFORM_GENERATOR_H
+#define WAVEFORM_GENERATOR_H
+
+#define WAVEFORM_GENERATOR_CLOCK_HZ             16000000
+#define WAVEFORM_GENERATOR_DEFAULT_SAMPLES      64
+
+// In waveform decoder mode each PWM step is three compare values and a COUNTERTOP, so there are three channels.
+#define WAVEFORM_GENERATOR_CHANNELS             3
+#define WAVEFORM_GENERATOR_STEP                 4
+
+// The shortest step, which keeps at least four bits of amplitude, and the longest COUNTERTOP the PWM allows.
+#define WAVEFORM_GENERATOR_MIN_TOP              16
+#define WAVEFORM_GENERATOR_MAX_TOP              32767
+
+#define WAVEFORM_GENERATOR_MAX_AMPLITUDE        1024
+
+#define WAVEFORM_SILENT                         0
+#define WAVEFORM_SINE                           1
+#define WAVEFORM_TRIANGLE                       2
+#define WAVEFORM_SAWTOOTH                       3
+#define WAVEFORM_SQUARE                         4
+#define WAVEFORM_CUSTOM                         5
+
+/**
+ * The waveform played on one channel of a WaveformGenerator.
+ */
+struct WaveformChannel
+{
+    int             shape;                  // One of the WAVEFORM_ shapes.
+    int             amplitude;              // Out of WAVEFORM_GENERATOR_MAX_AMPLITUDE, around the mid point.
+    int             phase;                  // In degrees, 0 to 359.
+    const int16_t   *custom;                // The cycle played by WAVEFORM_CUSTOM, from -32767 to 32767.
+    int             customLength;
+};
+
+/**
+ * Plays up to three periodic waveforms, in sync at the same frequency, from one PWM instance, without any work by the
+ * CPU while they play.
+ *
+ * One cycle of every channel is built into a table of PWM steps in waveform decoder mode, each holding a compare value
+ * for each channel and its own COUNTERTOP. The PWM's two sequences both point at the table, and loop forever through
+ * the LOOPSDONE to SEQSTART0 shortcut, so EasyDMA plays it with no interrupts at all.
+ *
+ * The COUNTERTOPs are spread over the cycle so that its length in 16MHz ticks is exact, giving a frequency resolution of
+ * one tick in the whole cycle rather than one tick per step. Retuning, or changing any channel, builds a second table
+ * and points the sequences at it. The PWM only reads a sequence's pointer when it starts that sequence, which is always
+ * at a cycle boundary, so changes never glitch, and the old table is reused once both sequences have moved on.
+ *
+ * Each channel is a PWM output at the step rate (64kHz for 1kHz with 64 steps), so it needs a low pass filter, or a
+ * speaker, to become the waveform.
+ */
+class WaveformGenerator
+{
+    NRF_PWM_Type        *pwm;
+    int                 samples;
+    uint16_t            *table[2];
+    int                 active;
+    bool                running;
+    bool                swapping;
+    uint32_t            cycleTicks;
+    WaveformChannel     channel[WAVEFORM_GENERATOR_CHANNELS];
+
+    uint32_t            builds;
+    uint32_t            buildCycles;
+    uint32_t            swapWaits;
+
+    /**
+     * Determine the level of a channel at the given step of the cycle.
+     * @return the level, from -32767 to 32767.
+     */
+    int level(const WaveformChannel &c, int step);
+
+    /**
+     * Builds the table not being played from the current settings, and hands it to the PWM.
+     */
+    void update();
+
+    /**
+     * Blocks the calling fiber until the PWM has stopped reading the table it was last moved from.
+     */
+    void waitForSwap();
+
+    public:
+    /**
+     * Creates a waveform generator. Every channel is silent, at 1kHz.
+     * @param pwm the PWM instance to use, which must not be shared.
+     * @param samples the number of steps in each cycle.
+     */
+    WaveformGenerator(NRF_PWM_Type *pwm = NRF_PWM2, int samples = WAVEFORM_GENERATOR_DEFAULT_SAMPLES);
+
+    /**
+     * Routes a channel to a pin.
+     * @param pin the pin to drive.
+     * @param channel the channel, from 0 to 2.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int connectPin(Pin &pin, int channel);
+
+    /**
+     * Disconnects a channel from its pin.
+     * @param channel the channel, from 0 to 2.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int disconnectPin(int channel);
+
+    /**
+     * Defines the waveform of a channel. Takes effect at the next cycle boundary.
+     * @param channel the channel, from 0 to 2.
+     * @param shape one of the WAVEFORM_ shapes other than WAVEFORM_CUSTOM.
+     * @param amplitude the amplitude, out of WAVEFORM_GENERATOR_MAX_AMPLITUDE.
+     * @param phase the phase, in degrees.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setWaveform(int channel, int shape, int amplitude = WAVEFORM_GENERATOR_MAX_AMPLITUDE, int phase = 0);
+
+    /**
+     * Defines a channel to play one cycle given as samples, resampled to the steps of the cycle. Takes effect at the
+     * next cycle boundary. The samples are not copied, and must not change while in use.
+     * @param channel the channel, from 0 to 2.
+     * @param cycle the samples of the cycle, from -32767 to 32767.
+     * @param length the number of samples.
+     * @param amplitude the amplitude, out of WAVEFORM_GENERATOR_MAX_AMPLITUDE.
+     * @param phase the phase, in degrees.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setCustomWaveform(int channel, const int16_t *cycle, int length, int amplitude = WAVEFORM_GENERATOR_MAX_AMPLITUDE, int phase = 0);
+
+    /**
+     * Defines the frequency of every channel. Takes effect at the next cycle boundary.
+     * @param frequency the frequency in Hz. The range depends on the number of steps in a cycle: with 64, it is 7.7Hz
+     * to 15.6kHz.
+     * @return DEVICE_OK on success, or DEVICE_INVALID_PARAMETER.
+     */
+    int setFrequency(float frequency);
+
+    /**
+     * Determines the frequency actually played, after rounding the cycle to a whole number of ticks.
+     */
+    float getFrequency();
+
+    /**
+     * Starts playing.
+     */
+    void start();
+
+    /**
+     * Stops playing, at the end of the current PWM step.
+     */
+    void stop();
+
+    /**
+     * Determines if the generator is playing.
+     */
+    bool isRunning();
+
+    /**
+     * Reset the statistics gathered.
+     */
+    void resetStatistics();
+
+    /**
+     * Output the statistics gathered to the DMESG buffer.
+     */
+    void printStatistics();
+};
+
+#endif
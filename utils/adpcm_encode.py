@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+
+# The MIT License (MIT)
+
+# Copyright (c) 2023 Lancaster University.
+
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+
+"""Encodes a mono PCM clip as IMA ADPCM, and writes it out as a C array for use with AdpcmSource.
+   USAGE: adpcm_encode.py [-n name] [-b block_align] [-r rate] input.(wav|raw) [output.h]
+
+   WAV input may be 8 or 16 bit mono PCM. Any other extension is treated as raw 8 bit unsigned
+   PCM (the format of the hello[] clip in SpeakerTest.cpp), at the rate given by -r.
+   The output is a four byte little endian sample count, followed by blocks laid out as in a WAV
+   IMA ADPCM data chunk. So a clip encoded with e.g. 'sox in.wav -e ima-adpcm out.wav' can also be
+   used, by putting the sample count from its fact chunk in front of its data chunk.
+"""
+
+import optparse
+import os
+import sys
+import wave
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+def clamp(v, lo, hi):
+    return max(lo, min(hi, v))
+
+def encode_sample(sample, predictor, index):
+    step = STEP_TABLE[index]
+    diff = sample - predictor
+    nibble = 0
+
+    if diff < 0:
+        nibble = 8
+        diff = -diff
+
+    vpdiff = step >> 3
+    if diff >= step:
+        nibble |= 4
+        diff -= step
+        vpdiff += step
+    step >>= 1
+    if diff >= step:
+        nibble |= 2
+        diff -= step
+        vpdiff += step
+    step >>= 1
+    if diff >= step:
+        nibble |= 1
+        vpdiff += step
+
+    predictor = predictor - vpdiff if nibble & 8 else predictor + vpdiff
+    predictor = clamp(predictor, -32768, 32767)
+    index = clamp(index + INDEX_TABLE[nibble & 7], 0, len(STEP_TABLE) - 1)
+
+    return nibble, predictor, index
+
+def encode(samples, block_align):
+    """Encodes a list of signed 16 bit samples into a sample count and WAV style IMA ADPCM blocks."""
+    out = bytearray(len(samples).to_bytes(4, 'little'))
+    per_block = (block_align - 4) * 2 + 1
+    index = 0
+
+    for start in range(0, len(samples), per_block):
+        block = samples[start:start + per_block]
+        predictor = block[0]
+
+        # The block header carries the first sample verbatim, and the step index to resume from.
+        out += (predictor & 0xFFFF).to_bytes(2, 'little')
+        out += bytes([index, 0])
+
+        nibbles = []
+        for s in block[1:]:
+            n, predictor, index = encode_sample(s, predictor, index)
+            nibbles.append(n)
+
+        # The final block is left short, rounded up to a whole byte. The decoder stops at the sample count, so
+        # never plays the padding.
+        if len(nibbles) % 2:
+            nibbles.append(0)
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i+1] << 4))
+
+    return out
+
+def read_samples(path, rate):
+    if os.path.splitext(path)[1].lower() == '.wav':
+        w = wave.open(path, 'rb')
+        if w.getnchannels() != 1 or w.getsampwidth() not in (1, 2):
+            sys.exit("adpcm_encode: only 8 or 16 bit mono WAV files are supported")
+        raw = w.readframes(w.getnframes())
+        rate = w.getframerate()
+        if w.getsampwidth() == 1:
+            return [(b - 128) << 8 for b in raw], rate
+        return [int.from_bytes(raw[i:i+2], 'little', signed=True) for i in range(0, len(raw), 2)], rate
+
+    with open(path, 'rb') as f:
+        return [(b - 128) << 8 for b in f.read()], rate
+
+def write_array(f, name, data, samples, rate, block_align):
+    f.write("// IMA ADPCM, %d Hz, %d samples, block align %d. Generated by utils/adpcm_encode.py\n" % (rate, samples, block_align))
+    f.write("static const uint8_t %s[] = {\n" % name)
+    for i in range(0, len(data), 16):
+        f.write("    " + " ".join("0x%02X," % b for b in data[i:i+16]) + " \n")
+    f.write("};\n")
+
+parser = optparse.OptionParser(usage="usage: %prog [options] input [output]")
+parser.add_option("-n", "--name", dest="name", default="clip", help="name of the generated C array")
+parser.add_option("-b", "--block-align", dest="block_align", type="int", default=256, help="size of each ADPCM block in bytes")
+parser.add_option("-r", "--rate", dest="rate", type="int", default=16000, help="sample rate of raw input files")
+
+(options, args) = parser.parse_args()
+
+if len(args) < 1:
+    parser.print_help()
+    sys.exit(1)
+
+if options.block_align < 8 or options.block_align % 4:
+    sys.exit("adpcm_encode: block align must be a multiple of 4 bytes")
+
+samples, rate = read_samples(args[0], options.rate)
+data = encode(samples, options.block_align)
+
+out = open(args[1], 'w') if len(args) > 1 else sys.stdout
+write_array(out, options.name, data, len(samples), rate, options.block_align)
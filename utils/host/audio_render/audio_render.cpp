@@ -0,0 +1,641 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * Offline renderer for the audio graphs used in source/samples/SpeakerTest.cpp.
+ *
+ * Each scene is built from Synthesizer, SoundEmojiSynthesizer, Mixer2 and MemorySource, and pulled through to a 16 bit
+ * mono WAV file as fast as the host can go. Every component is wrapped in a TimedSource, which records the time and
+ * cycles spent in it (excluding the components it pulls from), so the report gives the cost of each component per
+ * sample. Cycles are read from the time stamp counter on x86 hosts, and are 0 elsewhere.
+ *
+ *     USAGE: audio_render [-o outdir] [-r report.csv] [-b baseline.csv] [-t tolerance] [-n repeats] [scene ...]
+ *
+ * With no scenes named, all of them are rendered. Each scene is rendered 'repeats' times (default 5). The outputs must
+ * be identical, and the fastest time for each component is reported. The report holds one line per component, with
+ * the FNV-1a hash of the scene's WAV data. Given a baseline report, the renderer exits with status 1 if any scene's
+ * output differs from the baseline, or any component is more than 'tolerance' times slower than in the baseline
+ * (default 1.25). A tolerance of 0 compares the output only, as timings from another host mean nothing.
+ *
+ * reference.csv is the report for the current components, so a change to them that alters the output fails
+ *
+ *     ./audio_render -b reference.csv -t 0
+ *
+ * The audio components are the host stand-ins in codal/, which follow codal-core's interfaces and are built with a
+ * host implementation of the few target functions they call (host_platform.cpp).
+ *
+ * BUILD: from this directory:
+ *
+ *     g++ -std=c++11 -O2 -Wall -Icodal -I. -I../../../source/samples audio_render.cpp host_platform.cpp \
+ *         codal/DataStream.cpp codal/ManagedBuffer.cpp codal/MemorySource.cpp codal/Mixer2.cpp \
+ *         codal/SoundEmojiSynthesizer.cpp codal/SoundSynthesizerEffects.cpp codal/Synthesizer.cpp -o audio_render
+ *
+ * Use -std=c++11 rather than -std=gnu++11: it turns off floating point contraction, so the output is the same on every
+ * host.
+ */
+
+#include "CodalConfig.h"
+#include "DataStream.h"
+#include "MemorySource.h"
+#include "Mixer2.h"
+#include "Synthesizer.h"
+#include "SoundEmojiSynthesizer.h"
+#include "SoundSynthesizerEffects.h"
+#include "host_platform.h"
+#include "HelloClip.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace codal;
+
+#define AUDIO_RENDER_MAX_COMPONENTS             8
+#define AUDIO_RENDER_SAMPLE_RANGE               1023
+#define AUDIO_RENDER_DEFAULT_TOLERANCE          1.25f
+#define AUDIO_RENDER_DEFAULT_REPEATS            5
+
+static uint64_t host_time_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t host_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * A pass through DataSource, that measures the time spent pulling from the component upstream of it.
+ */
+class TimedSource : public DataSource, public DataSink
+{
+    DataSource          &upstream;
+    DataSink            *downstream;
+    uint64_t            childNs;                // Time spent in TimedSources called from within the current pull
+    uint64_t            childCycles;
+
+    static TimedSource  *current;
+
+    public:
+    const char          *name;
+    uint64_t            totalNs;                // Time spent in this component alone
+    uint64_t            totalCycles;
+    uint32_t            calls;
+    uint32_t            samples;
+
+    TimedSource(const char *name, DataSource &source) : upstream(source)
+    {
+        this->name = name;
+        this->downstream = NULL;
+        this->childNs = 0;
+        this->childCycles = 0;
+        this->totalNs = 0;
+        this->totalCycles = 0;
+        this->calls = 0;
+        this->samples = 0;
+
+        upstream.connect(*this);
+    }
+
+    virtual ManagedBuffer pull()
+    {
+        TimedSource *parent = current;
+        uint64_t savedChildNs = childNs;
+        uint64_t savedChildCycles = childCycles;
+
+        current = this;
+        childNs = 0;
+        childCycles = 0;
+
+        uint64_t start = host_time_ns();
+        uint64_t startCycles = host_cycles();
+        ManagedBuffer b = upstream.pull();
+        uint64_t elapsedCycles = host_cycles() - startCycles;
+        uint64_t elapsed = host_time_ns() - start;
+
+        totalNs += elapsed - childNs;
+        totalCycles += elapsedCycles - childCycles;
+        calls++;
+        samples += b.length() / DATASTREAM_FORMAT_BYTES_PER_SAMPLE(upstream.getFormat());
+
+        childNs = savedChildNs;
+        childCycles = savedChildCycles;
+        current = parent;
+
+        if (parent)
+        {
+            parent->childNs += elapsed;
+            parent->childCycles += elapsedCycles;
+        }
+
+        return b;
+    }
+
+    virtual int pullRequest()
+    {
+        return downstream ? downstream->pullRequest() : DEVICE_OK;
+    }
+
+    virtual void connect(DataSink &sink)
+    {
+        downstream = &sink;
+    }
+
+    virtual bool isConnected()
+    {
+        return downstream != NULL;
+    }
+
+    virtual void disconnect()
+    {
+        downstream = NULL;
+    }
+
+    virtual int getFormat()
+    {
+        return upstream.getFormat();
+    }
+
+    virtual int setFormat(int format)
+    {
+        return upstream.setFormat(format);
+    }
+
+    virtual float getSampleRate()
+    {
+        return upstream.getSampleRate();
+    }
+};
+
+TimedSource *TimedSource::current = NULL;
+
+/**
+ * A scene: an audio graph from SpeakerTest.cpp, and the events played through it.
+ */
+struct Scene
+{
+    int                 sampleRate;
+    TimedSource         *output;
+    TimedSource         *components[AUDIO_RENDER_MAX_COMPONENTS];
+    DataSource          *sources[AUDIO_RENDER_MAX_COMPONENTS];
+    int                 componentCount;
+
+    Scene(int sampleRate)
+    {
+        this->sampleRate = sampleRate;
+        this->output = NULL;
+        this->componentCount = 0;
+    }
+
+    TimedSource *add(const char *name, DataSource *source)
+    {
+        TimedSource *t = new TimedSource(name, *source);
+        sources[componentCount] = source;
+        components[componentCount++] = t;
+        return t;
+    }
+
+    ~Scene()
+    {
+        // Downstream components first, as a Mixer2 disconnects its channels when it is freed.
+        for (int i = componentCount - 1; i >= 0; i--)
+        {
+            delete sources[i];
+            delete components[i];
+        }
+    }
+};
+
+/**
+ * The effect played by sound_emoji_test() and mixer_test().
+ */
+static ManagedBuffer arpeggio_effect(int duration, bool ascending)
+{
+    ManagedBuffer b(sizeof(SoundEffect));
+    SoundEffect *fx = (SoundEffect *)&b[0];
+
+    fx->duration = duration;
+    fx->tone.tonePrint = Synthesizer::SquareWaveTone;
+    fx->frequency = 130.81f;
+    fx->volume = 1.0f;
+
+    if (ascending)
+        fx->effects[0].effect = SoundSynthesizerEffects::appregrioAscending;
+    else
+        fx->effects[0].effect = SoundSynthesizerEffects::appregrioDescending;
+
+    fx->effects[0].parameter_p[0] = MusicalProgressions::pentatonic;
+    fx->effects[0].steps = 12;
+
+    return b;
+}
+
+// As synthesizer_test(): a 440Hz square wave.
+static void scene_synth(Scene &s)
+{
+    Synthesizer *synth = new Synthesizer(s.sampleRate);
+
+    synth->setTone(Synthesizer::SquareWaveTone);
+    synth->setFrequency(440);
+
+    s.output = s.add("Synthesizer", synth);
+}
+
+// As sound_emoji_test(): an ascending pentatonic arpeggio.
+static void scene_emoji(Scene &s)
+{
+    SoundEmojiSynthesizer *emoji = new SoundEmojiSynthesizer(DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_0, s.sampleRate);
+
+    emoji->setSampleRange(AUDIO_RENDER_SAMPLE_RANGE);
+    s.output = s.add("SoundEmojiSynthesizer", emoji);
+
+    emoji->play(arpeggio_effect(1000, true));
+}
+
+// As mixer_test() and mixer_test2(), with the hello clip from say_hello() mixed in at 16kHz.
+static void scene_mixer(Scene &s)
+{
+    SoundEmojiSynthesizer *emoji = new SoundEmojiSynthesizer(DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_0);
+    SoundEmojiSynthesizer *emoji2 = new SoundEmojiSynthesizer(DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_1);
+    MemorySource *clip = new MemorySource();
+    Mixer2 *mixer = new Mixer2(s.sampleRate);
+
+    emoji->setSampleRange(AUDIO_RENDER_SAMPLE_RANGE);
+    emoji2->setSampleRange(AUDIO_RENDER_SAMPLE_RANGE);
+    clip->setFormat(DATASTREAM_FORMAT_8BIT_UNSIGNED);
+    clip->setBufferSize(512);
+
+    mixer->setSampleRange(AUDIO_RENDER_SAMPLE_RANGE);
+    mixer->addChannel(*s.add("SoundEmojiSynthesizer", emoji));
+    mixer->addChannel(*s.add("SoundEmojiSynthesizer2", emoji2));
+    mixer->addChannel(*s.add("MemorySource", clip), 16000, 255);
+
+    s.output = s.add("Mixer2", mixer);
+
+    emoji->play(arpeggio_effect(1000, true));
+    emoji2->play(arpeggio_effect(1000, false));
+    clip->playAsync(hello, sizeof(hello));
+}
+
+struct SceneDefinition
+{
+    const char          *name;
+    int                 sampleRate;
+    int                 durationMs;
+    void                (*build)(Scene &s);
+};
+
+static const SceneDefinition scenes[] = {
+    {"synth", 44100, 1000, scene_synth},
+    {"emoji", 44100, 1000, scene_emoji},
+    {"mixer", 44100, 1500, scene_mixer}
+};
+
+// A result line, as held in a report.
+struct Result
+{
+    std::string         scene;
+    std::string         component;
+    uint32_t            calls;
+    uint32_t            samples;
+    double              nsPerSample;
+    double              cyclesPerSample;
+    uint32_t            hash;
+};
+
+static uint32_t fnv1a(const uint8_t *data, size_t length, uint32_t hash = 2166136261u)
+{
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+
+    return hash;
+}
+
+static void write_le(FILE *f, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+        fputc((value >> (8 * i)) & 0xFF, f);
+}
+
+/**
+ * Writes 16 bit signed mono PCM as a WAV file.
+ */
+static bool write_wav(const std::string &path, const std::vector<int16_t> &pcm, int sampleRate)
+{
+    FILE *f = fopen(path.c_str(), "wb");
+
+    if (f == NULL)
+        return false;
+
+    uint32_t dataLength = pcm.size() * 2;
+
+    fwrite("RIFF", 1, 4, f);
+    write_le(f, 36 + dataLength, 4);
+    fwrite("WAVEfmt ", 1, 8, f);
+    write_le(f, 16, 4);
+    write_le(f, 1, 2);
+    write_le(f, 1, 2);
+    write_le(f, sampleRate, 4);
+    write_le(f, sampleRate * 2, 4);
+    write_le(f, 2, 2);
+    write_le(f, 16, 2);
+    fwrite("data", 1, 4, f);
+    write_le(f, dataLength, 4);
+
+    for (size_t i = 0; i < pcm.size(); i++)
+        write_le(f, (uint16_t)pcm[i], 2);
+
+    fclose(f);
+    return true;
+}
+
+/**
+ * Renders a scene once, to signed 16 bit PCM. The scene ends early if its output does.
+ */
+static void render_once(const SceneDefinition &d, Scene &s, std::vector<int16_t> &pcm)
+{
+    uint32_t total = (uint64_t)d.sampleRate * d.durationMs / 1000;
+
+    pcm.clear();
+    pcm.reserve(total);
+
+    while (pcm.size() < total)
+    {
+        ManagedBuffer b = s.output->pull();
+        int format = s.output->getFormat();
+        int count = b.length() / DATASTREAM_FORMAT_BYTES_PER_SAMPLE(format);
+
+        if (count == 0)
+            break;
+
+        // Convert to signed 16 bit PCM, centred on the middle of the sample range. This is exact integer arithmetic, so
+        // the output only changes if the component output does.
+        for (int i = 0; i < count && pcm.size() < total; i++)
+        {
+            int v;
+
+            if (format == DATASTREAM_FORMAT_8BIT_UNSIGNED)
+                v = (b[i] - 128) * 256;
+            else if (format == DATASTREAM_FORMAT_16BIT_SIGNED)
+                v = ((int16_t *)&b[0])[i];
+            else
+                v = (((uint16_t *)&b[0])[i] & 0x7FFF) * 64 - 32768;
+
+            pcm.push_back((int16_t)(v < -32768 ? -32768 : v > 32767 ? 32767 : v));
+        }
+    }
+}
+
+/**
+ * Renders a scene 'repeats' times, writes it to a WAV file, and appends the fastest timings of each component to the
+ * results.
+ */
+static bool render(const SceneDefinition &d, const std::string &outdir, int repeats, std::vector<Result> &results)
+{
+    std::vector<int16_t> pcm;
+    std::vector<Result> best;
+    uint32_t hash = 0;
+
+    for (int run = 0; run < repeats; run++)
+    {
+        Scene s(d.sampleRate);
+
+        host_platform_reset();
+        d.build(s);
+        render_once(d, s, pcm);
+
+        uint32_t h = fnv1a((const uint8_t *)pcm.data(), pcm.size() * 2);
+
+        if (run == 0)
+        {
+            hash = h;
+            best.resize(s.componentCount);
+        }
+        else if (h != hash)
+        {
+            fprintf(stderr, "audio_render: %s: output differs between renders [%08x, was %08x]\n", d.name, h, hash);
+            return false;
+        }
+
+        for (int i = 0; i < s.componentCount; i++)
+        {
+            TimedSource *t = s.components[i];
+            Result &r = best[i];
+            double ns = t->samples ? (double)t->totalNs / t->samples : 0;
+            double cycles = t->samples ? (double)t->totalCycles / t->samples : 0;
+
+            if (run == 0 || ns < r.nsPerSample)
+                r.nsPerSample = ns;
+
+            if (run == 0 || cycles < r.cyclesPerSample)
+                r.cyclesPerSample = cycles;
+
+            r.scene = d.name;
+            r.component = t->name;
+            r.calls = t->calls;
+            r.samples = t->samples;
+            r.hash = hash;
+        }
+    }
+
+    std::string path = outdir + "/" + d.name + ".wav";
+
+    if (!write_wav(path, pcm, d.sampleRate))
+    {
+        fprintf(stderr, "audio_render: can't write %s\n", path.c_str());
+        return false;
+    }
+
+    results.insert(results.end(), best.begin(), best.end());
+    return true;
+}
+
+static bool read_report(const char *path, std::vector<Result> &results)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (f == NULL)
+        return false;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        char scene[64], component[64];
+        Result r;
+
+        if (sscanf(line, "%63[^,],%63[^,],%u,%u,%lf,%lf,%x", scene, component, &r.calls, &r.samples, &r.nsPerSample, &r.cyclesPerSample, &r.hash) == 7)
+        {
+            r.scene = scene;
+            r.component = component;
+            results.push_back(r);
+        }
+    }
+
+    fclose(f);
+    return true;
+}
+
+static void print_report(FILE *f, const std::vector<Result> &results)
+{
+    fprintf(f, "scene,component,calls,samples,ns_per_sample,cycles_per_sample,hash\n");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result &r = results[i];
+        fprintf(f, "%s,%s,%u,%u,%.2f,%.2f,%08x\n", r.scene.c_str(), r.component.c_str(), r.calls, r.samples, r.nsPerSample, r.cyclesPerSample, r.hash);
+    }
+}
+
+/**
+ * Compares results with a baseline report.
+ * @return the number of regressions found.
+ */
+static int gate(const std::vector<Result> &results, const std::vector<Result> &baseline, float tolerance)
+{
+    int failures = 0;
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result &r = results[i];
+        bool found = false;
+
+        for (size_t j = 0; j < baseline.size(); j++)
+        {
+            const Result &b = baseline[j];
+
+            if (r.scene != b.scene || r.component != b.component)
+                continue;
+
+            found = true;
+
+            if (r.hash != b.hash || r.samples != b.samples)
+            {
+                printf("FAIL: %s/%s: output differs from baseline [%08x, was %08x]\n", r.scene.c_str(), r.component.c_str(), r.hash, b.hash);
+                failures++;
+            }
+
+            if (tolerance > 0 && r.nsPerSample > b.nsPerSample * tolerance)
+            {
+                printf("FAIL: %s/%s: %.2f ns/sample, baseline %.2f\n", r.scene.c_str(), r.component.c_str(), r.nsPerSample, b.nsPerSample);
+                failures++;
+            }
+        }
+
+        if (!found)
+            printf("NOTE: %s/%s: not in baseline\n", r.scene.c_str(), r.component.c_str());
+    }
+
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    std::string outdir = ".";
+    const char *reportPath = NULL;
+    const char *baselinePath = NULL;
+    float tolerance = AUDIO_RENDER_DEFAULT_TOLERANCE;
+    int repeats = AUDIO_RENDER_DEFAULT_REPEATS;
+    std::vector<const char *> selected;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            outdir = argv[++i];
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+            reportPath = argv[++i];
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+            baselinePath = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            tolerance = atof(argv[++i]);
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+            repeats = atoi(argv[++i]);
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "USAGE: audio_render [-o outdir] [-r report.csv] [-b baseline.csv] [-t tolerance] [-n repeats] [scene ...]\n");
+            return 2;
+        }
+        else
+            selected.push_back(argv[i]);
+    }
+
+    std::vector<Result> results;
+
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++)
+    {
+        bool wanted = selected.empty();
+
+        for (size_t j = 0; j < selected.size(); j++)
+            if (strcmp(selected[j], scenes[i].name) == 0)
+                wanted = true;
+
+        if (wanted && !render(scenes[i], outdir, repeats, results))
+            return 2;
+    }
+
+    print_report(stdout, results);
+
+    if (reportPath)
+    {
+        FILE *f = fopen(reportPath, "w");
+
+        if (f == NULL)
+        {
+            fprintf(stderr, "audio_render: can't write %s\n", reportPath);
+            return 2;
+        }
+
+        print_report(f, results);
+        fclose(f);
+    }
+
+    if (baselinePath)
+    {
+        std::vector<Result> baseline;
+
+        if (!read_report(baselinePath, baseline))
+        {
+            fprintf(stderr, "audio_render: can't read %s\n", baselinePath);
+            return 2;
+        }
+
+        int failures = gate(results, baseline, tolerance);
+        printf("%s: %d regression(s) against %s\n", failures ? "FAIL" : "PASS", failures, baselinePath);
+
+        return failures ? 1 : 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * Stands in for codal-core's CodalConfig.h and ErrorNo.h when the audio components are built for the host by
+ * audio_render. Only the configuration and status codes those components use are defined here.
+ */
+
+#ifndef CODAL_CONFIG_H
+#define CODAL_CONFIG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "codal_target_hal.h"
+
+#define DEVICE_OK                               0
+#define DEVICE_INVALID_PARAMETER                -1001
+#define DEVICE_NOT_SUPPORTED                    -1002
+#define DEVICE_NO_RESOURCES                     -1005
+
+#define DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_0     3010
+#define DEVICE_ID_SOUND_EMOJI_SYNTHESIZER_1     3011
+
+#define CONFIG_MIXER_BUFFER_SIZE                512
+#define CONFIG_MIXER_INTERNAL_RANGE             1023
+#define CONFIG_MIXER_DEFAULT_SAMPLERATE         44100
+
+#endif
@@ -0,0 +1,65 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DataStream.h"
+
+using namespace codal;
+
+int DataSink::pullRequest()
+{
+    return DEVICE_NOT_SUPPORTED;
+}
+
+ManagedBuffer DataSource::pull()
+{
+    return ManagedBuffer();
+}
+
+void DataSource::connect(DataSink &)
+{
+}
+
+bool DataSource::isConnected()
+{
+    return false;
+}
+
+void DataSource::disconnect()
+{
+}
+
+int DataSource::getFormat()
+{
+    return DATASTREAM_FORMAT_UNKNOWN;
+}
+
+int DataSource::setFormat(int)
+{
+    return DEVICE_NOT_SUPPORTED;
+}
+
+float DataSource::getSampleRate()
+{
+    return DATASTREAM_SAMPLE_RATE_UNKNOWN;
+}
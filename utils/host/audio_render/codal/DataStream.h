@@ -0,0 +1,83 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef DATA_STREAM_H
+#define DATA_STREAM_H
+
+#include "CodalConfig.h"
+#include "ManagedBuffer.h"
+
+#define DATASTREAM_FORMAT_UNKNOWN               0
+#define DATASTREAM_FORMAT_8BIT_UNSIGNED         1
+#define DATASTREAM_FORMAT_8BIT_SIGNED           2
+#define DATASTREAM_FORMAT_16BIT_UNSIGNED        3
+#define DATASTREAM_FORMAT_16BIT_SIGNED          4
+#define DATASTREAM_FORMAT_24BIT_UNSIGNED        5
+#define DATASTREAM_FORMAT_24BIT_SIGNED          6
+#define DATASTREAM_FORMAT_32BIT_UNSIGNED        7
+#define DATASTREAM_FORMAT_32BIT_SIGNED          8
+
+#define DATASTREAM_FORMAT_BYTES_PER_SAMPLE(x)   ((x+1)/2)
+
+#define DATASTREAM_SAMPLE_RATE_UNKNOWN          0.0f
+
+namespace codal
+{
+    /**
+     * Interface definition for a DataSink. A sink is told by its source when data is ready to be pulled.
+     */
+    class DataSink
+    {
+        public:
+
+        virtual ~DataSink()
+        {
+        }
+
+        virtual int pullRequest();
+    };
+
+    /**
+     * Interface definition for a DataSource, as in codal-core. Data is pulled from a source by its sink, one
+     * ManagedBuffer at a time. An empty buffer means the source has nothing more to give.
+     */
+    class DataSource
+    {
+        public:
+
+        virtual ~DataSource()
+        {
+        }
+
+        virtual ManagedBuffer pull();
+        virtual void connect(DataSink &sink);
+        virtual bool isConnected();
+        virtual void disconnect();
+        virtual int getFormat();
+        virtual int setFormat(int format);
+        virtual float getSampleRate();
+    };
+}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ManagedBuffer.h"
+
+using namespace codal;
+
+/**
+ * Create an empty buffer.
+ */
+ManagedBuffer::ManagedBuffer()
+{
+    ptr = NULL;
+}
+
+/**
+ * Create a buffer of the given length, filled with zeroes.
+ */
+ManagedBuffer::ManagedBuffer(int length)
+{
+    init(NULL, length);
+}
+
+/**
+ * Create a buffer holding a copy of the given bytes.
+ */
+ManagedBuffer::ManagedBuffer(const uint8_t *data, int length)
+{
+    init(data, length);
+}
+
+ManagedBuffer::ManagedBuffer(const ManagedBuffer &buffer)
+{
+    ptr = buffer.ptr;
+
+    if (ptr)
+        ptr->references++;
+}
+
+ManagedBuffer& ManagedBuffer::operator=(const ManagedBuffer &buffer)
+{
+    if (ptr == buffer.ptr)
+        return *this;
+
+    release();
+    ptr = buffer.ptr;
+
+    if (ptr)
+        ptr->references++;
+
+    return *this;
+}
+
+ManagedBuffer::~ManagedBuffer()
+{
+    release();
+}
+
+void ManagedBuffer::init(const uint8_t *data, int length)
+{
+    if (length <= 0)
+    {
+        ptr = NULL;
+        return;
+    }
+
+    ptr = (BufferData *) malloc(sizeof(BufferData) + length);
+
+    if (ptr == NULL)
+        target_panic(DEVICE_NO_RESOURCES);
+
+    ptr->references = 1;
+    ptr->length = length;
+
+    if (data)
+        memcpy(ptr + 1, data, length);
+    else
+        memset(ptr + 1, 0, length);
+}
+
+void ManagedBuffer::release()
+{
+    if (ptr && --ptr->references == 0)
+        free(ptr);
+
+    ptr = NULL;
+}
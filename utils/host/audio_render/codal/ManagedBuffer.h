@@ -0,0 +1,101 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MANAGED_BUFFER_H
+#define MANAGED_BUFFER_H
+
+#include "CodalConfig.h"
+
+namespace codal
+{
+    /**
+     * A reference counted buffer of bytes, with the parts of codal-core's ManagedBuffer interface the audio components
+     * use. Copies share the same bytes, which are freed with the last copy.
+     */
+    class ManagedBuffer
+    {
+        // The bytes follow the header, in the same allocation.
+        struct BufferData
+        {
+            int         references;
+            int         length;
+        };
+
+        BufferData      *ptr;
+
+        void init(const uint8_t *data, int length);
+        void release();
+
+        public:
+
+        /**
+         * Create an empty buffer.
+         */
+        ManagedBuffer();
+
+        /**
+         * Create a buffer of the given length, filled with zeroes.
+         */
+        ManagedBuffer(int length);
+
+        /**
+         * Create a buffer holding a copy of the given bytes.
+         */
+        ManagedBuffer(const uint8_t *data, int length);
+
+        ManagedBuffer(const ManagedBuffer &buffer);
+
+        ManagedBuffer& operator=(const ManagedBuffer &buffer);
+
+        ~ManagedBuffer();
+
+        /**
+         * @return the number of bytes in the buffer.
+         */
+        int length() const
+        {
+            return ptr ? ptr->length : 0;
+        }
+
+        /**
+         * @return a pointer to the bytes in the buffer, or NULL if it is empty.
+         */
+        uint8_t *getBytes()
+        {
+            return ptr ? (uint8_t *)(ptr + 1) : NULL;
+        }
+
+        uint8_t& operator[](int i)
+        {
+            return ((uint8_t *)(ptr + 1))[i];
+        }
+
+        uint8_t operator[](int i) const
+        {
+            return ((uint8_t *)(ptr + 1))[i];
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MemorySource.h"
+
+using namespace codal;
+
+MemorySource::MemorySource()
+{
+    this->downstream = NULL;
+    this->format = DATASTREAM_FORMAT_16BIT_UNSIGNED;
+    this->bufferSize = MEMORY_SOURCE_DEFAULT_MAX_BUFFER;
+    this->data = NULL;
+    this->length = 0;
+    this->offset = 0;
+    this->loop = 0;
+}
+
+/**
+ * Start playing the given block of memory. There are no fibers on the host, so this returns at once, and the
+ * data is played as it is pulled.
+ * @param data the samples, in the current format.
+ * @param length the number of bytes of data.
+ * @param loop the number of times to play it.
+ */
+void MemorySource::playAsync(const void *data, int length, int loop)
+{
+    this->data = (const uint8_t *) data;
+    this->length = length;
+    this->offset = 0;
+    this->loop = loop;
+}
+
+/**
+ * Set the maximum number of bytes in each buffer pulled.
+ */
+int MemorySource::setBufferSize(int size)
+{
+    if (size <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    bufferSize = size;
+    return DEVICE_OK;
+}
+
+ManagedBuffer MemorySource::pull()
+{
+    if (offset >= length && loop > 1)
+    {
+        offset = 0;
+        loop--;
+    }
+
+    if (data == NULL || offset >= length)
+        return ManagedBuffer();
+
+    int size = length - offset < bufferSize ? length - offset : bufferSize;
+    ManagedBuffer b(data + offset, size);
+
+    offset += size;
+    return b;
+}
+
+void MemorySource::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+bool MemorySource::isConnected()
+{
+    return downstream != NULL;
+}
+
+void MemorySource::disconnect()
+{
+    downstream = NULL;
+}
+
+int MemorySource::getFormat()
+{
+    return format;
+}
+
+int MemorySource::setFormat(int format)
+{
+    this->format = format;
+    return DEVICE_OK;
+}
@@ -0,0 +1,76 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef MEMORY_SOURCE_H
+#define MEMORY_SOURCE_H
+
+#define MEMORY_SOURCE_DEFAULT_MAX_BUFFER        256
+
+namespace codal
+{
+    /**
+     * Host stand-in for codal-core's MemorySource: plays a block of memory, as buffers of up to 'bufferSize' bytes.
+     * Once it has been played the given number of times, pull() returns an empty buffer.
+     */
+    class MemorySource : public DataSource
+    {
+        DataSink            *downstream;
+        int                 format;
+        int                 bufferSize;
+        const uint8_t       *data;
+        int                 length;
+        int                 offset;
+        int                 loop;
+
+        public:
+
+        MemorySource();
+
+        /**
+         * Start playing the given block of memory. There are no fibers on the host, so this returns at once, and the
+         * data is played as it is pulled.
+         * @param data the samples, in the current format.
+         * @param length the number of bytes of data.
+         * @param loop the number of times to play it.
+         */
+        void playAsync(const void *data, int length, int loop = 1);
+
+        /**
+         * Set the maximum number of bytes in each buffer pulled.
+         */
+        int setBufferSize(int size);
+
+        virtual ManagedBuffer pull();
+        virtual void connect(DataSink &sink);
+        virtual bool isConnected();
+        virtual void disconnect();
+        virtual int getFormat();
+        virtual int setFormat(int format);
+    };
+}
+
+#endif
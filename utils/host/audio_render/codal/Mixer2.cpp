@@ -0,0 +1,330 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mixer2.h"
+
+using namespace codal;
+
+/**
+ * Set the volume of this channel, 0..1.
+ */
+int MixerChannel::setVolume(float volume)
+{
+    if (volume < 0 || volume > 1)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->volume = volume;
+    this->gain = volume / range;
+
+    return DEVICE_OK;
+}
+
+float MixerChannel::getVolume()
+{
+    return volume;
+}
+
+/**
+ * Set the sample rate of this channel's stream. The mixer works out the step through the stream when the channel
+ * is next mixed.
+ */
+int MixerChannel::setSampleRate(float sampleRate)
+{
+    if (sampleRate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->rate = sampleRate;
+    this->skip = 0;
+
+    return DEVICE_OK;
+}
+
+float MixerChannel::getSampleRate()
+{
+    return rate;
+}
+
+/**
+ * Constructor.
+ * @param sampleRate the output sample rate, in Hz.
+ * @param sampleRange the output sample range.
+ * @param format the output format.
+ */
+Mixer2::Mixer2(float sampleRate, int sampleRange, int format)
+{
+    this->channels = NULL;
+    this->downstream = NULL;
+    this->sampleRate = sampleRate;
+    this->sampleRange = sampleRange;
+    this->format = format;
+    this->volume = 1023;
+    this->orMask = 0;
+    this->bufferSize = CONFIG_MIXER_BUFFER_SIZE;
+    this->mix = new float[CONFIG_MIXER_BUFFER_SIZE];
+}
+
+Mixer2::~Mixer2()
+{
+    while (channels)
+        removeChannel(channels);
+
+    delete[] mix;
+}
+
+/**
+ * Add a stream to the mix.
+ * @param stream the stream to add.
+ * @param sampleRate the sample rate of the stream, or 0 to use the rate it reports.
+ * @param sampleRange the sample range of the stream.
+ * @return the new channel, or NULL on error.
+ */
+MixerChannel *Mixer2::addChannel(DataSource &stream, float sampleRate, int sampleRange)
+{
+    if (sampleRange <= 0)
+        return NULL;
+
+    MixerChannel *c = new MixerChannel();
+
+    c->stream = &stream;
+    c->position = 0;
+    c->skip = 0;
+    c->range = sampleRange;
+    c->rate = sampleRate > 0 ? sampleRate : stream.getSampleRate();
+
+    if (c->rate <= 0)
+        c->rate = this->sampleRate;
+
+    c->setVolume(1.0f);
+
+    // Channels are mixed in the order they were added.
+    c->next = NULL;
+    MixerChannel **p = &channels;
+    while (*p)
+        p = &(*p)->next;
+    *p = c;
+
+    stream.connect(*this);
+    return c;
+}
+
+/**
+ * Remove a channel from the mix, and free it.
+ */
+int Mixer2::removeChannel(MixerChannel *channel)
+{
+    for (MixerChannel **p = &channels; *p; p = &(*p)->next)
+    {
+        if (*p == channel)
+        {
+            *p = channel->next;
+            channel->stream->disconnect();
+            delete channel;
+
+            return DEVICE_OK;
+        }
+    }
+
+    return DEVICE_INVALID_PARAMETER;
+}
+
+int Mixer2::getChannels()
+{
+    int count = 0;
+
+    for (MixerChannel *c = channels; c; c = c->next)
+        count++;
+
+    return count;
+}
+
+int Mixer2::setSampleRange(uint16_t sampleRange)
+{
+    if (sampleRange == 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRange = sampleRange;
+    return DEVICE_OK;
+}
+
+int Mixer2::setOrMask(uint32_t mask)
+{
+    orMask = mask;
+    return DEVICE_OK;
+}
+
+/**
+ * Set the output volume, 0..1023.
+ */
+int Mixer2::setVolume(int volume)
+{
+    if (volume < 0 || volume > 1023)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->volume = volume;
+    return DEVICE_OK;
+}
+
+int Mixer2::getVolume()
+{
+    return volume;
+}
+
+int Mixer2::setSampleRate(float sampleRate)
+{
+    if (sampleRate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRate = sampleRate;
+
+    for (MixerChannel *c = channels; c; c = c->next)
+        c->skip = 0;
+
+    return DEVICE_OK;
+}
+
+/**
+ * Reads a sample from a channel's input buffer, centred on zero.
+ */
+static int read_sample(const uint8_t *in, int format, int range)
+{
+    switch (format)
+    {
+        case DATASTREAM_FORMAT_8BIT_UNSIGNED:
+            return *in - range / 2;
+
+        case DATASTREAM_FORMAT_8BIT_SIGNED:
+            return (int8_t) *in;
+
+        case DATASTREAM_FORMAT_16BIT_SIGNED:
+            return *(const int16_t *) in;
+
+        default:
+            // Unsigned 16 bit, as from the synthesizers, with any OR mask left on by the source removed.
+            return (*(const uint16_t *) in & 0x7FFF) - range / 2;
+    }
+}
+
+ManagedBuffer Mixer2::pull()
+{
+    int bytesPerSample = DATASTREAM_FORMAT_BYTES_PER_SAMPLE(format);
+    int count = bufferSize / bytesPerSample;
+
+    for (int i = 0; i < count; i++)
+        mix[i] = 0;
+
+    for (MixerChannel *c = channels; c; c = c->next)
+    {
+        if (c->skip == 0)
+            c->skip = (uint32_t) ((double) c->rate * (1 << MIXER_POSITION_SHIFT) / sampleRate);
+
+        int inFormat = c->stream->getFormat();
+        int inBytes = DATASTREAM_FORMAT_BYTES_PER_SAMPLE(inFormat);
+
+        for (int i = 0; i < count; i++)
+        {
+            int index = c->position >> MIXER_POSITION_SHIFT;
+
+            while (index * inBytes >= c->in.length())
+            {
+                c->position -= (uint32_t) (c->in.length() / inBytes) << MIXER_POSITION_SHIFT;
+                c->in = c->stream->pull();
+
+                // Nothing more from this stream for now: it is silent for the rest of this buffer.
+                if (c->in.length() == 0)
+                {
+                    c->position = 0;
+                    break;
+                }
+
+                index = c->position >> MIXER_POSITION_SHIFT;
+            }
+
+            if (c->in.length() == 0)
+                break;
+
+            mix[i] += read_sample(&c->in[index * inBytes], inFormat, c->range) * c->gain;
+            c->position += c->skip;
+        }
+    }
+
+    ManagedBuffer b(count * bytesPerSample);
+    bool isSigned = format == DATASTREAM_FORMAT_8BIT_SIGNED || format == DATASTREAM_FORMAT_16BIT_SIGNED;
+    float scale = (float) volume * sampleRange / 1023;
+    int offset = isSigned ? 0 : sampleRange / 2;
+    int low = isSigned ? -sampleRange / 2 : 0;
+    int high = isSigned ? sampleRange / 2 : sampleRange;
+
+    for (int i = 0; i < count; i++)
+    {
+        int v = (int) (mix[i] * scale) + offset;
+
+        v = v < low ? low : v > high ? high : v;
+
+        if (bytesPerSample == 1)
+            b[i] = (uint8_t) v | orMask;
+        else
+            ((uint16_t *) b.getBytes())[i] = (uint16_t) v | orMask;
+    }
+
+    return b;
+}
+
+int Mixer2::pullRequest()
+{
+    return downstream ? downstream->pullRequest() : DEVICE_OK;
+}
+
+void Mixer2::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+bool Mixer2::isConnected()
+{
+    return downstream != NULL;
+}
+
+void Mixer2::disconnect()
+{
+    downstream = NULL;
+}
+
+int Mixer2::getFormat()
+{
+    return format;
+}
+
+int Mixer2::setFormat(int format)
+{
+    if (DATASTREAM_FORMAT_BYTES_PER_SAMPLE(format) > 2)
+        return DEVICE_NOT_SUPPORTED;
+
+    this->format = format;
+    return DEVICE_OK;
+}
+
+float Mixer2::getSampleRate()
+{
+    return sampleRate;
+}
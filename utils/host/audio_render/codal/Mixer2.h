@@ -0,0 +1,142 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef MIXER2_H
+#define MIXER2_H
+
+// Position in a channel's input buffer, in 16.16 fixed point samples.
+#define MIXER_POSITION_SHIFT                    16
+
+namespace codal
+{
+    class Mixer2;
+
+    /**
+     * A stream being mixed, at its own sample rate, sample range and volume.
+     */
+    class MixerChannel
+    {
+        friend class Mixer2;
+
+        MixerChannel        *next;
+        DataSource          *stream;
+        ManagedBuffer       in;
+        uint32_t            position;               // The next input sample to read
+        uint32_t            skip;                   // Input samples per output sample
+        float               gain;                   // Scales an input sample to -0.5..0.5 of full scale
+        float               volume;
+        float               rate;
+        int                 range;
+
+        public:
+
+        /**
+         * Set the volume of this channel, 0..1.
+         */
+        int setVolume(float volume);
+        float getVolume();
+
+        /**
+         * Set the sample rate of this channel's stream.
+         */
+        int setSampleRate(float sampleRate);
+        float getSampleRate();
+    };
+
+    /**
+     * Host stand-in for codal-core's Mixer2. Each channel is resampled to the output rate (nearest sample below),
+     * scaled by its volume and range, and summed in floating point. The sum is scaled to the output sample range, clamped,
+     * and combined with the OR mask.
+     *
+     * A channel whose stream has nothing to give is silent, until its stream has data again.
+     */
+    class Mixer2 : public DataSource, public DataSink
+    {
+        MixerChannel        *channels;
+        DataSink            *downstream;
+        float               sampleRate;
+        int                 sampleRange;
+        int                 format;
+        int                 volume;
+        uint32_t            orMask;
+        int                 bufferSize;             // In bytes
+        float               *mix;
+
+        void configure(MixerChannel *c);
+
+        public:
+
+        /**
+         * Constructor.
+         * @param sampleRate the output sample rate, in Hz.
+         * @param sampleRange the output sample range.
+         * @param format the output format.
+         */
+        Mixer2(float sampleRate = CONFIG_MIXER_DEFAULT_SAMPLERATE, int sampleRange = CONFIG_MIXER_INTERNAL_RANGE,
+               int format = DATASTREAM_FORMAT_16BIT_UNSIGNED);
+
+        ~Mixer2();
+
+        /**
+         * Add a stream to the mix.
+         * @param stream the stream to add.
+         * @param sampleRate the sample rate of the stream, or 0 to use the rate it reports.
+         * @param sampleRange the sample range of the stream.
+         * @return the new channel, or NULL on error.
+         */
+        MixerChannel *addChannel(DataSource &stream, float sampleRate = 0,
+                                 int sampleRange = CONFIG_MIXER_INTERNAL_RANGE);
+
+        /**
+         * Remove a channel from the mix, and free it.
+         */
+        int removeChannel(MixerChannel *channel);
+
+        int getChannels();
+        int setSampleRange(uint16_t sampleRange);
+        int setOrMask(uint32_t mask);
+
+        /**
+         * Set the output volume, 0..1023.
+         */
+        int setVolume(int volume);
+        int getVolume();
+
+        int setSampleRate(float sampleRate);
+
+        virtual ManagedBuffer pull();
+        virtual int pullRequest();
+        virtual void connect(DataSink &sink);
+        virtual bool isConnected();
+        virtual void disconnect();
+        virtual int getFormat();
+        virtual int setFormat(int format);
+        virtual float getSampleRate();
+    };
+}
+
+#endif
@@ -0,0 +1,225 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SoundEmojiSynthesizer.h"
+
+using namespace codal;
+
+/**
+ * Constructor.
+ * @param id the ID of this component.
+ * @param sampleRate the output sample rate, in Hz.
+ */
+SoundEmojiSynthesizer::SoundEmojiSynthesizer(uint16_t id, int sampleRate)
+{
+    this->downstream = NULL;
+    this->id = id;
+    this->sampleRate = sampleRate;
+    this->bufferSize = EMOJI_SYNTHESIZER_BUFFER_SIZE;
+    this->sampleRange = SYNTHESIZER_TONE_RANGE;
+    this->orMask = 0;
+    this->next = 0;
+    this->active = false;
+    this->sample = 0;
+    this->samples = 0;
+    this->amplitude = 0;
+    this->position = 0;
+    this->skip = 0;
+}
+
+/**
+ * Start playing a sequence of SoundEffects, replacing any sequence playing. Returns at once.
+ * @param sequence one or more SoundEffects.
+ */
+int SoundEmojiSynthesizer::play(ManagedBuffer sequence)
+{
+    if (sequence.length() < (int) sizeof(SoundEffect))
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sequence = sequence;
+    this->next = 0;
+    this->active = nextSoundEffect();
+
+    return DEVICE_OK;
+}
+
+/**
+ * Moves on to the next SoundEffect in the sequence.
+ * @return false if there are none left.
+ */
+bool SoundEmojiSynthesizer::nextSoundEffect()
+{
+    int count = sequence.length() / sizeof(SoundEffect);
+
+    while (next < count)
+    {
+        memcpy(&effect, &sequence[next * sizeof(SoundEffect)], sizeof(SoundEffect));
+        next++;
+
+        samples = (int) (effect.duration * sampleRate / 1000);
+
+        if (samples <= 0 || effect.tone.tonePrint == NULL)
+            continue;
+
+        for (int i = 0; i < EMOJI_SYNTHESIZER_TONE_EFFECTS; i++)
+        {
+            effect.effects[i].step = 0;
+
+            if (effect.effects[i].steps <= 0)
+                effect.effects[i].steps = 1;
+        }
+
+        sample = 0;
+        position = 0;
+        applyEffects();
+
+        return true;
+    }
+
+    sequence = ManagedBuffer();
+    return false;
+}
+
+/**
+ * Applies any effect steps due at the current sample.
+ */
+void SoundEmojiSynthesizer::applyEffects()
+{
+    bool changed = sample == 0;
+
+    for (int i = 0; i < EMOJI_SYNTHESIZER_TONE_EFFECTS; i++)
+    {
+        ToneEffect *e = &effect.effects[i];
+
+        while (e->effect && e->step < e->steps && sample >= (int64_t) e->step * samples / e->steps)
+        {
+            e->effect(&effect, e);
+            e->step++;
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        float volume = effect.volume < 0 ? 0 : effect.volume > 1 ? 1 : effect.volume;
+
+        amplitude = (int) (volume * sampleRange);
+        skip = (uint32_t) ((double) effect.frequency * (SYNTHESIZER_TONE_WIDTH << SYNTHESIZER_POSITION_SHIFT)
+                           / sampleRate);
+    }
+}
+
+int SoundEmojiSynthesizer::setSampleRate(int sampleRate)
+{
+    if (sampleRate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRate = sampleRate;
+    return DEVICE_OK;
+}
+
+int SoundEmojiSynthesizer::setSampleRange(int sampleRange)
+{
+    if (sampleRange <= 0 || sampleRange > 0x7FFF)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRange = sampleRange;
+    return DEVICE_OK;
+}
+
+int SoundEmojiSynthesizer::setOrMask(uint32_t mask)
+{
+    orMask = mask;
+    return DEVICE_OK;
+}
+
+int SoundEmojiSynthesizer::setBufferSize(int size)
+{
+    if (size <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    bufferSize = size;
+    return DEVICE_OK;
+}
+
+ManagedBuffer SoundEmojiSynthesizer::pull()
+{
+    if (!active)
+        return ManagedBuffer();
+
+    ManagedBuffer b(bufferSize * 2);
+    uint16_t *out = (uint16_t *) b.getBytes();
+
+    // The end of the sequence is padded with silence, to the end of the buffer.
+    for (int i = 0; i < bufferSize; i++)
+    {
+        int level = 0;
+
+        if (active)
+        {
+            level = effect.tone.tonePrint(effect.tone.parameter, position >> SYNTHESIZER_POSITION_SHIFT);
+            level = level * amplitude / SYNTHESIZER_TONE_RANGE;
+            position = (position + skip) & SYNTHESIZER_POSITION_MASK;
+
+            if (++sample >= samples)
+                active = nextSoundEffect();
+            else
+                applyEffects();
+        }
+
+        out[i] = (uint16_t) level | orMask;
+    }
+
+    return b;
+}
+
+void SoundEmojiSynthesizer::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+bool SoundEmojiSynthesizer::isConnected()
+{
+    return downstream != NULL;
+}
+
+void SoundEmojiSynthesizer::disconnect()
+{
+    downstream = NULL;
+}
+
+int SoundEmojiSynthesizer::getFormat()
+{
+    return DATASTREAM_FORMAT_16BIT_UNSIGNED;
+}
+
+int SoundEmojiSynthesizer::setFormat(int format)
+{
+    return format == DATASTREAM_FORMAT_16BIT_UNSIGNED ? DEVICE_OK : DEVICE_NOT_SUPPORTED;
+}
+
+float SoundEmojiSynthesizer::getSampleRate()
+{
+    return sampleRate;
+}
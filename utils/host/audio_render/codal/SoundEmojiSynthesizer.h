@@ -0,0 +1,141 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CodalConfig.h"
+#include "DataStream.h"
+#include "Synthesizer.h"
+
+#ifndef SOUND_EMOJI_SYNTHESIZER_H
+#define SOUND_EMOJI_SYNTHESIZER_H
+
+#define EMOJI_SYNTHESIZER_SAMPLE_RATE           44100
+#define EMOJI_SYNTHESIZER_BUFFER_SIZE           512
+#define EMOJI_SYNTHESIZER_TONE_EFFECTS          3
+#define EMOJI_SYNTHESIZER_TONE_EFFECT_PARAMETERS 2
+
+namespace codal
+{
+    typedef SynthesizerGetSample TonePrintFunction;
+
+    struct SoundEffect;
+    struct ToneEffect;
+
+    /**
+     * An effect is called at each of its steps, and may change the frequency and volume of the SoundEffect playing.
+     */
+    typedef void (*SoundEffectCallback)(SoundEffect *synth, ToneEffect *context);
+
+    struct ToneBlob
+    {
+        TonePrintFunction   tonePrint;
+        void                *parameter[EMOJI_SYNTHESIZER_TONE_EFFECT_PARAMETERS];
+    };
+
+    struct ToneEffect
+    {
+        SoundEffectCallback effect;                 // NULL for no effect
+        int                 step;                   // The step about to be applied
+        int                 steps;                  // The number of steps spread evenly over the SoundEffect
+        float               parameter[EMOJI_SYNTHESIZER_TONE_EFFECT_PARAMETERS];
+        const int           *parameter_p[EMOJI_SYNTHESIZER_TONE_EFFECT_PARAMETERS];
+    };
+
+    struct SoundEffect
+    {
+        float               frequency;              // In Hz
+        float               volume;                 // 0..1
+        float               duration;               // In ms
+        ToneBlob            tone;
+        ToneEffect          effects[EMOJI_SYNTHESIZER_TONE_EFFECTS];
+    };
+
+    /**
+     * Host stand-in for codal-core's SoundEmojiSynthesizer. It plays a sequence of SoundEffects, held one after
+     * another in a ManagedBuffer, as 16 bit unsigned samples.
+     *
+     * Each effect's steps are spread evenly over its SoundEffect, and step n is applied at the first sample at or past
+     * n/steps of the way through. A SoundEffect with no duration is skipped. Once the sequence is over, pull() returns
+     * an empty buffer.
+     */
+    class SoundEmojiSynthesizer : public DataSource
+    {
+        DataSink            *downstream;
+        uint16_t            id;
+        int                 sampleRate;
+        int                 bufferSize;             // In samples
+        int                 sampleRange;
+        uint32_t            orMask;
+
+        ManagedBuffer       sequence;
+        int                 next;                   // The index in the sequence of the next SoundEffect to play
+        bool                active;
+        SoundEffect         effect;                 // The SoundEffect playing, updated by its effects
+        int                 sample;                 // Samples played of the current SoundEffect
+        int                 samples;                // Samples in the current SoundEffect
+        int                 amplitude;
+        uint32_t            position;
+        uint32_t            skip;
+
+        /**
+         * Moves on to the next SoundEffect in the sequence.
+         * @return false if there are none left.
+         */
+        bool nextSoundEffect();
+
+        /**
+         * Applies any effect steps due at the current sample.
+         */
+        void applyEffects();
+
+        public:
+
+        /**
+         * Constructor.
+         * @param id the ID of this component.
+         * @param sampleRate the output sample rate, in Hz.
+         */
+        SoundEmojiSynthesizer(uint16_t id, int sampleRate = EMOJI_SYNTHESIZER_SAMPLE_RATE);
+
+        /**
+         * Start playing a sequence of SoundEffects, replacing any sequence playing. Returns at once.
+         * @param sequence one or more SoundEffects.
+         */
+        int play(ManagedBuffer sequence);
+
+        int setSampleRate(int sampleRate);
+        int setSampleRange(int sampleRange);
+        int setOrMask(uint32_t mask);
+        int setBufferSize(int size);
+
+        virtual ManagedBuffer pull();
+        virtual void connect(DataSink &sink);
+        virtual bool isConnected();
+        virtual void disconnect();
+        virtual int getFormat();
+        virtual int setFormat(int format);
+        virtual float getSampleRate();
+    };
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SoundSynthesizerEffects.h"
+
+using namespace codal;
+
+const int MusicalProgressions::chromatic[] = {12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+const int MusicalProgressions::majorScale[] = {7, 0, 2, 4, 5, 7, 9, 11};
+const int MusicalProgressions::minorScale[] = {7, 0, 2, 3, 5, 7, 8, 10};
+const int MusicalProgressions::majorTriad[] = {3, 0, 4, 7};
+const int MusicalProgressions::minorTriad[] = {3, 0, 3, 7};
+const int MusicalProgressions::pentatonic[] = {5, 0, 2, 4, 7, 9};
+const int MusicalProgressions::wholeTone[] = {6, 0, 2, 4, 6, 8, 10};
+
+// 2^(n/12) for each semitone in an octave. A table rather than powf(), which may round differently between hosts.
+static const float semitones[] = {
+    1.0f, 1.0594630944f, 1.1224620483f, 1.1892071150f, 1.2599210499f, 1.3348398542f,
+    1.4142135624f, 1.4983070769f, 1.5874010520f, 1.6817928305f, 1.7817974363f, 1.8877486254f
+};
+
+/**
+ * @return the frequency of the given step through a progression, rising an octave each time it wraps.
+ */
+float MusicalProgressions::calculateFrequencyFromProgression(float root, const int *progression, int offset)
+{
+    int length = progression[0];
+    int octave = offset / length;
+    int interval = progression[1 + offset % length];
+
+    octave += interval / 12;
+
+    return root * (float) (1 << octave) * semitones[interval % 12];
+}
+
+/**
+ * Step up through the progression in parameter_p[0], from the frequency of the SoundEffect.
+ */
+void SoundSynthesizerEffects::appregrioAscending(SoundEffect *synth, ToneEffect *context)
+{
+    if (context->step == 0)
+        context->parameter[0] = synth->frequency;
+
+    synth->frequency = MusicalProgressions::calculateFrequencyFromProgression(context->parameter[0],
+                                                                              context->parameter_p[0], context->step);
+}
+
+/**
+ * Step down through the progression in parameter_p[0], finishing on the frequency of the SoundEffect.
+ */
+void SoundSynthesizerEffects::appregrioDescending(SoundEffect *synth, ToneEffect *context)
+{
+    if (context->step == 0)
+        context->parameter[0] = synth->frequency;
+
+    int offset = context->steps - context->step - 1;
+
+    synth->frequency = MusicalProgressions::calculateFrequencyFromProgression(context->parameter[0],
+                                                                              context->parameter_p[0], offset);
+}
@@ -0,0 +1,74 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CodalConfig.h"
+#include "SoundEmojiSynthesizer.h"
+
+#ifndef SOUND_SYNTHESIZER_EFFECTS_H
+#define SOUND_SYNTHESIZER_EFFECTS_H
+
+namespace codal
+{
+    /**
+     * Musical progressions, for arpeggios. Each starts with the number of intervals in it, followed by the intervals
+     * in semitones above the root.
+     */
+    class MusicalProgressions
+    {
+        public:
+
+        static const int chromatic[];
+        static const int majorScale[];
+        static const int minorScale[];
+        static const int majorTriad[];
+        static const int minorTriad[];
+        static const int pentatonic[];
+        static const int wholeTone[];
+
+        /**
+         * @return the frequency of the given step through a progression, rising an octave each time it wraps.
+         */
+        static float calculateFrequencyFromProgression(float root, const int *progression, int offset);
+    };
+
+    /**
+     * Host stand-ins for the codal-core effects SpeakerTest.cpp uses.
+     */
+    class SoundSynthesizerEffects
+    {
+        public:
+
+        /**
+         * Step up through the progression in parameter_p[0], from the frequency of the SoundEffect.
+         */
+        static void appregrioAscending(SoundEffect *synth, ToneEffect *context);
+
+        /**
+         * Step down through the progression in parameter_p[0], finishing on the frequency of the SoundEffect.
+         */
+        static void appregrioDescending(SoundEffect *synth, ToneEffect *context);
+    };
+}
+
+#endif
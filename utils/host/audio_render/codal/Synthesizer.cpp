@@ -0,0 +1,235 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Synthesizer.h"
+
+using namespace codal;
+
+/**
+ * Constructor.
+ * @param sampleRate the output sample rate, in Hz.
+ * @param isSigned output 16 bit signed samples centred on zero, rather than 16 bit unsigned.
+ */
+Synthesizer::Synthesizer(int sampleRate, bool isSigned)
+{
+    this->downstream = NULL;
+    this->tonePrint = Synthesizer::SineTone;
+    this->tonePrintArg = NULL;
+    this->sampleRate = sampleRate;
+    this->bufferSize = SYNTHESIZER_BUFFER_SIZE;
+    this->sampleRange = SYNTHESIZER_TONE_RANGE;
+    this->orMask = 0;
+    this->isSigned = isSigned;
+    this->volume = SYNTHESIZER_MAX_VOLUME;
+    this->frequency = 0;
+    this->position = 0;
+    this->remaining = -1;
+
+    recalculate();
+}
+
+void Synthesizer::recalculate()
+{
+    amplitude = volume * sampleRange / SYNTHESIZER_MAX_VOLUME;
+    skip = (uint32_t) ((double) frequency * (SYNTHESIZER_TONE_WIDTH << SYNTHESIZER_POSITION_SHIFT) / sampleRate);
+}
+
+/**
+ * Play a tone at the given frequency.
+ * @param frequency the frequency in Hz, or 0 for silence.
+ * @param period the length of the note in ms, after which the output is silent, or 0 to hold it. On a device
+ * this blocks the calling fiber. There are no fibers on the host, so it returns at once and the note is timed
+ * by the samples pulled.
+ */
+int Synthesizer::setFrequency(float frequency, int period)
+{
+    if (frequency < 0 || period < 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->frequency = frequency;
+    this->remaining = period ? (int) ((int64_t) period * sampleRate / 1000) : -1;
+
+    recalculate();
+    return DEVICE_OK;
+}
+
+/**
+ * Set the volume, 0..SYNTHESIZER_MAX_VOLUME.
+ */
+int Synthesizer::setVolume(int volume)
+{
+    if (volume < 0 || volume > SYNTHESIZER_MAX_VOLUME)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->volume = volume;
+
+    recalculate();
+    return DEVICE_OK;
+}
+
+/**
+ * Set the waveform played.
+ */
+int Synthesizer::setTone(SynthesizerGetSample tonePrint, void *arg)
+{
+    if (tonePrint == NULL)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->tonePrint = tonePrint;
+    this->tonePrintArg = arg;
+
+    return DEVICE_OK;
+}
+
+int Synthesizer::setSampleRate(int sampleRate)
+{
+    if (sampleRate <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRate = sampleRate;
+
+    recalculate();
+    return DEVICE_OK;
+}
+
+int Synthesizer::setSampleRange(int sampleRange)
+{
+    if (sampleRange <= 0 || sampleRange > 0x7FFF)
+        return DEVICE_INVALID_PARAMETER;
+
+    this->sampleRange = sampleRange;
+
+    recalculate();
+    return DEVICE_OK;
+}
+
+int Synthesizer::setOrMask(uint32_t mask)
+{
+    orMask = mask;
+    return DEVICE_OK;
+}
+
+/**
+ * Set the number of samples in each buffer pulled.
+ */
+int Synthesizer::setBufferSize(int size)
+{
+    if (size <= 0)
+        return DEVICE_INVALID_PARAMETER;
+
+    bufferSize = size;
+    return DEVICE_OK;
+}
+
+ManagedBuffer Synthesizer::pull()
+{
+    ManagedBuffer b(bufferSize * 2);
+    uint16_t *out = (uint16_t *) b.getBytes();
+    int offset = isSigned ? amplitude / 2 : 0;
+
+    for (int i = 0; i < bufferSize; i++)
+    {
+        int level = 0;
+
+        if (remaining != 0 && skip)
+        {
+            level = tonePrint(tonePrintArg, position >> SYNTHESIZER_POSITION_SHIFT);
+            level = level * amplitude / SYNTHESIZER_TONE_RANGE;
+            position = (position + skip) & SYNTHESIZER_POSITION_MASK;
+
+            if (remaining > 0)
+                remaining--;
+        }
+
+        out[i] = (uint16_t) (level - offset) | orMask;
+    }
+
+    return b;
+}
+
+void Synthesizer::connect(DataSink &sink)
+{
+    downstream = &sink;
+}
+
+bool Synthesizer::isConnected()
+{
+    return downstream != NULL;
+}
+
+void Synthesizer::disconnect()
+{
+    downstream = NULL;
+}
+
+int Synthesizer::getFormat()
+{
+    return isSigned ? DATASTREAM_FORMAT_16BIT_SIGNED : DATASTREAM_FORMAT_16BIT_UNSIGNED;
+}
+
+int Synthesizer::setFormat(int format)
+{
+    return format == getFormat() ? DEVICE_OK : DEVICE_NOT_SUPPORTED;
+}
+
+float Synthesizer::getSampleRate()
+{
+    return sampleRate;
+}
+
+/**
+ * A sine wave. Bhaskara I's approximation is used for each half cycle, in integer arithmetic, so that the table is the
+ * same on every host. It is within about 0.2% of full scale of a true sine.
+ */
+uint16_t Synthesizer::SineTone(void *, int position)
+{
+    int half = SYNTHESIZER_TONE_WIDTH / 2;
+    int x = position % half;
+    int64_t p = (int64_t) x * (half - x);
+    int level = (int) (4 * p * (SYNTHESIZER_TONE_RANGE / 2) / ((int64_t) 5 * half * half / 4 - p));
+
+    return SYNTHESIZER_TONE_RANGE / 2 + (position < half ? level : -level);
+}
+
+uint16_t Synthesizer::SawtoothTone(void *, int position)
+{
+    return position * SYNTHESIZER_TONE_RANGE / (SYNTHESIZER_TONE_WIDTH - 1);
+}
+
+uint16_t Synthesizer::TriangleTone(void *, int position)
+{
+    int half = SYNTHESIZER_TONE_WIDTH / 2;
+
+    return (position < half ? position : SYNTHESIZER_TONE_WIDTH - 1 - position) * SYNTHESIZER_TONE_RANGE / (half - 1);
+}
+
+uint16_t Synthesizer::SquareWaveTone(void *, int position)
+{
+    return position < SYNTHESIZER_TONE_WIDTH / 2 ? SYNTHESIZER_TONE_RANGE : 0;
+}
+
+uint16_t Synthesizer::NoiseTone(void *, int)
+{
+    return target_random(SYNTHESIZER_TONE_RANGE + 1);
+}
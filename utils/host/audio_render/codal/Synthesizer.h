@@ -0,0 +1,129 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CodalConfig.h"
+#include "DataStream.h"
+
+#ifndef SYNTHESIZER_H
+#define SYNTHESIZER_H
+
+#define SYNTHESIZER_SAMPLE_RATE                 44100
+#define SYNTHESIZER_BUFFER_SIZE                 512
+#define SYNTHESIZER_TONE_WIDTH                  1024
+#define SYNTHESIZER_TONE_RANGE                  1023
+#define SYNTHESIZER_MAX_VOLUME                  1023
+
+// Position in the tone print, in 16.16 fixed point.
+#define SYNTHESIZER_POSITION_SHIFT              16
+#define SYNTHESIZER_POSITION_MASK               ((SYNTHESIZER_TONE_WIDTH << SYNTHESIZER_POSITION_SHIFT) - 1)
+
+namespace codal
+{
+    /**
+     * A tone print: one cycle of a waveform, as a function from a position (0..SYNTHESIZER_TONE_WIDTH-1) to a level
+     * (0..SYNTHESIZER_TONE_RANGE).
+     */
+    typedef uint16_t (*SynthesizerGetSample)(void *arg, int position);
+
+    /**
+     * Host stand-in for codal-core's Synthesizer: a single oscillator that plays a tone print at a given frequency
+     * and volume, as 16 bit samples.
+     *
+     * Everything is fixed point apart from the conversion of a frequency to a step through the tone print, so the
+     * output is the same on every host.
+     */
+    class Synthesizer : public DataSource
+    {
+        DataSink                *downstream;
+        SynthesizerGetSample    tonePrint;
+        void                    *tonePrintArg;
+        int                     sampleRate;
+        int                     bufferSize;             // In samples
+        int                     sampleRange;
+        uint32_t                orMask;
+        bool                    isSigned;
+        int                     volume;
+        int                     amplitude;              // The peak output level, from the volume and sample range
+        float                   frequency;
+        uint32_t                position;
+        uint32_t                skip;                   // Step through the tone print per sample
+        int                     remaining;              // Samples left of a timed note, or -1 if the note holds
+
+        void recalculate();
+
+        public:
+
+        /**
+         * Constructor.
+         * @param sampleRate the output sample rate, in Hz.
+         * @param isSigned output 16 bit signed samples centred on zero, rather than 16 bit unsigned.
+         */
+        Synthesizer(int sampleRate = SYNTHESIZER_SAMPLE_RATE, bool isSigned = false);
+
+        /**
+         * Play a tone at the given frequency.
+         * @param frequency the frequency in Hz, or 0 for silence.
+         * @param period the length of the note in ms, after which the output is silent, or 0 to hold it. On a device
+         * this blocks the calling fiber. There are no fibers on the host, so it returns at once and the note is timed
+         * by the samples pulled.
+         */
+        int setFrequency(float frequency, int period = 0);
+
+        /**
+         * Set the volume, 0..SYNTHESIZER_MAX_VOLUME.
+         */
+        int setVolume(int volume);
+
+        /**
+         * Set the waveform played.
+         */
+        int setTone(SynthesizerGetSample tonePrint, void *arg = NULL);
+
+        int setSampleRate(int sampleRate);
+        int setSampleRange(int sampleRange);
+        int setOrMask(uint32_t mask);
+
+        /**
+         * Set the number of samples in each buffer pulled.
+         */
+        int setBufferSize(int size);
+
+        virtual ManagedBuffer pull();
+        virtual void connect(DataSink &sink);
+        virtual bool isConnected();
+        virtual void disconnect();
+        virtual int getFormat();
+        virtual int setFormat(int format);
+        virtual float getSampleRate();
+
+        // Tone prints.
+        static uint16_t SineTone(void *arg, int position);
+        static uint16_t SawtoothTone(void *arg, int position);
+        static uint16_t TriangleTone(void *arg, int position);
+        static uint16_t SquareWaveTone(void *arg, int position);
+        static uint16_t NoiseTone(void *arg, int position);
+    };
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * The target functions the host audio components in codal/ call (see codal/codal_target_hal.h).
+ *
+ * Random numbers come from a fixed xorshift generator rather than the C library, so noise renders bit exactly on
+ * every host.
+ */
+
+#include "CodalConfig.h"
+#include "host_platform.h"
+#include <stdio.h>
+
+#define HOST_RANDOM_SEED                        0x2545F491
+
+static uint32_t host_random_state = HOST_RANDOM_SEED;
+
+/**
+ * Reset the random number generator, so that every scene starts from the same state.
+ */
+void host_platform_reset()
+{
+    host_random_state = HOST_RANDOM_SEED;
+}
+
+int target_seed_random(uint32_t rand)
+{
+    host_random_state = rand ? rand : HOST_RANDOM_SEED;
+    return DEVICE_OK;
+}
+
+int target_random(int max)
+{
+    host_random_state ^= host_random_state << 13;
+    host_random_state ^= host_random_state >> 17;
+    host_random_state ^= host_random_state << 5;
+
+    return max > 0 ? (int) (host_random_state % (uint32_t) max) : 0;
+}
+
+void target_panic(int statusCode)
+{
+    fprintf(stderr, "audio_render: panic %d\n", statusCode);
+    exit(2);
+}
@@ -0,0 +1,219 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * Converts a capture streamed by the LogicAnalyzer in source/samples to a Value Change Dump, for viewing in GTKWave or
+ * any other VCD viewer.
+ *
+ *     USAGE: logic_vcd [-o capture.vcd] capture.bin
+ *
+ * The capture is the raw serial output of logic_analyzer_test() (source/samples/GPIOTest.cpp), saved to a file with
+ * any terminal program that can log binary data, at the baud rate the test sets. Anything before the stream header
+ * (such as output from an earlier program) is skipped. Each pin becomes a one bit wire named by its label (P0, P1...),
+ * and any gaps where the device's buffer overflowed are marked with a comment, and counted on stderr.
+ *
+ * BUILD: from this directory:
+ *
+ *     g++ -std=c++11 -O2 logic_vcd.cpp -o logic_vcd
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// These must match the stream format defined in source/samples/LogicAnalyzer.h.
+#define LOGIC_ANALYZER_MAGIC                    0x41474F4C
+#define LOGIC_ANALYZER_VERSION                  1
+#define LOGIC_ANALYZER_OVERFLOW                 0xFFFFFFFF
+#define LOGIC_ANALYZER_HEADER_SIZE              12
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * The VCD identifier for a pin: printable characters from '!', as VCD viewers expect.
+ */
+static std::string vcd_id(int pin)
+{
+    std::string id;
+
+    do
+    {
+        id += (char)('!' + pin % 94);
+        pin /= 94;
+    } while (pin);
+
+    return id;
+}
+
+static bool read_file(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *f = fopen(path, "rb");
+
+    if (f == NULL)
+        return false;
+
+    uint8_t block[4096];
+    size_t n;
+
+    while ((n = fread(block, 1, sizeof(block), f)) > 0)
+        data.insert(data.end(), block, block + n);
+
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *inPath = NULL;
+    const char *outPath = NULL;
+
+    bool usage = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            outPath = argv[++i];
+        else if (argv[i][0] == '-' || inPath)
+            usage = true;
+        else
+            inPath = argv[i];
+    }
+
+    if (usage || inPath == NULL)
+    {
+        fprintf(stderr, "USAGE: logic_vcd [-o capture.vcd] capture.bin\n");
+        return 2;
+    }
+
+    std::vector<uint8_t> data;
+
+    if (!read_file(inPath, data))
+    {
+        fprintf(stderr, "logic_vcd: can't read %s\n", inPath);
+        return 2;
+    }
+
+    // Find the header.
+    size_t p = 0;
+
+    while (p + LOGIC_ANALYZER_HEADER_SIZE <= data.size() && !(get32(&data[p]) == LOGIC_ANALYZER_MAGIC && data[p + 4] == LOGIC_ANALYZER_VERSION))
+        p++;
+
+    if (p + LOGIC_ANALYZER_HEADER_SIZE > data.size())
+    {
+        fprintf(stderr, "logic_vcd: no capture found in %s\n", inPath);
+        return 1;
+    }
+
+    int pins = data[p + 5];
+    uint32_t sampleRate = get32(&data[p + 8]);
+    p += LOGIC_ANALYZER_HEADER_SIZE;
+
+    if (pins == 0 || pins > 32 || sampleRate == 0 || p + pins > data.size())
+    {
+        fprintf(stderr, "logic_vcd: corrupt header in %s\n", inPath);
+        return 1;
+    }
+
+    std::vector<int> labels(data.begin() + p, data.begin() + p + pins);
+    p += pins;
+
+    FILE *out = outPath ? fopen(outPath, "w") : stdout;
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "logic_vcd: can't write %s\n", outPath);
+        return 2;
+    }
+
+    // Time is given in nanoseconds, so that any sample rate can be represented.
+    fprintf(out, "$comment micro:bit logic analyzer capture, %u Hz $end\n", sampleRate);
+    fprintf(out, "$timescale 1ns $end\n");
+    fprintf(out, "$scope module edge_connector $end\n");
+
+    for (int i = 0; i < pins; i++)
+        fprintf(out, "$var wire 1 %s P%d $end\n", vcd_id(i).c_str(), labels[i]);
+
+    fprintf(out, "$upscope $end\n");
+    fprintf(out, "$enddefinitions $end\n");
+
+    uint32_t last = 0;
+    uint64_t lastTick = 0;
+    uint64_t wraps = 0;
+    bool first = true;
+    uint32_t transitions = 0;
+    uint32_t gaps = 0;
+    uint64_t gapSamples = 0;
+
+    for (; p + 8 <= data.size(); p += 8)
+    {
+        uint32_t tick = get32(&data[p]);
+        uint32_t value = get32(&data[p + 4]);
+
+        if (tick == LOGIC_ANALYZER_OVERFLOW)
+        {
+            fprintf(out, "$comment overflow: %u samples not recorded $end\n", value);
+            gaps++;
+            gapSamples += value;
+            continue;
+        }
+
+        // Sample numbers are 32 bit, and wrap on long captures.
+        uint64_t t = wraps + tick;
+
+        if (!first && t < lastTick)
+        {
+            wraps += 1ULL << 32;
+            t += 1ULL << 32;
+        }
+
+        fprintf(out, "#%llu\n", (unsigned long long)(t * 1000000000ULL / sampleRate));
+
+        for (int i = 0; i < pins; i++)
+            if (first || ((value ^ last) >> i) & 1)
+                fprintf(out, "%d%s\n", (value >> i) & 1, vcd_id(i).c_str());
+
+        last = value;
+        lastTick = t;
+        first = false;
+        transitions++;
+    }
+
+    if (outPath)
+        fclose(out);
+
+    fprintf(stderr, "logic_vcd: %d pins at %u Hz, %u transitions over %.6f s\n", pins, sampleRate, transitions, (double)lastTick / sampleRate);
+
+    if (gaps)
+        fprintf(stderr, "logic_vcd: WARNING: %u overflows, %llu samples not recorded\n", gaps, (unsigned long long)gapSamples);
+
+    return 0;
+}
@@ -0,0 +1,365 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * Bit level simulation of SoftSerial (source/samples/SoftSerial.h), to check the decoder against imperfect lines and
+ * late interrupts, and the encoder against late interrupts, without a device.
+ *
+ *     USAGE: soft_serial_sim [-n bytes] [-s seed]
+ *
+ * SoftSerialDecoder and SoftSerialEncoder are compiled unchanged from source/samples. For each scenario, random bytes
+ * are turned into the edges a transmitter would make, at a baud rate that may be off from the receiver's, with jitter
+ * on every edge, idle gaps between frames, and glitches on the idle line. Scenarios with a stalled transmitter instead
+ * run the bytes through SoftSerialEncoder as the device does: a few transitions queued ahead on compares, topped up by
+ * an interrupt after each one that now and then runs so late that a frame has to be abandoned and sent again. The edges
+ * are then handed to the decoder the way the device does: an interrupt some random latency after the first pending edge
+ * (or after the stop bit deadline) sees only the last edge's timestamp and the number of edges, and resets the decoder
+ * when edges have come too close together. The 16MHz clock starts just short of wrapping, so that wrap is covered too.
+ *
+ * Each scenario is reported with the bytes received intact, the decoder's errors, and the frames the transmitter sent
+ * again. Every frame abandoned after the receiver has seen part of it must show up as one framing error, and nothing
+ * else. The exit status is 1 if any scenario that should be received intact was not.
+ *
+ * BUILD: from this directory:
+ *
+ *     g++ -std=c++11 -O2 -I../../../source/samples soft_serial_sim.cpp ../../../source/samples/SoftSerialDecoder.cpp \
+ *         ../../../source/samples/SoftSerialEncoder.cpp -o soft_serial_sim
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "SoftSerialDecoder.h"
+#include "SoftSerialEncoder.h"
+
+// These must match source/samples/SoftSerial.h.
+#define SOFT_SERIAL_CLOCK_HZ                    16000000
+#define SOFT_SERIAL_TX_COMPARES                 3
+#define SOFT_SERIAL_TX_MIN_LEAD                 32
+
+// One in this many transmitter interrupts is stalled.
+#define STALL_ODDS                              32
+
+#define DEFAULT_BYTES                           10000
+
+/**
+ * A line and receiver to simulate. Times are in bit periods of the receiver's baud rate.
+ */
+struct Scenario
+{
+    const char      *name;
+    int             baud;
+    double          baudError;          // The transmitter's baud rate error, as a fraction.
+    double          jitter;             // The most any edge is moved either way.
+    int             gap;                // The most idle bits between frames.
+    double          glitch;             // The width of a low glitch in each gap, or 0 for none.
+    double          latency;            // The most that an interrupt is delayed.
+    double          stall;              // The most that a stalled transmitter interrupt is delayed, or 0 for none.
+    bool            intact;             // Whether every byte should be received intact.
+};
+
+static const Scenario scenarios[] = {
+    {"clean 115200",                    115200,  0.000, 0.00, 2, 0.0, 0.1, 0.0, true},
+    {"clean 9600",                      9600,    0.000, 0.00, 2, 0.0, 0.1, 0.0, true},
+    {"clean 1000000, back to back",     1000000, 0.000, 0.00, 0, 0.0, 0.5, 0.0, true},
+    {"transmitter 3% fast",             115200,  0.030, 0.00, 0, 0.0, 0.5, 0.0, true},
+    {"transmitter 3% slow",             115200, -0.030, 0.00, 0, 0.0, 0.5, 0.0, true},
+    {"jitter 20%",                      115200,  0.000, 0.20, 1, 0.0, 0.5, 0.0, true},
+    {"2% slow, jitter 15%",             115200, -0.020, 0.15, 0, 0.0, 0.5, 0.0, true},
+    {"glitches on idle",                115200,  0.000, 0.00, 4, 0.2, 0.5, 0.0, true},
+    {"latency under a bit",             115200,  0.000, 0.00, 0, 0.0, 0.9, 0.0, true},
+    {"transmitter 7% slow",             115200, -0.070, 0.00, 0, 0.0, 0.5, 0.0, false},
+    {"latency up to 3 bits",            115200,  0.000, 0.00, 0, 0.0, 3.0, 0.0, false},
+    {"TX stalls up to 4 bits",          115200,  0.000, 0.00, 0, 0.0, 0.5, 4.0, true},
+    {"TX stalls up to 4 bits, 9600",    9600,    0.000, 0.00, 0, 0.0, 0.5, 4.0, true},
+    {"TX stalls up to 20 bits",         115200,  0.000, 0.00, 0, 0.0, 0.5, 20.0, false},
+};
+
+static uint64_t rngState;
+
+static uint32_t rng()
+{
+    // xorshift64*
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return (uint32_t)((rngState * 2685821657736338717ULL) >> 32);
+}
+
+// A uniform random number from -1 to 1.
+static double rngSigned()
+{
+    return rng() / 2147483648.0 - 1.0;
+}
+
+struct Result
+{
+    int     received;
+    int     intact;
+    int     framingErrors;
+    int     noise;
+    int     lostEdges;
+    int     resent;             // Frames the transmitter abandoned and sent again.
+    int     broken;             // Of those, the frames it held low through the stop bit.
+};
+
+/**
+ * Turns bytes into the times of the edges on the line, which idles high. Times are absolute ticks of the clock.
+ */
+static std::vector<uint64_t> transmit(const Scenario &s, const std::vector<uint8_t> &data, uint64_t start)
+{
+    std::vector<uint64_t> edges;
+    double bit = (double)SOFT_SERIAL_CLOCK_HZ / (s.baud * (1.0 + s.baudError));
+    double t = start + 2 * bit;
+    int level = 1;
+
+    for (uint8_t c : data)
+    {
+        int frame = (c << 1) | (1 << (SOFT_SERIAL_FRAME_BITS - 1));
+
+        for (int b = 0; b < SOFT_SERIAL_FRAME_BITS; b++)
+        {
+            int l = (frame >> b) & 1;
+
+            if (l != level)
+            {
+                edges.push_back((uint64_t)(t + b * bit + s.jitter * bit * rngSigned()));
+                level = l;
+            }
+        }
+
+        t += SOFT_SERIAL_FRAME_BITS * bit;
+
+        int gap = s.gap ? rng() % (s.gap + 1) : 0;
+
+        // A glitch sits in the middle of an idle gap of at least two bits, clear of both frames.
+        if (s.glitch > 0 && gap >= 2)
+        {
+            double g = t + (gap - s.glitch) * bit / 2;
+            edges.push_back((uint64_t)g);
+            edges.push_back((uint64_t)(g + s.glitch * bit));
+        }
+
+        t += gap * bit;
+    }
+
+    return edges;
+}
+
+/**
+ * Turns bytes into the times of the edges on the line, through a SoftSerialEncoder whose transitions are queued on
+ * SOFT_SERIAL_TX_COMPARES compares by an interrupt that is sometimes stalled, as on the device.
+ */
+static std::vector<uint64_t> transmitStalled(const Scenario &s, const std::vector<uint8_t> &data, uint64_t start, Result &r)
+{
+    SoftSerialEncoder encoder(SOFT_SERIAL_CLOCK_HZ, s.baud);
+    std::vector<uint64_t> edges;
+    uint64_t compare[SOFT_SERIAL_TX_COMPARES];
+    int first = 0;
+    int queued = 0;
+    size_t loaded = 0;
+    uint64_t bit = SOFT_SERIAL_CLOCK_HZ / s.baud;
+    uint64_t now = start;
+
+    encoder.reset((uint32_t)now);
+
+    while (1)
+    {
+        // As SoftSerial::fillTransmitter().
+        while (queued < SOFT_SERIAL_TX_COMPARES)
+        {
+            uint32_t earliest = (uint32_t)(now + SOFT_SERIAL_TX_MIN_LEAD * 2);
+            uint32_t time;
+            int level;
+            bool more;
+
+            while (!(more = encoder.next(earliest, time, level)) && loaded < data.size())
+                encoder.load(data[loaded++]);
+
+            if (!more)
+                break;
+
+            int32_t ahead = (int32_t)(time - (uint32_t)now);
+
+            if (ahead < SOFT_SERIAL_TX_MIN_LEAD)
+            {
+                r.resent++;
+
+                if (encoder.abort(earliest) == SOFT_SERIAL_TX_BROKEN)
+                    r.broken++;
+
+                continue;
+            }
+
+            compare[(first + queued) % SOFT_SERIAL_TX_COMPARES] = now + ahead;
+            queued++;
+        }
+
+        if (!queued)
+            break;
+
+        // The interrupt follows the oldest compare, by which time any others that are due have been made too.
+        uint64_t latency = bit / 8;
+
+        if (rng() % STALL_ODDS == 0)
+            latency = (uint64_t)(s.stall * bit * (rng() / 4294967296.0));
+
+        now = compare[first] + (latency ? rng() % latency : 0);
+
+        while (queued && compare[first] <= now)
+        {
+            edges.push_back(compare[first]);
+            first = (first + 1) % SOFT_SERIAL_TX_COMPARES;
+            queued--;
+        }
+    }
+
+    return edges;
+}
+
+/**
+ * Hands the edges to a decoder as the device's interrupt handler would, and checks what comes out.
+ */
+static void receive(const Scenario &s, const std::vector<uint64_t> &edges, const std::vector<uint8_t> &data, Result &r)
+{
+    SoftSerialDecoder decoder(SOFT_SERIAL_CLOCK_HZ, s.baud);
+    size_t next = 0;
+    uint64_t latency = (uint64_t)(s.latency * SOFT_SERIAL_CLOCK_HZ / s.baud);
+
+    while (next < edges.size() || decoder.isReceiving())
+    {
+        uint64_t trigger = next < edges.size() ? edges[next] : UINT64_MAX;
+
+        if (decoder.isReceiving())
+        {
+            // The deadline is a 32 bit time, so find it relative to the edge that started the frame.
+            uint64_t last = edges[next - 1];
+            uint64_t deadline = last + (int32_t)(decoder.getDeadline() - (uint32_t)last);
+
+            if (deadline < trigger)
+                trigger = deadline;
+        }
+
+        uint64_t service = trigger + (latency ? rng() % latency : 0);
+        size_t pending = next;
+
+        while (pending < edges.size() && edges[pending] <= service)
+            pending++;
+
+        int results[3];
+        int count = 0;
+
+        if (pending > next)
+        {
+            results[count++] = decoder.edge((uint32_t)edges[pending - 1]);
+
+            if (pending - next > 1)
+            {
+                r.lostEdges += pending - next - 1;
+                decoder.reset(1 ^ (pending & 1));
+            }
+
+            next = pending;
+        }
+
+        results[count++] = decoder.advance((uint32_t)service);
+
+        for (int i = 0; i < count; i++)
+        {
+            if (results[i] >= 0)
+            {
+                if (r.received < (int)data.size() && results[i] == data[r.received])
+                    r.intact++;
+
+                r.received++;
+            }
+            else if (results[i] == SOFT_SERIAL_RX_FRAMING_ERROR)
+            {
+                r.framingErrors++;
+            }
+            else if (results[i] == SOFT_SERIAL_RX_NOISE)
+            {
+                r.noise++;
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int bytes = DEFAULT_BYTES;
+    uint64_t seed = 1;
+    bool usage = false;
+    int failed = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            bytes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 0);
+        else
+            usage = true;
+    }
+
+    if (usage || bytes <= 0 || seed == 0)
+    {
+        fprintf(stderr, "USAGE: soft_serial_sim [-n bytes] [-s seed]\n");
+        return 2;
+    }
+
+    printf("%-32s %10s %10s %10s %10s %10s %10s  %s\n", "SCENARIO", "RECEIVED", "INTACT", "FRAMING", "NOISE", "LOST", "RESENT", "RESULT");
+
+    for (const Scenario &s : scenarios)
+    {
+        rngState = seed;
+
+        std::vector<uint8_t> data(bytes);
+        for (uint8_t &c : data)
+            c = rng() & 0xFF;
+
+        Result r;
+        memset(&r, 0, sizeof(r));
+
+        std::vector<uint64_t> edges = s.stall > 0 ? transmitStalled(s, data, 0xFFF00000ULL, r) : transmit(s, data, 0xFFF00000ULL);
+        receive(s, edges, data, r);
+
+        bool intact = r.received == bytes && r.intact == bytes && r.framingErrors == r.broken;
+        const char *result = intact ? "intact" : "damaged";
+
+        if (s.intact && !intact)
+        {
+            result = "FAILED";
+            failed++;
+        }
+
+        printf("%-32s %10d %10d %10d %10d %10d %10d  %s\n", s.name, r.received, r.intact, r.framingErrors, r.noise, r.lostEdges, r.resent, result);
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,490 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2023 Lancaster University.
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+/**
+ * Replays traces of capacitive touch samples through TouchClassifier (source/samples/TouchClassifier.h), to tune and
+ * check it without a device.
+ *
+ *     USAGE: touch_replay [-t threshold] [-c ceiling] [-s smoothing] [-d drift] [-r rate] [-v] [trace.csv ...]
+ *
+ * TouchClassifier is compiled unchanged from source/samples, with the same settings as the device unless they are
+ * given. Each trace file holds one scan per line, with the sample of each channel separated by commas or spaces, as
+ * printed by touch_trace_test() on the device. The touch and release events of every channel are listed, with the
+ * time of each at the given scan rate. Lines starting with '#' are comments, apart from these:
+ *
+ *     # N scans missed             as printed by touch_trace_test(), so later events keep their times
+ *     # rate N                     the scan rate of the trace, unless -r is given
+ *     # expect C TOUCH RELEASE     a touch on channel C from TOUCH to RELEASE seconds
+ *     # expect none                no touches at all
+ *
+ * A trace with expectations is checked as the made up scenarios are, and the exit status is 1 if any check fails. The
+ * expectations are added by hand after recording, from notes of when each pad was touched. Traces are kept in the
+ * traces directory, and checked with:
+ *
+ *     touch_replay traces/standin_idle.csv traces/standin_taps.csv
+ *
+ * Until traces recorded from a device are added, those there are stand-ins: generated in the same format, with hum,
+ * drift, impulses and a gap in the serial output, and marked as such in their first line.
+ *
+ * With no trace files, traces are made up for a set of scenarios instead: three channels scanned at 1kHz for 20
+ * seconds, with touches at known times on each, and noise, drift, impulses and pins that don't rise in the timeout
+ * added. Every touch must be reported within 50ms of starting and released within 50ms of ending, with no other
+ * events, or no events at all where the touches are too weak to be told from noise. The exit status is 1 if any
+ * scenario fails.
+ *
+ * BUILD: from this directory:
+ *
+ *     g++ -std=c++11 -O2 -I../../../source/samples touch_replay.cpp ../../../source/samples/TouchClassifier.cpp \
+ *         -o touch_replay
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+
+#include "TouchClassifier.h"
+
+// These match touch_classifier_test() in source/samples/CapTouchTest.cpp: 1kHz scans with an 800us timeout, in 16MHz
+// ticks.
+#define DEFAULT_RATE                            1000
+#define DEFAULT_CEILING                         12800
+
+#define SCENARIO_CHANNELS                       3
+#define SCENARIO_SECONDS                        20
+
+// How late a touch or release event may be, in scenarios and in traces with expectations.
+#define CHECK_LATENCY_MS                        50
+
+/**
+ * A made up trace. Times are in milliseconds, and samples in ticks.
+ */
+struct Scenario
+{
+    const char      *name;
+    int             baseline;           // The untouched sample.
+    int             delta;              // The increase in the sample while touched.
+    double          noise;              // The standard deviation of the noise on every sample.
+    double          drift;              // The change in the untouched sample over the trace, as a fraction.
+    double          impulses;           // The chance of a single sample spike.
+    int             touchMs;
+    int             gapMs;
+    bool            detectable;         // Whether the touches should be reported.
+};
+
+static const Scenario scenarios[] = {
+    {"clean touches",                   3000, 2500,   20, 0.00, 0.000,  300, 1200, true},
+    {"short taps",                      3000, 2500,   20, 0.00, 0.000,   60,  500, true},
+    {"noise 150 ticks",                 3000, 2500,  150, 0.00, 0.000,  300, 1200, true},
+    {"weak touches",                    3000,  800,   40, 0.00, 0.000,  300, 1200, true},
+    {"baseline drifts up 30%",          3000, 2500,   40, 0.30, 0.000,  300, 1200, true},
+    {"baseline drifts down 30%",        3000, 2500,   40, -0.30, 0.000, 300, 1200, true},
+    {"long touches",                    3000, 2500,   40, 0.00, 0.000, 5000, 1500, true},
+    {"touches past the timeout",        3000, 20000,  40, 0.00, 0.000,  300, 1200, true},
+    {"impulses of 2000 ticks",          3000, 2500,   40, 0.00, 0.010,  300, 1200, true},
+    {"changes under the threshold",     3000,  300,   40, 0.00, 0.000,  300, 1200, false},
+};
+
+static uint64_t rngState = 1;
+
+static uint32_t rng()
+{
+    // xorshift64*
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return (uint32_t)((rngState * 2685821657736338717ULL) >> 32);
+}
+
+// Roughly normal, with a standard deviation of 1.
+static double rngNormal()
+{
+    double x = 0;
+
+    for (int i = 0; i < 12; i++)
+        x += rng() / 4294967296.0;
+
+    return x - 6.0;
+}
+
+struct TouchEvent
+{
+    int     scan;
+    int     channel;
+    int     type;
+};
+
+/**
+ * A trace read from a file.
+ */
+struct Trace
+{
+    std::vector<std::vector<uint32_t>>              scans;      // Empty where scans were missed.
+    int                                             channels;
+    int                                             rate;       // The rate given by the trace, or 0 if none.
+    bool                                            expected;   // Whether the trace has expectations.
+    std::vector<std::vector<std::pair<int, int>>>   touches;    // The touches expected on each channel, in scans.
+};
+
+struct Settings
+{
+    uint32_t    threshold;
+    uint32_t    ceiling;
+    int         smoothing;
+    int         drift;
+    int         rate;
+    bool        verbose;
+};
+
+/**
+ * Runs a trace through a classifier, one scan at a time, as the device's interrupt handler would.
+ */
+static std::vector<TouchEvent> classify(const Settings &settings, const std::vector<std::vector<uint32_t>> &trace, int channels)
+{
+    TouchClassifier classifier(channels, settings.threshold, settings.ceiling);
+    std::vector<TouchEvent> events;
+
+    classifier.setFilter(settings.smoothing, settings.drift);
+
+    for (size_t scan = 0; scan < trace.size(); scan++)
+    {
+        for (int c = 0; c < channels && c < (int)trace[scan].size(); c++)
+        {
+            int result = classifier.update(c, trace[scan][c]);
+
+            if (result == TOUCH_CLASSIFIER_NONE)
+                continue;
+
+            TouchEvent e = {(int)scan, c, result};
+            events.push_back(e);
+
+            if (settings.verbose)
+                printf("  %8.3fs  CH%d %-7s [LEVEL: %u] [BASELINE: %u] [TOUCHED: %u]\n", (double)scan / settings.rate, c,
+                       result == TOUCH_CLASSIFIER_TOUCH ? "TOUCH" : "RELEASE", classifier.getLevel(c), classifier.getBaseline(c),
+                       classifier.getTouchLevel(c));
+        }
+    }
+
+    return events;
+}
+
+/**
+ * Makes up a trace for a scenario, with the touches on each channel.
+ */
+static std::vector<std::vector<uint32_t>> generate(const Scenario &s, const Settings &settings, std::vector<std::vector<std::pair<int, int>>> &touches)
+{
+    int scans = SCENARIO_SECONDS * settings.rate;
+    int cycle = s.touchMs + s.gapMs;
+    std::vector<std::vector<uint32_t>> trace(scans, std::vector<uint32_t>(SCENARIO_CHANNELS));
+
+    touches.assign(SCENARIO_CHANNELS, std::vector<std::pair<int, int>>());
+
+    // Start after a second, clear of calibration, and stagger the channels.
+    for (int c = 0; c < SCENARIO_CHANNELS; c++)
+        for (int t = 1000 + c * cycle / SCENARIO_CHANNELS; t + cycle < SCENARIO_SECONDS * 1000; t += cycle)
+            touches[c].push_back(std::make_pair(t * settings.rate / 1000, (t + s.touchMs) * settings.rate / 1000));
+
+    for (int c = 0; c < SCENARIO_CHANNELS; c++)
+    {
+        size_t next = 0;
+
+        for (int scan = 0; scan < scans; scan++)
+        {
+            double value = s.baseline * (1.0 + s.drift * scan / scans) + s.noise * rngNormal();
+
+            while (next < touches[c].size() && touches[c][next].second <= scan)
+                next++;
+
+            // A finger takes a few milliseconds to come down and lift off.
+            if (next < touches[c].size() && scan >= touches[c][next].first)
+            {
+                int in = scan - touches[c][next].first;
+                int out = touches[c][next].second - scan;
+                int ramp = 5 * settings.rate / 1000;
+                int edge = in < out ? in : out;
+
+                value += edge < ramp ? s.delta * (edge + 1.0) / (ramp + 1) : s.delta;
+            }
+
+            if (s.impulses > 0 && rng() < s.impulses * 4294967296.0)
+                value += 2000;
+
+            trace[scan][c] = value < 0 ? 0 : value > settings.ceiling ? settings.ceiling : (uint32_t)value;
+        }
+    }
+
+    return trace;
+}
+
+/**
+ * Checks the events from a trace against the touches made.
+ * @param name the name of the scenario or trace.
+ * @param detectable whether the touches should be reported, or there should be no events at all.
+ * @return true if the check passed.
+ */
+static bool check(const char *name, bool detectable, const Settings &settings, const std::vector<std::vector<std::pair<int, int>>> &touches, const std::vector<TouchEvent> &events)
+{
+    int latency = CHECK_LATENCY_MS * settings.rate / 1000;
+    int expected = 0, detected = 0, released = 0, spurious = 0;
+    int touchLatency = 0, releaseLatency = 0;
+
+    for (int c = 0; c < (int)touches.size(); c++)
+    {
+        std::vector<bool> used(events.size(), false);
+
+        for (const std::pair<int, int> &t : touches[c])
+        {
+            bool down = false, up = false;
+
+            expected++;
+
+            // Each touch takes its first touch and release events in time. Anything else is spurious.
+            for (size_t i = 0; i < events.size(); i++)
+            {
+                const TouchEvent &e = events[i];
+
+                if (used[i] || e.channel != c)
+                    continue;
+
+                if (!down && e.type == TOUCH_CLASSIFIER_TOUCH && e.scan >= t.first && e.scan <= t.first + latency)
+                {
+                    used[i] = true;
+                    down = true;
+                    detected++;
+                    if (e.scan - t.first > touchLatency)
+                        touchLatency = e.scan - t.first;
+                }
+                else if (!up && e.type == TOUCH_CLASSIFIER_RELEASE && e.scan >= t.second && e.scan <= t.second + latency)
+                {
+                    used[i] = true;
+                    up = true;
+                    released++;
+                    if (e.scan - t.second > releaseLatency)
+                        releaseLatency = e.scan - t.second;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < events.size(); i++)
+            if (!used[i] && events[i].channel == c)
+                spurious++;
+    }
+
+    bool passed = detectable ? (detected == expected && released == expected && spurious == 0) : events.empty();
+
+    printf("%-32s %-4s [TOUCHES: %3d] [DETECTED: %3d] [RELEASED: %3d] [SPURIOUS: %3d] [LATENCY: %2d ms, %2d ms]\n", name,
+           passed ? "ok" : "FAIL", expected, detected, released, spurious, touchLatency * 1000 / settings.rate,
+           releaseLatency * 1000 / settings.rate);
+
+    return passed;
+}
+
+/**
+ * Reads a trace recorded from the device, with any expectations added to it.
+ * @return the number of channels, or 0 if the file couldn't be read.
+ */
+static int load(const char *filename, Trace &trace)
+{
+    FILE *f = fopen(filename, "r");
+    char line[256];
+    std::vector<std::pair<int, double>> expect;
+    std::vector<double> expectEnd;
+
+    trace.channels = 0;
+    trace.rate = 0;
+    trace.expected = false;
+
+    if (f == NULL)
+        return 0;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        int n, c;
+        double from, to;
+
+        if (line[0] == '#')
+        {
+            if (sscanf(line, "# %d scans missed", &n) == 1 && n > 0)
+                trace.scans.resize(trace.scans.size() + n);
+            else if (sscanf(line, "# rate %d", &n) == 1)
+                trace.rate = n;
+            else if (strncmp(line, "# expect none", 13) == 0)
+                trace.expected = true;
+            else if (sscanf(line, "# expect %d %lf %lf", &c, &from, &to) == 3 && c >= 0)
+            {
+                trace.expected = true;
+                expect.push_back(std::make_pair(c, from));
+                expectEnd.push_back(to);
+            }
+
+            continue;
+        }
+
+        if (!isdigit((unsigned char)line[0]))
+            continue;
+
+        std::vector<uint32_t> scan;
+        char *p = line;
+
+        while (*p)
+        {
+            char *end;
+            unsigned long v = strtoul(p, &end, 10);
+
+            if (end == p)
+            {
+                p++;
+                continue;
+            }
+
+            scan.push_back((uint32_t)v);
+            p = end;
+        }
+
+        if (trace.channels == 0)
+            trace.channels = scan.size();
+
+        trace.scans.push_back(scan);
+    }
+
+    fclose(f);
+
+    // Expectations are kept in seconds until the rate is known.
+    trace.touches.assign(trace.channels, std::vector<std::pair<int, int>>());
+
+    for (size_t i = 0; i < expect.size(); i++)
+        if (expect[i].first < trace.channels)
+            trace.touches[expect[i].first].push_back(std::make_pair((int)(expect[i].second * 1000), (int)(expectEnd[i] * 1000)));
+
+    return trace.channels;
+}
+
+int main(int argc, char **argv)
+{
+    Settings settings = {TOUCH_CLASSIFIER_DEFAULT_THRESHOLD, DEFAULT_CEILING, TOUCH_CLASSIFIER_DEFAULT_SMOOTHING,
+                         TOUCH_CLASSIFIER_DEFAULT_DRIFT, DEFAULT_RATE, false};
+    std::vector<const char *> files;
+    bool usage = false;
+    bool rateGiven = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-v") == 0)
+            settings.verbose = true;
+        else if (argv[i][0] != '-')
+            files.push_back(argv[i]);
+        else if (i + 1 >= argc)
+            usage = true;
+        else if (strcmp(argv[i], "-t") == 0)
+            settings.threshold = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0)
+            settings.ceiling = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0)
+            settings.smoothing = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-d") == 0)
+            settings.drift = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            settings.rate = atoi(argv[++i]);
+            rateGiven = true;
+        }
+        else
+            usage = true;
+    }
+
+    if (usage || settings.rate <= 0)
+    {
+        fprintf(stderr, "USAGE: touch_replay [-t threshold] [-c ceiling] [-s smoothing] [-d drift] [-r rate] [-v] [trace.csv ...]\n");
+        return 2;
+    }
+
+    int failed = 0;
+
+    if (!files.empty())
+    {
+        for (const char *filename : files)
+        {
+            Trace trace;
+            Settings traceSettings = settings;
+            int channels = load(filename, trace);
+
+            if (channels == 0)
+            {
+                fprintf(stderr, "%s: no samples\n", filename);
+                return 2;
+            }
+
+            if (trace.rate > 0 && !rateGiven)
+                traceSettings.rate = trace.rate;
+
+            // Only list every event when there's nothing to check them against, unless asked to.
+            if (!trace.expected)
+                traceSettings.verbose = true;
+
+            printf("%s: [SCANS: %d] [CHANNELS: %d] [RATE: %d]\n", filename, (int)trace.scans.size(), channels, traceSettings.rate);
+
+            std::vector<TouchEvent> events = classify(traceSettings, trace.scans, channels);
+            std::vector<int> count(channels, 0);
+
+            for (const TouchEvent &e : events)
+                if (e.type == TOUCH_CLASSIFIER_TOUCH)
+                    count[e.channel]++;
+
+            for (int c = 0; c < channels; c++)
+                printf("  CH%d: [TOUCHES: %d]\n", c, count[c]);
+
+            if (trace.expected)
+            {
+                for (std::vector<std::pair<int, int>> &touches : trace.touches)
+                    for (std::pair<int, int> &t : touches)
+                        t = std::make_pair(t.first * traceSettings.rate / 1000, t.second * traceSettings.rate / 1000);
+
+                bool touched = false;
+
+                for (const std::vector<std::pair<int, int>> &touches : trace.touches)
+                    touched |= !touches.empty();
+
+                if (!check(filename, touched, traceSettings, trace.touches, events))
+                    failed++;
+            }
+        }
+
+        return failed ? 1 : 0;
+    }
+
+    for (const Scenario &s : scenarios)
+    {
+        std::vector<std::vector<std::pair<int, int>>> touches;
+        std::vector<std::vector<uint32_t>> trace = generate(s, settings, touches);
+
+        if (!check(s.name, s.detectable, settings, touches, classify(settings, trace, SCENARIO_CHANNELS)))
+            failed++;
+    }
+
+    return failed ? 1 : 0;
+}